@@ -0,0 +1,318 @@
+//
+// Measures the per-call cost of the console APIs the agent depends on and
+// prints one table, headed by the Windows build, so runs on several builds
+// can be compared side by side when tuning the scraper's defaults.  It
+// covers what VeryLargeRead.cc and FreezePerfTest.cc probe one at a time:
+//
+//  - ReadConsoleOutputW, from a single line up to a large history read
+//  - WriteConsoleOutputW of one line (as for a sync marker)
+//  - GetConsoleScreenBufferInfo, GetConsoleCursorInfo, GetConsoleTitleW,
+//    GetConsoleMode, and GetNumberOfConsoleInputEvents
+//  - WriteConsoleInputW, in batches of 1 to 256 records
+//  - freezing the console (SC_CONSOLE_MARK), unfreezing it synchronously
+//    and asynchronously (as with WINPTY_FLAG_ASYNC_UNFREEZE), and a whole
+//    freeze/read/unfreeze scrape of the window
+//
+// Usage: ConsoleApiCost [-iterations N]
+//
+// Each row gives the mean, median, 99th percentile, and maximum time of one
+// call, in microseconds.  A failed call ends its row early and prints
+// "failed"; before Windows 8, reads past roughly 13-17 thousand cells fail
+// this way (see VeryLargeRead.cc).  Reads of more than 10000 cells run a
+// tenth as many times.  The console window is hidden while the console is
+// frozen, as in FreezePerfTest.cc.  The program leaves the console's buffer
+// resized and filled with its test text.
+//
+
+#include <windows.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <functional>
+
+#include "TestUtil.cc"
+
+const int SC_CONSOLE_MARK = 0xFFF2;
+
+const int kBufferWidth = 240;
+const int kBufferHeight = 3000;
+const int kWindowWidth = 80;
+const int kWindowHeight = 25;
+
+static int64_t qpcValue() {
+    LARGE_INTEGER ret;
+    QueryPerformanceCounter(&ret);
+    return ret.QuadPart;
+}
+
+static double qpcUs(int64_t ticks) {
+    static const int64_t freq = []() {
+        LARGE_INTEGER ret;
+        QueryPerformanceFrequency(&ret);
+        return ret.QuadPart;
+    }();
+    return static_cast<double>(ticks) * 1000000.0 /
+        static_cast<double>(freq);
+}
+
+typedef LONG WINAPI RtlGetVersion_t(OSVERSIONINFOW *info);
+
+// GetVersionEx reports Windows 8 to an unmanifested program on any later
+// release, so ask ntdll.  The update revision (UBR) is only in the registry.
+static void printWindowsVersion() {
+    OSVERSIONINFOW info = {};
+    info.dwOSVersionInfoSize = sizeof(info);
+    const auto pRtlGetVersion = reinterpret_cast<RtlGetVersion_t*>(
+        GetProcAddress(GetModuleHandleW(L"ntdll.dll"), "RtlGetVersion"));
+    if (pRtlGetVersion == NULL || pRtlGetVersion(&info) != 0) {
+        GetVersionExW(&info);
+    }
+    DWORD ubr = 0;
+    HKEY key = NULL;
+    if (RegOpenKeyExW(HKEY_LOCAL_MACHINE,
+                      L"SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion",
+                      0, KEY_QUERY_VALUE, &key) == ERROR_SUCCESS) {
+        DWORD size = sizeof(ubr);
+        if (RegQueryValueExW(key, L"UBR", NULL, NULL,
+                             reinterpret_cast<BYTE*>(&ubr),
+                             &size) != ERROR_SUCCESS) {
+            ubr = 0;
+        }
+        RegCloseKey(key);
+    }
+    printf("Windows %u.%u.%u.%u, %d-bit process\n",
+           static_cast<unsigned int>(info.dwMajorVersion),
+           static_cast<unsigned int>(info.dwMinorVersion),
+           static_cast<unsigned int>(info.dwBuildNumber),
+           static_cast<unsigned int>(ubr),
+           static_cast<int>(sizeof(void*) * 8));
+}
+
+static double percentile(const std::vector<double> &sorted, int pct) {
+    return sorted[(sorted.size() - 1) * pct / 100];
+}
+
+// Times `call` `iterations` times and prints a row.  `before` and `after`,
+// if given, run untimed around each call.
+static void measure(const char *api, const std::string &detail,
+                    int iterations,
+                    const std::function<bool()> &call,
+                    const std::function<void()> &before = nullptr,
+                    const std::function<void()> &after = nullptr) {
+    std::vector<double> samples;
+    samples.reserve(iterations);
+    DWORD error = 0;
+    for (int i = 0; i < iterations; ++i) {
+        if (before) {
+            before();
+        }
+        const int64_t start = qpcValue();
+        const bool success = call();
+        const int64_t end = qpcValue();
+        if (!success) {
+            error = GetLastError();
+        }
+        if (after) {
+            after();
+        }
+        if (!success) {
+            break;
+        }
+        samples.push_back(qpcUs(end - start));
+    }
+    printf("%-30s %-10s %7d", api, detail.c_str(),
+           static_cast<int>(samples.size()));
+    if (samples.size() < static_cast<size_t>(iterations)) {
+        printf("  failed (error %u)\n", static_cast<unsigned int>(error));
+        return;
+    }
+    double total = 0.0;
+    for (double sample : samples) {
+        total += sample;
+    }
+    std::sort(samples.begin(), samples.end());
+    printf(" %10.2f %10.2f %10.2f %10.2f\n",
+           total / samples.size(),
+           percentile(samples, 50),
+           percentile(samples, 99),
+           samples.back());
+}
+
+static std::string sizeString(int cols, int rows) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%dx%d", cols, rows);
+    return buf;
+}
+
+int main(int argc, char *argv[]) {
+    int iterations = 1000;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-iterations") && i + 1 < argc) {
+            iterations = std::max(1, atoi(argv[++i]));
+        } else {
+            printf("Usage: %s [-iterations N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const HANDLE conout = openConout();
+    const HANDLE conin = CreateFileW(L"CONIN$",
+                                     GENERIC_READ | GENERIC_WRITE,
+                                     FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                     NULL, OPEN_EXISTING, 0, NULL);
+    ASSERT(conin != INVALID_HANDLE_VALUE);
+    const HWND hwnd = GetConsoleWindow();
+    ASSERT(hwnd != NULL);
+
+    // A full buffer, with the window at the bottom, as in a long session.
+    setWindowPos(conout, 0, 0, 1, 1);
+    setBufferSize(conout, kBufferWidth, kBufferHeight);
+    setWindowPos(conout, 0, kBufferHeight - kWindowHeight,
+                 kWindowWidth, kWindowHeight);
+    setCursorPos(conout, 0, kBufferHeight - 1);
+    for (int y = 0; y < kBufferHeight; ++y) {
+        DWORD actual = 0;
+        FillConsoleOutputCharacterW(
+            conout, static_cast<WCHAR>(L'!' + y % 90), kBufferWidth,
+            { 0, static_cast<SHORT>(y) }, &actual);
+        FillConsoleOutputAttribute(
+            conout, static_cast<WORD>(1 + y % 15), kBufferWidth,
+            { 0, static_cast<SHORT>(y) }, &actual);
+    }
+    SetConsoleTitleW(L"ConsoleApiCost");
+
+    printWindowsVersion();
+    printf("%-30s %-10s %7s %10s %10s %10s %10s\n",
+           "api", "size", "calls", "mean-us", "p50-us", "p99-us", "max-us");
+
+    const int kReadSizes[][2] = {
+        { 80, 1 }, { 80, 25 }, { 120, 50 }, { 240, 50 }, { 240, 100 },
+        { 240, 1000 }, { 240, 3000 },
+    };
+    std::vector<CHAR_INFO> cells(kBufferWidth * kBufferHeight);
+    for (const auto &size : kReadSizes) {
+        const int cols = size[0];
+        const int rows = size[1];
+        const int top = kBufferHeight - rows;
+        measure("ReadConsoleOutputW", sizeString(cols, rows),
+                cols * rows > 10000 ? std::max(1, iterations / 10)
+                                    : iterations,
+                [&]() {
+                    SMALL_RECT rect = {
+                        0, static_cast<SHORT>(top),
+                        static_cast<SHORT>(cols - 1),
+                        static_cast<SHORT>(kBufferHeight - 1)
+                    };
+                    return ReadConsoleOutputW(
+                        conout, cells.data(),
+                        { static_cast<SHORT>(cols), static_cast<SHORT>(rows) },
+                        { 0, 0 }, &rect) != FALSE;
+                });
+    }
+
+    measure("WriteConsoleOutputW", sizeString(kWindowWidth, 1), iterations,
+            [&]() {
+                SMALL_RECT rect = {
+                    0, 0, static_cast<SHORT>(kWindowWidth - 1), 0
+                };
+                return WriteConsoleOutputW(
+                    conout, cells.data(),
+                    { static_cast<SHORT>(kWindowWidth), 1 },
+                    { 0, 0 }, &rect) != FALSE;
+            });
+
+    measure("GetConsoleScreenBufferInfo", "", iterations, [&]() {
+        CONSOLE_SCREEN_BUFFER_INFO info = {};
+        return GetConsoleScreenBufferInfo(conout, &info) != FALSE;
+    });
+    measure("GetConsoleCursorInfo", "", iterations, [&]() {
+        CONSOLE_CURSOR_INFO info = {};
+        return GetConsoleCursorInfo(conout, &info) != FALSE;
+    });
+    measure("GetConsoleTitleW", "", iterations, [&]() {
+        wchar_t title[1024];
+        return GetConsoleTitleW(title, 1024) != 0;
+    });
+    measure("GetConsoleMode", "conin", iterations, [&]() {
+        DWORD mode = 0;
+        return GetConsoleMode(conin, &mode) != FALSE;
+    });
+    measure("GetNumberOfConsoleInputEvents", "", iterations, [&]() {
+        DWORD count = 0;
+        return GetNumberOfConsoleInputEvents(conin, &count) != FALSE;
+    });
+
+    // Key presses of 'a', as the agent writes typed input.  The input buffer
+    // is flushed after each call, untimed.
+    const int kBatchSizes[] = { 1, 16, 64, 256 };
+    std::vector<INPUT_RECORD> records(256);
+    for (INPUT_RECORD &record : records) {
+        record.EventType = KEY_EVENT;
+        record.Event.KeyEvent.bKeyDown = TRUE;
+        record.Event.KeyEvent.wRepeatCount = 1;
+        record.Event.KeyEvent.wVirtualKeyCode = 'A';
+        record.Event.KeyEvent.wVirtualScanCode =
+            static_cast<WORD>(MapVirtualKeyW('A', MAPVK_VK_TO_VSC));
+        record.Event.KeyEvent.uChar.UnicodeChar = L'a';
+        record.Event.KeyEvent.dwControlKeyState = 0;
+    }
+    for (int batch : kBatchSizes) {
+        char detail[32];
+        snprintf(detail, sizeof(detail), "%d recs", batch);
+        measure("WriteConsoleInputW", detail, iterations,
+                [&]() {
+                    DWORD actual = 0;
+                    return WriteConsoleInputW(conin, records.data(), batch,
+                                              &actual) != FALSE &&
+                        actual == static_cast<DWORD>(batch);
+                },
+                nullptr,
+                [&]() { FlushConsoleInputBuffer(conin); });
+    }
+
+    // The agent freezes the console by starting a selection and unfreezes it
+    // with an Escape keypress.  An asynchronous unfreeze returns at once;
+    // the untimed WM_NULL waits for the console to process it.
+    const auto freeze = [&]() {
+        SendMessageW(hwnd, WM_SYSCOMMAND, SC_CONSOLE_MARK, 0);
+    };
+    const auto unfreeze = [&]() {
+        SendMessageW(hwnd, WM_CHAR, 27, 0x00010001);
+    };
+    ShowWindow(hwnd, SW_HIDE);
+    measure("freeze", "", iterations,
+            [&]() { freeze(); return true; }, nullptr, unfreeze);
+    measure("unfreeze", "sync", iterations,
+            [&]() { unfreeze(); return true; }, freeze);
+    measure("unfreeze", "async", iterations,
+            [&]() {
+                return SendMessageCallbackW(hwnd, WM_CHAR, 27, 0x00010001,
+                                            NULL, 0) != FALSE;
+            },
+            freeze,
+            [&]() { SendMessageW(hwnd, WM_NULL, 0, 0); });
+    measure("freeze+read+unfreeze", sizeString(kWindowWidth, kWindowHeight),
+            iterations,
+            [&]() {
+                SMALL_RECT rect = {
+                    0, static_cast<SHORT>(kBufferHeight - kWindowHeight),
+                    static_cast<SHORT>(kWindowWidth - 1),
+                    static_cast<SHORT>(kBufferHeight - 1)
+                };
+                freeze();
+                const BOOL success = ReadConsoleOutputW(
+                    conout, cells.data(),
+                    { static_cast<SHORT>(kWindowWidth),
+                      static_cast<SHORT>(kWindowHeight) },
+                    { 0, 0 }, &rect);
+                unfreeze();
+                return success != FALSE;
+            });
+    ShowWindow(hwnd, SW_SHOW);
+
+    CloseHandle(conin);
+    CloseHandle(conout);
+    return 0;
+}
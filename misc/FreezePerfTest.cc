@@ -8,17 +8,25 @@ const int SC_CONSOLE_SELECT_ALL = 0xFFF5;
 int main(int argc, char *argv[0]) {
 
     if (argc != 2) {
-        printf("Usage: %s (mark|selectall|read)\n", argv[0]);
+        printf("Usage: %s (mark|selectall|read|markread|markread-async)\n",
+               argv[0]);
         return 1;
     }
 
-    enum class Test { Mark, SelectAll, Read } test;
+    // markread and markread-async freeze, read the window, and unfreeze, as
+    // the agent's scrape does.  The -async variant unfreezes the way the
+    // agent does with WINPTY_FLAG_ASYNC_UNFREEZE.
+    enum class Test { Mark, SelectAll, Read, MarkRead, MarkReadAsync } test;
     if (!strcmp(argv[1], "mark")) {
         test = Test::Mark;
     } else if (!strcmp(argv[1], "selectall")) {
         test = Test::SelectAll;
     } else if (!strcmp(argv[1], "read")) {
         test = Test::Read;
+    } else if (!strcmp(argv[1], "markread")) {
+        test = Test::MarkRead;
+    } else if (!strcmp(argv[1], "markread-async")) {
+        test = Test::MarkReadAsync;
     } else {
         printf("Invalid test: %s\n", argv[1]);
         return 1;
@@ -52,6 +60,18 @@ int main(int argc, char *argv[0]) {
             SMALL_RECT tmp = readRegion;
             BOOL ret = ReadConsoleOutput(conout, buffer, {100, 3000}, {0, 0}, &tmp);
             ASSERT(ret && !memcmp(&tmp, &readRegion, sizeof(tmp)));
+        } else if (test == Test::MarkRead || test == Test::MarkReadAsync) {
+            static CHAR_INFO buffer[100 * 25];
+            const SMALL_RECT readRegion = {0, 2975, 99, 2999};
+            SMALL_RECT tmp = readRegion;
+            SendMessage(hwnd, WM_SYSCOMMAND, SC_CONSOLE_MARK, 0);
+            BOOL ret = ReadConsoleOutput(conout, buffer, {100, 25}, {0, 0}, &tmp);
+            ASSERT(ret && !memcmp(&tmp, &readRegion, sizeof(tmp)));
+            if (test == Test::MarkReadAsync) {
+                SendMessageCallback(hwnd, WM_CHAR, 27, 0x00010001, NULL, 0);
+            } else {
+                SendMessage(hwnd, WM_CHAR, 27, 0x00010001);
+            }
         }
     }
 
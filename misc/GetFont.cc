@@ -7,7 +7,9 @@
 #include "../src/shared/StringUtil.h"
 
 #include "TestUtil.cc"
+#include "../src/shared/CpuFeatures.cc"
 #include "../src/shared/StringUtil.cc"
+#include "../src/shared/UnicodeTranscode.cc"
 
 #define COUNT_OF(x) (sizeof(x) / sizeof((x)[0]))
 
@@ -38,20 +38,149 @@
 #include "../shared/Buffer.h"
 #include "../shared/DebugClient.h"
 #include "../shared/GenRandom.h"
+#include "../shared/OsModule.h"
+#include "../shared/SharedRing.h"
 #include "../shared/StringBuilder.h"
 #include "../shared/StringUtil.h"
+#include "../shared/TimeMeasurement.h"
 #include "../shared/WindowsVersion.h"
 #include "../shared/WinptyAssert.h"
 
+#include "AllocationCounter.h"
+#include "CharInfoScan.h"
+#include "ConsoleBuffer.h"
 #include "ConsoleFont.h"
 #include "ConsoleInput.h"
+#include "ConsoleSnapshot.h"
+#include "ConsoleTrace.h"
+#include "EtwTrace.h"
+#include "HistoryStore.h"
+#include "InputThread.h"
+#include "LargeConsoleRead.h"
 #include "NamedPipe.h"
+#include "OutputJournal.h"
+#include "Profiler.h"
+#include "PseudoConsole.h"
 #include "Scraper.h"
+#include "SessionRecorder.h"
 #include "Terminal.h"
 #include "Win32ConsoleBuffer.h"
 
 namespace {
 
+// With WINPTY_FLAG_EVENT_DRIVEN_SCRAPE, the agent scrapes at most this often
+// in response to console events, and at least this often regardless of them.
+const DWORD kMinEventScrapeIntervalMs = 10;
+const DWORD kEventScrapeFallbackMs = 250;
+
+// After delivering input, the agent scrapes after these delays to pick up the
+// echo sooner than the poll interval would.  The second scrape catches
+// programs that take a little longer to respond.
+const int kInputEchoScrapeDelaysMs[] = { 3, 15 };
+
+// Without a title change event, the title is polled at this interval rather
+// than on every scrape.
+const DWORD kTitlePollIntervalMs = 250;
+
+// With WINPTY_FLAG_TRUE_COLOR_OUTPUT, the console palette is reread at this
+// interval.
+const DWORD kPalettePollIntervalMs = 1000;
+
+// With WINPTY_SPAWN_FLAG_FAST_SHUTDOWN, the longest the agent blocks writing
+// its final output to each pipe.
+const DWORD kFastShutdownFlushMs = 1000;
+
+// How often a subscribed process list is checked for changes.
+const DWORD kProcessListPollIntervalMs = 100;
+
+// The cached CONOUT$ handle is reopened when the event hook reports a layout
+// change, and at least this often in case a switch of the active screen
+// buffer went unreported.  Without a hook, it's reopened for every use.
+const DWORD kPrimaryBufferRefreshMs = 1000;
+
+// While the client has hidden the session, the poll timer runs at this
+// interval, and a scrolling-mode console is scraped at most this often.
+const DWORD kHiddenScrapeIntervalMs = 1000;
+
+// An output observer with more than this much CONOUT output queued is
+// disconnected rather than allowed to hold up the session.
+const size_t kMaxObserverBacklog = 4 * 1024 * 1024;
+// Each observer pipe adds to the handles the event loop waits on, which are
+// capped at MAXIMUM_WAIT_OBJECTS.
+const size_t kMaxOutputObservers = 8;
+
+// The CONERR buffer is inactive, so the event hook doesn't see its writes.
+// It's scraped when its buffer info changes, and at least this often, since
+// a write can leave the info as it was.
+const DWORD kErrorBufferRescrapeMs = 250;
+
+// With WINPTY_FLAG_IDLE_TRIM, how long the pipes must be quiet before the
+// agent releases its idle buffers.
+const DWORD kIdleTrimMs = 30000;
+
+// With WINPTY_FLAG_BULK_PRIORITY, a session is "bulk" once it has gone this
+// long without terminal input while writing at least kBulkOutputBytes of
+// output per interval.
+const DWORD kBulkCheckIntervalMs = 1000;
+const uint64_t kBulkOutputBytes = 256 * 1024;
+
+// With WINPTY_FLAG_IDLE_ECO_QOS, how long the pipes must be quiet before the
+// agent lowers its priority and opts into power throttling.
+const DWORD kIdleEcoQosMs = 10000;
+
+// PROCESS_POWER_THROTTLING_STATE and its constants are missing from the old
+// MinGW headers.
+struct AGENT_PROCESS_POWER_THROTTLING_STATE {
+    ULONG Version;
+    ULONG ControlMask;
+    ULONG StateMask;
+};
+const ULONG AGENT_PROCESS_POWER_THROTTLING_CURRENT_VERSION = 1;
+const ULONG AGENT_PROCESS_POWER_THROTTLING_EXECUTION_SPEED = 0x1;
+const int AGENT_ProcessPowerThrottling = 4;
+
+// Windows 8 and up.  Power throttling needs Windows 10 1709 or later;
+// before that, the call fails harmlessly.
+typedef BOOL WINAPI SetProcessInformation_t(
+    HANDLE hProcess,
+    int ProcessInformationClass,
+    LPVOID ProcessInformation,
+    DWORD ProcessInformationSize);
+
+// Once this much output is waiting to be sent on a data pipe, the client
+// isn't keeping up, so scrapes for that pipe are skipped rather than queuing
+// more.  The console retains the content, so the first scrape after the pipe
+// drains sends a single catch-up frame.
+const size_t kOutputHighWaterMark = 256 * 1024;
+
+// The capacity of the WINPTY_FLAG_SHARED_MEMORY_OUTPUT ring.  It must be a
+// power of two.  It's larger than the high-water mark, so a full frame
+// usually fits without waiting for the client.
+const uint32_t kSharedOutputRingSize = 1024 * 1024;
+
+// The amount of CONOUT output retained for WINPTY_FLAG_OUTPUT_JOURNAL.  It's
+// a few scrapes' worth at the high-water mark.
+const size_t kOutputJournalSize = 1024 * 1024;
+
+// The most output a single GetOutputSince reply carries.
+const int kMaxOutputSinceReply = 256 * 1024;
+
+// The most cells a single GetHistory reply carries, except that it always
+// carries at least one line.
+const int kMaxHistoryReplyCells = 64 * 1024;
+
+// The most matches a single SearchHistory reply carries.
+const int kMaxSearchResults = 1024;
+
+// A poll tick at least this long is traced with its phase durations.
+const int64_t kSlowTickUs = 50000;
+
+int64_t ticksToUs(uint64_t ticks) {
+    static const double freq =
+        static_cast<double>(TimeMeasurement::frequency());
+    return static_cast<int64_t>(static_cast<double>(ticks) * 1000000.0 / freq);
+}
+
 static BOOL WINAPI consoleCtrlHandler(DWORD dwCtrlType)
 {
     if (dwCtrlType == CTRL_C_EVENT) {
@@ -72,7 +201,9 @@ static BOOL WINAPI consoleCtrlHandler(DWORD dwCtrlType)
 static void detectNewWindows10Console(
         Win32Console &console, Win32ConsoleBuffer &buffer)
 {
-    if (!isAtLeastWindows8()) {
+    // The new console only exists on Windows 10, so skip the Mark probe on
+    // Windows 8 and 8.1.
+    if (!isAtLeastWindows10()) {
         return;
     }
 
@@ -133,6 +264,68 @@ static HANDLE duplicateHandle(HANDLE h) {
     return ret;
 }
 
+// The length of the name part of a "VAR=VAL" (or "VAR") environment entry.
+// Names like "=C:" begin with an '='.
+static size_t envNameLength(const wchar_t *entry, size_t length)
+{
+    const wchar_t *const eq =
+        length > 1 ? wmemchr(entry + 1, L'=', length - 1) : nullptr;
+    return eq != nullptr ? eq - entry : length;
+}
+
+// Returns the agent's environment block with the WINPTY_SPAWN_FLAG_ENV_DELTA
+// entries in `delta` applied, sorted by name as CreateProcess expects.
+static std::wstring applyEnvironmentDelta(const std::wstring &delta)
+{
+    struct Entry {
+        const wchar_t *text;
+        size_t length;
+        size_t nameLength;
+    };
+    const auto nameLess = [](const Entry &a, const Entry &b) {
+        const int cmp = _wcsnicmp(a.text, b.text,
+                                  std::min(a.nameLength, b.nameLength));
+        return cmp != 0 ? cmp < 0 : a.nameLength < b.nameLength;
+    };
+    const auto parseBlock = [](const wchar_t *p, std::vector<Entry> &out) {
+        while (*p != L'\0') {
+            const size_t len = wcslen(p);
+            out.push_back(Entry { p, len, envNameLength(p, len) });
+            p += len + 1;
+        }
+    };
+
+    wchar_t *const block = GetEnvironmentStringsW();
+    ASSERT(block != nullptr && "GetEnvironmentStringsW failed");
+    std::vector<Entry> entries;
+    parseBlock(block, entries);
+    std::vector<Entry> changes;
+    parseBlock(delta.c_str(), changes);
+
+    // Later changes win, so a stable sort keeps them in order, and each
+    // change replaces every inherited entry of the same name.
+    std::stable_sort(entries.begin(), entries.end(), nameLess);
+    for (const Entry &change : changes) {
+        const auto range = std::equal_range(
+            entries.begin(), entries.end(), change, nameLess);
+        const auto it = entries.erase(range.first, range.second);
+        if (change.nameLength < change.length) {
+            entries.insert(it, change);
+        }
+    }
+
+    std::wstring ret;
+    for (const Entry &entry : entries) {
+        ret.append(entry.text, entry.length + 1);
+    }
+    if (entries.empty()) {
+        ret.push_back(L'\0');
+    }
+    ret.push_back(L'\0');
+    FreeEnvironmentStringsW(block);
+    return ret;
+}
+
 // It's safe to truncate a handle from 64-bits to 32-bits, or to sign-extend it
 // back to 64-bits.  See the MSDN article, "Interprocess Communication Between
 // 32-bit and 64-bit Applications".
@@ -147,70 +340,245 @@ Agent::Agent(LPCWSTR controlPipeName,
              uint64_t agentFlags,
              int mouseMode,
              int initialCols,
-             int initialRows) :
+             int initialRows,
+             int minPollInterval,
+             int maxPollInterval,
+             int bufferLineCount,
+             int escapeTimeout,
+             int pipeOutBufferSize,
+             int pipeInBufferSize,
+             int pipeIoSize,
+             int scrollbackBudget,
+             uint64_t hostCaps) :
     m_useConerr((agentFlags & WINPTY_FLAG_CONERR) != 0),
-    m_plainMode((agentFlags & WINPTY_FLAG_PLAIN_OUTPUT) != 0),
-    m_mouseMode(mouseMode)
+    m_plainMode((agentFlags & (WINPTY_FLAG_PLAIN_OUTPUT |
+                               WINPTY_FLAG_LOG_OUTPUT)) != 0),
+    m_logOutput((agentFlags & WINPTY_FLAG_LOG_OUTPUT) != 0),
+    m_cellStream((agentFlags & WINPTY_FLAG_CELL_STREAM_OUTPUT) != 0),
+    m_idleTrim((agentFlags & WINPTY_FLAG_IDLE_TRIM) != 0),
+    m_bulkPriority((agentFlags & WINPTY_FLAG_BULK_PRIORITY) != 0),
+    m_idleEcoQos((agentFlags & WINPTY_FLAG_IDLE_ECO_QOS) != 0),
+    m_trueColor((agentFlags & WINPTY_FLAG_TRUE_COLOR_OUTPUT) != 0 &&
+                (agentFlags & WINPTY_FLAG_CELL_STREAM_OUTPUT) == 0),
+    m_mouseMode(mouseMode),
+    m_pipeOutBufferSize(pipeOutBufferSize),
+    m_pipeInBufferSize(pipeInBufferSize),
+    m_pipeIoSize(pipeIoSize)
 {
     trace("Agent::Agent entered");
+    TimeMeasurement initTime;
+    std::fill(std::begin(m_startupStatsUs), std::end(m_startupStatsUs), -1);
+
+    // An out-of-context WinEvent hook is delivered through the message queue,
+    // which a completion port wait can't watch.
+    if (!(agentFlags & WINPTY_FLAG_EVENT_DRIVEN_SCRAPE)) {
+        useCompletionPort();
+    }
 
     ASSERT(initialCols >= 1 && initialRows >= 1);
+    ASSERT(pipeOutBufferSize >= 0 && pipeInBufferSize >= 0);
+    ASSERT(pipeIoSize >= WINPTY_PIPE_IO_SIZE_MIN &&
+           pipeIoSize <= WINPTY_PIPE_IO_SIZE_MAX);
+    ASSERT(scrollbackBudget >= 0);
+    ASSERT(escapeTimeout >= 1);
     initialCols = std::min(initialCols, MAX_CONSOLE_WIDTH);
-    initialRows = std::min(initialRows, MAX_CONSOLE_HEIGHT);
+    initialRows = std::min(initialRows, maxConsoleHeight(bufferLineCount));
 
     const bool outputColor =
-        !m_plainMode || (agentFlags & WINPTY_FLAG_COLOR_ESCAPES);
+        !m_plainMode ||
+        ((agentFlags & WINPTY_FLAG_COLOR_ESCAPES) && !m_logOutput);
+    const bool synchronizedOutput =
+        (agentFlags & WINPTY_FLAG_SYNCHRONIZED_OUTPUT) != 0;
+    const bool repeatCompression =
+        (agentFlags & WINPTY_FLAG_REPEAT_CHAR_OUTPUT) != 0;
+    const bool legacyTentativeScrape =
+        (agentFlags & WINPTY_FLAG_LEGACY_TENTATIVE_SCRAPE) != 0;
+    const bool fingerprintScroll =
+        (agentFlags & WINPTY_FLAG_FINGERPRINT_SCROLL) != 0;
+    // Plain output can't backtrack, and a cell-stream client lays the lines
+    // out itself.
+    const bool terminalReflow =
+        (agentFlags & WINPTY_FLAG_TERMINAL_REFLOW) != 0 &&
+        !m_plainMode && !m_cellStream;
     const Coord initialSize(initialCols, initialRows);
 
+    TimeMeasurement consoleTime;
     auto primaryBuffer = openPrimaryBuffer();
     if (m_useConerr) {
+        // The child's stderr handle refers to this buffer, so it can't wait
+        // like the error scraper.
         m_errorBuffer = Win32ConsoleBuffer::createErrorBuffer();
     }
+    m_startupStatsUs[WINPTY_STARTUP_STAT_CONSOLE_SETUP] =
+        consoleTime.elapsedUs();
+
+    m_console.setAsyncUnfreeze((agentFlags & WINPTY_FLAG_ASYNC_UNFREEZE) != 0);
 
-    detectNewWindows10Console(m_console, *primaryBuffer);
+    // libwinpty passes on an earlier agent's probe result, if it has one.
+    TimeMeasurement detectTime;
+    if (hostCaps & HostConsoleCaps::Probed) {
+        m_console.setNewW10((hostCaps & HostConsoleCaps::NewW10) != 0);
+        trace("New Windows 10 console %s by an earlier agent",
+            m_console.isNewW10() ? "detected" : "not detected");
+    } else {
+        detectNewWindows10Console(m_console, *primaryBuffer);
+    }
+    m_startupStatsUs[WINPTY_STARTUP_STAT_DETECT_CONSOLE] =
+        detectTime.elapsedUs();
+
+    if (hasDebugFlag("console_trace")) {
+        ConsoleTrace::Options options;
+        options.agentFlags = agentFlags;
+        options.cols = initialCols;
+        options.rows = initialRows;
+        options.bufferLineCount = bufferLineCount;
+        options.scrollbackBudget = scrollbackBudget;
+        options.newW10 = m_console.isNewW10();
+        wchar_t tempPath[MAX_PATH];
+        const DWORD len = GetTempPathW(MAX_PATH, tempPath);
+        if (len > 0 && len < MAX_PATH) {
+            m_consoleTrace = ConsoleTrace::createRecording(
+                (WStringBuilder(MAX_PATH + 64)
+                    << tempPath << L"winpty-console-trace-"
+                    << GetCurrentProcessId() << L".bin").str_moved(),
+                options);
+            primaryBuffer->setTrace(m_consoleTrace.get());
+        }
+    }
 
+    // Every data pipe is opened with an overlapped ConnectNamedPipe already
+    // pending, and their names go out together in the one reply below, ahead
+    // of the scraper and font setup.  libwinpty returns from winpty_open as
+    // soon as it reads that reply, so the client connects its data pipes, in
+    // any order and whenever it likes, while this agent finishes starting.
+    TimeMeasurement pipesTime;
     m_controlPipe = &connectToControlPipe(controlPipeName);
-    m_coninPipe = &createDataServerPipe(false, L"conin");
-    m_conoutPipe = &createDataServerPipe(true, L"conout");
-    if (m_useConerr) {
+    // The pseudoconsole decodes input itself, and its input pipe belongs to
+    // this loop, so that path keeps CONIN here.
+    NamedPipe *coninPipe = nullptr;
+    if ((agentFlags & WINPTY_FLAG_INPUT_THREAD) &&
+            !(agentFlags & WINPTY_FLAG_PSEUDOCONSOLE)) {
+        m_inputThread.reset(
+            new InputThread(*this, GetStdHandle(STD_INPUT_HANDLE),
+                            m_mouseMode, escapeTimeout, m_console));
+        coninPipe = &m_inputThread->createPipe();
+        openDataServerPipe(*coninPipe, false, L"conin");
+    } else {
+        m_coninPipe = &createDataServerPipe(false, L"conin");
+        coninPipe = m_coninPipe;
+    }
+    const bool sharedOutput =
+        (agentFlags & WINPTY_FLAG_SHARED_MEMORY_OUTPUT) != 0;
+    const bool outputThread =
+        (agentFlags & WINPTY_FLAG_OUTPUT_THREAD) != 0;
+    int64_t ringHandles[3] = {};
+    if (sharedOutput) {
+        auto ring = SharedRing::create(kSharedOutputRingSize);
+        ASSERT(ring != nullptr && "Could not create the CONOUT shared ring");
+        // libwinpty takes these duplicates from the agent process.
+        ringHandles[0] = int64FromHandle(duplicateHandle(ring->section()));
+        ringHandles[1] = int64FromHandle(duplicateHandle(ring->dataEvent()));
+        ringHandles[2] = int64FromHandle(duplicateHandle(ring->spaceEvent()));
+        m_conoutPipe = &createNamedPipe();
+        m_conoutPipe->setIoSize(m_pipeIoSize);
+        m_conoutPipe->openSharedRing(std::move(ring));
+    } else if (outputThread) {
+        m_conoutPipe = &createNamedPipe();
+        useOutputThread(*m_conoutPipe);
+        openDataServerPipe(*m_conoutPipe, true, L"conout");
+    } else {
+        m_conoutPipe = &createDataServerPipe(true, L"conout");
+    }
+    if (agentFlags & WINPTY_FLAG_OUTPUT_JOURNAL) {
+        m_outputJournal.reset(new OutputJournal(kOutputJournalSize));
+        m_conoutPipe->setJournal(m_outputJournal.get());
+    }
+    if (m_useConerr && outputThread) {
+        m_conerrPipe = &createNamedPipe();
+        useOutputThread(*m_conerrPipe);
+        openDataServerPipe(*m_conerrPipe, true, L"conerr");
+    } else if (m_useConerr) {
         m_conerrPipe = &createDataServerPipe(true, L"conerr");
     }
+    if (agentFlags & WINPTY_FLAG_COMPRESSED_OUTPUT) {
+        m_conoutPipe->setCompressed(true);
+        if (m_conerrPipe != nullptr) {
+            m_conerrPipe->setCompressed(true);
+        }
+    }
+    m_startupStatsUs[WINPTY_STARTUP_STAT_AGENT_PIPES] = pipesTime.elapsedUs();
 
     // Send an initial response packet to winpty.dll containing pipe names.
     {
         auto setupPacket = newPacket();
-        setupPacket.putWString(m_coninPipe->name());
-        setupPacket.putWString(m_conoutPipe->name());
+        setupPacket.putWString(coninPipe->name());
+        setupPacket.putWString(
+            sharedOutput ? std::wstring() : m_conoutPipe->name());
         if (m_useConerr) {
             setupPacket.putWString(m_conerrPipe->name());
         }
+        if (sharedOutput) {
+            setupPacket.putInt32(kSharedOutputRingSize);
+            for (int64_t handle : ringHandles) {
+                setupPacket.putInt64(handle);
+            }
+        }
+        setupPacket.putInt64(
+            HostConsoleCaps::Probed |
+            (m_console.isNewW10() ? HostConsoleCaps::NewW10 : 0));
         writePacket(setupPacket);
     }
 
-    std::unique_ptr<Terminal> primaryTerminal;
-    primaryTerminal.reset(new Terminal(*m_conoutPipe,
-                                       m_plainMode,
-                                       outputColor));
-    m_primaryScraper.reset(new Scraper(m_console,
-                                       *primaryBuffer,
-                                       std::move(primaryTerminal),
-                                       initialSize));
+    m_scraperSettings.initialCols = initialCols;
+    m_scraperSettings.initialRows = initialRows;
+    m_scraperSettings.bufferLineCount = bufferLineCount;
+    m_scraperSettings.scrollbackBudget = scrollbackBudget;
+    m_scraperSettings.outputColor = outputColor;
+    m_scraperSettings.synchronizedOutput = synchronizedOutput;
+    m_scraperSettings.repeatCompression = repeatCompression;
+    m_scraperSettings.legacyTentativeScrape = legacyTentativeScrape;
+    m_scraperSettings.fingerprintScroll = fingerprintScroll;
+    m_scraperSettings.trimWideReads =
+        (agentFlags & WINPTY_FLAG_TRIM_WIDE_READS) != 0;
+    m_scraperSettings.terminalReflow = terminalReflow;
+    m_ptyCols = initialCols;
+    m_ptyRows = initialRows;
+
+    m_primaryScraper =
+        createScraper(*primaryBuffer, *m_conoutPipe, /*initBuffer=*/true);
+    if (agentFlags & WINPTY_FLAG_HISTORY_STORE) {
+        m_historyStore = HistoryStore::create();
+        m_primaryScraper->setHistoryStore(m_historyStore.get());
+    }
+    int64_t errorFontUs = 0;
     if (m_useConerr) {
-        std::unique_ptr<Terminal> errorTerminal;
-        errorTerminal.reset(new Terminal(*m_conerrPipe,
-                                         m_plainMode,
-                                         outputColor));
-        m_errorScraper.reset(new Scraper(m_console,
-                                         *m_errorBuffer,
-                                         std::move(errorTerminal),
-                                         initialSize));
+        // Many children never write to stderr, so the error scraper and its
+        // terminal wait for the buffer's first output (see
+        // ensureErrorScraper).  The buffer is set up now, though, before the
+        // child can write to it.
+        errorFontUs = Scraper::setupBuffer(
+            m_console, *m_errorBuffer, initialSize, bufferLineCount);
+        m_errorBufferInfo = m_errorBuffer->bufferInfo();
+        m_errorScrapeTick = GetTickCount();
+    }
+    m_startupStatsUs[WINPTY_STARTUP_STAT_CONSOLE_FONT] =
+        m_primaryScraper->initialFontSetupUs() + errorFontUs;
+
+    if (m_trueColor) {
+        m_lastPaletteTick = GetTickCount() - kPalettePollIntervalMs;
+        syncConsolePalette();
     }
 
     m_console.setTitle(m_currentTitle);
 
-    const HANDLE conin = GetStdHandle(STD_INPUT_HANDLE);
-    m_consoleInput.reset(
-        new ConsoleInput(conin, m_mouseMode, *this, m_console));
+    if (m_inputThread != nullptr) {
+        m_inputThread->start(*coninPipe);
+    } else {
+        const HANDLE conin = GetStdHandle(STD_INPUT_HANDLE);
+        m_consoleInput.reset(
+            new ConsoleInput(conin, m_mouseMode, escapeTimeout,
+                             *this, m_console));
+    }
 
     // Setup Ctrl-C handling.  First restore default handling of Ctrl-C.  This
     // attribute is inherited by child processes.  Then register a custom
@@ -219,16 +587,54 @@ Agent::Agent(LPCWSTR controlPipeName,
     SetConsoleCtrlHandler(NULL, FALSE);
     SetConsoleCtrlHandler(consoleCtrlHandler, TRUE);
 
-    setPollInterval(25);
+    // A pseudoconsole can't separate CONERR, and its VT output doesn't suit
+    // the plain and cell-stream modes, so those keep scraping.
+    if ((agentFlags & WINPTY_FLAG_PSEUDOCONSOLE) &&
+            !m_useConerr && !m_plainMode && !m_cellStream) {
+        COORD ptySize = { initialSize.X, initialSize.Y };
+        openPseudoConsole(ptySize);
+    }
+
+    if ((agentFlags & WINPTY_FLAG_EVENT_DRIVEN_SCRAPE) &&
+            m_pseudoConsole == nullptr) {
+        m_consoleEventHook.reset(
+            new ConsoleEventHook(m_console.hwnd(), *this));
+        if (!m_consoleEventHook->isActive()) {
+            m_consoleEventHook.reset();
+        }
+    }
+
+    ASSERT(minPollInterval >= 1 && minPollInterval <= maxPollInterval);
+    m_visibleMinPoll = minPollInterval;
+    m_visibleMaxPoll = maxPollInterval;
+    if (m_pseudoConsole != nullptr) {
+        // Nothing is scraped, and the child's exit wakes the loop anyway.
+        setPollIntervalRange(maxPollInterval, maxPollInterval);
+    } else {
+        setPollIntervalRange(minPollInterval, maxPollInterval);
+    }
+
+    m_startupStatsUs[WINPTY_STARTUP_STAT_AGENT_INIT] = initTime.elapsedUs();
+    trace("Agent::Agent: console=%dus detect=%dus pipes=%dus font=%dus "
+          "total=%dus",
+        static_cast<int>(m_startupStatsUs[WINPTY_STARTUP_STAT_CONSOLE_SETUP]),
+        static_cast<int>(m_startupStatsUs[WINPTY_STARTUP_STAT_DETECT_CONSOLE]),
+        static_cast<int>(m_startupStatsUs[WINPTY_STARTUP_STAT_AGENT_PIPES]),
+        static_cast<int>(m_startupStatsUs[WINPTY_STARTUP_STAT_CONSOLE_FONT]),
+        static_cast<int>(m_startupStatsUs[WINPTY_STARTUP_STAT_AGENT_INIT]));
 }
 
 Agent::~Agent()
 {
     trace("Agent::~Agent entered");
+    terminateChildJob();
+    // Its ConsoleInput refers to m_console, and it wakes this loop.
+    m_inputThread.reset();
+    dumpProfile("exit");
+    closePseudoConsole();
+    stopOutputRecording();
     agentShutdown();
-    if (m_childProcess != NULL) {
-        CloseHandle(m_childProcess);
-    }
+    releaseChildProcess();
 }
 
 // Write a "Device Status Report" command to the terminal.  The terminal will
@@ -237,11 +643,25 @@ Agent::~Agent()
 // bytes before it are complete keypresses.
 void Agent::sendDsr()
 {
-    if (!m_plainMode && !m_conoutPipe->isClosed()) {
+    // A cell-stream client has no terminal to reply.
+    if (!m_plainMode && !m_cellStream && !m_conoutPipe->isClosed()) {
         m_conoutPipe->write("\x1B[6n");
     }
 }
 
+void Agent::onConsoleChanged()
+{
+    // Scrape on the next pass through the event loop, unless we've just
+    // scraped, in which case the regular poll picks up the change.  A hidden
+    // session waits for the slow poll.
+    if (m_hidden) {
+        return;
+    }
+    if (GetTickCount() - m_lastScrapeTick >= kMinEventScrapeIntervalMs) {
+        requestPoll();
+    }
+}
+
 NamedPipe &Agent::connectToControlPipe(LPCWSTR pipeName)
 {
     NamedPipe &pipe = createNamedPipe();
@@ -252,28 +672,40 @@ NamedPipe &Agent::connectToControlPipe(LPCWSTR pipeName)
 
 // Returns a new server named pipe.  It has not yet been connected.
 NamedPipe &Agent::createDataServerPipe(bool write, const wchar_t *kind)
+{
+    NamedPipe &pipe = createNamedPipe();
+    openDataServerPipe(pipe, write, kind);
+    return pipe;
+}
+
+// Opens a server named pipe on a pipe created by this loop or another one.
+void Agent::openDataServerPipe(NamedPipe &pipe, bool write,
+                               const wchar_t *kind)
 {
     const auto name =
         (WStringBuilder(128)
             << L"\\\\.\\pipe\\winpty-"
             << kind << L'-'
-            << GenRandom().uniqueName()).str_moved();
-    NamedPipe &pipe = createNamedPipe();
+            << GenRandom::uniqueName()).str_moved();
+    pipe.setIoSize(m_pipeIoSize);
     pipe.openServerPipe(
         name.c_str(),
         write ? NamedPipe::OpenMode::Writing
               : NamedPipe::OpenMode::Reading,
-        write ? 8192 : 0,
-        write ? 0 : 256);
+        write ? m_pipeOutBufferSize : 0,
+        write ? 0 : m_pipeInBufferSize);
     if (!write) {
-        pipe.setReadBufferSize(64 * 1024);
+        pipe.setReadBufferSize(std::max(64 * 1024, m_pipeIoSize));
     }
-    return pipe;
 }
 
 void Agent::onPipeIo(NamedPipe &namedPipe)
 {
-    if (&namedPipe == m_conoutPipe || &namedPipe == m_conerrPipe) {
+    if (&namedPipe == m_ptyOutputPipe ||
+            (&namedPipe == m_conoutPipe && m_pseudoConsole != nullptr)) {
+        forwardPseudoConsoleOutput();
+        autoClosePipesForShutdown();
+    } else if (&namedPipe == m_conoutPipe || &namedPipe == m_conerrPipe) {
         autoClosePipesForShutdown();
     } else if (&namedPipe == m_coninPipe) {
         pollConinPipe();
@@ -290,6 +722,7 @@ void Agent::pollControlPipe()
         return;
     }
 
+    m_deferringReplies = true;
     while (true) {
         uint64_t packetSize = 0;
         const auto amt1 =
@@ -304,38 +737,108 @@ void Agent::pollControlPipe()
             }
             break;
         }
-        std::vector<char> packetData;
-        packetData.resize(packetSize);
-        const auto amt2 = m_controlPipe->read(packetData.data(), packetSize);
-        ASSERT(amt2 == packetSize);
+        // Usually the packet is decoded where it sits in the pipe's input
+        // queue, and it's discarded afterward.  (Nothing in handlePacket
+        // services the control pipe, so the bytes stay put.)  Otherwise it's
+        // copied out into the packet buffer, which is reused for every
+        // packet, so steady-state control traffic doesn't allocate.
+        const char *packetData = m_controlPipe->peekInPlace(packetSize);
+        const bool inPlace = packetData != nullptr;
+        if (!inPlace) {
+            if (m_packetData.size() < packetSize) {
+                m_packetData.resize(packetSize);
+            }
+            const auto amt2 =
+                m_controlPipe->read(m_packetData.data(), packetSize);
+            ASSERT(amt2 == packetSize);
+            packetData = m_packetData.data();
+        }
         try {
-            ReadBuffer buffer(std::move(packetData));
+            ReadBuffer buffer(packetData, packetSize);
             buffer.getRawValue<uint64_t>(); // Discard the size.
+            PROFILE_ZONE("agent.packet");
             handlePacket(buffer);
         } catch (const ReadBuffer::DecodeError&) {
             ASSERT(false && "Decode error");
         }
+        if (inPlace) {
+            m_controlPipe->skip(packetSize);
+        }
+    }
+    m_deferringReplies = false;
+    if (!m_pendingReplies.empty()) {
+        m_controlPipe->write(m_pendingReplies.data(), m_pendingReplies.size());
+        m_pendingReplies.clear();
     }
 }
 
 void Agent::handlePacket(ReadBuffer &packet)
 {
     const int type = packet.getInt32();
+    if (type != AgentMsg::SetSize && type != AgentMsg::Batch) {
+        // Other requests must see the console at the size requested before
+        // them.
+        applyPendingResize();
+    }
     switch (type) {
     case AgentMsg::StartProcess:
         handleStartProcessPacket(packet);
         break;
     case AgentMsg::SetSize:
-        // TODO: I think it might make sense to collapse consecutive SetSize
-        // messages.  i.e. The terminal process can probably generate SetSize
-        // messages faster than they can be processed, and some GUIs might
-        // generate a flood of them, so if we can read multiple SetSize packets
-        // at once, we can ignore the early ones.
         handleSetSizePacket(packet);
         break;
     case AgentMsg::GetConsoleProcessList:
         handleGetConsoleProcessListPacket(packet);
         break;
+    case AgentMsg::GetStartupStats:
+        handleGetStartupStatsPacket(packet);
+        break;
+    case AgentMsg::GetFreezeStats:
+        handleGetFreezeStatsPacket(packet);
+        break;
+    case AgentMsg::GetStats:
+        handleGetStatsPacket(packet);
+        break;
+    case AgentMsg::GetScreenSnapshot:
+        handleGetScreenSnapshotPacket(packet);
+        break;
+    case AgentMsg::GetOutputSince:
+        handleGetOutputSincePacket(packet);
+        break;
+    case AgentMsg::SubscribeProcessList:
+        handleSubscribeProcessListPacket(packet);
+        break;
+    case AgentMsg::Batch:
+        handleBatchPacket(packet);
+        break;
+    case AgentMsg::Ping:
+        packet.assertEof();
+        writePacket(newPacket());
+        break;
+    case AgentMsg::GetTickStats:
+        handleGetTickStatsPacket(packet);
+        break;
+    case AgentMsg::GetHistory:
+        handleGetHistoryPacket(packet);
+        break;
+    case AgentMsg::SearchHistory:
+        handleSearchHistoryPacket(packet);
+        break;
+    case AgentMsg::SetVisibility:
+        handleSetVisibilityPacket(packet);
+        break;
+    case AgentMsg::AttachOutputObserver:
+        handleAttachOutputObserverPacket(packet);
+        break;
+    case AgentMsg::SetOutputRecording:
+        handleSetOutputRecordingPacket(packet);
+        break;
+    case AgentMsg::EnableFrameOnDemand:
+        handleEnableFrameOnDemandPacket(packet);
+        break;
+    case AgentMsg::RequestFrame:
+        handleRequestFramePacket(packet);
+        break;
     default:
         trace("Unrecognized message, id:%d", type);
     }
@@ -343,14 +846,19 @@ void Agent::handlePacket(ReadBuffer &packet)
 
 void Agent::writePacket(WriteBuffer &packet)
 {
-    const auto &bytes = packet.buf();
-    packet.replaceRawValue<uint64_t>(0, bytes.size());
-    m_controlPipe->write(bytes.data(), bytes.size());
+    packet.replaceRawValue<uint64_t>(0, packet.size());
+    if (m_deferringReplies) {
+        m_pendingReplies.append(packet.data(), packet.size());
+    } else {
+        m_controlPipe->write(packet.data(), packet.size());
+    }
 }
 
+// A session may start any number of children, one after another or side by
+// side.  The handles returned to the client report each child's exit.  The
+// spawn flags (e.g. auto-shutdown) follow the most recent child.
 void Agent::handleStartProcessPacket(ReadBuffer &packet)
 {
-    ASSERT(m_childProcess == nullptr);
     ASSERT(!m_closingOutputPipes);
 
     const uint64_t spawnFlags = packet.getInt64();
@@ -359,24 +867,45 @@ void Agent::handleStartProcessPacket(ReadBuffer &packet)
     const auto program = packet.getWString();
     const auto cmdline = packet.getWString();
     const auto cwd = packet.getWString();
-    const auto env = packet.getWString();
+    auto env = packet.getWString();
     const auto desktop = packet.getWString();
     packet.assertEof();
+    if (spawnFlags & WINPTY_SPAWN_FLAG_ENV_DELTA) {
+        env = applyEnvironmentDelta(env);
+    }
+
+    if ((spawnFlags & WINPTY_SPAWN_FLAG_RESET_TERMINAL) &&
+            m_pseudoConsole == nullptr) {
+        clearConsoleForSpawn();
+    }
 
     auto cmdlineV = vectorWithNulFromString(cmdline);
     auto desktopV = vectorWithNulFromString(desktop);
-    auto envV = vectorFromString(env);
 
     LPCWSTR programArg = program.empty() ? nullptr : program.c_str();
     LPWSTR cmdlineArg = cmdline.empty() ? nullptr : cmdlineV.data();
     LPCWSTR cwdArg = cwd.empty() ? nullptr : cwd.c_str();
-    LPWSTR envArg = env.empty() ? nullptr : envV.data();
+    // CreateProcess doesn't modify the environment block, so there's no need
+    // to copy it into a mutable vector.
+    LPWSTR envArg = env.empty() ? nullptr : &env[0];
 
-    STARTUPINFOW sui = {};
+    PseudoConsole::StartupInfo suiEx = {};
+    STARTUPINFOW &sui = suiEx.StartupInfo;
     PROCESS_INFORMATION pi = {};
     sui.cb = sizeof(sui);
     sui.lpDesktop = desktop.empty() ? nullptr : desktopV.data();
     BOOL inheritHandles = FALSE;
+    DWORD creationFlags = CREATE_UNICODE_ENVIRONMENT;
+    std::vector<char> attributeStorage;
+    if (m_pseudoConsole != nullptr &&
+            m_pseudoConsole->initStartupInfo(suiEx, attributeStorage)) {
+        creationFlags |= PseudoConsole::kExtendedStartupInfoPresent;
+    }
+    const bool killTree = (spawnFlags & WINPTY_SPAWN_FLAG_KILL_TREE) != 0;
+    if (killTree) {
+        // The child joins the job before it can start any processes.
+        creationFlags |= CREATE_SUSPENDED;
+    }
     if (m_useConerr) {
         inheritHandles = TRUE;
         sui.dwFlags |= STARTF_USESTDHANDLES;
@@ -388,14 +917,20 @@ void Agent::handleStartProcessPacket(ReadBuffer &packet)
     const BOOL success =
         CreateProcessW(programArg, cmdlineArg, nullptr, nullptr,
                        /*bInheritHandles=*/inheritHandles,
-                       /*dwCreationFlags=*/CREATE_UNICODE_ENVIRONMENT,
+                       /*dwCreationFlags=*/creationFlags,
                        envArg, cwdArg, &sui, &pi);
     const int lastError = success ? 0 : GetLastError();
+    PseudoConsole::freeStartupInfo(suiEx);
 
     trace("CreateProcess: %s %u",
           (success ? "success" : "fail"),
           static_cast<unsigned int>(pi.dwProcessId));
 
+    if (success && killTree) {
+        addToChildJob(pi.hProcess);
+        ResumeThread(pi.hThread);
+    }
+
     auto reply = newPacket();
     if (success) {
         int64_t replyProcess = 0;
@@ -407,9 +942,14 @@ void Agent::handleStartProcessPacket(ReadBuffer &packet)
             replyThread = int64FromHandle(duplicateHandle(pi.hThread));
         }
         CloseHandle(pi.hThread);
+        releaseChildProcess();
         m_childProcess = pi.hProcess;
-        m_autoShutdown = (spawnFlags & WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN) != 0;
-        m_exitAfterShutdown = (spawnFlags & WINPTY_SPAWN_FLAG_EXIT_AFTER_SHUTDOWN) != 0;
+        requestPollOnSignal(m_childProcess);
+        m_fastShutdown = (spawnFlags & WINPTY_SPAWN_FLAG_FAST_SHUTDOWN) != 0;
+        m_autoShutdown = m_fastShutdown ||
+            (spawnFlags & WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN) != 0;
+        m_exitAfterShutdown = m_fastShutdown ||
+            (spawnFlags & WINPTY_SPAWN_FLAG_EXIT_AFTER_SHUTDOWN) != 0;
         reply.putInt32(static_cast<int32_t>(StartProcessResult::ProcessCreated));
         reply.putInt64(replyProcess);
         reply.putInt64(replyThread);
@@ -420,100 +960,1058 @@ void Agent::handleStartProcessPacket(ReadBuffer &packet)
     writePacket(reply);
 }
 
+// Stops tracking the current child, if any, whether or not it has exited.
+void Agent::releaseChildProcess()
+{
+    if (m_childProcess != nullptr) {
+        requestPollOnSignal(nullptr);
+        CloseHandle(m_childProcess);
+        m_childProcess = nullptr;
+    }
+}
+
+// Places a suspended child in m_childJob, creating the job first if needed.
+// The job kills its processes when its last handle closes, so the tree dies
+// with the agent even if the agent never calls terminateChildJob.
+bool Agent::addToChildJob(HANDLE process)
+{
+    if (m_childJob.get() == nullptr) {
+        const HANDLE job = CreateJobObjectW(nullptr, nullptr);
+        if (job == nullptr) {
+            trace("CreateJobObjectW failed: %u",
+                  static_cast<unsigned int>(GetLastError()));
+            return false;
+        }
+        m_childJob = OwnedHandle(job);
+        JOBOBJECT_EXTENDED_LIMIT_INFORMATION info = {};
+        info.BasicLimitInformation.LimitFlags =
+            JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
+        if (!SetInformationJobObject(job, JobObjectExtendedLimitInformation,
+                                     &info, sizeof(info))) {
+            trace("SetInformationJobObject failed: %u",
+                  static_cast<unsigned int>(GetLastError()));
+        }
+    }
+    if (!AssignProcessToJobObject(m_childJob.get(), process)) {
+        // Before Windows 8, a process can't be in two jobs, so this fails if
+        // the agent's own job doesn't allow breakaway.
+        trace("AssignProcessToJobObject failed: %u",
+              static_cast<unsigned int>(GetLastError()));
+        return false;
+    }
+    return true;
+}
+
+// Ends every process in m_childJob at once, so that closing the console
+// doesn't wait for each one to handle CTRL_CLOSE_EVENT.
+void Agent::terminateChildJob()
+{
+    if (m_childJob.get() != nullptr) {
+        trace("Terminating the child job");
+        TerminateJobObject(m_childJob.get(), 1);
+        m_childJob.dispose(true);
+    }
+}
+
+// Sends the output the console holds, then blanks the console and the
+// terminal for the next child.
+void Agent::clearConsoleForSpawn()
+{
+    ConsoleSnapshot snapshot(GetStdHandle(STD_INPUT_HANDLE));
+    scrapeBuffers(snapshot, true);
+    m_primaryScraper->clearConsole(primaryBuffer());
+    if (m_errorScraper) {
+        m_errorScraper->clearConsole(*m_errorBuffer);
+    }
+}
+
 void Agent::handleSetSizePacket(ReadBuffer &packet)
 {
     const int cols = packet.getInt32();
     const int rows = packet.getInt32();
     packet.assertEof();
-    resizeWindow(cols, rows);
+    // A GUI being resized can generate a flood of SetSize messages.  Resizing
+    // the console is slow, so the size is applied on the next poll tick, and
+    // only the latest size received by then is used.  The reply is sent right
+    // away.
+    m_pendingResize = true;
+    m_pendingResizeCols = cols;
+    m_pendingResizeRows = rows;
+    notePollActivity();
     auto reply = newPacket();
     writePacket(reply);
 }
 
-void Agent::handleGetConsoleProcessListPacket(ReadBuffer &packet)
+// Reads the console's process list into `list`, reusing its storage.
+void Agent::readConsoleProcessList(std::vector<DWORD> &list)
 {
-    packet.assertEof();
-
-    auto processList = std::vector<DWORD>(64);
-    auto processCount = GetConsoleProcessList(&processList[0], processList.size());
+    if (list.size() < 64) {
+        list.resize(64);
+    }
+    auto processCount = GetConsoleProcessList(&list[0], list.size());
 
     // The process list can change while we're trying to read it
-    while (processList.size() < processCount) {
+    while (list.size() < processCount) {
         // Multiplying by two caps the number of iterations
-        const auto newSize = std::max<DWORD>(processList.size() * 2, processCount);
-        processList.resize(newSize);
-        processCount = GetConsoleProcessList(&processList[0], processList.size());
+        const auto newSize = std::max<DWORD>(list.size() * 2, processCount);
+        list.resize(newSize);
+        processCount = GetConsoleProcessList(&list[0], list.size());
     }
 
     if (processCount == 0) {
         trace("GetConsoleProcessList failed");
     }
+    list.resize(processCount);
+}
+
+void Agent::handleGetConsoleProcessListPacket(ReadBuffer &packet)
+{
+    packet.assertEof();
+
+    readConsoleProcessList(m_processListWork);
+
+    auto reply = newPacket();
+    reply.putInt32(static_cast<int32_t>(m_processListWork.size()));
+    for (DWORD pid : m_processListWork) {
+        reply.putInt32(pid);
+    }
+    writePacket(reply);
+}
+
+void Agent::handleSubscribeProcessListPacket(ReadBuffer &packet)
+{
+    packet.assertEof();
+    if (m_processListEvent.get() == nullptr) {
+        m_processListEvent = OwnedHandle(
+            CreateEventW(nullptr, FALSE, FALSE, nullptr));
+        ASSERT(m_processListEvent.get() != nullptr);
+        readConsoleProcessList(m_processList);
+        std::sort(m_processList.begin(), m_processList.end());
+        m_lastProcessListTick = GetTickCount();
+    }
+    auto reply = newPacket();
+    reply.putInt64(int64FromHandle(duplicateHandle(m_processListEvent.get())));
+    writePacket(reply);
+}
+
+void Agent::handleSetVisibilityPacket(ReadBuffer &packet)
+{
+    const bool hidden = packet.getInt32() == 0;
+    packet.assertEof();
+    writePacket(newPacket());
+    if (hidden == m_hidden || m_pseudoConsole != nullptr) {
+        return;
+    }
+    trace("Session %s", hidden ? "hidden" : "visible");
+    m_hidden = hidden;
+    if (hidden) {
+        setPollInterval(kHiddenScrapeIntervalMs);
+    } else {
+        // Catch up at once, and resume the usual poll rate.
+        setPollIntervalRange(m_visibleMinPoll, m_visibleMaxPoll);
+        requestPoll();
+    }
+}
+
+// Switches CONOUT to frame-on-demand output.  The reply is the activity
+// event, which a pseudoconsole session doesn't have, because conhost does
+// the rendering.
+void Agent::handleEnableFrameOnDemandPacket(ReadBuffer &packet)
+{
+    packet.assertEof();
+    auto reply = newPacket();
+    if (m_pseudoConsole != nullptr) {
+        reply.putInt64(0);
+        writePacket(reply);
+        return;
+    }
+    if (m_frameActivityEvent.get() == nullptr) {
+        m_frameActivityEvent = OwnedHandle(
+            CreateEventW(nullptr, FALSE, FALSE, nullptr));
+        ASSERT(m_frameActivityEvent.get() != nullptr);
+        trace("Frame-on-demand output enabled");
+    }
+    m_frameOnDemand = true;
+    // The client's first request produces its first frame, so anything
+    // already waiting is reported at once.
+    m_frameActivitySignaled = false;
+    reply.putInt64(
+        int64FromHandle(duplicateHandle(m_frameActivityEvent.get())));
+    writePacket(reply);
+}
+
+void Agent::handleRequestFramePacket(ReadBuffer &packet)
+{
+    packet.assertEof();
+    writePacket(newPacket());
+    if (m_frameOnDemand) {
+        m_frameRequested = true;
+        requestPoll();
+    }
+}
+
+// Opens another CONOUT pipe that receives a copy of everything written to
+// CONOUT.  The terminal encodes each frame once, and the pipe queues the
+// bytes for every reader.  The new observer starts with a repaint of the
+// whole window, which the other readers see too.  The reply is the pipe's
+// name, or an empty string if observers aren't possible.
+void Agent::handleAttachOutputObserverPacket(ReadBuffer &packet)
+{
+    packet.assertEof();
+    auto reply = newPacket();
+    pruneOutputObservers();
+    if (m_pseudoConsole != nullptr || m_closingOutputPipes ||
+            m_conoutPipe->isClosed() ||
+            m_outputObservers.size() >= kMaxOutputObservers) {
+        reply.putWString(std::wstring());
+        writePacket(reply);
+        return;
+    }
+    NamedPipe &observer = createDataServerPipe(true, L"conout-observer");
+    m_conoutPipe->addMirror(observer);
+    m_outputObservers.push_back(&observer);
+    m_repaintRequested = true;
+    requestPoll();
+    trace("Attached a CONOUT observer (%d total)",
+          static_cast<int>(m_outputObservers.size()));
+    reply.putWString(observer.name());
+    writePacket(reply);
+}
+
+// Drops the observers that disconnected or fell too far behind.  A slow
+// observer never holds up CONOUT; it can attach again for a fresh repaint.
+void Agent::pruneOutputObservers()
+{
+    for (auto it = m_outputObservers.begin();
+            it != m_outputObservers.end();) {
+        NamedPipe &observer = **it;
+        if (!observer.isClosed() &&
+                observer.bytesToSend() > kMaxObserverBacklog) {
+            trace("Disconnecting a CONOUT observer that fell behind");
+            observer.closePipe();
+        }
+        if (observer.isClosed()) {
+            m_conoutPipe->removeMirror(observer);
+            it = m_outputObservers.erase(it);
+            deleteNamedPipe(observer);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Starts recording CONOUT to the named file, replacing any earlier
+// recording, or stops recording if the name is empty.  The reply is 0, or
+// the Windows error from creating the file.
+void Agent::handleSetOutputRecordingPacket(ReadBuffer &packet)
+{
+    const auto path = packet.getWString();
+    const int format = packet.getInt32();
+    packet.assertEof();
+    stopOutputRecording();
+    DWORD error = 0;
+    if (!path.empty()) {
+        if (format != WINPTY_RECORDING_ASCIICAST &&
+                format != WINPTY_RECORDING_BINARY) {
+            error = ERROR_INVALID_PARAMETER;
+        } else {
+            m_recorder = SessionRecorder::create(
+                path, format, m_ptyCols, m_ptyRows, error);
+        }
+        if (m_recorder != nullptr) {
+            m_conoutPipe->setRecorder(m_recorder.get());
+            trace("Recording CONOUT (format %d)", format);
+        } else {
+            trace("Could not start recording CONOUT: error %u",
+                  static_cast<unsigned int>(error));
+        }
+    }
+    auto reply = newPacket();
+    reply.putInt32(static_cast<int32_t>(error));
+    writePacket(reply);
+}
+
+// Detaches the recorder from CONOUT, then waits for it to write out what it
+// has buffered.
+void Agent::stopOutputRecording()
+{
+    if (m_recorder != nullptr) {
+        if (m_conoutPipe != nullptr) {
+            m_conoutPipe->setRecorder(nullptr);
+        }
+        m_recorder.reset();
+        trace("Stopped recording CONOUT");
+    }
+}
+
+void Agent::checkProcessListChanged()
+{
+    const DWORD now = GetTickCount();
+    if (now - m_lastProcessListTick < kProcessListPollIntervalMs) {
+        return;
+    }
+    m_lastProcessListTick = now;
+    readConsoleProcessList(m_processListWork);
+    std::sort(m_processListWork.begin(), m_processListWork.end());
+    if (m_processListWork != m_processList) {
+        m_processList.swap(m_processListWork);
+        SetEvent(m_processListEvent.get());
+    }
+}
+
+// The bytes moved on all the pipes so far.  Any change means the session
+// isn't idle.
+uint64_t Agent::pipeTraffic() const
+{
+    uint64_t traffic = 0;
+    for (NamedPipe *pipe : { m_controlPipe, m_coninPipe,
+                             m_conoutPipe, m_conerrPipe }) {
+        if (pipe != nullptr) {
+            traffic += pipe->bytesRead() + pipe->bytesWritten();
+        }
+    }
+    if (m_inputThread != nullptr) {
+        traffic += m_inputThread->bytesRead();
+    }
+    return traffic;
+}
+
+void Agent::checkIdleTrim()
+{
+    const uint64_t traffic = pipeTraffic();
+    const DWORD now = GetTickCount();
+    if (traffic != m_idleTrimTraffic) {
+        m_idleTrimTraffic = traffic;
+        m_idleTrimTick = now;
+        m_idleTrimmed = false;
+    } else if (!m_idleTrimmed && now - m_idleTrimTick >= kIdleTrimMs) {
+        releaseIdleMemory();
+        m_idleTrimmed = true;
+    }
+}
+
+// Terminal input leaves eco mode immediately (see restoreInputPriority).
+// Output leaves it at the next poll.
+void Agent::checkIdleEcoQos()
+{
+    const uint64_t traffic = pipeTraffic();
+    const DWORD now = GetTickCount();
+    if (traffic != m_ecoQosTraffic) {
+        m_ecoQosTraffic = traffic;
+        m_ecoQosTick = now;
+        setEcoQos(false);
+    } else if (now - m_ecoQosTick >= kIdleEcoQosMs) {
+        setEcoQos(true);
+    }
+}
+
+// In eco mode, the agent runs at below-normal priority, and opts into
+// execution-speed power throttling (EcoQoS), which lets the system run it
+// on efficient cores at low clock speeds.  Leaving it hands both decisions
+// back to the system.
+void Agent::setEcoQos(bool eco)
+{
+    if (eco == m_inEcoQos) {
+        return;
+    }
+    trace("%s idle eco mode", eco ? "Entering" : "Leaving");
+    SetPriorityClass(GetCurrentProcess(),
+                     eco ? BELOW_NORMAL_PRIORITY_CLASS
+                         : NORMAL_PRIORITY_CLASS);
+    const auto setProcessInformation =
+        reinterpret_cast<SetProcessInformation_t*>(
+            loadedModuleProc(L"kernel32.dll", "SetProcessInformation"));
+    if (setProcessInformation != nullptr) {
+        AGENT_PROCESS_POWER_THROTTLING_STATE state = {};
+        state.Version = AGENT_PROCESS_POWER_THROTTLING_CURRENT_VERSION;
+        state.ControlMask =
+            eco ? AGENT_PROCESS_POWER_THROTTLING_EXECUTION_SPEED : 0;
+        state.StateMask =
+            eco ? AGENT_PROCESS_POWER_THROTTLING_EXECUTION_SPEED : 0;
+        if (!setProcessInformation(GetCurrentProcess(),
+                                   AGENT_ProcessPowerThrottling,
+                                   &state, sizeof(state))) {
+            trace("SetProcessInformation(ProcessPowerThrottling) failed: "
+                  "error %u", static_cast<unsigned int>(GetLastError()));
+        }
+    }
+    m_inEcoQos = eco;
+}
+
+// Once per interval, decide whether the session is doing bulk output.  Input
+// ends a bulk phase immediately (see restoreInputPriority).
+void Agent::checkBulkOutput()
+{
+    const DWORD now = GetTickCount();
+    if (now - m_bulkCheckTick < kBulkCheckIntervalMs) {
+        return;
+    }
+    uint64_t output = m_conoutPipe->bytesWritten();
+    if (m_conerrPipe != nullptr) {
+        output += m_conerrPipe->bytesWritten();
+    }
+    const uint64_t input = coninBytesRead();
+    const bool bulk =
+        input == m_bulkCheckInput &&
+        output - m_bulkCheckOutput >= kBulkOutputBytes;
+    m_bulkCheckTick = now;
+    m_bulkCheckInput = input;
+    m_bulkCheckOutput = output;
+    setBulkPriority(bulk);
+}
+
+void Agent::setBulkPriority(bool bulk)
+{
+    if (bulk == m_inBulkPriority) {
+        return;
+    }
+    trace("%s bulk-output priority", bulk ? "Entering" : "Leaving");
+    SetThreadPriority(GetCurrentThread(),
+                      bulk ? THREAD_PRIORITY_BELOW_NORMAL
+                           : THREAD_PRIORITY_NORMAL);
+    m_inBulkPriority = bulk;
+}
+
+// Frees what the agent can rebuild on demand, then hands its unused pages
+// back to the system.  Everything released here is reallocated by the next
+// scrape or pipe transfer.
+void Agent::releaseIdleMemory()
+{
+    trace("Idle for %u ms; releasing buffers",
+          static_cast<unsigned int>(kIdleTrimMs));
+    for (Scraper *scraper : { m_primaryScraper.get(),
+                              m_errorScraper.get() }) {
+        if (scraper != nullptr) {
+            scraper->releaseScratchBuffers();
+        }
+    }
+    for (NamedPipe *pipe : { m_controlPipe, m_coninPipe,
+                             m_conoutPipe, m_conerrPipe }) {
+        if (pipe != nullptr) {
+            pipe->releaseIdleBuffers();
+        }
+    }
+    std::vector<char>().swap(m_packetData);
+    if (m_pendingReplies.empty()) {
+        std::string().swap(m_pendingReplies);
+    }
+    SetProcessWorkingSetSize(GetCurrentProcess(),
+                             static_cast<SIZE_T>(-1),
+                             static_cast<SIZE_T>(-1));
+}
+
+void Agent::handleGetStartupStatsPacket(ReadBuffer &packet)
+{
+    packet.assertEof();
+    auto reply = newPacket();
+    const int first = WINPTY_STARTUP_STAT_CONSOLE_SETUP;
+    reply.putInt32(first);
+    reply.putInt32(WINPTY_STARTUP_STAT_COUNT - first);
+    for (int i = first; i < WINPTY_STARTUP_STAT_COUNT; ++i) {
+        reply.putInt64(m_startupStatsUs[i]);
+    }
+    writePacket(reply);
+}
+
+void Agent::handleGetFreezeStatsPacket(ReadBuffer &packet)
+{
+    packet.assertEof();
+    auto reply = newPacket();
+    const int64_t *const stats = m_console.freezeStats();
+    reply.putInt32(WINPTY_FREEZE_STAT_COUNT);
+    for (int i = 0; i < WINPTY_FREEZE_STAT_COUNT; ++i) {
+        reply.putInt64(stats[i]);
+    }
+    writePacket(reply);
+}
 
+void Agent::handleGetTickStatsPacket(ReadBuffer &packet)
+{
+    packet.assertEof();
     auto reply = newPacket();
-    reply.putInt32(processCount);
-    for (DWORD i = 0; i < processCount; i++) {
-        reply.putInt32(processList[i]);
+    reply.putInt32(WINPTY_TICK_STAT_COUNT);
+    for (int i = 0; i < WINPTY_TICK_STAT_COUNT; ++i) {
+        reply.putInt64(m_tickStats[i]);
     }
     writePacket(reply);
 }
 
+void Agent::handleGetStatsPacket(ReadBuffer &packet)
+{
+    packet.assertEof();
+    dumpProfile("stats");
+    int64_t stats[WINPTY_STAT_COUNT] = {};
+    stats[WINPTY_STAT_UPTIME_US] = m_uptime.elapsedUs();
+    Scraper *const scrapers[] = {
+        m_primaryScraper.get(), m_errorScraper.get()
+    };
+    for (Scraper *scraper : scrapers) {
+        if (scraper != nullptr) {
+            stats[WINPTY_STAT_SCRAPES] += scraper->scrapeCount();
+            stats[WINPTY_STAT_LINES_SENT] += scraper->terminal().linesSent();
+            stats[WINPTY_STAT_SYNC_MARKER_RESETS] +=
+                scraper->syncMarkerResets();
+            stats[WINPTY_STAT_CONSOLE_RESETS] += scraper->consoleResets();
+            stats[WINPTY_STAT_CONTENT_RESYNCS] += scraper->contentResyncs();
+            stats[WINPTY_STAT_SKIPPED_LINES] += scraper->skippedLines();
+            stats[WINPTY_STAT_LINE_MEMORY_BYTES] +=
+                scraper->lineMemoryUsage();
+            stats[WINPTY_STAT_READ_BUFFER_MEMORY_BYTES] +=
+                scraper->readBufferMemoryUsage();
+        }
+    }
+    stats[WINPTY_STAT_CONOUT_BYTES] = m_conoutPipe->bytesWritten();
+    stats[WINPTY_STAT_CONOUT_QUEUED_BYTES] = m_conoutPipe->bytesToSend();
+    if (m_conerrPipe != nullptr) {
+        stats[WINPTY_STAT_CONERR_BYTES] = m_conerrPipe->bytesWritten();
+        stats[WINPTY_STAT_CONERR_QUEUED_BYTES] = m_conerrPipe->bytesToSend();
+    }
+    if (m_inputThread != nullptr) {
+        const InputThread::Stats inputStats = m_inputThread->stats();
+        stats[WINPTY_STAT_CONIN_BYTES] = inputStats.bytesRead;
+        stats[WINPTY_STAT_CONIN_QUEUED_BYTES] = inputStats.queuedBytes;
+        stats[WINPTY_STAT_INPUT_RECORDS] = inputStats.recordsWritten;
+        stats[WINPTY_STAT_INPUT_MAP_MEMORY_BYTES] = inputStats.inputMapMemory;
+        stats[WINPTY_STAT_PIPE_MEMORY_BYTES] = inputStats.pipeMemory;
+    } else {
+        stats[WINPTY_STAT_CONIN_BYTES] = m_coninPipe->bytesRead();
+        stats[WINPTY_STAT_CONIN_QUEUED_BYTES] =
+            m_coninPipe->bytesAvailable() + m_consoleInput->queuedByteCount();
+        stats[WINPTY_STAT_INPUT_RECORDS] =
+            m_consoleInput->inputRecordsWritten();
+        stats[WINPTY_STAT_INPUT_MAP_MEMORY_BYTES] =
+            m_consoleInput->inputMapMemoryUsage();
+    }
+    stats[WINPTY_STAT_FREEZE_US] =
+        m_console.freezeStats()[WINPTY_FREEZE_STAT_TOTAL_US];
+    for (NamedPipe *pipe : { m_controlPipe, m_coninPipe,
+                             m_conoutPipe, m_conerrPipe }) {
+        if (pipe != nullptr) {
+            stats[WINPTY_STAT_PIPE_MEMORY_BYTES] += pipe->memoryUsage();
+        }
+    }
+    for (NamedPipe *observer : m_outputObservers) {
+        stats[WINPTY_STAT_PIPE_MEMORY_BYTES] += observer->memoryUsage();
+    }
+    if (m_recorder != nullptr) {
+        stats[WINPTY_STAT_PIPE_MEMORY_BYTES] += m_recorder->memoryUsage();
+    }
+    stats[WINPTY_STAT_TRACE_MEMORY_BYTES] = traceMemoryUsage();
+    stats[WINPTY_STAT_HEAP_ALLOCATIONS] = heapAllocationCount();
+    stats[WINPTY_STAT_POLL_ALLOCATIONS] = m_pollAllocations;
+
+    auto reply = newPacket();
+    reply.putInt32(WINPTY_STAT_COUNT);
+    for (int i = 0; i < WINPTY_STAT_COUNT; ++i) {
+        reply.putInt64(stats[i]);
+    }
+    writePacket(reply);
+}
+
+// Reply with the primary buffer's window: its size, the cursor position
+// relative to it, and its cells in row-major order.
+void Agent::handleGetScreenSnapshotPacket(ReadBuffer &packet)
+{
+    packet.assertEof();
+    ConsoleScreenBufferInfo info;
+    bool cursorVisible = true;
+    LargeConsoleReadBuffer cells;
+    {
+        Win32Console::FreezeGuard guard(m_console, true);
+        m_primaryScraper->readWindowSnapshot(
+            primaryBuffer(), info, cursorVisible, cells);
+    }
+    const SmallRect window = info.windowRect();
+    const Coord cursor = info.cursorPosition();
+    const int cols = window.width();
+    const int rows = window.height();
+    const bool cursorInWindow = window.contains(cursor);
+
+    auto reply = newPacket();
+    reply.putInt32(cols);
+    reply.putInt32(rows);
+    reply.putInt32(cursor.X - window.Left);
+    reply.putInt32(cursor.Y - window.Top);
+    reply.putInt32(cursorVisible && cursorInWindow);
+    for (int y = window.Top; y <= window.Bottom; ++y) {
+        reply.putRawData(cells.lineData(y), cols * sizeof(CHAR_INFO));
+    }
+    writePacket(reply);
+}
+
+// Reply with the retained CONOUT output starting at the given byte offset:
+// a status (0 if the output is available, 1 if the journal no longer holds
+// it, 2 if there is no journal), the retained range's start and end offsets,
+// and the bytes.
+void Agent::handleGetOutputSincePacket(ReadBuffer &packet)
+{
+    const uint64_t offset = packet.getInt64();
+    const int maxSize = packet.getInt32();
+    packet.assertEof();
+    ASSERT(maxSize >= 0 && "Invalid GetOutputSince size");
+    std::string data;
+    bool retained = false;
+    uint64_t startOffset = 0;
+    uint64_t endOffset = 0;
+    if (m_outputJournal != nullptr) {
+        retained = m_outputJournal->readFrom(
+            offset, std::min(maxSize, kMaxOutputSinceReply), data);
+        startOffset = m_outputJournal->startOffset();
+        endOffset = m_outputJournal->endOffset();
+    }
+    auto reply = newPacket();
+    reply.putInt32(m_outputJournal == nullptr ? 2 : retained ? 0 : 1);
+    reply.putInt64(startOffset);
+    reply.putInt64(endOffset);
+    reply.putInt32(static_cast<int32_t>(data.size()));
+    reply.putRawData(data.data(), data.size());
+    writePacket(reply);
+}
+
+// Reply with the stored history lines starting at the given line: a status
+// (0 if there is a history store, 2 if there isn't), the number of lines in
+// the store, and the number of lines copied, each as its width and cells.
+// The reply stops before a line that would exceed the cell limit.
+void Agent::handleGetHistoryPacket(ReadBuffer &packet)
+{
+    const uint64_t firstLine = packet.getInt64();
+    const int maxLines = packet.getInt32();
+    const int maxCells = packet.getInt32();
+    packet.assertEof();
+    ASSERT(maxLines >= 0 && maxCells >= 0 && "Invalid GetHistory size");
+    std::vector<int> widths;
+    std::vector<CHAR_INFO> cells;
+    if (m_historyStore != nullptr) {
+        const size_t cellLimit = std::min(maxCells, kMaxHistoryReplyCells);
+        std::vector<CHAR_INFO> line;
+        while (static_cast<int>(widths.size()) < maxLines &&
+                m_historyStore->readLine(firstLine + widths.size(), line)) {
+            const size_t total = cells.size() + line.size();
+            if (total > static_cast<size_t>(maxCells) ||
+                    (!widths.empty() && total > cellLimit)) {
+                break;
+            }
+            widths.push_back(static_cast<int>(line.size()));
+            cells.insert(cells.end(), line.begin(), line.end());
+        }
+    }
+    auto reply = newPacket();
+    reply.putInt32(m_historyStore == nullptr ? 2 : 0);
+    reply.putInt64(m_historyStore == nullptr ? 0
+                                             : m_historyStore->lineCount());
+    reply.putInt32(static_cast<int32_t>(widths.size()));
+    size_t pos = 0;
+    for (int width : widths) {
+        reply.putInt32(width);
+        reply.putRawData(cells.data() + pos, width * sizeof(CHAR_INFO));
+        pos += width;
+    }
+    writePacket(reply);
+}
+
+// Reply with the history lines that match a query: a status (as for
+// GetHistory), the number of matches, and their line numbers.
+void Agent::handleSearchHistoryPacket(ReadBuffer &packet)
+{
+    const std::wstring query = packet.getWString();
+    const uint64_t fromLine = packet.getInt64();
+    const uint64_t flags = packet.getInt64();
+    const int maxResults = packet.getInt32();
+    packet.assertEof();
+    ASSERT(maxResults >= 0 && "Invalid SearchHistory count");
+    std::vector<uint64_t> lines;
+    if (m_historyStore != nullptr) {
+        m_historyStore->search(
+            query,
+            (flags & WINPTY_SEARCH_FLAG_IGNORE_CASE) != 0,
+            (flags & WINPTY_SEARCH_FLAG_BACKWARD) != 0,
+            fromLine,
+            std::min(maxResults, kMaxSearchResults),
+            lines);
+    }
+    auto reply = newPacket();
+    reply.putInt32(m_historyStore == nullptr ? 2 : 0);
+    reply.putInt32(static_cast<int32_t>(lines.size()));
+    for (uint64_t line : lines) {
+        reply.putInt64(line);
+    }
+    writePacket(reply);
+}
+
+void Agent::handleBatchPacket(ReadBuffer &packet)
+{
+    const int count = packet.getInt32();
+    ASSERT(count >= 0 && "Invalid batch packet count");
+    for (int i = 0; i < count; ++i) {
+        const uint64_t packetSize = packet.getRawValue<uint64_t>();
+        ASSERT(packetSize >= sizeof(packetSize) && packetSize <= SIZE_MAX);
+        const size_t innerSize = packetSize - sizeof(packetSize);
+        ReadBuffer innerPacket(packet.getRawSpan(innerSize), innerSize);
+        handlePacket(innerPacket);
+    }
+    packet.assertEof();
+}
+
+// The input is passed on a chunk at a time, straight out of the pipe's input
+// queue.
 void Agent::pollConinPipe()
 {
-    const std::string newData = m_coninPipe->readAllToString();
-    if (hasDebugFlag("input_separated_bytes")) {
-        // This debug flag is intended to help with testing incomplete escape
-        // sequences and multibyte UTF-8 encodings.  (I wonder if the normal
-        // code path ought to advance a state machine one byte at a time.)
-        for (size_t i = 0; i < newData.size(); ++i) {
-            m_consoleInput->writeInput(newData.substr(i, 1));
+    if (m_coninPipe->bytesAvailable() == 0) {
+        return;
+    }
+    restoreInputPriority();
+    PROFILE_ZONE("input.pipe");
+    const bool separateBytes = hasDebugFlag("input_separated_bytes");
+    size_t size = 0;
+    while (const char *data = m_coninPipe->peekFront(size)) {
+        if (m_pseudoConsole != nullptr) {
+            // The pseudoconsole decodes the terminal's input itself.
+            m_ptyInputPipe->write(data, size);
+        } else if (separateBytes) {
+            // This debug flag is intended to help with testing incomplete
+            // escape sequences and multibyte UTF-8 encodings.  (I wonder if
+            // the normal code path ought to advance a state machine one byte
+            // at a time.)
+            for (size_t i = 0; i < size; ++i) {
+                m_consoleInput->writeInput(data + i, 1);
+            }
+        } else {
+            m_consoleInput->writeInput(data, size);
         }
+        m_coninPipe->skip(size);
+    }
+    if (m_pseudoConsole == nullptr) {
+        scheduleEscapeFlush();
+        scheduleInputEchoScrapes();
+    }
+}
+
+// Input ends a bulk-output phase and idle eco mode.
+void Agent::restoreInputPriority()
+{
+    if (m_inBulkPriority) {
+        setBulkPriority(false);
+    }
+    if (m_inEcoQos) {
+        setEcoQos(false);
+    }
+}
+
+// Scrape soon, and then a few more times, to pick up the echo of the input.
+void Agent::scheduleInputEchoScrapes()
+{
+    notePollActivity();
+    m_inputEchoScrapes = 0;
+    requestPollIn(kInputEchoScrapeDelaysMs[0]);
+}
+
+// With WINPTY_FLAG_INPUT_THREAD, the input thread wakes this loop when it has
+// written input or its ConsoleInput needs a DSR.
+void Agent::onWake()
+{
+    if (m_inputThread == nullptr) {
+        return;
+    }
+    if (m_inputThread->takeDsrRequest()) {
+        sendDsr();
+    }
+    if (m_inputThread->takeInputDelivered()) {
+        restoreInputPriority();
+        scheduleInputEchoScrapes();
+    }
+}
+
+void Agent::setMouseWindowRect(const SmallRect &rect)
+{
+    if (m_inputThread != nullptr) {
+        m_inputThread->setMouseWindowRect(rect);
     } else {
-        m_consoleInput->writeInput(newData);
+        m_consoleInput->setMouseWindowRect(rect);
     }
 }
 
-void Agent::onPollTimeout()
+uint64_t Agent::coninBytesRead() const
 {
-    m_consoleInput->updateInputFlags();
-    const bool enableMouseMode = m_consoleInput->shouldActivateTerminalMouse();
+    return m_inputThread != nullptr ? m_inputThread->bytesRead()
+                                    : m_coninPipe->bytesRead();
+}
+
+// If the input ended with an incomplete escape sequence (e.g. pressing ESC),
+// arrange for the ConsoleInput object to flush it once it times out.
+void Agent::scheduleEscapeFlush()
+{
+    const int delayMs = m_consoleInput->incompleteEscapeDelay();
+    if (delayMs >= 0) {
+        setTimer(delayMs);
+    }
+}
 
-    // Give the ConsoleInput object a chance to flush input from an incomplete
-    // escape sequence (e.g. pressing ESC).
+void Agent::onTimer()
+{
     m_consoleInput->flushIncompleteEscapeCode();
+    scheduleEscapeFlush();
+}
 
-    const bool shouldScrapeContent = !m_closingOutputPipes;
+void Agent::onPollTimeout()
+{
+    EtwScope etwScope(kEtwPollTimeout);
+    PROFILE_ZONE("agent.poll");
+    const uintptr_t allocationsBefore = threadHeapAllocationCount();
+    m_tickStart = TimeMeasurement::ticks();
+    m_tickPhaseStart = m_tickStart;
+    std::fill(std::begin(m_tickPhaseUs), std::end(m_tickPhaseUs), 0);
+    applyPendingResize();
+    endTickPhase(WINPTY_TICK_PHASE_RESIZE);
+
+    if (m_processListEvent.get() != nullptr) {
+        checkProcessListChanged();
+        endTickPhase(WINPTY_TICK_PHASE_PROCESS_LIST);
+    }
+
+    if (m_pseudoConsole != nullptr) {
+        pollPseudoConsole();
+        endTickPhase(WINPTY_TICK_PHASE_SCRAPE);
+    } else {
+        pollScrapedConsole();
+        // Schedule the next of the scrapes that follow input, if any.  (This
+        // poll may not be the one requestPollIn asked for, but it scraped
+        // just as well.)
+        const int echoScrapeCount = static_cast<int>(
+            sizeof(kInputEchoScrapeDelaysMs) /
+                sizeof(kInputEchoScrapeDelaysMs[0]));
+        if (m_inputEchoScrapes < echoScrapeCount &&
+                ++m_inputEchoScrapes < echoScrapeCount) {
+            requestPollIn(kInputEchoScrapeDelaysMs[m_inputEchoScrapes] -
+                          kInputEchoScrapeDelaysMs[m_inputEchoScrapes - 1]);
+        }
+    }
+
+    autoClosePipesForShutdown();
+    endTickPhase(WINPTY_TICK_PHASE_SHUTDOWN);
+
+    if (m_idleTrim) {
+        checkIdleTrim();
+    }
+    if (m_bulkPriority) {
+        checkBulkOutput();
+    }
+    if (m_idleEcoQos) {
+        checkIdleEcoQos();
+    }
+    if (!m_outputObservers.empty()) {
+        pruneOutputObservers();
+    }
+    endTickPhase(WINPTY_TICK_PHASE_HOUSEKEEPING);
+
+    m_pollAllocations += threadHeapAllocationCount() - allocationsBefore;
+
+    const int64_t totalUs = ticksToUs(TimeMeasurement::ticks() - m_tickStart);
+    noteTickPhaseUs(WINPTY_TICK_PHASE_TOTAL, totalUs);
+    if (totalUs >= kSlowTickUs) {
+        const int64_t *const us = m_tickPhaseUs;
+        trace("slow poll tick: %lldus (resize=%lld processList=%lld "
+              "inputFlags=%lld childExit=%lld title=%lld scrape=%lld "
+              "mouseMode=%lld shutdown=%lld housekeeping=%lld)",
+              static_cast<long long>(totalUs),
+              static_cast<long long>(us[WINPTY_TICK_PHASE_RESIZE]),
+              static_cast<long long>(us[WINPTY_TICK_PHASE_PROCESS_LIST]),
+              static_cast<long long>(us[WINPTY_TICK_PHASE_INPUT_FLAGS]),
+              static_cast<long long>(us[WINPTY_TICK_PHASE_CHILD_EXIT]),
+              static_cast<long long>(us[WINPTY_TICK_PHASE_TITLE]),
+              static_cast<long long>(us[WINPTY_TICK_PHASE_SCRAPE]),
+              static_cast<long long>(us[WINPTY_TICK_PHASE_MOUSE_MODE]),
+              static_cast<long long>(us[WINPTY_TICK_PHASE_SHUTDOWN]),
+              static_cast<long long>(us[WINPTY_TICK_PHASE_HOUSEKEEPING]));
+    }
+}
 
-    // Check if the child process has exited.
+// Ends the current phase of a poll tick and starts the next.
+void Agent::endTickPhase(int phase)
+{
+    const uint64_t now = TimeMeasurement::ticks();
+    const int64_t us = ticksToUs(now - m_tickPhaseStart);
+    m_tickPhaseStart = now;
+    m_tickPhaseUs[phase] += us;
+    noteTickPhaseUs(phase, us);
+}
+
+void Agent::noteTickPhaseUs(int phase, int64_t us)
+{
+    int64_t *const stats = &m_tickStats[phase * WINPTY_TICK_STAT_FIELD_COUNT];
+    stats[WINPTY_TICK_STAT_RUNS]++;
+    stats[WINPTY_TICK_STAT_TOTAL_US] += us;
+    stats[WINPTY_TICK_STAT_MAX_US] =
+        std::max(stats[WINPTY_TICK_STAT_MAX_US], us);
+    const int bucket =
+        us < 100    ? WINPTY_TICK_STAT_UNDER_100US :
+        us < 1000   ? WINPTY_TICK_STAT_UNDER_1MS :
+        us < 10000  ? WINPTY_TICK_STAT_UNDER_10MS :
+        us < 100000 ? WINPTY_TICK_STAT_UNDER_100MS :
+                      WINPTY_TICK_STAT_OVER_100MS;
+    stats[bucket]++;
+}
+
+// Returns true if the child has exited since the last call (with
+// auto-shutdown enabled).
+bool Agent::checkChildExited()
+{
     if (m_autoShutdown &&
             m_childProcess != nullptr &&
             WaitForSingleObject(m_childProcess, 0) == WAIT_OBJECT_0) {
-        CloseHandle(m_childProcess);
-        m_childProcess = nullptr;
+        releaseChildProcess();
+        return true;
+    }
+    return false;
+}
 
+void Agent::pollScrapedConsole()
+{
+    // The console state shared by the input mode check and the scrapers.
+    ConsoleSnapshot snapshot(GetStdHandle(STD_INPUT_HANDLE));
+    bool enableMouseMode = false;
+    if (m_inputThread != nullptr) {
+        m_inputThread->setInputMode(snapshot.inputMode());
+        enableMouseMode = ConsoleInput::shouldActivateTerminalMouse(
+            m_mouseMode, snapshot.inputMode());
+    } else {
+        m_consoleInput->updateInputFlags(snapshot.inputMode());
+        enableMouseMode = m_consoleInput->shouldActivateTerminalMouse();
+    }
+    endTickPhase(WINPTY_TICK_PHASE_INPUT_FLAGS);
+
+    const bool shouldScrapeContent = !m_closingOutputPipes;
+
+    if (checkChildExited()) {
         // Close the data socket to signal to the client that the child
         // process has exited.  If there's any data left to send, send it
         // before closing the socket.
         m_closingOutputPipes = true;
     }
+    endTickPhase(WINPTY_TICK_PHASE_CHILD_EXIT);
 
     // Scrape for output *after* the above exit-check to ensure that we collect
     // the child process's final output.
     if (shouldScrapeContent) {
         syncConsoleTitle();
-        scrapeBuffers();
+        if (m_trueColor) {
+            syncConsolePalette();
+        }
+        endTickPhase(WINPTY_TICK_PHASE_TITLE);
+        scrapeBuffers(snapshot,
+                      m_closingOutputPipes || m_repaintRequested ||
+                          consoleMayHaveChanged());
+        if (m_closingOutputPipes) {
+            // This was the final scrape.
+            m_primaryScraper->terminal().finishLog();
+            if (m_errorScraper) {
+                m_errorScraper->terminal().finishLog();
+            }
+        }
+        endTickPhase(WINPTY_TICK_PHASE_SCRAPE);
     }
 
     // We must ensure that we disable mouse mode before closing the CONOUT
     // pipe, so update the mouse mode here.
     m_primaryScraper->terminal().enableMouseMode(
         enableMouseMode && !m_closingOutputPipes);
+    endTickPhase(WINPTY_TICK_PHASE_MOUSE_MODE);
+}
 
-    autoClosePipesForShutdown();
+// With a pseudoconsole, conhost does the rendering, so a poll tick only
+// watches for the child's exit.
+void Agent::pollPseudoConsole()
+{
+    forwardPseudoConsoleOutput();
+    if (checkChildExited()) {
+        m_ptyChildExited = true;
+        m_ptyOutputAtExit = m_ptyOutputPipe->bytesRead();
+    } else if (m_ptyChildExited && !m_closingOutputPipes) {
+        // Conhost may still be rendering the child's final output, so the
+        // pipes are closed once its output goes a tick without new bytes.
+        const uint64_t bytes = m_ptyOutputPipe->bytesRead();
+        if (bytes == m_ptyOutputAtExit) {
+            m_closingOutputPipes = true;
+        }
+        m_ptyOutputAtExit = bytes;
+    }
+}
+
+// Relays the pseudoconsole's VT output to CONOUT.  While the client isn't
+// keeping up, the bytes are left in the pseudoconsole pipe, whose reads stop
+// once its buffer fills, so conhost, and then the child, block instead of
+// the agent queuing without bound.
+void Agent::forwardPseudoConsoleOutput()
+{
+    if (m_conoutPipe->isClosed() ||
+            m_conoutPipe->bytesToSend() >= kOutputHighWaterMark) {
+        return;
+    }
+    const std::string data = m_ptyOutputPipe->readAllToString();
+    if (!data.empty()) {
+        m_conoutPipe->write(data.data(), data.size());
+    }
+}
+
+// Creates the pseudoconsole that WINPTY_FLAG_PSEUDOCONSOLE asks for.  On
+// failure, the agent keeps scraping its own console.
+void Agent::openPseudoConsole(COORD size)
+{
+    if (!PseudoConsole::isSupported()) {
+        trace("The pseudoconsole API is missing; scraping instead");
+        return;
+    }
+    NamedPipe &input = createDataServerPipe(true, L"pty-in");
+    NamedPipe &output = createDataServerPipe(false, L"pty-out");
+    // Conhost gets synchronous client ends of the pipes.
+    const auto openClient = [](const std::wstring &name, DWORD access) {
+        const HANDLE h = CreateFileW(
+            name.c_str(), access, 0, nullptr, OPEN_EXISTING,
+            SECURITY_SQOS_PRESENT | SECURITY_IDENTIFICATION, nullptr);
+        return OwnedHandle(h == INVALID_HANDLE_VALUE ? nullptr : h);
+    };
+    OwnedHandle inputClient = openClient(input.name(), GENERIC_READ);
+    OwnedHandle outputClient = openClient(output.name(), GENERIC_WRITE);
+    if (inputClient.get() != nullptr && outputClient.get() != nullptr) {
+        m_pseudoConsole = PseudoConsole::create(
+            size, inputClient.get(), outputClient.get());
+    }
+    if (m_pseudoConsole == nullptr) {
+        trace("Could not create a pseudoconsole; scraping instead");
+        input.closePipe();
+        output.closePipe();
+        return;
+    }
+    trace("Using a pseudoconsole");
+    m_ptyInputPipe = &input;
+    m_ptyOutputPipe = &output;
+}
+
+// Closes the pseudoconsole.  Its pipes are closed first, since
+// ClosePseudoConsole may otherwise wait for conhost to write output that
+// nothing is reading.
+void Agent::closePseudoConsole()
+{
+    if (m_pseudoConsole == nullptr) {
+        return;
+    }
+    m_ptyInputPipe->closePipe();
+    m_ptyOutputPipe->closePipe();
+    m_pseudoConsole.reset();
 }
 
 void Agent::autoClosePipesForShutdown()
 {
     if (m_closingOutputPipes) {
+        if (m_fastShutdown) {
+            // Write the final output now rather than across poll ticks.  If a
+            // flush times out, the pipe is closed once it drains, as usual.
+            if (m_conoutPipe->isConnected()) {
+                m_conoutPipe->flushOutput(kFastShutdownFlushMs);
+            }
+            if (m_conerrPipe != nullptr && m_conerrPipe->isConnected()) {
+                m_conerrPipe->flushOutput(kFastShutdownFlushMs);
+            }
+        }
         // We don't want to close a pipe before it's connected!  If we do, the
         // libwinpty client may try to connect to a non-existent pipe.  This
         // case is important for short-lived programs.
@@ -528,6 +2026,11 @@ void Agent::autoClosePipesForShutdown()
             trace("Closing CONERR pipe (auto-shutdown)");
             m_conerrPipe->closePipe();
         }
+        for (NamedPipe *observer : m_outputObservers) {
+            if (observer->isConnected() && observer->bytesToSend() == 0) {
+                observer->closePipe();
+            }
+        }
         if (m_exitAfterShutdown &&
                 m_conoutPipe->isClosed() &&
                 (m_conerrPipe == nullptr || m_conerrPipe->isClosed())) {
@@ -544,10 +2047,45 @@ std::unique_ptr<Win32ConsoleBuffer> Agent::openPrimaryBuffer()
     // buffer twice.  That probably shouldn't happen in ordinary use, but it
     // can be avoided anyway by using the original console screen buffer in
     // that mode.
+    auto ret = m_useConerr
+        ? Win32ConsoleBuffer::openStdout()
+        : Win32ConsoleBuffer::openConout();
+    ret->setTrace(m_consoleTrace.get());
+    return ret;
+}
+
+// Returns the active screen buffer, reusing the handle from a previous call
+// unless the active buffer may have changed since.  A CONOUT$ handle keeps
+// referring to the buffer that was active when it was opened, so after a
+// program calls SetConsoleActiveScreenBuffer (see misc/ChangeScreenBuffer.cc),
+// the handle must be reopened to follow it.
+Win32ConsoleBuffer &Agent::primaryBuffer()
+{
+    const DWORD now = GetTickCount();
+    bool reopen = m_primaryBuffer == nullptr;
     if (!m_useConerr) {
-        return Win32ConsoleBuffer::openConout();
-    } else {
-        return Win32ConsoleBuffer::openStdout();
+        // The stdout handle always names the original buffer, so it never
+        // needs reopening.
+        reopen = reopen ||
+            m_consoleEventHook == nullptr ||
+            m_consoleEventHook->layoutChanged() ||
+            now - m_primaryBufferTick >= kPrimaryBufferRefreshMs;
+    }
+    if (reopen) {
+        if (m_consoleEventHook != nullptr) {
+            m_consoleEventHook->clearLayoutChanged();
+        }
+        m_primaryBuffer = openPrimaryBuffer();
+        m_primaryBufferTick = now;
+    }
+    return *m_primaryBuffer;
+}
+
+void Agent::applyPendingResize()
+{
+    if (m_pendingResize) {
+        m_pendingResize = false;
+        resizeWindow(m_pendingResizeCols, m_pendingResizeRows);
     }
 }
 
@@ -555,17 +2093,29 @@ void Agent::resizeWindow(int cols, int rows)
 {
     ASSERT(cols >= 1 && rows >= 1);
     cols = std::min(cols, MAX_CONSOLE_WIDTH);
-    rows = std::min(rows, MAX_CONSOLE_HEIGHT);
+    rows = std::min(rows, maxConsoleHeight(m_scraperSettings.bufferLineCount));
+    TRACE_CAT(kTraceResize, "resizeWindow: cols=%d rows=%d", cols, rows);
+    if (m_recorder != nullptr) {
+        m_recorder->recordResize(cols, rows);
+    }
+
+    if (m_pseudoConsole != nullptr) {
+        // Conhost resizes its buffer and repaints the terminal itself.
+        COORD size = { static_cast<SHORT>(cols), static_cast<SHORT>(rows) };
+        m_pseudoConsole->resize(size);
+        return;
+    }
 
     Win32Console::FreezeGuard guard(m_console, m_console.frozen());
     const Coord newSize(cols, rows);
     ConsoleScreenBufferInfo info;
-    auto primaryBuffer = openPrimaryBuffer();
-    m_primaryScraper->resizeWindow(*primaryBuffer, newSize, info);
-    m_consoleInput->setMouseWindowRect(info.windowRect());
+    m_primaryScraper->resizeWindow(primaryBuffer(), newSize, info);
+    setMouseWindowRect(info.windowRect());
     if (m_errorScraper) {
         m_errorScraper->resizeWindow(*m_errorBuffer, newSize, info);
     }
+    m_ptyCols = cols;
+    m_ptyRows = rows;
 
     // Synthesize a WINDOW_BUFFER_SIZE_EVENT event.  Normally, Windows
     // generates this event only when the buffer size changes, not when the
@@ -582,31 +2132,270 @@ void Agent::resizeWindow(int cols, int rows)
     // harmless.  See https://github.com/rprichard/winpty/issues/110.
     INPUT_RECORD sizeEvent {};
     sizeEvent.EventType = WINDOW_BUFFER_SIZE_EVENT;
-    sizeEvent.Event.WindowBufferSizeEvent.dwSize = primaryBuffer->bufferSize();
+    sizeEvent.Event.WindowBufferSizeEvent.dwSize =
+        primaryBuffer().bufferSize();
     DWORD actual {};
     WriteConsoleInputW(GetStdHandle(STD_INPUT_HANDLE), &sizeEvent, 1, &actual);
 }
 
-void Agent::scrapeBuffers()
+bool Agent::consoleMayHaveChanged()
 {
-    Win32Console::FreezeGuard guard(m_console, m_console.frozen());
-    ConsoleScreenBufferInfo info;
-    m_primaryScraper->scrapeBuffer(*openPrimaryBuffer(), info);
-    m_consoleInput->setMouseWindowRect(info.windowRect());
-    if (m_errorScraper) {
-        m_errorScraper->scrapeBuffer(*m_errorBuffer, info);
+    if (m_consoleEventHook == nullptr || m_consoleEventHook->dirty()) {
+        return true;
+    }
+    return GetTickCount() - m_lastScrapeTick >= kEventScrapeFallbackMs;
+}
+
+bool Agent::isOutputBackedUp(NamedPipe &pipe, bool &backedUp)
+{
+    // Never hold back the final output once the child has exited.
+    const bool ret = !m_closingOutputPipes &&
+        pipe.bytesToSend() >= kOutputHighWaterMark;
+    if (ret != backedUp) {
+        trace("%s pipe %s", utf8FromWide(pipe.name()).c_str(),
+            ret ? "backed up; pausing scrapes" : "drained; resuming scrapes");
+        backedUp = ret;
+    }
+    return ret;
+}
+
+// The console only raises WinEvents for the active screen buffer, so the
+// CONERR buffer is scraped on every poll regardless of scrapePrimary.
+void Agent::scrapeBuffers(ConsoleSnapshot &snapshot, bool scrapePrimary)
+{
+    if (m_hidden && !m_closingOutputPipes && !m_repaintRequested &&
+            !hiddenScrapeDue()) {
+        // The event hook's dirty state is kept for the catch-up scrape.
+        return;
+    }
+    if (m_frameOnDemand && holdFrameUntilRequested(scrapePrimary)) {
+        return;
+    }
+    if (isOutputBackedUp(*m_conoutPipe, m_conoutBackedUp)) {
+        // Leave the event hook's dirty state alone so that the catch-up
+        // scrape isn't mistaken for an idle poll.
+        scrapePrimary = false;
+    }
+    const bool scrapeError = m_useConerr &&
+        !isOutputBackedUp(*m_conerrPipe, m_conerrBackedUp) &&
+        (m_closingOutputPipes || errorBufferMayHaveChanged()) &&
+        ensureErrorScraper();
+    if (m_conoutBackedUp || m_conerrBackedUp) {
+        // Keep polling at the fast rate so that the catch-up frame goes out
+        // promptly once the pipe drains.
+        notePollActivity();
+    }
+    if (!scrapePrimary && !scrapeError) {
+        return;
+    }
+    if (scrapePrimary && m_repaintRequested) {
+        // A new output observer has seen nothing yet, so send it everything
+        // a terminal needs, by way of every CONOUT reader.
+        m_repaintRequested = false;
+        m_primaryScraper->requestRepaint();
+        if (!m_currentTitle.empty()) {
+            m_primaryScraper->terminal().sendTitle(m_currentTitle);
+        }
+    }
+    // Unless this is a fallback scrape, the event hook knows which cells
+    // changed.  Take its changes before reading the buffer, so that a change
+    // made while the scrape runs keeps the hook dirty for the next one.
+    ChangedRegion changed;
+    if (scrapePrimary && m_consoleEventHook != nullptr) {
+        const ConsoleChangeTracker::Changes changes =
+            m_consoleEventHook->takeChanges();
+        if (changes.dirty) {
+            changed.top = changes.firstRow;
+            changed.bottom = changes.lastRow;
+            changed.left = changes.firstColumn;
+            changed.right = changes.lastColumn;
+        }
+    }
+    TimeMeasurement scrapeTime;
+    {
+        Win32Console::FreezeGuard guard(m_console, m_console.frozen());
+        ConsoleScreenBufferInfo info;
+        bool sawOutput = false;
+        if (scrapePrimary) {
+            if (m_consoleTrace != nullptr) {
+                m_consoleTrace->recordScrape(changed);
+            }
+            sawOutput = m_primaryScraper->scrapeBuffer(
+                primaryBuffer(), snapshot, info, changed);
+            setMouseWindowRect(info.windowRect());
+        }
+        if (scrapeError) {
+            sawOutput |= m_errorScraper->scrapeBuffer(
+                *m_errorBuffer, snapshot, info);
+            m_errorBufferInfo = info;
+            m_errorScrapeTick = GetTickCount();
+        }
+        if (sawOutput) {
+            notePollActivity();
+        }
+    }
+    if (scrapePrimary &&
+            m_startupStatsUs[WINPTY_STARTUP_STAT_FIRST_SCRAPE] < 0) {
+        m_startupStatsUs[WINPTY_STARTUP_STAT_FIRST_SCRAPE] =
+            scrapeTime.elapsedUs();
+    }
+    if (scrapePrimary) {
+        m_lastScrapeTick = GetTickCount();
+    }
+}
+
+// A hidden session's scrolling-mode console is scraped at a low rate, so
+// that its lines still reach the terminal before they scroll out of the
+// console buffer.  A full-screen program's window is just redrawn once the
+// session is visible again, so it isn't scraped at all.
+bool Agent::hiddenScrapeDue()
+{
+    return !m_primaryScraper->directMode() &&
+        GetTickCount() - m_lastScrapeTick >= kHiddenScrapeIntervalMs;
+}
+
+// With frame-on-demand output, a poll scrapes only to answer the client's
+// request for a frame.  Otherwise, a change to the console signals the
+// activity event, once until the next frame goes out, and the event hook's
+// dirty state is kept for that frame.  The final scrape and an observer's
+// repaint don't wait, and neither does a scrolling-mode console's slow
+// scrape, which keeps lines from scrolling out of the console buffer before
+// a client that has stopped asking gets them.
+bool Agent::holdFrameUntilRequested(bool scrapePrimary)
+{
+    if (m_frameRequested || m_closingOutputPipes || m_repaintRequested ||
+            hiddenScrapeDue()) {
+        m_frameRequested = false;
+        m_frameActivitySignaled = false;
+        return false;
+    }
+    if (scrapePrimary && !m_frameActivitySignaled) {
+        m_frameActivitySignaled = true;
+        SetEvent(m_frameActivityEvent.get());
+    }
+    return true;
+}
+
+// Returns false if the CONERR buffer looks untouched since its last scrape.
+// Whichever scraper runs first under the scrape's freeze keeps the console
+// frozen, so the error buffer is read under the same freeze as the primary.
+bool Agent::errorBufferMayHaveChanged()
+{
+    if (GetTickCount() - m_errorScrapeTick >= kErrorBufferRescrapeMs) {
+        return true;
+    }
+    const ConsoleScreenBufferInfo info = m_errorBuffer->bufferInfo();
+    return memcmp(&info, &m_errorBufferInfo, sizeof(m_errorBufferInfo)) != 0;
+}
+
+// Creates the error scraper once the CONERR buffer shows output, and returns
+// false while it's still untouched.  A change of the buffer's info counts as
+// output.  Otherwise, the cursor's row is read for output that a carriage
+// return left in place, at most every kErrorBufferRescrapeMs (see
+// errorBufferMayHaveChanged).
+bool Agent::ensureErrorScraper()
+{
+    if (m_errorScraper != nullptr) {
+        return true;
+    }
+    const ConsoleScreenBufferInfo info = m_errorBuffer->bufferInfo();
+    if (memcmp(&info, &m_errorBufferInfo, sizeof(m_errorBufferInfo)) == 0) {
+        const SmallRect row(0, info.cursorPosition().Y,
+                            std::min<int>(info.bufferSize().X,
+                                          MAX_CONSOLE_WIDTH), 1);
+        m_errorProbeLine.resize(row.width());
+        if (!m_errorBuffer->read(row, m_errorProbeLine.data()) ||
+                charInfoLineBlank(m_errorProbeLine.data(), row.width(),
+                                  ConsoleBuffer::kDefaultAttributes)) {
+            m_errorScrapeTick = GetTickCount();
+            return false;
+        }
+    }
+
+    trace("CONERR buffer has output; creating its scraper");
+    std::vector<CHAR_INFO>().swap(m_errorProbeLine);
+    m_errorScraper =
+        createScraper(*m_errorBuffer, *m_conerrPipe, /*initBuffer=*/false);
+    if (m_trueColor) {
+        COLORREF colorTable[16];
+        if (m_errorBuffer->readColorTable(colorTable)) {
+            m_errorScraper->terminal().setPalette(colorTable);
+        }
+    }
+    // The buffer still has its initial size, so apply any resize since.
+    if (m_ptyCols != m_scraperSettings.initialCols ||
+            m_ptyRows != m_scraperSettings.initialRows) {
+        Win32Console::FreezeGuard guard(m_console, m_console.frozen());
+        ConsoleScreenBufferInfo resizedInfo;
+        m_errorScraper->resizeWindow(
+            *m_errorBuffer, Coord(m_ptyCols, m_ptyRows), resizedInfo);
+    }
+    return true;
+}
+
+std::unique_ptr<Scraper> Agent::createScraper(ConsoleBuffer &buffer,
+                                              NamedPipe &pipe,
+                                              bool initBuffer)
+{
+    const ScraperSettings &settings = m_scraperSettings;
+    std::unique_ptr<Terminal> terminal(new Terminal(pipe,
+                                                    m_plainMode,
+                                                    settings.outputColor,
+                                                    settings.synchronizedOutput,
+                                                    m_cellStream));
+    std::unique_ptr<Scraper> scraper(
+        new Scraper(m_console,
+                    buffer,
+                    std::move(terminal),
+                    Coord(settings.initialCols, settings.initialRows),
+                    settings.bufferLineCount,
+                    settings.legacyTentativeScrape,
+                    settings.fingerprintScroll,
+                    settings.terminalReflow,
+                    initBuffer));
+    scraper->setScrollbackBudget(settings.scrollbackBudget);
+    scraper->setTextOnlyReads(!settings.outputColor);
+    scraper->setTrimWideReads(settings.trimWideReads);
+    scraper->terminal().setRepeatCompression(settings.repeatCompression);
+    scraper->terminal().setLogMode(m_logOutput);
+    return scraper;
+}
+
+// Hands each screen buffer's palette to its terminal, which ignores an
+// unchanged palette.
+void Agent::syncConsolePalette()
+{
+    const DWORD now = GetTickCount();
+    if (now - m_lastPaletteTick < kPalettePollIntervalMs) {
+        return;
+    }
+    m_lastPaletteTick = now;
+    COLORREF colorTable[16];
+    if (primaryBuffer().readColorTable(colorTable)) {
+        m_primaryScraper->terminal().setPalette(colorTable);
+    }
+    if (m_errorScraper && m_errorBuffer->readColorTable(colorTable)) {
+        m_errorScraper->terminal().setPalette(colorTable);
     }
 }
 
 void Agent::syncConsoleTitle()
 {
-    std::wstring newTitle = m_console.title();
-    if (newTitle != m_currentTitle) {
-        if (!m_plainMode && !m_conoutPipe->isClosed()) {
-            std::string command = std::string("\x1b]0;") +
-                    utf8FromWide(newTitle) + "\x07";
-            m_conoutPipe->write(command.c_str());
+    if (m_consoleEventHook != nullptr && m_consoleEventHook->isTitleHooked()) {
+        if (!m_consoleEventHook->titleChanged()) {
+            return;
+        }
+        m_consoleEventHook->clearTitleChanged();
+    } else {
+        const DWORD now = GetTickCount();
+        if (now - m_lastTitleTick < kTitlePollIntervalMs) {
+            return;
+        }
+        m_lastTitleTick = now;
+    }
+    if (m_console.updateTitle(m_currentTitle)) {
+        if (!m_conoutPipe->isClosed()) {
+            m_primaryScraper->terminal().sendTitle(m_currentTitle);
         }
-        m_currentTitle = newTitle;
     }
 }
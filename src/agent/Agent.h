@@ -22,36 +22,63 @@
 #define AGENT_H
 
 #include <windows.h>
+#include <limits.h>
 #include <stdint.h>
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "../include/winpty_constants.h"
+#include "../shared/OwnedHandle.h"
+#include "../shared/TimeMeasurement.h"
+
+#include "ConsoleEventHook.h"
 #include "DsrSender.h"
 #include "EventLoop.h"
 #include "Win32Console.h"
 
+class ConsoleBuffer;
 class ConsoleInput;
+class ConsoleSnapshot;
+class ConsoleTrace;
+class HistoryStore;
+class InputThread;
 class NamedPipe;
+class OutputJournal;
+class PseudoConsole;
 class ReadBuffer;
 class Scraper;
+class SessionRecorder;
+struct SmallRect;
 class WriteBuffer;
 class Win32ConsoleBuffer;
 
-class Agent : public EventLoop, public DsrSender
+class Agent : public EventLoop, public DsrSender, public ConsoleChangeListener
 {
 public:
     Agent(LPCWSTR controlPipeName,
           uint64_t agentFlags,
           int mouseMode,
           int initialCols,
-          int initialRows);
+          int initialRows,
+          int minPollInterval,
+          int maxPollInterval,
+          int bufferLineCount,
+          int escapeTimeout,
+          int pipeOutBufferSize,
+          int pipeInBufferSize,
+          int pipeIoSize,
+          int scrollbackBudget,
+          uint64_t hostCaps);
     virtual ~Agent();
     void sendDsr() override;
+    void onConsoleChanged() override;
 
 private:
     NamedPipe &connectToControlPipe(LPCWSTR pipeName);
     NamedPipe &createDataServerPipe(bool write, const wchar_t *kind);
+    void openDataServerPipe(NamedPipe &pipe, bool write, const wchar_t *kind);
 
 private:
     void pollControlPipe();
@@ -60,36 +87,224 @@ private:
     void handleStartProcessPacket(ReadBuffer &packet);
     void handleSetSizePacket(ReadBuffer &packet);
     void handleGetConsoleProcessListPacket(ReadBuffer &packet);
+    void handleGetStartupStatsPacket(ReadBuffer &packet);
+    void handleGetFreezeStatsPacket(ReadBuffer &packet);
+    void handleGetTickStatsPacket(ReadBuffer &packet);
+    void handleGetStatsPacket(ReadBuffer &packet);
+    void handleGetScreenSnapshotPacket(ReadBuffer &packet);
+    void handleGetOutputSincePacket(ReadBuffer &packet);
+    void handleGetHistoryPacket(ReadBuffer &packet);
+    void handleSearchHistoryPacket(ReadBuffer &packet);
+    void handleSubscribeProcessListPacket(ReadBuffer &packet);
+    void handleSetVisibilityPacket(ReadBuffer &packet);
+    void handleAttachOutputObserverPacket(ReadBuffer &packet);
+    void pruneOutputObservers();
+    void handleSetOutputRecordingPacket(ReadBuffer &packet);
+    void handleEnableFrameOnDemandPacket(ReadBuffer &packet);
+    void handleRequestFramePacket(ReadBuffer &packet);
+    void stopOutputRecording();
+    void releaseChildProcess();
+    bool addToChildJob(HANDLE process);
+    void terminateChildJob();
+    void clearConsoleForSpawn();
+    void handleBatchPacket(ReadBuffer &packet);
     void pollConinPipe();
+    void restoreInputPriority();
+    void scheduleInputEchoScrapes();
+    void scheduleEscapeFlush();
+    void setMouseWindowRect(const SmallRect &rect);
+    uint64_t coninBytesRead() const;
 
 protected:
     virtual void onPollTimeout() override;
+    virtual void onTimer() override;
     virtual void onPipeIo(NamedPipe &namedPipe) override;
+    virtual void onWake() override;
 
 private:
     void autoClosePipesForShutdown();
+    bool checkChildExited();
+    void endTickPhase(int phase);
+    void noteTickPhaseUs(int phase, int64_t us);
+    void pollScrapedConsole();
+    void pollPseudoConsole();
+    void forwardPseudoConsoleOutput();
+    void openPseudoConsole(COORD size);
+    void closePseudoConsole();
     std::unique_ptr<Win32ConsoleBuffer> openPrimaryBuffer();
+    Win32ConsoleBuffer &primaryBuffer();
+    void applyPendingResize();
     void resizeWindow(int cols, int rows);
-    void scrapeBuffers();
+    bool consoleMayHaveChanged();
+    bool isOutputBackedUp(NamedPipe &pipe, bool &backedUp);
+    void scrapeBuffers(ConsoleSnapshot &snapshot, bool scrapePrimary);
+    bool errorBufferMayHaveChanged();
+    bool hiddenScrapeDue();
+    bool holdFrameUntilRequested(bool scrapePrimary);
+    bool ensureErrorScraper();
+    std::unique_ptr<Scraper> createScraper(ConsoleBuffer &buffer,
+                                           NamedPipe &pipe,
+                                           bool initBuffer);
     void syncConsoleTitle();
+    void syncConsolePalette();
+    void readConsoleProcessList(std::vector<DWORD> &list);
+    void checkProcessListChanged();
+    uint64_t pipeTraffic() const;
+    void checkIdleTrim();
+    void releaseIdleMemory();
+    void checkBulkOutput();
+    void setBulkPriority(bool bulk);
+    void checkIdleEcoQos();
+    void setEcoQos(bool eco);
 
 private:
     const bool m_useConerr;
     const bool m_plainMode;
+    const bool m_logOutput;
+    const bool m_cellStream;
+    const bool m_idleTrim;
+    const bool m_bulkPriority;
+    const bool m_idleEcoQos;
+    const bool m_trueColor;
     const int m_mouseMode;
+    const int m_pipeOutBufferSize;
+    const int m_pipeInBufferSize;
+    const int m_pipeIoSize;
+    int m_visibleMinPoll = 0;
+    int m_visibleMaxPoll = 0;
+    // Whether the client has hidden the session (see winpty_set_visibility).
+    bool m_hidden = false;
+    // Frame-on-demand output (see winpty_frame_activity_event).  Between
+    // requests, a poll that sees a change only signals m_frameActivityEvent,
+    // once per frame.
+    bool m_frameOnDemand = false;
+    bool m_frameRequested = false;
+    bool m_frameActivitySignaled = false;
+    OwnedHandle m_frameActivityEvent;
     Win32Console m_console;
+    // With the "console_trace" debug flag, what the primary scraper reads.
+    std::unique_ptr<ConsoleTrace> m_consoleTrace;
+    // What each Scraper is created with.
+    struct ScraperSettings {
+        int initialCols = 0;
+        int initialRows = 0;
+        int bufferLineCount = 0;
+        int scrollbackBudget = 0;
+        bool outputColor = false;
+        bool synchronizedOutput = false;
+        bool repeatCompression = false;
+        bool legacyTentativeScrape = false;
+        bool fingerprintScroll = false;
+        bool terminalReflow = false;
+        bool trimWideReads = false;
+    };
+    ScraperSettings m_scraperSettings;
     std::unique_ptr<Scraper> m_primaryScraper;
+    // With WINPTY_FLAG_CONERR, this is null until the error buffer shows
+    // output (see ensureErrorScraper), and m_errorProbeLine holds the row
+    // read to look for it.
     std::unique_ptr<Scraper> m_errorScraper;
+    std::vector<CHAR_INFO> m_errorProbeLine;
     std::unique_ptr<Win32ConsoleBuffer> m_errorBuffer;
+    // The cached handle to the active screen buffer (see primaryBuffer), and
+    // when it was opened.
+    std::unique_ptr<Win32ConsoleBuffer> m_primaryBuffer;
+    DWORD m_primaryBufferTick = 0;
     NamedPipe *m_controlPipe = nullptr;
     NamedPipe *m_coninPipe = nullptr;
     NamedPipe *m_conoutPipe = nullptr;
     NamedPipe *m_conerrPipe = nullptr;
+    std::unique_ptr<OutputJournal> m_outputJournal;
+    // Extra CONOUT pipes that mirror m_conoutPipe (see
+    // winpty_attach_output_observer).  m_repaintRequested is set until the
+    // primary scraper has been asked to repaint for a new observer.
+    std::vector<NamedPipe*> m_outputObservers;
+    bool m_repaintRequested = false;
+    // Set while CONOUT is recorded to a file (see
+    // winpty_set_output_recording).
+    std::unique_ptr<SessionRecorder> m_recorder;
+    std::unique_ptr<HistoryStore> m_historyStore;
     bool m_autoShutdown = false;
     bool m_exitAfterShutdown = false;
+    bool m_fastShutdown = false;
     bool m_closingOutputPipes = false;
+    // While pollControlPipe handles the packets it has received, replies
+    // collect here, so they reach the control pipe in a single write.
+    bool m_deferringReplies = false;
+    std::string m_pendingReplies;
+    std::vector<char> m_packetData;
     std::unique_ptr<ConsoleInput> m_consoleInput;
+    // With WINPTY_FLAG_INPUT_THREAD, this thread owns the CONIN pipe and the
+    // ConsoleInput instead, and m_coninPipe and m_consoleInput are null.
+    std::unique_ptr<InputThread> m_inputThread;
     HANDLE m_childProcess = nullptr;
+    // With WINPTY_SPAWN_FLAG_KILL_TREE, the job holding the children's
+    // process trees.  It's created by the first such spawn.
+    OwnedHandle m_childJob;
+    std::unique_ptr<ConsoleEventHook> m_consoleEventHook;
+    DWORD m_lastScrapeTick = 0;
+    // The number of post-input echo scrapes done since the last input.
+    int m_inputEchoScrapes = INT_MAX;
+    DWORD m_lastTitleTick = 0;
+    DWORD m_lastPaletteTick = 0;
+    // With a process list subscription, the list is checked on the poll
+    // timer, and m_processListEvent is signaled when it changes.
+    OwnedHandle m_processListEvent;
+    std::vector<DWORD> m_processList;
+    std::vector<DWORD> m_processListWork;
+    DWORD m_lastProcessListTick = 0;
+    // WINPTY_FLAG_IDLE_TRIM state: the pipe byte total at the last poll that
+    // saw traffic, and whether memory was released since then.
+    uint64_t m_idleTrimTraffic = 0;
+    DWORD m_idleTrimTick = 0;
+    bool m_idleTrimmed = false;
+    // WINPTY_FLAG_BULK_PRIORITY state: the pipe totals at the last check, and
+    // whether the thread priority is currently lowered.
+    DWORD m_bulkCheckTick = 0;
+    uint64_t m_bulkCheckInput = 0;
+    uint64_t m_bulkCheckOutput = 0;
+    bool m_inBulkPriority = false;
+    // WINPTY_FLAG_IDLE_ECO_QOS state, tracked like the idle-trim state.
+    uint64_t m_ecoQosTraffic = 0;
+    DWORD m_ecoQosTick = 0;
+    bool m_inEcoQos = false;
+    // With WINPTY_FLAG_PSEUDOCONSOLE on a host that supports it, the child
+    // runs in this pseudoconsole, and its pipes replace the scraper and
+    // ConsoleInput.  m_ptyOutputAtExit is the pseudoconsole output read as of
+    // the previous tick after the child exited.
+    std::unique_ptr<PseudoConsole> m_pseudoConsole;
+    NamedPipe *m_ptyInputPipe = nullptr;
+    NamedPipe *m_ptyOutputPipe = nullptr;
+    bool m_ptyChildExited = false;
+    uint64_t m_ptyOutputAtExit = 0;
+    bool m_conoutBackedUp = false;
+    bool m_conerrBackedUp = false;
+    // The CONERR buffer's info after its last scrape, and when that was.
+    CONSOLE_SCREEN_BUFFER_INFO m_errorBufferInfo = {};
+    DWORD m_errorScrapeTick = 0;
+    // The size of the last resize, which the error scraper applies when it's
+    // created.
+    int m_ptyCols = 0;
+    int m_ptyRows = 0;
+    bool m_pendingResize = false;
+    int m_pendingResizeCols = 0;
+    int m_pendingResizeRows = 0;
+    // Microseconds spent in the agent's startup phases, indexed by
+    // WINPTY_STARTUP_STAT_xxx (from WINPTY_STARTUP_STAT_CONSOLE_SETUP on).
+    int64_t m_startupStatsUs[WINPTY_STARTUP_STAT_COUNT];
+    // Started when the agent starts, for WINPTY_STAT_UPTIME_US.
+    TimeMeasurement m_uptime;
+    // The heap allocations made during poll ticks, for
+    // WINPTY_STAT_POLL_ALLOCATIONS.
+    uint64_t m_pollAllocations = 0;
+    // Poll tick latency, for winpty_get_tick_stats.  m_tickPhaseStart is the
+    // TimeMeasurement tick count when the current phase began, and
+    // m_tickPhaseUs holds the current tick's phase durations, for the trace
+    // of a slow tick.
+    int64_t m_tickStats[WINPTY_TICK_STAT_COUNT] = {};
+    int64_t m_tickPhaseUs[WINPTY_TICK_PHASE_COUNT] = {};
+    uint64_t m_tickStart = 0;
+    uint64_t m_tickPhaseStart = 0;
 
     // If the title is initialized to the empty string, then cmd.exe will
     // sometimes print this error:
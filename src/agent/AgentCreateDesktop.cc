@@ -59,9 +59,8 @@ CreateDesktopLoop::CreateDesktopLoop(LPCWSTR controlPipeName) :
 }
 
 void CreateDesktopLoop::writePacket(WriteBuffer &packet) {
-    const auto &bytes = packet.buf();
-    packet.replaceRawValue<uint64_t>(0, bytes.size());
-    m_pipe.write(bytes.data(), bytes.size());
+    packet.replaceRawValue<uint64_t>(0, packet.size());
+    m_pipe.write(packet.data(), packet.size());
 }
 
 void CreateDesktopLoop::onPipeIo(NamedPipe &namedPipe) {
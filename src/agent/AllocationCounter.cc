@@ -0,0 +1,110 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "AllocationCounter.h"
+
+#include <windows.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <new>
+
+#include "../shared/WinptyException.h"
+
+namespace {
+
+// The agent's other threads allocate too, so the total is atomic.
+std::atomic<uint64_t> g_allocationCount(0);
+
+// Each thread's count is kept in the slot itself rather than behind a
+// pointer, so counting never needs an allocation of its own.
+DWORD g_tlsIndex = TLS_OUT_OF_INDEXES;
+
+void *countedAlloc(size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (g_tlsIndex != TLS_OUT_OF_INDEXES) {
+        // TlsGetValue clears the last error, which the caller may not have
+        // read yet.
+        const DWORD lastError = GetLastError();
+        const uintptr_t count =
+            reinterpret_cast<uintptr_t>(TlsGetValue(g_tlsIndex));
+        TlsSetValue(g_tlsIndex, reinterpret_cast<void*>(count + 1));
+        SetLastError(lastError);
+    }
+    return malloc(size == 0 ? 1 : size);
+}
+
+} // anonymous namespace
+
+uint64_t heapAllocationCount() {
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+// Called once from main, before the agent starts any threads.
+void initAllocationCounter() {
+    g_tlsIndex = TlsAlloc();
+}
+
+uintptr_t threadHeapAllocationCount() {
+    if (g_tlsIndex == TLS_OUT_OF_INDEXES) {
+        return 0;
+    }
+    const DWORD lastError = GetLastError();
+    const uintptr_t ret =
+        reinterpret_cast<uintptr_t>(TlsGetValue(g_tlsIndex));
+    SetLastError(lastError);
+    return ret;
+}
+
+void *operator new(size_t size) {
+    void *const ret = countedAlloc(size);
+    if (ret == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ret;
+}
+
+void *operator new[](size_t size) {
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t&) WINPTY_NOEXCEPT {
+    return countedAlloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t&) WINPTY_NOEXCEPT {
+    return countedAlloc(size);
+}
+
+void operator delete(void *ptr) WINPTY_NOEXCEPT {
+    free(ptr);
+}
+
+void operator delete[](void *ptr) WINPTY_NOEXCEPT {
+    free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t&) WINPTY_NOEXCEPT {
+    free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t&) WINPTY_NOEXCEPT {
+    free(ptr);
+}
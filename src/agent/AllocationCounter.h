@@ -0,0 +1,38 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_ALLOCATION_COUNTER_H
+#define AGENT_ALLOCATION_COUNTER_H
+
+#include <stdint.h>
+
+// The agent replaces the global operator new and counts each call, so the
+// stats API can show whether the steady-state paths allocate.  Allocations
+// made with malloc directly aren't counted.
+uint64_t heapAllocationCount();
+
+// The count for the calling thread alone, which the agent's other threads
+// (input, output, trace flushing) don't disturb.  It is only counted from the
+// call to initAllocationCounter, and it may wrap on 32-bit builds, so only
+// differences between two readings on the same thread are meaningful.
+void initAllocationCounter();
+uintptr_t threadHeapAllocationCount();
+
+#endif // AGENT_ALLOCATION_COUNTER_H
@@ -0,0 +1,148 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_ARENA_H
+#define AGENT_ARENA_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../shared/WinptyAssert.h"
+
+// A region for objects that all live until their owner is done with them.
+// Objects are bump-allocated from the newest chunk; when it fills, a chunk
+// twice its size is added, so a long-lived arena makes few large allocations
+// instead of one per object.  Objects are never freed individually.
+//
+// reset() destroys the objects but keeps the chunks for the next batch, and
+// clear() destroys the objects and frees the chunks.  Destructors only run
+// for types that have a non-trivial one, in the reverse order of creation.
+class Arena {
+public:
+    explicit Arena(size_t firstChunkSize = 4096) :
+        m_firstChunkSize(firstChunkSize) {}
+    ~Arena() { clear(); }
+    Arena(const Arena &other) = delete;
+    Arena &operator=(const Arena &other) = delete;
+
+    template <typename T, typename... Args>
+    T *create(Args&&... args) {
+        void *const p = allocate(sizeof(T), alignof(T));
+        T *const ret = new (p) T(std::forward<Args>(args)...);
+        if (!std::is_trivially_destructible<T>::value) {
+            m_destructors.push_back(Destructor { &destroy<T>, ret });
+        }
+        return ret;
+    }
+
+    void reset() {
+        destroyAll();
+        m_chunkIndex = 0;
+        m_chunkOffset = 0;
+    }
+
+    void clear() {
+        destroyAll();
+        for (const Chunk &chunk : m_chunks) {
+            free(chunk.data);
+        }
+        std::vector<Chunk>().swap(m_chunks);
+        std::vector<Destructor>().swap(m_destructors);
+        m_chunkIndex = 0;
+        m_chunkOffset = 0;
+    }
+
+    size_t memoryUsage() const {
+        size_t ret = m_chunks.capacity() * sizeof(Chunk) +
+            m_destructors.capacity() * sizeof(Destructor);
+        for (const Chunk &chunk : m_chunks) {
+            ret += chunk.size;
+        }
+        return ret;
+    }
+
+private:
+    struct Chunk {
+        char *data;
+        size_t size;
+    };
+
+    struct Destructor {
+        void (*destroy)(void *object);
+        void *object;
+    };
+
+    template <typename T>
+    static void destroy(void *object) {
+        static_cast<T*>(object)->~T();
+    }
+
+    void destroyAll() {
+        for (auto it = m_destructors.rbegin(); it != m_destructors.rend();
+                ++it) {
+            it->destroy(it->object);
+        }
+        m_destructors.clear();
+    }
+
+    // malloc's alignment on Windows: 8 bytes for 32-bit code and 16 for
+    // 64-bit code.
+    enum { kMaxAlign = sizeof(void*) * 2 };
+
+    // Returns `size` bytes aligned to `align`, which must be a power of two
+    // no larger than kMaxAlign.  After a reset, the kept chunks are
+    // reused in order before a new one is added.
+    void *allocate(size_t size, size_t align) {
+        ASSERT(align <= kMaxAlign && (align & (align - 1)) == 0);
+        while (m_chunkIndex < m_chunks.size()) {
+            const Chunk &chunk = m_chunks[m_chunkIndex];
+            const size_t offset = (m_chunkOffset + align - 1) & ~(align - 1);
+            if (offset + size <= chunk.size) {
+                m_chunkOffset = offset + size;
+                return chunk.data + offset;
+            }
+            ++m_chunkIndex;
+            m_chunkOffset = 0;
+        }
+        const size_t prevSize =
+            m_chunks.empty() ? m_firstChunkSize / 2 : m_chunks.back().size;
+        const size_t chunkSize = std::max(prevSize * 2, size);
+        char *const data = static_cast<char*>(malloc(chunkSize));
+        ASSERT(data != nullptr);
+        m_chunks.push_back(Chunk { data, chunkSize });
+        m_chunkIndex = m_chunks.size() - 1;
+        m_chunkOffset = size;
+        return data;
+    }
+
+    size_t m_firstChunkSize;
+    std::vector<Chunk> m_chunks;
+    size_t m_chunkIndex = 0;
+    size_t m_chunkOffset = 0;
+    std::vector<Destructor> m_destructors;
+};
+
+#endif // AGENT_ARENA_H
@@ -0,0 +1,536 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "CharInfoScan.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "../shared/CpuFeatures.h"
+
+#ifdef WINPTY_CPU_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+static_assert(sizeof(CHAR_INFO) == sizeof(uint32_t),
+              "CHAR_INFO is expected to be a 32-bit value");
+
+namespace {
+
+inline uint32_t cellValue(const CHAR_INFO *cell) {
+    uint32_t ret;
+    memcpy(&ret, cell, sizeof(ret));
+    return ret;
+}
+
+inline uint32_t blankValue(WORD attributes) {
+    CHAR_INFO blank;
+    blank.Char.UnicodeChar = L' ';
+    blank.Attributes = attributes;
+    return cellValue(&blank);
+}
+
+// A cell value selecting the given character and attribute bits.
+inline uint32_t bitsValue(WCHAR ch, WORD attributes) {
+    CHAR_INFO bits;
+    bits.Char.UnicodeChar = ch;
+    bits.Attributes = attributes;
+    return cellValue(&bits);
+}
+
+int firstDifferenceScalar(const CHAR_INFO *a, const CHAR_INFO *b,
+                          int start, int length) {
+    for (int i = start; i < length; ++i) {
+        if (cellValue(&a[i]) != cellValue(&b[i])) {
+            return i;
+        }
+    }
+    return length;
+}
+
+int firstMismatchScalar(const CHAR_INFO *a, uint32_t value,
+                        int start, int length) {
+    for (int i = start; i < length; ++i) {
+        if (cellValue(&a[i]) != value) {
+            return i;
+        }
+    }
+    return length;
+}
+
+// The line hash runs eight independent 32-bit lanes over blocks of eight
+// cells (one AVX2 register), then folds the lanes, the leftover cells, and the
+// length into 64 bits.
+const int kHashLanes = 8;
+const uint32_t kHashSeed = 0x2545F491u;
+const uint32_t kHashMultiplier = 0x9E3779B1u;
+
+inline uint32_t hashStep(uint32_t acc, uint32_t value) {
+    acc = (acc ^ value) * kHashMultiplier;
+    return (acc << 15) | (acc >> 17);
+}
+
+uint64_t hashFinish(const uint32_t (&lanes)[kHashLanes],
+                    const CHAR_INFO *a, int start, int length) {
+    uint64_t h = static_cast<uint64_t>(length) * 0x9E3779B97F4A7C15ull;
+    for (int j = 0; j < kHashLanes; ++j) {
+        h = (h ^ lanes[j]) * 0x100000001B3ull;
+    }
+    for (int i = start; i < length; ++i) {
+        h = (h ^ cellValue(&a[i])) * 0x100000001B3ull;
+    }
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+int firstRunDifferenceScalar(const CHAR_INFO *a, const WCHAR *text,
+                             uint32_t attributeBits, int start, int length) {
+    for (int i = start; i < length; ++i) {
+        if (cellValue(&a[i]) != (attributeBits | text[i])) {
+            return i;
+        }
+    }
+    return length;
+}
+
+bool anyBitsScalar(const CHAR_INFO *a, uint32_t bits, int start, int length) {
+    uint32_t acc = 0;
+    for (int i = start; i < length; ++i) {
+        acc |= cellValue(&a[i]);
+    }
+    return (acc & bits) != 0;
+}
+
+void maskCellsScalar(CHAR_INFO *a, uint32_t mask, int start, int length) {
+    for (int i = start; i < length; ++i) {
+        const uint32_t value = cellValue(&a[i]) & mask;
+        memcpy(&a[i], &value, sizeof(value));
+    }
+}
+
+inline bool isAsciiCell(uint32_t value, uint32_t attributeBits) {
+    const uint32_t ch = value & 0xFFFF;
+    return (value & 0xFFFF0000u) == attributeBits && ch >= 0x20 && ch <= 0x7E;
+}
+
+int narrowAsciiScalar(const CHAR_INFO *a, uint32_t attributeBits, char *out,
+                      int start, int length) {
+    for (int i = start; i < length; ++i) {
+        const uint32_t value = cellValue(&a[i]);
+        if (!isAsciiCell(value, attributeBits)) {
+            return i;
+        }
+        out[i] = static_cast<char>(value);
+    }
+    return length;
+}
+
+int firstDifferenceGeneric(const CHAR_INFO *a, const CHAR_INFO *b, int length) {
+    return firstDifferenceScalar(a, b, 0, length);
+}
+
+int firstMismatchGeneric(const CHAR_INFO *a, uint32_t value, int length) {
+    return firstMismatchScalar(a, value, 0, length);
+}
+
+int firstRunDifferenceGeneric(const CHAR_INFO *a, const WCHAR *text,
+                              uint32_t attributeBits, int length) {
+    return firstRunDifferenceScalar(a, text, attributeBits, 0, length);
+}
+
+bool anyBitsGeneric(const CHAR_INFO *a, uint32_t bits, int length) {
+    return anyBitsScalar(a, bits, 0, length);
+}
+
+void maskCellsGeneric(CHAR_INFO *a, uint32_t mask, int length) {
+    maskCellsScalar(a, mask, 0, length);
+}
+
+int narrowAsciiGeneric(const CHAR_INFO *a, uint32_t attributeBits, char *out,
+                       int length) {
+    return narrowAsciiScalar(a, attributeBits, out, 0, length);
+}
+
+// SSE2 has no 32-bit multiply, so SSE2 machines use this loop too.
+uint64_t hashGeneric(const CHAR_INFO *a, int length) {
+    uint32_t lanes[kHashLanes];
+    for (int j = 0; j < kHashLanes; ++j) {
+        lanes[j] = kHashSeed + j;
+    }
+    int i = 0;
+    for (; i + kHashLanes <= length; i += kHashLanes) {
+        for (int j = 0; j < kHashLanes; ++j) {
+            lanes[j] = hashStep(lanes[j], cellValue(&a[i + j]));
+        }
+    }
+    return hashFinish(lanes, a, i, length);
+}
+
+#ifdef WINPTY_CPU_X86
+
+inline int lowestSetBit(unsigned int mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+WINPTY_TARGET("sse2")
+int firstDifferenceSse2(const CHAR_INFO *a, const CHAR_INFO *b, int length) {
+    int i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        const unsigned int eq =
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(va, vb)));
+        if (eq != 0xF) {
+            return i + lowestSetBit(~eq & 0xF);
+        }
+    }
+    return firstDifferenceScalar(a, b, i, length);
+}
+
+WINPTY_TARGET("sse2")
+int firstMismatchSse2(const CHAR_INFO *a, uint32_t value, int length) {
+    const __m128i vv = _mm_set1_epi32(static_cast<int>(value));
+    int i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const unsigned int eq =
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(va, vv)));
+        if (eq != 0xF) {
+            return i + lowestSetBit(~eq & 0xF);
+        }
+    }
+    return firstMismatchScalar(a, value, i, length);
+}
+
+// Interleaves eight characters with the attributes to form the cells they
+// are compared against.
+WINPTY_TARGET("sse2")
+int firstRunDifferenceSse2(const CHAR_INFO *a, const WCHAR *text,
+                           uint32_t attributeBits, int length) {
+    const __m128i attrs =
+        _mm_set1_epi16(static_cast<short>(attributeBits >> 16));
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m128i vt = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 4));
+        const unsigned int eq =
+            _mm_movemask_ps(_mm_castsi128_ps(
+                _mm_cmpeq_epi32(v0, _mm_unpacklo_epi16(vt, attrs)))) |
+            (_mm_movemask_ps(_mm_castsi128_ps(
+                _mm_cmpeq_epi32(v1, _mm_unpackhi_epi16(vt, attrs)))) << 4);
+        if (eq != 0xFF) {
+            return i + lowestSetBit(~eq & 0xFF);
+        }
+    }
+    return firstRunDifferenceScalar(a, text, attributeBits, i, length);
+}
+
+WINPTY_TARGET("sse2")
+bool anyBitsSse2(const CHAR_INFO *a, uint32_t bits, int length) {
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= length; i += 4) {
+        acc = _mm_or_si128(
+            acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+    }
+    acc = _mm_and_si128(acc, _mm_set1_epi32(static_cast<int>(bits)));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128())) != 0xFFFF) {
+        return true;
+    }
+    return anyBitsScalar(a, bits, i, length);
+}
+
+WINPTY_TARGET("sse2")
+void maskCellsSse2(CHAR_INFO *a, uint32_t mask, int length) {
+    const __m128i vm = _mm_set1_epi32(static_cast<int>(mask));
+    int i = 0;
+    for (; i + 4 <= length; i += 4) {
+        __m128i *const p = reinterpret_cast<__m128i*>(a + i);
+        _mm_storeu_si128(p, _mm_and_si128(_mm_loadu_si128(p), vm));
+    }
+    maskCellsScalar(a, mask, i, length);
+}
+
+// Checks and narrows eight cells at a time.  The bytes of a block are stored
+// before the block is known to qualify, which is why `out` must be as long
+// as the line.  (The AVX2 level uses this kernel too; the lines are short
+// enough that the cross-lane packing wouldn't pay for itself.)
+WINPTY_TARGET("sse2")
+int narrowAsciiSse2(const CHAR_INFO *a, uint32_t attributeBits, char *out,
+                    int length) {
+    const __m128i charMask = _mm_set1_epi32(0xFFFF);
+    const __m128i attrs = _mm_set1_epi32(static_cast<int>(attributeBits));
+    const __m128i low = _mm_set1_epi32(0x20 - 1);
+    const __m128i high = _mm_set1_epi32(0x7E + 1);
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 4));
+        const __m128i c0 = _mm_and_si128(v0, charMask);
+        const __m128i c1 = _mm_and_si128(v1, charMask);
+        const __m128i ok0 = _mm_and_si128(
+            _mm_cmpeq_epi32(_mm_andnot_si128(charMask, v0), attrs),
+            _mm_and_si128(_mm_cmpgt_epi32(c0, low), _mm_cmpgt_epi32(high, c0)));
+        const __m128i ok1 = _mm_and_si128(
+            _mm_cmpeq_epi32(_mm_andnot_si128(charMask, v1), attrs),
+            _mm_and_si128(_mm_cmpgt_epi32(c1, low), _mm_cmpgt_epi32(high, c1)));
+        const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(c0, c1),
+                                               _mm_setzero_si128());
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), bytes);
+        const unsigned int okMask =
+            _mm_movemask_ps(_mm_castsi128_ps(ok0)) |
+            (_mm_movemask_ps(_mm_castsi128_ps(ok1)) << 4);
+        if (okMask != 0xFF) {
+            return i + lowestSetBit(~okMask & 0xFF);
+        }
+    }
+    return narrowAsciiScalar(a, attributeBits, out, i, length);
+}
+
+WINPTY_TARGET("avx2")
+int firstDifferenceAvx2(const CHAR_INFO *a, const CHAR_INFO *b, int length) {
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const unsigned int eq =
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(va, vb)));
+        if (eq != 0xFF) {
+            return i + lowestSetBit(~eq & 0xFF);
+        }
+    }
+    return firstDifferenceScalar(a, b, i, length);
+}
+
+WINPTY_TARGET("avx2")
+int firstMismatchAvx2(const CHAR_INFO *a, uint32_t value, int length) {
+    const __m256i vv = _mm256_set1_epi32(static_cast<int>(value));
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const unsigned int eq =
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(va, vv)));
+        if (eq != 0xFF) {
+            return i + lowestSetBit(~eq & 0xFF);
+        }
+    }
+    return firstMismatchScalar(a, value, i, length);
+}
+
+WINPTY_TARGET("avx2")
+int firstRunDifferenceAvx2(const CHAR_INFO *a, const WCHAR *text,
+                           uint32_t attributeBits, int length) {
+    const __m256i attrs = _mm256_set1_epi32(static_cast<int>(attributeBits));
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m256i vt = _mm256_or_si256(
+            _mm256_cvtepu16_epi32(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i))),
+            attrs);
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const unsigned int eq =
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(va, vt)));
+        if (eq != 0xFF) {
+            return i + lowestSetBit(~eq & 0xFF);
+        }
+    }
+    return firstRunDifferenceScalar(a, text, attributeBits, i, length);
+}
+
+WINPTY_TARGET("avx2")
+bool anyBitsAvx2(const CHAR_INFO *a, uint32_t bits, int length) {
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        acc = _mm256_or_si256(
+            acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)));
+    }
+    acc = _mm256_and_si256(acc, _mm256_set1_epi32(static_cast<int>(bits)));
+    if (!_mm256_testz_si256(acc, acc)) {
+        return true;
+    }
+    return anyBitsScalar(a, bits, i, length);
+}
+
+WINPTY_TARGET("avx2")
+void maskCellsAvx2(CHAR_INFO *a, uint32_t mask, int length) {
+    const __m256i vm = _mm256_set1_epi32(static_cast<int>(mask));
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        __m256i *const p = reinterpret_cast<__m256i*>(a + i);
+        _mm256_storeu_si256(p, _mm256_and_si256(_mm256_loadu_si256(p), vm));
+    }
+    maskCellsScalar(a, mask, i, length);
+}
+
+WINPTY_TARGET("avx2")
+uint64_t hashAvx2(const CHAR_INFO *a, int length) {
+    __m256i acc = _mm256_add_epi32(
+        _mm256_set1_epi32(static_cast<int>(kHashSeed)),
+        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    const __m256i mult = _mm256_set1_epi32(static_cast<int>(kHashMultiplier));
+    int i = 0;
+    for (; i + kHashLanes <= length; i += kHashLanes) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        acc = _mm256_mullo_epi32(_mm256_xor_si256(acc, va), mult);
+        acc = _mm256_or_si256(_mm256_slli_epi32(acc, 15),
+                              _mm256_srli_epi32(acc, 17));
+    }
+    uint32_t lanes[kHashLanes];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return hashFinish(lanes, a, i, length);
+}
+
+struct Kernels {
+    int (*firstDifference)(const CHAR_INFO*, const CHAR_INFO*, int);
+    int (*firstMismatch)(const CHAR_INFO*, uint32_t, int);
+    int (*firstRunDifference)(const CHAR_INFO*, const WCHAR*, uint32_t, int);
+    uint64_t (*hash)(const CHAR_INFO*, int);
+    bool (*anyBits)(const CHAR_INFO*, uint32_t, int);
+    void (*maskCells)(CHAR_INFO*, uint32_t, int);
+    int (*narrowAscii)(const CHAR_INFO*, uint32_t, char*, int);
+};
+
+Kernels selectKernels(CpuLevel level) {
+    switch (level) {
+        case CpuLevel::Avx2:
+            return { firstDifferenceAvx2, firstMismatchAvx2,
+                     firstRunDifferenceAvx2, hashAvx2,
+                     anyBitsAvx2, maskCellsAvx2, narrowAsciiSse2 };
+        case CpuLevel::Sse2:
+            return { firstDifferenceSse2, firstMismatchSse2,
+                     firstRunDifferenceSse2, hashGeneric,
+                     anyBitsSse2, maskCellsSse2, narrowAsciiSse2 };
+        default:
+            return { firstDifferenceGeneric, firstMismatchGeneric,
+                     firstRunDifferenceGeneric, hashGeneric,
+                     anyBitsGeneric, maskCellsGeneric, narrowAsciiGeneric };
+    }
+}
+
+#else
+
+struct Kernels {
+    int (*firstDifference)(const CHAR_INFO*, const CHAR_INFO*, int);
+    int (*firstMismatch)(const CHAR_INFO*, uint32_t, int);
+    int (*firstRunDifference)(const CHAR_INFO*, const WCHAR*, uint32_t, int);
+    uint64_t (*hash)(const CHAR_INFO*, int);
+    bool (*anyBits)(const CHAR_INFO*, uint32_t, int);
+    void (*maskCells)(CHAR_INFO*, uint32_t, int);
+    int (*narrowAscii)(const CHAR_INFO*, uint32_t, char*, int);
+};
+
+Kernels selectKernels(CpuLevel) {
+    return { firstDifferenceGeneric, firstMismatchGeneric,
+             firstRunDifferenceGeneric, hashGeneric,
+             anyBitsGeneric, maskCellsGeneric, narrowAsciiGeneric };
+}
+
+#endif // WINPTY_CPU_X86
+
+Kernels &kernels() {
+    static Kernels ret = selectKernels(detectCpuLevel());
+    return ret;
+}
+
+} // anonymous namespace
+
+CpuLevel charInfoScanUseCpuLevel(CpuLevel level) {
+    const CpuLevel supported = detectCpuLevel();
+    if (static_cast<int>(level) > static_cast<int>(supported)) {
+        level = supported;
+    }
+    kernels() = selectKernels(level);
+    return level;
+}
+
+bool charInfoLinesEqual(const CHAR_INFO *line1, const CHAR_INFO *line2,
+                        int length) {
+    return charInfoFirstDifference(line1, line2, length) == length;
+}
+
+bool charInfoLineBlank(const CHAR_INFO *line, int length, WORD attributes) {
+    if (length <= 0) {
+        return true;
+    }
+    return kernels().firstMismatch(
+        line, blankValue(attributes), length) == length;
+}
+
+int charInfoFirstDifference(const CHAR_INFO *line1, const CHAR_INFO *line2,
+                            int length) {
+    if (length <= 0) {
+        return 0;
+    }
+    return kernels().firstDifference(
+        line1, line2, length);
+}
+
+int charInfoFirstRunDifference(const CHAR_INFO *line, const WCHAR *text,
+                               int length, WORD attributes) {
+    if (length <= 0) {
+        return 0;
+    }
+    return kernels().firstRunDifference(
+        line, text, bitsValue(0, attributes), length);
+}
+
+uint64_t charInfoLineHash(const CHAR_INFO *line, int length) {
+    return kernels().hash(line, std::max(length, 0));
+}
+
+bool charInfoAnyAttributes(const CHAR_INFO *line, int length, WORD bits) {
+    if (length <= 0 || bits == 0) {
+        return false;
+    }
+    return kernels().anyBits(line, bitsValue(0, bits), length);
+}
+
+void charInfoMaskAttributes(CHAR_INFO *line, int length, WORD mask) {
+    if (length <= 0) {
+        return;
+    }
+    kernels().maskCells(line, bitsValue(static_cast<WCHAR>(0xFFFF), mask),
+                        length);
+}
+
+int charInfoNarrowAscii(const CHAR_INFO *line, int length, WORD attributes,
+                        char *out) {
+    if (length <= 0) {
+        return 0;
+    }
+    return kernels().narrowAscii(line, bitsValue(0, attributes), out, length);
+}
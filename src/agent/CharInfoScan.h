@@ -0,0 +1,77 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_CHAR_INFO_SCAN_H
+#define AGENT_CHAR_INFO_SCAN_H
+
+#include <windows.h>
+#include <stdint.h>
+
+#include "../shared/CpuFeatures.h"
+
+// Vectorized comparisons of CHAR_INFO cell arrays.  On x86, SSE2 or AVX2
+// kernels are selected at runtime; elsewhere, a scalar loop is used.
+//
+// The cells are compared as 32-bit values, so callers must not leave
+// uninitialized padding in a CHAR_INFO (i.e. write Char.UnicodeChar rather
+// than Char.AsciiChar).
+
+// Returns true if the first `length` cells of the two lines are identical.
+bool charInfoLinesEqual(const CHAR_INFO *line1, const CHAR_INFO *line2,
+                        int length);
+
+// Returns true if every cell is a space with the given attributes.
+bool charInfoLineBlank(const CHAR_INFO *line, int length, WORD attributes);
+
+// Returns the index of the first cell that differs, or `length` if the lines
+// are identical.
+int charInfoFirstDifference(const CHAR_INFO *line1, const CHAR_INFO *line2,
+                            int length);
+
+// Returns the index of the first cell whose character differs from the same
+// element of `text` or whose attributes differ from `attributes`, or `length`
+// if there is no such cell.
+int charInfoFirstRunDifference(const CHAR_INFO *line, const WCHAR *text,
+                               int length, WORD attributes);
+
+// Returns true if any cell has any of the given attribute bits set.
+bool charInfoAnyAttributes(const CHAR_INFO *line, int length, WORD bits);
+
+// Clears the attribute bits not in `mask` in every cell.
+void charInfoMaskAttributes(CHAR_INFO *line, int length, WORD mask);
+
+// Copies the characters of the leading cells that hold printable ASCII
+// (U+0020 through U+007E) and have exactly the given attributes to `out`,
+// one byte per cell, and returns the number of such cells.  `out` must have
+// room for `length` bytes.
+int charInfoNarrowAscii(const CHAR_INFO *line, int length, WORD attributes,
+                        char *out);
+
+// Returns a 64-bit hash of the first `length` cells.  The value depends only
+// on the cells, not on the kernel selected.
+uint64_t charInfoLineHash(const CHAR_INFO *line, int length);
+
+// Switches every function above to the kernels for the given level, or for
+// the processor's own level if that's lower, and returns the level used.
+// Only the unit tests call this, to check each kernel against the generic
+// one; the switch isn't synchronized with scans on other threads.
+CpuLevel charInfoScanUseCpuLevel(CpuLevel level);
+
+#endif // AGENT_CHAR_INFO_SCAN_H
@@ -0,0 +1,191 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "ChunkedQueue.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "../shared/WinptyAssert.h"
+
+void ChunkedQueue::clear()
+{
+    ASSERT(!m_tailReserved);
+    m_chunks.clear();
+    m_frontOffset = 0;
+    m_size = 0;
+}
+
+// Frees the storage of an empty queue, including the recycled chunk.
+void ChunkedQueue::trim()
+{
+    if (m_size != 0 || m_tailReserved) {
+        return;
+    }
+    std::deque<std::string>().swap(m_chunks);
+    std::string().swap(m_spare);
+    m_frontOffset = 0;
+}
+
+// The bytes allocated for the chunks, which may well exceed size().
+size_t ChunkedQueue::memoryUsage() const
+{
+    size_t ret = m_spare.capacity();
+    for (const auto &chunk : m_chunks) {
+        ret += chunk.capacity();
+    }
+    return ret;
+}
+
+void ChunkedQueue::pushChunk()
+{
+    m_chunks.push_back(std::string());
+    m_chunks.back().swap(m_spare);
+    m_chunks.back().clear();
+}
+
+// Drop the front chunk, keeping its storage for reuse.
+void ChunkedQueue::recycleFront()
+{
+    m_spare.swap(m_chunks.front());
+    m_chunks.pop_front();
+    m_frontOffset = 0;
+}
+
+void ChunkedQueue::append(const char *data, size_t size)
+{
+    ASSERT(!m_tailReserved);
+    m_size += size;
+    while (size > 0) {
+        if (m_chunks.empty() || m_chunks.back().size() >= m_chunkSize) {
+            pushChunk();
+        }
+        std::string &back = m_chunks.back();
+        const size_t n = std::min<size_t>(size, m_chunkSize - back.size());
+        back.append(data, n);
+        data += n;
+        size -= n;
+    }
+}
+
+std::string &ChunkedQueue::reserveTail()
+{
+    ASSERT(!m_tailReserved);
+    if (m_chunks.empty() || m_chunks.back().size() >= m_chunkSize) {
+        pushChunk();
+    }
+    m_tailReserved = true;
+    m_tailReservedSize = m_chunks.back().size();
+    return m_chunks.back();
+}
+
+void ChunkedQueue::commitTail()
+{
+    ASSERT(m_tailReserved);
+    m_tailReserved = false;
+    std::string &back = m_chunks.back();
+    ASSERT(back.size() >= m_tailReservedSize);
+    m_size += back.size() - m_tailReservedSize;
+    if (back.empty()) {
+        // Nothing was written to a fresh chunk.
+        m_spare.swap(back);
+        m_chunks.pop_back();
+    }
+}
+
+size_t ChunkedQueue::peek(void *data, size_t size) const
+{
+    ASSERT(!m_tailReserved);
+    char *out = reinterpret_cast<char*>(data);
+    size_t offset = m_frontOffset;
+    size_t ret = 0;
+    for (const auto &chunk : m_chunks) {
+        if (ret == size) {
+            break;
+        }
+        const size_t n = std::min(size - ret, chunk.size() - offset);
+        memcpy(out + ret, chunk.data() + offset, n);
+        ret += n;
+        offset = 0;
+    }
+    return ret;
+}
+
+const char *ChunkedQueue::peekInPlace(size_t size) const
+{
+    ASSERT(!m_tailReserved);
+    if (size > m_size || m_chunks.empty() ||
+            m_chunks.front().size() - m_frontOffset < size) {
+        return nullptr;
+    }
+    return m_chunks.front().data() + m_frontOffset;
+}
+
+const char *ChunkedQueue::peekFront(size_t &size) const
+{
+    ASSERT(!m_tailReserved);
+    if (m_size == 0) {
+        size = 0;
+        return nullptr;
+    }
+    size = m_chunks.front().size() - m_frontOffset;
+    return m_chunks.front().data() + m_frontOffset;
+}
+
+void ChunkedQueue::consume(size_t size)
+{
+    ASSERT(!m_tailReserved);
+    ASSERT(size <= m_size);
+    m_size -= size;
+    while (size > 0) {
+        const size_t avail = m_chunks.front().size() - m_frontOffset;
+        if (size < avail) {
+            m_frontOffset += size;
+            break;
+        }
+        size -= avail;
+        recycleFront();
+    }
+}
+
+std::string ChunkedQueue::take(size_t size)
+{
+    std::string ret(std::min(size, m_size), '\0');
+    if (!ret.empty()) {
+        peek(&ret[0], ret.size());
+        consume(ret.size());
+    }
+    return ret;
+}
+
+void ChunkedQueue::popFront(std::string &out)
+{
+    ASSERT(!m_tailReserved);
+    ASSERT(!m_chunks.empty());
+    std::string &front = m_chunks.front();
+    if (m_frontOffset != 0) {
+        front.erase(0, m_frontOffset);
+    }
+    m_size -= front.size();
+    out.swap(front);
+    // `front` now holds the caller's old storage; keep it for reuse.
+    recycleFront();
+}
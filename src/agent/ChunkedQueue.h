@@ -0,0 +1,85 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_CHUNKED_QUEUE_H
+#define AGENT_CHUNKED_QUEUE_H
+
+#include <stddef.h>
+
+#include <deque>
+#include <string>
+
+// A byte FIFO stored as a deque of chunks.  Consuming from the front never
+// moves the remaining bytes, and the storage of a drained chunk is recycled
+// for the next chunk pushed at the back, so a long burst of traffic through
+// the queue neither copies quadratically nor reallocates on every chunk.
+class ChunkedQueue
+{
+public:
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    void clear();
+    void trim();
+    size_t memoryUsage() const;
+
+    // New chunks are started once the back chunk holds this many bytes.
+    // (A reserved tail may still grow past it.)
+    void setChunkSize(size_t size) { m_chunkSize = size; }
+
+    void append(const char *data, size_t size);
+
+    // Returns the back chunk so that the caller can append to it in place.
+    // The appended bytes become part of the queue when commitTail is called.
+    // The chunk's existing contents must not be modified.
+    std::string &reserveTail();
+    void commitTail();
+    bool isTailReserved() const { return m_tailReserved; }
+
+    size_t peek(void *data, size_t size) const;
+    // Returns the first `size` bytes in place if the front chunk holds all of
+    // them, or nullptr otherwise.  The pointer is valid until the queue is
+    // next changed.
+    const char *peekInPlace(size_t size) const;
+    // Returns the bytes of the front chunk in place, and their count in
+    // `size`, or nullptr if the queue is empty.
+    const char *peekFront(size_t &size) const;
+    void consume(size_t size);
+    std::string take(size_t size);
+
+    // Moves the entire front chunk into `out` (replacing its contents)
+    // without copying it.  The queue must not be empty.
+    void popFront(std::string &out);
+
+private:
+    enum { kDefaultChunkSize = 64 * 1024 };
+    void pushChunk();
+    void recycleFront();
+
+    size_t m_chunkSize = kDefaultChunkSize;
+    std::deque<std::string> m_chunks;
+    // Bytes already consumed from the front chunk.
+    size_t m_frontOffset = 0;
+    size_t m_size = 0;
+    bool m_tailReserved = false;
+    size_t m_tailReservedSize = 0;
+    std::string m_spare;
+};
+
+#endif // AGENT_CHUNKED_QUEUE_H
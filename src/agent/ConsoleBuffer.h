@@ -0,0 +1,99 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_CONSOLE_BUFFER_H
+#define AGENT_CONSOLE_BUFFER_H
+
+#include <windows.h>
+
+#include <string.h>
+
+#include "Coord.h"
+#include "SmallRect.h"
+
+class ConsoleScreenBufferInfo : public CONSOLE_SCREEN_BUFFER_INFO {
+public:
+    ConsoleScreenBufferInfo()
+    {
+        memset(this, 0, sizeof(*this));
+    }
+
+    Coord bufferSize() const        { return dwSize;    }
+    SmallRect windowRect() const    { return srWindow;  }
+    Coord cursorPosition() const    { return dwCursorPosition; }
+};
+
+// A screen buffer as the Scraper and largeConsoleRead see it.
+// Win32ConsoleBuffer implements it with a console handle, and other
+// implementations (such as a ConsoleTrace replay) supply the contents without
+// one, so the scrape path can run and be profiled without conhost.
+class ConsoleBuffer {
+public:
+    static const int kDefaultAttributes = 7;
+
+    virtual ~ConsoleBuffer() {}
+
+    // The console handle, for the console calls that have no method here
+    // (e.g. the font), or NULL if there is no console.
+    virtual HANDLE conout() = 0;
+    virtual void clearLines(int row, int count,
+                            const ConsoleScreenBufferInfo &info) = 0;
+    void clearAllLines(const ConsoleScreenBufferInfo &info) {
+        clearLines(0, info.bufferSize().Y, info);
+    }
+
+    // Buffer and window sizes.
+    virtual ConsoleScreenBufferInfo bufferInfo() = 0;
+    Coord bufferSize() { return bufferInfo().bufferSize(); }
+    SmallRect windowRect() { return bufferInfo().windowRect(); }
+    virtual void resizeBuffer(const Coord &size) = 0;
+    virtual bool resizeBufferRange(const Coord &initialSize,
+                                   Coord &finalSize) = 0;
+    bool resizeBufferRange(const Coord &initialSize) {
+        Coord dummy;
+        return resizeBufferRange(initialSize, dummy);
+    }
+    virtual void moveWindow(const SmallRect &rect) = 0;
+
+    // Cursor.
+    Coord cursorPosition() { return bufferInfo().dwCursorPosition; }
+    virtual void setCursorPosition(const Coord &point) = 0;
+
+    // Screen content.  read returns false if the console rejected the read
+    // (e.g. because it was too large for the console's RPC buffer).
+    virtual bool read(const SmallRect &rect, CHAR_INFO *data) = 0;
+    // Reads only the characters of `rect`, one per cell, in row-major order.
+    // The rect must span whole rows of the buffer.  readAttributes reads
+    // `count` attributes starting at `pos`, continuing onto the following
+    // rows.  Both return false if the buffer can't do the read, in which case
+    // the caller should read the cells instead.
+    virtual bool readText(const SmallRect &rect, wchar_t *text) {
+        return false;
+    }
+    virtual bool readAttributes(const Coord &pos, int count,
+                                WORD *attributes) {
+        return false;
+    }
+    virtual void write(const SmallRect &rect, const CHAR_INFO *data) = 0;
+
+    virtual void setTextAttribute(WORD attributes) = 0;
+};
+
+#endif // AGENT_CONSOLE_BUFFER_H
@@ -0,0 +1,95 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "ConsoleChangeTracker.h"
+
+#include <algorithm>
+
+namespace {
+
+// The idObject flag of a caret event for a console selection rather than
+// the cursor (CONSOLE_CARET_SELECTION in winuser.h).
+const LONG AGENT_CONSOLE_CARET_SELECTION = 0x0001;
+
+} // anonymous namespace
+
+bool ConsoleChangeTracker::noteEvent(DWORD event, LONG idObject,
+                                     LONG idChild)
+{
+    if (event < EVENT_CONSOLE_CARET || event > EVENT_CONSOLE_LAYOUT) {
+        return false;
+    }
+
+    // For the update events, idObject packs the top-left cell of the modified
+    // region (column in the low word).  For a region update, idChild packs
+    // its bottom-right cell, and a simple update modifies a single character,
+    // which may be two cells wide.  A caret event packs the caret's flags in
+    // idObject and its position in idChild, and doesn't change any content.
+    switch (event) {
+        case EVENT_CONSOLE_CARET:
+            if (idObject & AGENT_CONSOLE_CARET_SELECTION) {
+                // The agent's freeze selects, and nothing else can.
+                return false;
+            }
+            m_caretFlags = idObject;
+            m_caretPosition = idChild;
+            return caretMoved();
+        case EVENT_CONSOLE_UPDATE_REGION:
+        case EVENT_CONSOLE_UPDATE_SIMPLE:
+            if (m_changes.firstRow != -1) {
+                const int left = std::max<int>(LOWORD(idObject), 0);
+                const int top = std::max<int>(
+                    static_cast<SHORT>(HIWORD(idObject)), 0);
+                int right = left + 1;
+                int bottom = top;
+                if (event == EVENT_CONSOLE_UPDATE_REGION) {
+                    right = static_cast<SHORT>(LOWORD(idChild));
+                    bottom = static_cast<SHORT>(HIWORD(idChild));
+                }
+                m_changes.firstRow = std::min(m_changes.firstRow, top);
+                m_changes.lastRow = std::max(m_changes.lastRow, bottom);
+                m_changes.firstColumn =
+                    std::min(m_changes.firstColumn, left);
+                m_changes.lastColumn =
+                    std::max(m_changes.lastColumn, right);
+            }
+            break;
+        default:
+            m_changes.firstRow = -1;
+            break;
+    }
+    m_changes.dirty = true;
+    return true;
+}
+
+// Returns the changes noted since the previous call, and starts over.
+ConsoleChangeTracker::Changes ConsoleChangeTracker::take()
+{
+    Changes ret = m_changes;
+    ret.dirty = dirty();
+    m_changes = Changes();
+    m_changes.firstRow = INT_MAX;
+    m_changes.lastRow = -1;
+    m_changes.firstColumn = INT_MAX;
+    m_changes.lastColumn = -1;
+    m_takenCaretFlags = m_caretFlags;
+    m_takenCaretPosition = m_caretPosition;
+    return ret;
+}
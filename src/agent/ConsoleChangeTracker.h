@@ -0,0 +1,76 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_CONSOLE_CHANGE_TRACKER_H
+#define AGENT_CONSOLE_CHANGE_TRACKER_H
+
+#include <windows.h>
+#include <limits.h>
+
+// The bookkeeping behind ConsoleEventHook, kept apart from the hook so it
+// can be tested without a console: what the EVENT_CONSOLE_* events received
+// since the last take call say about the screen buffer.
+//
+// A scrape takes the changes before it reads the buffer.  Events that
+// arrive during or after the read, including late ones for changes the read
+// already saw, count toward the next scrape, so no change is ever dropped.
+// The agent's own freeze doesn't keep the tracker dirty: selection caret
+// events are ignored, and the caret only counts as changed if it ends up
+// somewhere other than where it was at the last take.
+class ConsoleChangeTracker
+{
+public:
+    struct Changes {
+        bool dirty = false;
+        // The topmost screen buffer row modified, INT_MAX if no rows were
+        // modified, or -1 if any row may have been (e.g. the buffer scrolled
+        // or resized).  Unless firstRow is -1, the other bounds of the
+        // modified cells, inclusive.  Each is -1 or INT_MAX if no cells were
+        // modified.
+        int firstRow = -1;
+        int lastRow = INT_MAX;
+        int firstColumn = 0;
+        int lastColumn = INT_MAX;
+    };
+
+    // Everything is dirty until the first take.
+    ConsoleChangeTracker() { m_changes.dirty = true; }
+
+    // Returns true if the event may reflect a change.
+    bool noteEvent(DWORD event, LONG idObject, LONG idChild);
+    bool dirty() const { return m_changes.dirty || caretMoved(); }
+    Changes take();
+
+private:
+    bool caretMoved() const {
+        return m_caretFlags != m_takenCaretFlags ||
+            m_caretPosition != m_takenCaretPosition;
+    }
+
+    Changes m_changes;
+    // The caret's state, from the last non-selection caret event, and as of
+    // the last take.  -1 is unknown.
+    LONG m_caretFlags = -1;
+    LONG m_caretPosition = -1;
+    LONG m_takenCaretFlags = -1;
+    LONG m_takenCaretPosition = -1;
+};
+
+#endif // AGENT_CONSOLE_CHANGE_TRACKER_H
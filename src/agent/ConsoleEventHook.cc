@@ -0,0 +1,122 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "ConsoleEventHook.h"
+
+#include "../shared/DebugClient.h"
+#include "../shared/WinptyAssert.h"
+
+namespace {
+
+ConsoleEventHook *g_activeHook = nullptr;
+
+} // anonymous namespace
+
+ConsoleEventHook::ConsoleEventHook(HWND consoleWindow,
+                                   ConsoleChangeListener &listener) :
+    m_consoleWindow(consoleWindow),
+    m_listener(listener)
+{
+    ASSERT(g_activeHook == nullptr);
+
+    // The console window belongs to conhost.exe (or csrss.exe before Windows
+    // 7), which is the process that raises the events.
+    DWORD consolePid = 0;
+    GetWindowThreadProcessId(m_consoleWindow, &consolePid);
+    if (consolePid == 0) {
+        trace("ConsoleEventHook: could not identify the console process");
+        return;
+    }
+
+    g_activeHook = this;
+    m_hook = SetWinEventHook(EVENT_CONSOLE_CARET, EVENT_CONSOLE_LAYOUT,
+                             nullptr, hookProc, consolePid, 0,
+                             WINEVENT_OUTOFCONTEXT);
+    if (m_hook == nullptr) {
+        trace("ConsoleEventHook: SetWinEventHook failed: %u",
+              static_cast<unsigned int>(GetLastError()));
+        g_activeHook = nullptr;
+        return;
+    }
+    // The title hook is only an optimization, so the agent polls the title
+    // anyway if it can't be installed.
+    m_titleHook = SetWinEventHook(EVENT_OBJECT_NAMECHANGE,
+                                  EVENT_OBJECT_NAMECHANGE,
+                                  nullptr, hookProc, consolePid, 0,
+                                  WINEVENT_OUTOFCONTEXT);
+    if (m_titleHook == nullptr) {
+        trace("ConsoleEventHook: title hook failed: %u",
+              static_cast<unsigned int>(GetLastError()));
+    }
+    trace("ConsoleEventHook: watching console events from pid %u",
+          static_cast<unsigned int>(consolePid));
+}
+
+ConsoleEventHook::~ConsoleEventHook()
+{
+    if (m_titleHook != nullptr) {
+        UnhookWinEvent(m_titleHook);
+    }
+    if (m_hook != nullptr) {
+        UnhookWinEvent(m_hook);
+        g_activeHook = nullptr;
+    }
+}
+
+// Returns the console changes seen so far and starts tracking anew.  Call
+// this before reading the screen buffer: any event still queued is
+// dispatched first, and whatever arrives during or after the read is left
+// for the next scrape, which may then find nothing new but never misses a
+// change.
+ConsoleChangeTracker::Changes ConsoleEventHook::takeChanges()
+{
+    MSG msg;
+    while (PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE)) {
+        DispatchMessageW(&msg);
+    }
+    return m_tracker.take();
+}
+
+void CALLBACK ConsoleEventHook::hookProc(
+        HWINEVENTHOOK hook, DWORD event, HWND hwnd,
+        LONG idObject, LONG idChild,
+        DWORD idEventThread, DWORD dwmsEventTime)
+{
+    ConsoleEventHook *const self = g_activeHook;
+    if (self == nullptr || hwnd != self->m_consoleWindow) {
+        return;
+    }
+    if (hook == self->m_titleHook) {
+        if (event == EVENT_OBJECT_NAMECHANGE && idObject == OBJID_WINDOW) {
+            self->m_titleChanged = true;
+            self->m_listener.onConsoleChanged();
+        }
+        return;
+    }
+    if (hook != self->m_hook) {
+        return;
+    }
+    if (event == EVENT_CONSOLE_LAYOUT) {
+        self->m_layoutChanged = true;
+    }
+    if (self->m_tracker.noteEvent(event, idObject, idChild)) {
+        self->m_listener.onConsoleChanged();
+    }
+}
@@ -0,0 +1,74 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_CONSOLE_EVENT_HOOK_H
+#define AGENT_CONSOLE_EVENT_HOOK_H
+
+#include <windows.h>
+
+#include "ConsoleChangeTracker.h"
+
+class ConsoleChangeListener
+{
+public:
+    virtual void onConsoleChanged() = 0;
+};
+
+// Watches the console window for the EVENT_CONSOLE_* WinEvents that conhost
+// raises when the screen buffer is modified, and for the
+// EVENT_OBJECT_NAMECHANGE event raised when its title changes.  The hooks are
+// out-of-context, so the callback only runs while the installing thread pumps
+// its message queue (see EventLoop::run).  At most one hook may exist at a
+// time.
+class ConsoleEventHook
+{
+public:
+    ConsoleEventHook(HWND consoleWindow, ConsoleChangeListener &listener);
+    ~ConsoleEventHook();
+    bool isActive() { return m_hook != nullptr; }
+    bool dirty() { return m_tracker.dirty(); }
+    ConsoleChangeTracker::Changes takeChanges();
+    bool isTitleHooked() { return m_titleHook != nullptr; }
+    bool titleChanged() { return m_titleChanged; }
+    void clearTitleChanged() { m_titleChanged = false; }
+    // Set by EVENT_CONSOLE_LAYOUT, which conhost raises when the active
+    // screen buffer changes (among other layout changes).
+    bool layoutChanged() { return m_layoutChanged; }
+    void clearLayoutChanged() { m_layoutChanged = false; }
+
+    ConsoleEventHook(const ConsoleEventHook &other) = delete;
+    ConsoleEventHook &operator=(const ConsoleEventHook &other) = delete;
+
+private:
+    static void CALLBACK hookProc(HWINEVENTHOOK hook, DWORD event, HWND hwnd,
+                                  LONG idObject, LONG idChild,
+                                  DWORD idEventThread, DWORD dwmsEventTime);
+
+private:
+    HWND m_consoleWindow = nullptr;
+    ConsoleChangeListener &m_listener;
+    HWINEVENTHOOK m_hook = nullptr;
+    HWINEVENTHOOK m_titleHook = nullptr;
+    ConsoleChangeTracker m_tracker;
+    bool m_titleChanged = true;
+    bool m_layoutChanged = true;
+};
+
+#endif // AGENT_CONSOLE_EVENT_HOOK_H
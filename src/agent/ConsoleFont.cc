@@ -33,6 +33,7 @@
 
 #include "../shared/DebugClient.h"
 #include "../shared/OsModule.h"
+#include "../shared/StringBuilder.h"
 #include "../shared/StringUtil.h"
 #include "../shared/WindowsVersion.h"
 #include "../shared/WinptyAssert.h"
@@ -287,8 +288,10 @@ typedef BOOL WINAPI SetCurrentConsoleFontEx_t(
             BOOL bMaximumWindow,
             AGENT_CONSOLE_FONT_INFOEX *lpConsoleCurrentFontEx);
 
-#define GET_MODULE_PROC(mod, funcName) \
-    m_##funcName = reinterpret_cast<funcName##_t*>((mod).proc(#funcName)); \
+// kernel32 is always loaded, so the APIs are looked up without an OsModule.
+#define GET_KERNEL32_PROC(funcName) \
+    m_##funcName = reinterpret_cast<funcName##_t*>( \
+        loadedModuleProc(L"kernel32.dll", #funcName))
 
 #define DEFINE_ACCESSOR(funcName) \
     funcName##_t &funcName() const { \
@@ -298,9 +301,9 @@ typedef BOOL WINAPI SetCurrentConsoleFontEx_t(
 
 class XPFontAPI {
 public:
-    XPFontAPI() : m_kernel32(L"kernel32.dll") {
-        GET_MODULE_PROC(m_kernel32, GetCurrentConsoleFont);
-        GET_MODULE_PROC(m_kernel32, GetConsoleFontSize);
+    XPFontAPI() {
+        GET_KERNEL32_PROC(GetCurrentConsoleFont);
+        GET_KERNEL32_PROC(GetConsoleFontSize);
     }
 
     bool valid() const {
@@ -312,16 +315,16 @@ public:
     DEFINE_ACCESSOR(GetConsoleFontSize)
 
 private:
-    OsModule m_kernel32;
     GetCurrentConsoleFont_t *m_GetCurrentConsoleFont;
     GetConsoleFontSize_t *m_GetConsoleFontSize;
 };
 
+#ifndef WINPTY_TARGET_WIN10
 class UndocumentedXPFontAPI : public XPFontAPI {
 public:
-    UndocumentedXPFontAPI() : m_kernel32(L"kernel32.dll") {
-        GET_MODULE_PROC(m_kernel32, SetConsoleFont);
-        GET_MODULE_PROC(m_kernel32, GetNumberOfConsoleFonts);
+    UndocumentedXPFontAPI() {
+        GET_KERNEL32_PROC(SetConsoleFont);
+        GET_KERNEL32_PROC(GetNumberOfConsoleFonts);
     }
 
     bool valid() const {
@@ -334,16 +337,16 @@ public:
     DEFINE_ACCESSOR(GetNumberOfConsoleFonts)
 
 private:
-    OsModule m_kernel32;
     SetConsoleFont_t *m_SetConsoleFont;
     GetNumberOfConsoleFonts_t *m_GetNumberOfConsoleFonts;
 };
+#endif // WINPTY_TARGET_WIN10
 
 class VistaFontAPI : public XPFontAPI {
 public:
-    VistaFontAPI() : m_kernel32(L"kernel32.dll") {
-        GET_MODULE_PROC(m_kernel32, GetCurrentConsoleFontEx);
-        GET_MODULE_PROC(m_kernel32, SetCurrentConsoleFontEx);
+    VistaFontAPI() {
+        GET_KERNEL32_PROC(GetCurrentConsoleFontEx);
+        GET_KERNEL32_PROC(SetCurrentConsoleFontEx);
     }
 
     bool valid() const {
@@ -356,7 +359,6 @@ public:
     DEFINE_ACCESSOR(SetCurrentConsoleFontEx)
 
 private:
-    OsModule m_kernel32;
     GetCurrentConsoleFontEx_t *m_GetCurrentConsoleFontEx;
     SetCurrentConsoleFontEx_t *m_SetCurrentConsoleFontEx;
 };
@@ -455,6 +457,7 @@ static void dumpVistaFont(VistaFontAPI &api, HANDLE conout, const char *prefix)
     dumpFontInfoEx(infoex, prefix);
 }
 
+#ifndef WINPTY_TARGET_WIN10
 static void dumpXPFont(XPFontAPI &api, HANDLE conout, const char *prefix) {
     if (!isTracingEnabled()) {
         return;
@@ -469,6 +472,7 @@ static void dumpXPFont(XPFontAPI &api, HANDLE conout, const char *prefix) {
         static_cast<unsigned>(info.nFont),
         info.dwFontSize.X, info.dwFontSize.Y);
 }
+#endif // WINPTY_TARGET_WIN10
 
 static bool setFontVista(
         VistaFontAPI &api,
@@ -599,12 +603,78 @@ static Font selectSmallFont(int codePage, int columns, bool isNewW10) {
     return Font { faceName, fontFamily, table[bestIndex].size };
 }
 
+// The font that worked on a previous start is remembered in the registry, so
+// later agents can skip the attempts that failed, and on XP, the font table
+// enumeration.  Entries are keyed by the Windows build, so an OS upgrade
+// starts over.  Only successes are recorded, in case a font is installed
+// later.
+const wchar_t kFontCacheKey[] = L"Software\\winpty\\ConsoleFontCache";
+
+static std::wstring fontCacheName(const wchar_t *api, int codePage,
+                                  int columns, bool isNewW10) {
+    return (WStringBuilder(64)
+        << api << L'-' << windowsBuildNumber()
+        << L"-cp" << codePage
+        << L"-c" << columns
+        << (isNewW10 ? L"-w10" : L"")).str_moved();
+}
+
+static bool readFontCache(const std::wstring &name, DWORD &value) {
+    if (hasDebugFlag("no_font_cache")) {
+        return false;
+    }
+    HKEY key = nullptr;
+    if (RegOpenKeyExW(HKEY_CURRENT_USER, kFontCacheKey, 0,
+                      KEY_QUERY_VALUE, &key) != ERROR_SUCCESS) {
+        return false;
+    }
+    DWORD type = 0;
+    DWORD size = sizeof(value);
+    const LONG ret = RegQueryValueExW(key, name.c_str(), nullptr, &type,
+                                      reinterpret_cast<BYTE*>(&value), &size);
+    RegCloseKey(key);
+    return ret == ERROR_SUCCESS && type == REG_DWORD && size == sizeof(value);
+}
+
+static void writeFontCache(const std::wstring &name, DWORD value) {
+    if (hasDebugFlag("no_font_cache")) {
+        return;
+    }
+    HKEY key = nullptr;
+    if (RegCreateKeyExW(HKEY_CURRENT_USER, kFontCacheKey, 0, nullptr, 0,
+                        KEY_SET_VALUE, nullptr, &key,
+                        nullptr) != ERROR_SUCCESS) {
+        trace("writeFontCache: could not open the registry key");
+        return;
+    }
+    RegSetValueExW(key, name.c_str(), 0, REG_DWORD,
+                   reinterpret_cast<const BYTE*>(&value), sizeof(value));
+    RegCloseKey(key);
+}
+
+// The Vista cache records which of selectSmallFont's choices worked.
+enum : DWORD { kCodePageFont = 0, kFallbackFont = 1 };
+
 static void setSmallFontVista(VistaFontAPI &api, HANDLE conout,
                               int columns, bool isNewW10) {
     int codePage = GetConsoleOutputCP();
+    const auto cacheName =
+        fontCacheName(L"vista", codePage, columns, isNewW10);
+    DWORD cached = 0;
+    if (readFontCache(cacheName, cached) &&
+            (cached == kCodePageFont || cached == kFallbackFont)) {
+        const auto fontC = selectSmallFont(
+            cached == kCodePageFont ? codePage : 0, columns, isNewW10);
+        if (setFontVista(api, conout, fontC)) {
+            trace("setSmallFontVista: cached font was successful");
+            return;
+        }
+        trace("setSmallFontVista: cached font failed");
+    }
     const auto font = selectSmallFont(codePage, columns, isNewW10);
     if (setFontVista(api, conout, font)) {
         trace("setSmallFontVista: success");
+        writeFontCache(cacheName, kCodePageFont);
         return;
     }
     if (codePage == 932 || codePage == 936 ||
@@ -613,12 +683,14 @@ static void setSmallFontVista(VistaFontAPI &api, HANDLE conout,
         const auto fontFB = selectSmallFont(0, columns, isNewW10);
         if (setFontVista(api, conout, fontFB)) {
             trace("setSmallFontVista: fallback was successful");
+            writeFontCache(cacheName, kFallbackFont);
             return;
         }
     }
     trace("setSmallFontVista: failure");
 }
 
+#ifndef WINPTY_TARGET_WIN10
 struct FontSizeComparator {
     bool operator()(const std::pair<DWORD, COORD> &obj1,
                     const std::pair<DWORD, COORD> &obj2) const {
@@ -628,7 +700,41 @@ struct FontSizeComparator {
     }
 };
 
+// Sets the font at `index` in the console font table, returning true if the
+// console accepted it.
+static bool setFontXP(UndocumentedXPFontAPI &api, HANDLE conout, DWORD index) {
+    trace("setSmallFontXP: setting font to %u",
+        static_cast<unsigned>(index));
+    if (!api.SetConsoleFont()(conout, index)) {
+        trace("setSmallFontXP: SetConsoleFont call failed");
+        return false;
+    }
+    AGENT_CONSOLE_FONT_INFO info;
+    if (!api.GetCurrentConsoleFont()(conout, FALSE, &info)) {
+        trace("setSmallFontXP: GetCurrentConsoleFont call failed");
+        return false;
+    }
+    if (info.nFont != index) {
+        trace("setSmallFontXP: font was not set");
+        dumpXPFont(api, conout, "setSmallFontXP: post-call font: ");
+        return false;
+    }
+    return true;
+}
+
 static void setSmallFontXP(UndocumentedXPFontAPI &api, HANDLE conout) {
+    // The XP font table depends on the code page, but not the column count.
+    const auto cacheName =
+        fontCacheName(L"xp", GetConsoleOutputCP(), 0, false);
+    DWORD cached = 0;
+    if (readFontCache(cacheName, cached)) {
+        if (setFontXP(api, conout, cached)) {
+            trace("setSmallFontXP: cached font was successful");
+            return;
+        }
+        trace("setSmallFontXP: cached font failed");
+    }
+
     // Read the console font table and sort it from smallest to largest.
     const DWORD fontCount = api.GetNumberOfConsoleFonts()();
     trace("setSmallFontXP: number of console fonts: %u",
@@ -641,27 +747,16 @@ static void setSmallFontXP(UndocumentedXPFontAPI &api, HANDLE conout) {
         if (table[i].second.X < 4) {
             continue;
         }
-        trace("setSmallFontXP: setting font to %u",
-            static_cast<unsigned>(table[i].first));
-        if (!api.SetConsoleFont()(conout, table[i].first)) {
-            trace("setSmallFontXP: SetConsoleFont call failed");
-            continue;
-        }
-        AGENT_CONSOLE_FONT_INFO info;
-        if (!api.GetCurrentConsoleFont()(conout, FALSE, &info)) {
-            trace("setSmallFontXP: GetCurrentConsoleFont call failed");
-            return;
-        }
-        if (info.nFont != table[i].first) {
-            trace("setSmallFontXP: font was not set");
-            dumpXPFont(api, conout, "setSmallFontXP: post-call font: ");
+        if (!setFontXP(api, conout, table[i].first)) {
             continue;
         }
         trace("setSmallFontXP: success");
+        writeFontCache(cacheName, table[i].first);
         return;
     }
     trace("setSmallFontXP: failure");
 }
+#endif // WINPTY_TARGET_WIN10
 
 } // anonymous namespace
 
@@ -684,6 +779,7 @@ void setSmallFont(HANDLE conout, int columns, bool isNewW10) {
         dumpFontTable(conout, "new font table: ");
         return;
     }
+#ifndef WINPTY_TARGET_WIN10
     UndocumentedXPFontAPI xp;
     if (xp.valid()) {
         dumpXPFont(xp, conout, "previous font: ");
@@ -693,6 +789,7 @@ void setSmallFont(HANDLE conout, int columns, bool isNewW10) {
         dumpFontTable(conout, "new font table: ");
         return;
     }
+#endif // WINPTY_TARGET_WIN10
     trace("setSmallFont: neither Vista nor XP APIs detected -- giving up");
     dumpFontTable(conout, "font table: ");
 }
@@ -29,13 +29,17 @@
 #include "../include/winpty_constants.h"
 
 #include "../shared/DebugClient.h"
+#include "../shared/Mutex.h"
 #include "../shared/StringBuilder.h"
+#include "../shared/UnicodeTranscode.h"
 #include "../shared/UnixCtrlChars.h"
 
 #include "ConsoleInputReencoding.h"
 #include "DebugShowInput.h"
 #include "DefaultInputMap.h"
 #include "DsrSender.h"
+#include "EtwTrace.h"
+#include "Profiler.h"
 #include "UnicodeEncoding.h"
 #include "Win32Console.h"
 
@@ -64,7 +68,17 @@ std::string MouseRecord::toString() const {
     return sb.str_moved();
 }
 
-const unsigned int kIncompleteEscapeTimeoutMs = 1000u;
+// Runs of printable input at least this long (e.g. pasted text) bypass
+// scanInput.
+const size_t kPrintableRunMinLength = 16;
+
+// VkKeyScan returns -1 for an unmapped character, so use -2 as a placeholder.
+const short kUnknownCharScan = -2;
+
+// Bound each WriteConsoleInputW call, so a large paste reaches the console
+// in pieces rather than as one huge record array.  (Before Windows 8, a
+// single console API call can only transfer about 64KB.)
+const size_t kMaxInputRecordsPerWrite = 2048;
 
 #define CHECK(cond)                                 \
         do {                                        \
@@ -190,16 +204,49 @@ static int matchMouseRecord(const char *input, int inputSize, MouseRecord &out)
 #undef ADVANCE
 #undef SCAN_INT
 
+// Returns the length of the run of bytes at the start of the input that are
+// neither C0 control characters nor DEL, testing eight bytes at a time.
+static size_t printableRunLength(const char *input, size_t inputSize)
+{
+    const uint64_t kOnes = 0x0101010101010101ull;
+    const uint64_t kHighBits = 0x8080808080808080ull;
+    size_t i = 0;
+    for (; i + 8 <= inputSize; i += 8) {
+        uint64_t v;
+        memcpy(&v, &input[i], sizeof(v));
+        // Flags a byte that is less than 0x20 or is equal to 0x7F.
+        const uint64_t del = v ^ (kOnes * 0x7F);
+        if (((v - kOnes * 0x20) & ~v & kHighBits) ||
+                ((del - kOnes) & ~del & kHighBits)) {
+            break;
+        }
+    }
+    for (; i < inputSize; ++i) {
+        const unsigned char ch = input[i];
+        if (ch < 0x20 || ch == 0x7F) {
+            break;
+        }
+    }
+    return i;
+}
+
+static bool isPlainMouseMove(const INPUT_RECORD &record)
+{
+    return record.EventType == MOUSE_EVENT &&
+        record.Event.MouseEvent.dwEventFlags == MOUSE_MOVED;
+}
+
 } // anonymous namespace
 
-ConsoleInput::ConsoleInput(HANDLE conin, int mouseMode, DsrSender &dsrSender,
-                           Win32Console &console) :
+ConsoleInput::ConsoleInput(HANDLE conin, int mouseMode, int escapeTimeoutMs,
+                           DsrSender &dsrSender, Win32Console &console) :
     m_console(console),
     m_conin(conin),
     m_mouseMode(mouseMode),
-    m_dsrSender(dsrSender)
+    m_escapeTimeoutMs(escapeTimeoutMs),
+    m_dsrSender(dsrSender),
+    m_inputMap(kDefaultInputMapTable)
 {
-    addDefaultEntriesToInputMap(m_inputMap);
     if (hasDebugFlag("dump_input_map")) {
         m_inputMap.dumpInputMap();
     }
@@ -231,46 +278,53 @@ ConsoleInput::ConsoleInput(HANDLE conin, int mouseMode, DsrSender &dsrSender,
         }
     }
 
-    updateInputFlags(true);
+    updateInputFlags(inputConsoleMode(), true);
 }
 
-void ConsoleInput::writeInput(const std::string &input)
+// The input is decoded where it is, and only the bytes left undecoded (e.g.
+// an incomplete escape sequence) are copied into m_byteQueue.  Once bytes are
+// queued, new input is appended to them.
+void ConsoleInput::writeInput(const char *input, size_t size)
 {
-    if (input.size() == 0) {
+    PROFILE_ZONE("input.decode");
+    if (size == 0) {
         return;
     }
 
-    if (isTracingEnabled()) {
-        static bool debugInput = hasDebugFlag("input");
-        if (debugInput) {
-            std::string dumpString;
-            for (size_t i = 0; i < input.size(); ++i) {
-                const char ch = input[i];
-                const char ctrl = decodeUnixCtrlChar(ch);
-                if (ctrl != '\0') {
-                    dumpString += '^';
-                    dumpString += ctrl;
-                } else {
-                    dumpString += ch;
-                }
+    if (isTraceCategoryEnabled(kTraceInput)) {
+        std::string dumpString;
+        for (size_t i = 0; i < size; ++i) {
+            const char ch = input[i];
+            const char ctrl = decodeUnixCtrlChar(ch);
+            if (ctrl != '\0') {
+                dumpString += '^';
+                dumpString += ctrl;
+            } else {
+                dumpString += ch;
             }
-            dumpString += " (";
-            for (size_t i = 0; i < input.size(); ++i) {
-                if (i > 0) {
-                    dumpString += ' ';
-                }
-                const unsigned char uch = input[i];
-                char buf[32];
-                winpty_snprintf(buf, "%02X", uch);
-                dumpString += buf;
+        }
+        dumpString += " (";
+        for (size_t i = 0; i < size; ++i) {
+            if (i > 0) {
+                dumpString += ' ';
             }
-            dumpString += ')';
-            trace("input chars: %s", dumpString.c_str());
+            const unsigned char uch = input[i];
+            char buf[32];
+            winpty_snprintf(buf, "%02X", uch);
+            dumpString += buf;
         }
+        dumpString += ')';
+        trace("input chars: %s", dumpString.c_str());
     }
 
-    m_byteQueue.append(input);
-    doWrite(false);
+    if (m_byteQueue.empty()) {
+        const size_t consumed = scanAndWrite(input, size, false);
+        m_byteQueue.assign(input + consumed, size - consumed);
+        m_byteQueueStart = 0;
+    } else {
+        m_byteQueue.append(input, size);
+        doWrite(false);
+    }
     if (!m_byteQueue.empty() && !m_dsrSent) {
         trace("send DSR");
         m_dsrSender.sendDsr();
@@ -279,18 +333,31 @@ void ConsoleInput::writeInput(const std::string &input)
     m_lastWriteTick = GetTickCount();
 }
 
+// Returns the number of milliseconds until flushIncompleteEscapeCode will
+// flush the queued input, or -1 if nothing is queued.
+int ConsoleInput::incompleteEscapeDelay()
+{
+    if (m_byteQueue.empty()) {
+        return -1;
+    }
+    const DWORD elapsed = GetTickCount() - m_lastWriteTick;
+    return elapsed >= m_escapeTimeoutMs ?
+        0 : static_cast<int>(m_escapeTimeoutMs - elapsed);
+}
+
 void ConsoleInput::flushIncompleteEscapeCode()
 {
     if (!m_byteQueue.empty() &&
-            (GetTickCount() - m_lastWriteTick) > kIncompleteEscapeTimeoutMs) {
+            (GetTickCount() - m_lastWriteTick) >= m_escapeTimeoutMs) {
         doWrite(true);
         m_byteQueue.clear();
+        m_byteQueueStart = 0;
     }
 }
 
-void ConsoleInput::updateInputFlags(bool forceTrace)
+// The caller passes the CONIN mode (e.g. from the tick's ConsoleSnapshot).
+void ConsoleInput::updateInputFlags(DWORD mode, bool forceTrace)
 {
-    const DWORD mode = inputConsoleMode();
     const bool newFlagEE = (mode & ENABLE_EXTENDED_FLAGS) != 0;
     const bool newFlagMI = (mode & ENABLE_MOUSE_INPUT) != 0;
     const bool newFlagQE = (mode & ENABLE_QUICK_EDIT_MODE) != 0;
@@ -310,21 +377,23 @@ void ConsoleInput::updateInputFlags(bool forceTrace)
     m_mouseInputEnabled = newFlagMI;
     m_quickEditEnabled = newFlagQE;
     m_escapeInputEnabled = newFlagEI;
+    m_inputMode = mode;
 }
 
-bool ConsoleInput::shouldActivateTerminalMouse()
+bool ConsoleInput::shouldActivateTerminalMouse(int mouseMode, DWORD inputMode)
 {
     // Return whether the agent should activate the terminal's mouse mode.
-    if (m_mouseMode == WINPTY_MOUSE_MODE_AUTO) {
+    if (mouseMode == WINPTY_MOUSE_MODE_AUTO) {
         // Some programs (e.g. Cygwin command-line programs like bash.exe and
         // python2.7.exe) turn off ENABLE_EXTENDED_FLAGS and turn on
         // ENABLE_MOUSE_INPUT, but do not turn off QuickEdit mode and do not
         // actually care about mouse input.  Only enable the terminal mouse
         // mode if ENABLE_EXTENDED_FLAGS is on.  See
         // misc/EnableExtendedFlags.txt.
-        return m_mouseInputEnabled && !m_quickEditEnabled &&
-                m_enableExtendedEnabled;
-    } else if (m_mouseMode == WINPTY_MOUSE_MODE_FORCE) {
+        return (inputMode & ENABLE_MOUSE_INPUT) &&
+                !(inputMode & ENABLE_QUICK_EDIT_MODE) &&
+                (inputMode & ENABLE_EXTENDED_FLAGS);
+    } else if (mouseMode == WINPTY_MOUSE_MODE_FORCE) {
         return true;
     } else {
         return false;
@@ -333,17 +402,84 @@ bool ConsoleInput::shouldActivateTerminalMouse()
 
 void ConsoleInput::doWrite(bool isEof)
 {
-    const char *data = m_byteQueue.c_str();
-    std::vector<INPUT_RECORD> records;
+    const size_t idx = m_byteQueueStart +
+        scanAndWrite(m_byteQueue.data() + m_byteQueueStart,
+                     m_byteQueue.size() - m_byteQueueStart, isEof);
+    // Leave any unconsumed bytes (e.g. an incomplete escape sequence) in
+    // place, and only shift them down once the consumed bytes are most of
+    // the queue.
+    if (idx == m_byteQueue.size()) {
+        m_byteQueue.clear();
+        m_byteQueueStart = 0;
+    } else if (idx > m_byteQueue.size() / 2) {
+        m_byteQueue.erase(0, idx);
+        m_byteQueueStart = 0;
+    } else {
+        m_byteQueueStart = idx;
+    }
+}
+
+// Converts as much of the input as is complete into input records and
+// writes them.  Returns the number of bytes consumed.
+size_t ConsoleInput::scanAndWrite(const char *data, size_t size, bool isEof)
+{
+    std::vector<INPUT_RECORD> &records = m_records;
+    ASSERT(records.empty());
     size_t idx = 0;
-    while (idx < m_byteQueue.size()) {
-        int charSize = scanInput(records, &data[idx], m_byteQueue.size() - idx, isEof);
-        if (charSize == -1)
-            break;
-        idx += charSize;
+    while (idx < size) {
+        const size_t runLength = printableRunLength(&data[idx], size - idx);
+        if (runLength >= kPrintableRunMinLength) {
+            idx += scanPrintableRun(records, &data[idx], runLength);
+        } else {
+            int charSize = scanInput(records, &data[idx], size - idx, isEof);
+            if (charSize == -1)
+                break;
+            idx += charSize;
+        }
+        if (records.size() >= kMaxInputRecordsPerWrite) {
+            flushInputRecords(records);
+        }
     }
-    m_byteQueue.erase(0, idx);
     flushInputRecords(records);
+    return idx;
+}
+
+// Converts a run of printable bytes to key presses.  None of the sequences
+// scanInput looks for (Ctrl-C, DSR replies, mouse reports, and the input
+// map's encodings) begin with a printable byte, so each character is
+// handled just as scanInput would handle it, only faster.  Returns the
+// number of bytes consumed, which stops short of a UTF-8 character that
+// extends past the run, leaving it to scanInput.
+size_t ConsoleInput::scanPrintableRun(std::vector<INPUT_RECORD> &records,
+                                      const char *input,
+                                      size_t runLength)
+{
+    // The keyboard layout won't change during the run, so look up each ASCII
+    // character's key only once.
+    short asciiScan[128];
+    std::fill(asciiScan, asciiScan + 128, kUnknownCharScan);
+    size_t idx = 0;
+    while (idx < runLength) {
+        const unsigned char ch = input[idx];
+        if (ch < 0x80) {
+            if (asciiScan[ch] == kUnknownCharScan) {
+                asciiScan[ch] = VkKeyScan(ch);
+            }
+            appendCodePoint(records, ch, asciiScan[ch], false);
+            ++idx;
+        } else {
+            const int len = appendUtf8Char(
+                records, &input[idx], runLength - idx, false);
+            if (len == 0) {
+                break;
+            }
+            idx += len;
+        }
+        if (records.size() >= kMaxInputRecordsPerWrite) {
+            flushInputRecords(records);
+        }
+    }
+    return idx;
 }
 
 void ConsoleInput::flushInputRecords(std::vector<INPUT_RECORD> &records)
@@ -351,10 +487,23 @@ void ConsoleInput::flushInputRecords(std::vector<INPUT_RECORD> &records)
     if (records.size() == 0) {
         return;
     }
+    EtwScope etwScope(kEtwFlushInputRecords,
+                      static_cast<uint32_t>(records.size()));
+    PROFILE_ZONE("input.flush");
+#ifdef CONSOLE_INPUT_TESTING
+    if (m_recordSink != nullptr) {
+        m_recordSink->insert(m_recordSink->end(),
+                             records.begin(), records.end());
+        m_inputRecordsWritten += records.size();
+        records.clear();
+        return;
+    }
+#endif
     DWORD actual = 0;
     if (!WriteConsoleInputW(m_conin, records.data(), records.size(), &actual)) {
         trace("WriteConsoleInputW failed");
     }
+    m_inputRecordsWritten += actual;
     records.clear();
 }
 
@@ -454,34 +603,25 @@ int ConsoleInput::scanInput(std::vector<INPUT_RECORD> &records,
     // than the DSR flushing mechanism or use a decrepit terminal.  The user
     // might be on a slow network connection.)
     if (input[0] == '\x1B' && inputSize >= 2 && input[1] != '\x1B') {
-        const int len = utf8CharLength(input[1]);
-        if (len > 0) {
-            if (1 + len > inputSize) {
+        if (utf8CharLength(input[1]) > 0) {
+            const int len = appendUtf8Char(
+                records, &input[1], inputSize - 1, true);
+            if (len == 0) {
                 // Incomplete character.
                 trace("Incomplete UTF-8 character in Alt-<Char>");
                 return -1;
             }
-            appendUtf8Char(records, &input[1], len, true);
             return 1 + len;
         }
     }
 
     // A UTF-8 character.
-    const int len = utf8CharLength(input[0]);
+    const int len = appendUtf8Char(records, &input[0], inputSize, false);
     if (len == 0) {
-        static bool debugInput = isTracingEnabled() && hasDebugFlag("input");
-        if (debugInput) {
-            trace("Discarding invalid input byte: %02X",
-                static_cast<unsigned char>(input[0]));
-        }
-        return 1;
-    }
-    if (len > inputSize) {
         // Incomplete character.
         trace("Incomplete UTF-8 character");
         return -1;
     }
-    appendUtf8Char(records, &input[0], len, false);
     return len;
 }
 
@@ -495,12 +635,7 @@ int ConsoleInput::scanMouseInput(std::vector<INPUT_RECORD> &records,
         return len;
     }
 
-    if (isTracingEnabled()) {
-        static bool debugInput = hasDebugFlag("input");
-        if (debugInput) {
-            trace("mouse input: %s", record.toString().c_str());
-        }
-    }
+    TRACE_CAT(kTraceInput, "mouse input: %s", record.toString().c_str());
 
     const int button = record.flags & 0x03;
     INPUT_RECORD newRecord = {0};
@@ -585,40 +720,68 @@ int ConsoleInput::scanMouseInput(std::vector<INPUT_RECORD> &records,
     mer.dwButtonState |= m_mouseButtonState;
 
     if (m_mouseInputEnabled && !m_quickEditEnabled) {
-        if (isTracingEnabled()) {
-            static bool debugInput = hasDebugFlag("input");
-            if (debugInput) {
-                trace("mouse event: %s", mouseEventToString(mer).c_str());
-            }
+        TRACE_CAT(kTraceInput, "mouse event: %s",
+            mouseEventToString(mer).c_str());
+
+        // Terminals report motion far more often than a console program
+        // can use it.  A motion report that follows another in this batch,
+        // with no change in buttons or modifiers, replaces it.  (Button
+        // transitions are never merged, and double-click detection above
+        // still sees every report.)
+        if (!records.empty() &&
+                isPlainMouseMove(records.back()) &&
+                isPlainMouseMove(newRecord) &&
+                records.back().Event.MouseEvent.dwButtonState ==
+                    mer.dwButtonState &&
+                records.back().Event.MouseEvent.dwControlKeyState ==
+                    mer.dwControlKeyState) {
+            records.back() = newRecord;
+        } else {
+            records.push_back(newRecord);
         }
-
-        records.push_back(newRecord);
     }
 
     return len;
 }
 
-void ConsoleInput::appendUtf8Char(std::vector<INPUT_RECORD> &records,
-                                  const char *charBuffer,
-                                  const int charLen,
-                                  const bool terminalAltEscape)
+// Decodes the UTF-8 character at the start of `input` and appends its
+// records.  Returns the number of bytes consumed, or 0 if the input ends
+// partway through the character.  An invalid sequence is consumed and
+// discarded.
+int ConsoleInput::appendUtf8Char(std::vector<INPUT_RECORD> &records,
+                                 const char *input,
+                                 const size_t inputSize,
+                                 const bool terminalAltEscape)
 {
-    const uint32_t codePoint = decodeUtf8(charBuffer);
-    if (codePoint == static_cast<uint32_t>(-1)) {
-        static bool debugInput = isTracingEnabled() && hasDebugFlag("input");
-        if (debugInput) {
+    uint32_t codePoint;
+    const int charLen = decodeUtf8Sequence(input, inputSize, codePoint);
+    if (charLen == 0) {
+        return 0;
+    }
+    if (codePoint == kInvalidCodePoint) {
+        if (isTraceCategoryEnabled(kTraceInput)) {
             StringBuilder error(64);
             error << "Discarding invalid UTF-8 sequence:";
             for (int i = 0; i < charLen; ++i) {
                 error << ' ';
-                error << hexOfInt<true, uint8_t>(charBuffer[i]);
+                error << hexOfInt<true, uint8_t>(input[i]);
             }
             trace("%s", error.c_str());
         }
-        return;
+        return charLen;
     }
 
     const short charScan = codePoint > 0xFFFF ? -1 : VkKeyScan(codePoint);
+    appendCodePoint(records, codePoint, charScan, terminalAltEscape);
+    return charLen;
+}
+
+// Appends the key press for a character, given its VkKeyScan result.
+void ConsoleInput::appendCodePoint(std::vector<INPUT_RECORD> &records,
+                                   const uint32_t codePoint,
+                                   const short charScan,
+                                   const bool terminalAltEscape)
+{
     uint16_t virtualKey = 0;
     uint16_t winKeyState = 0;
     uint32_t winCodePointDn = codePoint;
@@ -672,13 +835,10 @@ void ConsoleInput::appendKeyPress(std::vector<INPUT_RECORD> &records,
     const bool enhanced = (winKeyState & ENHANCED_KEY) != 0;
     bool hasDebugInput = false;
 
-    if (isTracingEnabled()) {
-        static bool debugInput = hasDebugFlag("input");
-        if (debugInput) {
-            hasDebugInput = true;
-            InputMap::Key key = { virtualKey, winCodePointDn, winKeyState };
-            trace("keypress: %s", key.toString().c_str());
-        }
+    if (isTraceCategoryEnabled(kTraceInput)) {
+        hasDebugInput = true;
+        InputMap::Key key = { virtualKey, winCodePointDn, winKeyState };
+        trace("keypress: %s", key.toString().c_str());
     }
 
     if (m_escapeInputEnabled &&
@@ -693,6 +853,9 @@ void ConsoleInput::appendKeyPress(std::vector<INPUT_RECORD> &records,
         if (hasDebugInput) {
             trace("sending keypress to console HWND");
         }
+        // The input thread may get here while the agent's thread has the
+        // console frozen, and the selection would eat the key.
+        LockGuard<Mutex> guard(m_console.freezeLock());
         sendKeyMessage(m_console.hwnd(), true, virtualKey);
         sendKeyMessage(m_console.hwnd(), false, virtualKey);
         return;
@@ -38,28 +38,55 @@ class DsrSender;
 class ConsoleInput
 {
 public:
-    ConsoleInput(HANDLE conin, int mouseMode, DsrSender &dsrSender,
-                 Win32Console &console);
-    void writeInput(const std::string &input);
+    ConsoleInput(HANDLE conin, int mouseMode, int escapeTimeoutMs,
+                 DsrSender &dsrSender, Win32Console &console);
+    void writeInput(const char *input, size_t size);
+    void writeInput(const std::string &input) {
+        writeInput(input.data(), input.size());
+    }
+    int incompleteEscapeDelay();
     void flushIncompleteEscapeCode();
     void setMouseWindowRect(SmallRect val) { m_mouseWindowRect = val; }
-    void updateInputFlags(bool forceTrace=false);
-    bool shouldActivateTerminalMouse();
+    void updateInputFlags(DWORD inputMode, bool forceTrace=false);
+    bool shouldActivateTerminalMouse() {
+        return shouldActivateTerminalMouse(m_mouseMode, m_inputMode);
+    }
+    static bool shouldActivateTerminalMouse(int mouseMode, DWORD inputMode);
+    DWORD inputMode() const { return m_inputMode; }
+    int64_t inputRecordsWritten() const { return m_inputRecordsWritten; }
+    size_t queuedByteCount() const {
+        return m_byteQueue.size() - m_byteQueueStart;
+    }
+    size_t inputMapMemoryUsage() const { return m_inputMap.memoryUsage(); }
+
+#ifdef CONSOLE_INPUT_TESTING
+    // Appends the generated records to `sink` instead of writing them to
+    // CONIN, so the parser can run without a console input buffer.
+    void setRecordSink(std::vector<INPUT_RECORD> *sink) { m_recordSink = sink; }
+#endif // CONSOLE_INPUT_TESTING
 
 private:
     void doWrite(bool isEof);
+    size_t scanAndWrite(const char *data, size_t size, bool isEof);
     void flushInputRecords(std::vector<INPUT_RECORD> &records);
     int scanInput(std::vector<INPUT_RECORD> &records,
                   const char *input,
                   int inputSize,
                   bool isEof);
+    size_t scanPrintableRun(std::vector<INPUT_RECORD> &records,
+                            const char *input,
+                            size_t runLength);
     int scanMouseInput(std::vector<INPUT_RECORD> &records,
                        const char *input,
                        int inputSize);
-    void appendUtf8Char(std::vector<INPUT_RECORD> &records,
-                        const char *charBuffer,
-                        int charLen,
-                        bool terminalAltEscape);
+    int appendUtf8Char(std::vector<INPUT_RECORD> &records,
+                       const char *input,
+                       size_t inputSize,
+                       bool terminalAltEscape);
+    void appendCodePoint(std::vector<INPUT_RECORD> &records,
+                         uint32_t codePoint,
+                         short charScan,
+                         bool terminalAltEscape);
     void appendKeyPress(std::vector<INPUT_RECORD> &records,
                         uint16_t virtualKey,
                         uint32_t winCodePointDn,
@@ -87,12 +114,19 @@ private:
     Win32Console &m_console;
     HANDLE m_conin = nullptr;
     int m_mouseMode = 0;
+    DWORD m_escapeTimeoutMs = 0;
     DsrSender &m_dsrSender;
     bool m_dsrSent = false;
+    // Input bytes not yet converted, starting at m_byteQueueStart.  The
+    // queue and m_records keep their capacity, so steady-state input doesn't
+    // allocate.
     std::string m_byteQueue;
+    size_t m_byteQueueStart = 0;
+    std::vector<INPUT_RECORD> m_records;
     InputMap m_inputMap;
     DWORD m_lastWriteTick = 0;
     DWORD m_mouseButtonState = 0;
+    int64_t m_inputRecordsWritten = 0;
     struct DoubleClickDetection {
         DWORD button = 0;
         Coord pos;
@@ -103,7 +137,11 @@ private:
     bool m_mouseInputEnabled = false;
     bool m_quickEditEnabled = false;
     bool m_escapeInputEnabled = false;
+    DWORD m_inputMode = 0;
     SmallRect m_mouseWindowRect;
+#ifdef CONSOLE_INPUT_TESTING
+    std::vector<INPUT_RECORD> *m_recordSink = nullptr;
+#endif
 };
 
 #endif // CONSOLEINPUT_H
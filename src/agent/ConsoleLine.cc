@@ -25,6 +25,10 @@
 // output line and determines when a line has changed.  Detecting line changes
 // is made complicated by terminal resizing.
 //
+// The scraper keeps a ConsoleLine for every line of its buffer, so the
+// content is stored compactly: most lines are short text with one or two
+// color runs, followed by blanks.
+//
 
 #include "ConsoleLine.h"
 
@@ -32,44 +36,190 @@
 
 #include "../shared/WinptyAssert.h"
 
-static CHAR_INFO blankChar(WORD attributes)
+#include "CharInfoScan.h"
+
+static inline bool isLineBlank(const CHAR_INFO *line, int length, WORD attributes)
 {
-    // N.B.: As long as we write to UnicodeChar rather than AsciiChar, there
-    // are no padding bytes that could contain uninitialized bytes.  This fact
-    // is important for efficient comparison.
-    CHAR_INFO ret;
-    ret.Attributes = attributes;
-    ret.Char.UnicodeChar = L' ';
-    return ret;
+    return charInfoLineBlank(line, length, attributes);
+}
+
+void ConsoleLine::Content::clear()
+{
+    length = 0;
+    storedLength = 0;
+    blankAttributes = 0;
+    text.clear();
+    runs.clear();
+}
+
+// Swap explicitly, because MSVC 2013 doesn't generate move operations.
+void ConsoleLine::Content::swap(Content &other)
+{
+    std::swap(length, other.length);
+    std::swap(storedLength, other.storedLength);
+    std::swap(blankAttributes, other.blankAttributes);
+    text.swap(other.text);
+    runs.swap(other.runs);
 }
 
-static bool isLineBlank(const CHAR_INFO *line, int length, WORD attributes)
+void ConsoleLine::Content::append(WCHAR ch, WORD attributes)
 {
-    for (int col = 0; col < length; ++col) {
-        if (line[col].Attributes != attributes ||
-                line[col].Char.UnicodeChar != L' ') {
+    if (runs.empty() || runs.back().attributes != attributes) {
+        AttributeRun run = { static_cast<uint16_t>(text.size()), attributes };
+        runs.push_back(run);
+    }
+    text.push_back(ch);
+}
+
+void ConsoleLine::Content::append(const CHAR_INFO *cells, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        append(cells[i].Char.UnicodeChar, cells[i].Attributes);
+    }
+}
+
+// Appends the stored cells [begin, end) of another line.
+void ConsoleLine::Content::append(const Content &other, int begin, int end)
+{
+    ASSERT(end <= other.storedLength);
+    const int textEnd = std::min<int>(end, other.text.size());
+    for (int i = begin; i < textEnd; ++i) {
+        append(other.text[i], other.attributesAt(i));
+    }
+    for (int i = std::max(begin, textEnd); i < end; ++i) {
+        append(L' ', other.blankAttributes);
+    }
+}
+
+// Call after appending every cell.  The trailing blank cells are trimmed.
+void ConsoleLine::Content::finish(int newLength)
+{
+    storedLength = static_cast<int>(text.size());
+    length = newLength;
+    ASSERT(length <= storedLength);
+    if (runs.empty()) {
+        return;
+    }
+    blankAttributes = runs.back().attributes;
+    while (!text.empty() && text.back() == L' ' &&
+            runs.back().attributes == blankAttributes) {
+        text.pop_back();
+        if (runs.back().start == text.size()) {
+            runs.pop_back();
+            if (runs.empty()) {
+                break;
+            }
+        }
+    }
+    // Don't let a line that was once wide hold onto its memory.
+    if (text.capacity() > text.size() * 2 + 16) {
+        std::vector<WCHAR>(text).swap(text);
+    }
+    if (runs.capacity() > runs.size() * 2 + 4) {
+        std::vector<AttributeRun>(runs).swap(runs);
+    }
+}
+
+// Returns the run covering a cell of the (untrimmed) text.
+size_t ConsoleLine::Content::runIndex(int cell) const
+{
+    ASSERT(cell >= 0 && cell < static_cast<int>(text.size()));
+    const auto it = std::upper_bound(
+        runs.begin(), runs.end(), cell,
+        [](int c, const AttributeRun &run) { return c < run.start; });
+    return (it - runs.begin()) - 1;
+}
+
+WORD ConsoleLine::Content::attributesAt(int cell) const
+{
+    if (cell >= static_cast<int>(text.size())) {
+        return blankAttributes;
+    }
+    return runs[runIndex(cell)].attributes;
+}
+
+// Returns true if the stored cells [begin, end) are equal to the same cells of
+// `line`.
+bool ConsoleLine::Content::equalCells(
+    const CHAR_INFO *line, int begin, int end) const
+{
+    ASSERT(begin >= 0 && end <= storedLength);
+    const int textEnd = std::min<int>(end, text.size());
+    if (begin < textEnd) {
+        size_t r = runIndex(begin);
+        int i = begin;
+        while (i < textEnd) {
+            const int runEnd = r + 1 < runs.size()
+                ? std::min<int>(runs[r + 1].start, textEnd)
+                : textEnd;
+            if (charInfoFirstRunDifference(line + i, text.data() + i,
+                                           runEnd - i, runs[r].attributes)
+                    != runEnd - i) {
+                return false;
+            }
+            i = runEnd;
+            ++r;
+        }
+    }
+    const int blankBegin = std::max(begin, textEnd);
+    return isLineBlank(line + blankBegin, end - blankBegin, blankAttributes);
+}
+
+// Returns true if the stored cells [begin, end) are spaces with the given
+// attributes.
+bool ConsoleLine::Content::blankCells(
+    int begin, int end, WORD attributes) const
+{
+    ASSERT(begin >= 0 && end <= storedLength);
+    const int textEnd = std::min<int>(end, text.size());
+    for (int i = begin; i < textEnd; ++i) {
+        if (text[i] != L' ') {
             return false;
         }
     }
-    return true;
+    if (begin < textEnd) {
+        for (size_t r = runIndex(begin);
+                r < runs.size() && runs[r].start < textEnd; ++r) {
+            if (runs[r].attributes != attributes) {
+                return false;
+            }
+        }
+    }
+    return std::max(begin, textEnd) >= end || blankAttributes == attributes;
 }
 
-static inline bool areLinesEqual(
-    const CHAR_INFO *line1,
-    const CHAR_INFO *line2,
-    int length)
+// Writes the first `length` cells.
+void ConsoleLine::Content::decode(CHAR_INFO *out) const
 {
-    return memcmp(line1, line2, sizeof(CHAR_INFO) * length) == 0;
+    // N.B.: As long as we write to UnicodeChar rather than AsciiChar, there
+    // are no padding bytes that could contain uninitialized bytes.  This fact
+    // is important for efficient comparison.
+    const int textEnd = std::min<int>(length, text.size());
+    for (size_t r = 0; r < runs.size() && runs[r].start < textEnd; ++r) {
+        const int runEnd = r + 1 < runs.size()
+            ? std::min<int>(runs[r + 1].start, textEnd)
+            : textEnd;
+        for (int i = runs[r].start; i < runEnd; ++i) {
+            out[i].Char.UnicodeChar = text[i];
+            out[i].Attributes = runs[r].attributes;
+        }
+    }
+    for (int i = textEnd; i < length; ++i) {
+        out[i].Char.UnicodeChar = L' ';
+        out[i].Attributes = blankAttributes;
+    }
 }
 
-ConsoleLine::ConsoleLine() : m_prevLength(0)
+ConsoleLine::ConsoleLine()
 {
 }
 
 void ConsoleLine::reset()
 {
-    m_prevLength = 0;
-    m_prevData.clear();
+    m_content.clear();
+    m_replaced.clear();
+    m_hash = 0;
+    m_contentDropped = false;
 }
 
 // Determines whether the given line is sufficiently different from the
@@ -77,35 +227,44 @@ void ConsoleLine::reset()
 // also sets the `ConsoleLine` to the given line, exactly as if `setLine` had
 // been called.
 bool ConsoleLine::detectChangeAndSetLine(const CHAR_INFO *const line, const int newLength)
+{
+    return detectChangeAndSetLine(line, newLength,
+                                  charInfoLineHash(line, newLength));
+}
+
+// As above, but with the line's hash already computed (e.g. by
+// largeConsoleRead).
+bool ConsoleLine::detectChangeAndSetLine(const CHAR_INFO *const line,
+                                         const int newLength,
+                                         const uint64_t hash)
 {
     ASSERT(newLength >= 1);
-    ASSERT(m_prevLength <= static_cast<int>(m_prevData.size()));
+    const int prevLength = m_content.length;
 
-    if (newLength == m_prevLength) {
-        bool equalLines = areLinesEqual(m_prevData.data(), line, newLength);
+    if (newLength == prevLength) {
+        bool equalLines = hash == m_hash &&
+            (m_contentDropped || m_content.equalCells(line, 0, newLength));
         if (!equalLines) {
-            setLine(line, newLength);
+            setLine(line, newLength, hash);
         }
         return !equalLines;
     } else {
-        if (m_prevLength == 0) {
-            setLine(line, newLength);
+        if (prevLength == 0 || m_contentDropped) {
+            setLine(line, newLength, hash);
             return true;
         }
 
-        ASSERT(m_prevLength >= 1);
-        const WORD prevBlank = m_prevData[m_prevLength - 1].Attributes;
+        ASSERT(prevLength >= 1);
+        const WORD prevBlank = m_content.attributesAt(prevLength - 1);
         const WORD newBlank = line[newLength - 1].Attributes;
 
         bool equalLines = false;
-        if (newLength < m_prevLength) {
+        if (newLength < prevLength) {
             // The line has become shorter.  The lines are equal if the common
             // part is equal, and if the newly truncated characters were blank.
             equalLines =
-                areLinesEqual(m_prevData.data(), line, newLength) &&
-                isLineBlank(m_prevData.data() + newLength,
-                            m_prevLength - newLength,
-                            newBlank);
+                m_content.equalCells(line, 0, newLength) &&
+                m_content.blankCells(newLength, prevLength, newBlank);
         } else {
             //
             // The line has become longer.  The lines are equal if the common
@@ -120,33 +279,110 @@ bool ConsoleLine::detectChangeAndSetLine(const CHAR_INFO *const line, const int
             //  * https://github.com/mintty/mintty/issues/480
             //  * https://github.com/JetBrains/jediterm/issues/118
             //
-            ASSERT(newLength > m_prevLength);
+            ASSERT(newLength > prevLength);
             equalLines =
-                areLinesEqual(m_prevData.data(), line, m_prevLength) &&
-                isLineBlank(m_prevData.data() + m_prevLength,
-                            std::min<int>(m_prevData.size(), newLength) - m_prevLength,
-                            prevBlank) &&
-                isLineBlank(line + m_prevLength,
-                            newLength - m_prevLength,
+                m_content.equalCells(line, 0, prevLength) &&
+                m_content.blankCells(prevLength,
+                                     std::min(m_content.storedLength, newLength),
+                                     prevBlank) &&
+                isLineBlank(line + prevLength,
+                            newLength - prevLength,
                             prevBlank);
         }
-        setLine(line, newLength);
+        setLine(line, newLength, hash);
         return !equalLines;
     }
 }
 
 void ConsoleLine::setLine(const CHAR_INFO *const line, const int newLength)
 {
-    if (static_cast<int>(m_prevData.size()) < newLength) {
-        m_prevData.resize(newLength);
+    setLine(line, newLength, charInfoLineHash(line, newLength));
+}
+
+void ConsoleLine::setLine(const CHAR_INFO *const line, const int newLength,
+                          const uint64_t hash)
+{
+    // Keep the old content around so the terminal can diff against it.  The
+    // old content past the new length stays obscured in the new line.
+    m_content.swap(m_replaced);
+    if (m_contentDropped) {
+        m_replaced.clear();
+        m_contentDropped = false;
+    }
+    m_hash = hash;
+    m_content.clear();
+    m_content.append(line, newLength);
+    if (m_replaced.storedLength > newLength) {
+        m_content.append(m_replaced, newLength, m_replaced.storedLength);
     }
-    memcpy(m_prevData.data(), line, sizeof(CHAR_INFO) * newLength);
-    m_prevLength = newLength;
+    m_content.finish(newLength);
 }
 
 void ConsoleLine::blank(WORD attributes)
 {
-    m_prevData.resize(1);
-    m_prevData[0] = blankChar(attributes);
-    m_prevLength = 1;
+    m_content.clear();
+    m_content.append(L' ', attributes);
+    m_content.finish(1);
+    m_replaced.clear();
+    CHAR_INFO blankChar;
+    blankChar.Char.UnicodeChar = L' ';
+    blankChar.Attributes = attributes;
+    m_hash = charInfoLineHash(&blankChar, 1);
+    m_contentDropped = false;
+}
+
+bool ConsoleLine::equals(const CHAR_INFO *line, int length) const
+{
+    if (m_content.length != length) {
+        return false;
+    }
+    if (m_contentDropped) {
+        return charInfoLineHash(line, length) == m_hash;
+    }
+    return m_content.equalCells(line, 0, length);
+}
+
+void ConsoleLine::dropContent()
+{
+    if (m_contentDropped || m_content.length == 0) {
+        return;
+    }
+    const int length = m_content.length;
+    Content().swap(m_content);
+    Content().swap(m_replaced);
+    m_content.length = length;
+    m_contentDropped = true;
+}
+
+size_t ConsoleLine::memoryUsage() const
+{
+    return (m_content.text.capacity() + m_replaced.text.capacity()) *
+            sizeof(WCHAR) +
+        (m_content.runs.capacity() + m_replaced.runs.capacity()) *
+            sizeof(AttributeRun);
+}
+
+const CHAR_INFO *ConsoleLine::data(std::vector<CHAR_INFO> &buffer) const
+{
+    if (m_content.length == 0 || m_contentDropped) {
+        return nullptr;
+    }
+    if (buffer.size() < static_cast<size_t>(m_content.length)) {
+        buffer.resize(m_content.length);
+    }
+    m_content.decode(buffer.data());
+    return buffer.data();
+}
+
+const CHAR_INFO *ConsoleLine::replacedData(
+    std::vector<CHAR_INFO> &buffer) const
+{
+    if (m_replaced.length == 0) {
+        return nullptr;
+    }
+    if (buffer.size() < static_cast<size_t>(m_replaced.length)) {
+        buffer.resize(m_replaced.length);
+    }
+    m_replaced.decode(buffer.data());
+    return buffer.data();
 }
@@ -22,6 +22,7 @@
 #define CONSOLE_LINE_H
 
 #include <windows.h>
+#include <stdint.h>
 
 #include <vector>
 
@@ -31,11 +32,75 @@ public:
     ConsoleLine();
     void reset();
     bool detectChangeAndSetLine(const CHAR_INFO *line, int newLength);
+    bool detectChangeAndSetLine(const CHAR_INFO *line, int newLength,
+                                uint64_t hash);
     void setLine(const CHAR_INFO *line, int newLength);
+    void setLine(const CHAR_INFO *line, int newLength, uint64_t hash);
     void blank(WORD attributes);
+    int length() const { return m_content.length; }
+    // The width of the line's content without its trailing blank cells (but
+    // including any content past length()), or -1 if the content was
+    // dropped.
+    int contentWidth() const {
+        return m_contentDropped ? -1 : static_cast<int>(m_content.text.size());
+    }
+    bool equals(const CHAR_INFO *line, int length) const;
+    // The hash of the first length() cells (see charInfoLineHash).
+    uint64_t hash() const { return m_hash; }
+
+    // Frees the line's content but keeps its hash, e.g. once the line has
+    // been committed to the terminal and won't be diffed again.  Until the
+    // next setLine, a line with the same length and hash is assumed to be
+    // unchanged.
+    void dropContent();
+
+    // Decodes the line's first length() cells into `buffer`, or returns NULL
+    // if they are unknown (e.g. after a reset or dropContent).
+    const CHAR_INFO *data(std::vector<CHAR_INFO> &buffer) const;
+
+    // Decodes the content that the most recent setLine call replaced into
+    // `buffer`, or returns NULL if it is unknown (e.g. after a reset).
+    const CHAR_INFO *replacedData(std::vector<CHAR_INFO> &buffer) const;
+    int replacedLength() const { return m_replaced.length; }
+
+    // The heap bytes held by the line's content and replaced content.
+    size_t memoryUsage() const;
+
 private:
-    int m_prevLength;
-    std::vector<CHAR_INFO> m_prevData;
+    struct AttributeRun {
+        uint16_t start;
+        WORD attributes;
+    };
+
+    // A line is stored as its UTF-16 text and its runs of attributes, with
+    // trailing blank cells trimmed.  Cells past `length` are content that a
+    // longer line once had, which the terminal may still be displaying.
+    struct Content {
+        int length = 0;
+        int storedLength = 0;
+        WORD blankAttributes = 0;
+        std::vector<WCHAR> text;
+        std::vector<AttributeRun> runs;
+
+        void clear();
+        void swap(Content &other);
+        void append(WCHAR ch, WORD attributes);
+        void append(const CHAR_INFO *cells, int count);
+        void append(const Content &other, int begin, int end);
+        void finish(int newLength);
+        size_t runIndex(int cell) const;
+        WORD attributesAt(int cell) const;
+        bool equalCells(const CHAR_INFO *line, int begin, int end) const;
+        bool blankCells(int begin, int end, WORD attributes) const;
+        void decode(CHAR_INFO *out) const;
+    };
+
+    Content m_content;
+    Content m_replaced;
+    // The hash of the first m_content.length cells, which filters out most
+    // changed lines without comparing them.
+    uint64_t m_hash = 0;
+    bool m_contentDropped = false;
 };
 
 #endif // CONSOLE_LINE_H
@@ -0,0 +1,79 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "ConsoleSnapshot.h"
+
+#include "../shared/DebugClient.h"
+
+DWORD ConsoleSnapshot::inputMode()
+{
+    if (!m_haveInputMode) {
+        m_haveInputMode = true;
+        if (!GetConsoleMode(m_conin, &m_inputMode)) {
+            trace("GetConsoleMode failed");
+            m_inputMode = 0;
+        }
+    }
+    return m_inputMode;
+}
+
+// Returns 0 if the mode can't be queried.
+DWORD ConsoleSnapshot::outputMode(HANDLE conout)
+{
+    for (int i = 0; i < m_outputModeCount; ++i) {
+        if (m_outputModes[i].first == conout) {
+            return m_outputModes[i].second;
+        }
+    }
+    DWORD mode = 0;
+    if (!GetConsoleMode(conout, &mode)) {
+        mode = 0;
+    }
+    if (m_outputModeCount < kMaxOutputModes) {
+        m_outputModes[m_outputModeCount++] = std::make_pair(conout, mode);
+    }
+    return mode;
+}
+
+UINT ConsoleSnapshot::outputCodePage()
+{
+    if (!m_haveCodePage) {
+        m_haveCodePage = true;
+        m_codePage = GetConsoleOutputCP();
+    }
+    return m_codePage;
+}
+
+// The cursor of the active screen buffer, which every scraper reports.
+bool ConsoleSnapshot::cursorVisible()
+{
+    if (!m_haveCursorVisible) {
+        m_haveCursorVisible = true;
+        CONSOLE_CURSOR_INFO cursorInfo = {};
+        if (!GetConsoleCursorInfo(GetStdHandle(STD_OUTPUT_HANDLE),
+                                  &cursorInfo)) {
+            trace("GetConsoleCursorInfo failed");
+            m_cursorVisible = true;
+        } else {
+            m_cursorVisible = cursorInfo.bVisible != 0;
+        }
+    }
+    return m_cursorVisible;
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_CONSOLE_SNAPSHOT_H
+#define AGENT_CONSOLE_SNAPSHOT_H
+
+#include <windows.h>
+
+#include <utility>
+
+// The console state that several parts of a poll tick consult.  Each query is
+// an RPC to conhost, so each piece is fetched on first use and reused for the
+// rest of the tick.  Agent::onPollTimeout creates one per tick and hands it to
+// ConsoleInput and the scrapers.
+//
+// State that has to be rechecked within a tick, such as the buffer info that
+// a tentative scrape compares against after reading, is still queried
+// directly.
+class ConsoleSnapshot
+{
+public:
+    explicit ConsoleSnapshot(HANDLE conin) : m_conin(conin) {}
+    DWORD inputMode();
+    DWORD outputMode(HANDLE conout);
+    UINT outputCodePage();
+    bool cursorVisible();
+
+    ConsoleSnapshot(const ConsoleSnapshot &other) = delete;
+    ConsoleSnapshot &operator=(const ConsoleSnapshot &other) = delete;
+
+private:
+    HANDLE m_conin = nullptr;
+    bool m_haveInputMode = false;
+    DWORD m_inputMode = 0;
+    bool m_haveCodePage = false;
+    UINT m_codePage = 0;
+    bool m_haveCursorVisible = false;
+    bool m_cursorVisible = true;
+    // The output mode of each screen buffer asked about (at most the primary
+    // and error buffers).  A fixed array keeps the per-tick snapshot off the
+    // heap.
+    enum { kMaxOutputModes = 2 };
+    std::pair<HANDLE, DWORD> m_outputModes[kMaxOutputModes];
+    int m_outputModeCount = 0;
+};
+
+#endif // AGENT_CONSOLE_SNAPSHOT_H
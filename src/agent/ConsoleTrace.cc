@@ -0,0 +1,358 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "ConsoleTrace.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "../shared/DebugClient.h"
+#include "../shared/WinptyAssert.h"
+
+#include "Scraper.h"
+
+namespace {
+
+// The file starts with kMagic and kVersion, then holds records, each a type,
+// a payload size, and the payload.  The Options record comes first.
+const char kMagic[4] = { 'W', 'P', 'C', 'T' };
+const uint32_t kVersion = 1;
+
+enum RecordType : uint32_t {
+    kRecordOptions = 1,
+    kRecordScrape = 2,
+    kRecordBufferInfo = 3,
+    kRecordRead = 4,
+};
+
+struct ScrapeRecord {
+    int32_t top;
+    int32_t bottom;
+    int32_t left;
+    int32_t right;
+};
+
+const CHAR_INFO kBlankCell = { { L' ' }, ConsoleBuffer::kDefaultAttributes };
+
+// Forwards to the screen buffer copy kept by a replaying ConsoleTrace.
+class ReplayBuffer : public ConsoleBuffer {
+public:
+    explicit ReplayBuffer(ConsoleTrace &trace) : m_trace(trace) {}
+
+    virtual HANDLE conout() override { return nullptr; }
+    virtual void clearLines(int row, int count,
+                            const ConsoleScreenBufferInfo &info) override {
+        m_trace.replayFill(row, count, kDefaultAttributes);
+    }
+    virtual ConsoleScreenBufferInfo bufferInfo() override {
+        return m_trace.replayInfo();
+    }
+    virtual void resizeBuffer(const Coord &size) override {
+        m_trace.replayResize(size);
+    }
+    using ConsoleBuffer::resizeBufferRange;
+    virtual bool resizeBufferRange(const Coord &initialSize,
+                                   Coord &finalSize) override {
+        m_trace.replayResize(initialSize);
+        finalSize = initialSize;
+        return true;
+    }
+    virtual void moveWindow(const SmallRect &rect) override {
+        m_trace.replayInfo().srWindow = rect;
+    }
+    virtual void setCursorPosition(const Coord &point) override {
+        m_trace.replayInfo().dwCursorPosition = point;
+    }
+    virtual bool read(const SmallRect &rect, CHAR_INFO *data) override {
+        m_trace.replayRead(rect, data);
+        return true;
+    }
+    virtual void write(const SmallRect &rect,
+                       const CHAR_INFO *data) override {
+        m_trace.replayWrite(rect, data);
+    }
+    virtual void setTextAttribute(WORD attributes) override {
+        m_trace.replayInfo().wAttributes = attributes;
+    }
+
+private:
+    ConsoleTrace &m_trace;
+};
+
+} // anonymous namespace
+
+std::unique_ptr<ConsoleTrace> ConsoleTrace::createRecording(
+        const std::wstring &path, const Options &options)
+{
+    FILE *fp = _wfopen(path.c_str(), L"wb");
+    if (fp == nullptr) {
+        trace("ConsoleTrace: could not create %ls", path.c_str());
+        return nullptr;
+    }
+    std::unique_ptr<ConsoleTrace> ret(new ConsoleTrace);
+    ret->m_file = fp;
+    ret->m_options = options;
+    fwrite(kMagic, 1, sizeof(kMagic), fp);
+    fwrite(&kVersion, 1, sizeof(kVersion), fp);
+    ret->writeRecord(kRecordOptions, &options, sizeof(options));
+    trace("ConsoleTrace: recording to %ls", path.c_str());
+    return ret;
+}
+
+std::unique_ptr<ConsoleTrace> ConsoleTrace::openReplay(
+        const std::wstring &path)
+{
+    FILE *fp = _wfopen(path.c_str(), L"rb");
+    if (fp == nullptr) {
+        return nullptr;
+    }
+    std::unique_ptr<ConsoleTrace> ret(new ConsoleTrace);
+    ret->m_replaying = true;
+    char buf[64 * 1024];
+    size_t amount = 0;
+    while ((amount = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        ret->m_data.append(buf, amount);
+    }
+    fclose(fp);
+
+    uint32_t version = 0;
+    if (ret->m_data.size() < sizeof(kMagic) + sizeof(version) ||
+            memcmp(ret->m_data.data(), kMagic, sizeof(kMagic)) != 0) {
+        return nullptr;
+    }
+    memcpy(&version, ret->m_data.data() + sizeof(kMagic), sizeof(version));
+    if (version != kVersion) {
+        return nullptr;
+    }
+    ret->m_pos = sizeof(kMagic) + sizeof(version);
+
+    uint32_t type = 0;
+    const char *data = nullptr;
+    uint32_t size = 0;
+    if (!ret->readRecord(type, data, size) ||
+            type != kRecordOptions || size != sizeof(Options)) {
+        return nullptr;
+    }
+    memcpy(&ret->m_options, data, sizeof(Options));
+
+    // Apply what was read while the Scraper was constructed, up to the first
+    // scrape.
+    size_t pos = ret->m_pos;
+    while (ret->readRecord(type, data, size) && type != kRecordScrape) {
+        if (!ret->applyRecord(type, data, size)) {
+            return nullptr;
+        }
+        pos = ret->m_pos;
+    }
+    ret->m_pos = pos;
+    return ret;
+}
+
+ConsoleTrace::~ConsoleTrace()
+{
+    if (m_file != nullptr) {
+        fclose(m_file);
+    }
+}
+
+void ConsoleTrace::writeRecord(uint32_t type, const void *data, size_t size)
+{
+    ASSERT(!m_replaying);
+    const uint32_t size32 = static_cast<uint32_t>(size);
+    fwrite(&type, 1, sizeof(type), m_file);
+    fwrite(&size32, 1, sizeof(size32), m_file);
+    fwrite(data, 1, size, m_file);
+}
+
+void ConsoleTrace::recordScrape(const ChangedRegion &changed)
+{
+    const ScrapeRecord rec = {
+        changed.top, changed.bottom, changed.left, changed.right,
+    };
+    writeRecord(kRecordScrape, &rec, sizeof(rec));
+    // Keep finished scrapes if the agent is killed.
+    fflush(m_file);
+}
+
+void ConsoleTrace::recordBufferInfo(const CONSOLE_SCREEN_BUFFER_INFO &info)
+{
+    writeRecord(kRecordBufferInfo, &info, sizeof(info));
+}
+
+void ConsoleTrace::recordRead(const SMALL_RECT &rect, const CHAR_INFO *data)
+{
+    const SmallRect sr(rect);
+    const size_t cells = static_cast<size_t>(sr.width()) * sr.height();
+    std::string payload(sizeof(rect) + cells * sizeof(CHAR_INFO), '\0');
+    memcpy(&payload[0], &rect, sizeof(rect));
+    memcpy(&payload[sizeof(rect)], data, cells * sizeof(CHAR_INFO));
+    writeRecord(kRecordRead, payload.data(), payload.size());
+}
+
+bool ConsoleTrace::readRecord(uint32_t &type, const char *&data,
+                              uint32_t &size)
+{
+    if (m_data.size() - m_pos < sizeof(type) + sizeof(size)) {
+        return false;
+    }
+    memcpy(&type, &m_data[m_pos], sizeof(type));
+    memcpy(&size, &m_data[m_pos + sizeof(type)], sizeof(size));
+    const size_t start = m_pos + sizeof(type) + sizeof(size);
+    if (m_data.size() - start < size) {
+        // A recording cut off by the end of the agent.
+        return false;
+    }
+    data = &m_data[start];
+    m_pos = start + size;
+    return true;
+}
+
+bool ConsoleTrace::applyRecord(uint32_t type, const char *data, uint32_t size)
+{
+    if (type == kRecordBufferInfo) {
+        if (size != sizeof(CONSOLE_SCREEN_BUFFER_INFO)) {
+            return false;
+        }
+        CONSOLE_SCREEN_BUFFER_INFO info;
+        memcpy(&info, data, sizeof(info));
+        replayResize(info.dwSize);
+        memcpy(static_cast<CONSOLE_SCREEN_BUFFER_INFO*>(&m_info),
+               &info, sizeof(info));
+        return true;
+    } else if (type == kRecordRead) {
+        SMALL_RECT rect;
+        if (size < sizeof(rect)) {
+            return false;
+        }
+        memcpy(&rect, data, sizeof(rect));
+        const SmallRect sr(rect);
+        const size_t cells = static_cast<size_t>(std::max<int>(sr.width(), 0)) *
+            std::max<int>(sr.height(), 0);
+        if (size != sizeof(rect) + cells * sizeof(CHAR_INFO)) {
+            return false;
+        }
+        std::vector<CHAR_INFO> buf(cells);
+        memcpy(buf.data(), data + sizeof(rect), cells * sizeof(CHAR_INFO));
+        replayWrite(sr, buf.data());
+        return true;
+    }
+    return false;
+}
+
+std::unique_ptr<ConsoleBuffer> ConsoleTrace::createReplayBuffer()
+{
+    ASSERT(m_replaying);
+    return std::unique_ptr<ConsoleBuffer>(new ReplayBuffer(*this));
+}
+
+bool ConsoleTrace::nextScrape(ChangedRegion &changed)
+{
+    ASSERT(m_replaying);
+    uint32_t type = 0;
+    const char *data = nullptr;
+    uint32_t size = 0;
+    if (!readRecord(type, data, size) ||
+            type != kRecordScrape || size != sizeof(ScrapeRecord)) {
+        return false;
+    }
+    ScrapeRecord rec;
+    memcpy(&rec, data, sizeof(rec));
+    changed.top = rec.top;
+    changed.bottom = rec.bottom;
+    changed.left = rec.left;
+    changed.right = rec.right;
+    size_t pos = m_pos;
+    while (readRecord(type, data, size) && type != kRecordScrape) {
+        if (!applyRecord(type, data, size)) {
+            trace("ConsoleTrace: malformed record");
+            return false;
+        }
+        pos = m_pos;
+    }
+    m_pos = pos;
+    return true;
+}
+
+CHAR_INFO *ConsoleTrace::cellAt(int x, int y)
+{
+    const Coord size = m_info.bufferSize();
+    if (x < 0 || y < 0 || x >= size.X || y >= size.Y) {
+        return nullptr;
+    }
+    return &m_cells[static_cast<size_t>(y) * size.X + x];
+}
+
+void ConsoleTrace::replayRead(const SmallRect &rect, CHAR_INFO *data)
+{
+    for (int y = rect.Top; y <= rect.Bottom; ++y) {
+        for (int x = rect.Left; x <= rect.Right; ++x) {
+            const CHAR_INFO *cell = cellAt(x, y);
+            *data++ = cell != nullptr ? *cell : kBlankCell;
+        }
+    }
+}
+
+void ConsoleTrace::replayWrite(const SmallRect &rect, const CHAR_INFO *data)
+{
+    for (int y = rect.Top; y <= rect.Bottom; ++y) {
+        for (int x = rect.Left; x <= rect.Right; ++x) {
+            CHAR_INFO *cell = cellAt(x, y);
+            if (cell != nullptr) {
+                *cell = *data;
+            }
+            ++data;
+        }
+    }
+}
+
+void ConsoleTrace::replayFill(int row, int count, WORD attributes)
+{
+    const int width = m_info.bufferSize().X;
+    for (int y = row; y < row + count; ++y) {
+        for (int x = 0; x < width; ++x) {
+            CHAR_INFO *cell = cellAt(x, y);
+            if (cell != nullptr) {
+                cell->Char.UnicodeChar = L' ';
+                cell->Attributes = attributes;
+            }
+        }
+    }
+}
+
+void ConsoleTrace::replayResize(const Coord &size)
+{
+    const Coord oldSize = m_info.bufferSize();
+    if (size == oldSize) {
+        return;
+    }
+    const int width = std::max<int>(size.X, 0);
+    const int height = std::max<int>(size.Y, 0);
+    std::vector<CHAR_INFO> cells(static_cast<size_t>(width) * height,
+                                 kBlankCell);
+    for (int y = 0; y < std::min<int>(height, oldSize.Y); ++y) {
+        for (int x = 0; x < std::min<int>(width, oldSize.X); ++x) {
+            cells[static_cast<size_t>(y) * width + x] =
+                m_cells[static_cast<size_t>(y) * oldSize.X + x];
+        }
+    }
+    m_cells.swap(cells);
+    m_info.dwSize = size;
+}
@@ -0,0 +1,102 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_CONSOLE_TRACE_H
+#define AGENT_CONSOLE_TRACE_H
+
+#include <windows.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ConsoleBuffer.h"
+
+struct ChangedRegion;
+
+// A recording of what the primary Scraper saw of the console: each
+// GetConsoleScreenBufferInfo and ReadConsoleOutputW result, grouped by
+// scrape.  With the "console_trace" debug flag, the agent writes one to
+// %TEMP%\winpty-console-trace-<pid>.bin, and ScrapeReplay drives a Scraper
+// and Terminal from it with no console, so changes to diffing and encoding
+// can be measured repeatably.
+//
+// When replaying, the trace is the console: the ConsoleBuffer made by
+// createReplayBuffer reads and writes a copy of the screen buffer kept here.
+// Each nextScrape call applies the buffer info and cells recorded during the
+// next scrape, so a replayed scrape sees the console as it was by the end of
+// the recorded one.
+class ConsoleTrace {
+public:
+    // The agent settings that affect scraping.
+    struct Options {
+        uint64_t agentFlags = 0;
+        int32_t cols = 0;
+        int32_t rows = 0;
+        int32_t bufferLineCount = 0;
+        int32_t scrollbackBudget = 0;
+        int32_t newW10 = 0;
+    };
+
+    static std::unique_ptr<ConsoleTrace> createRecording(
+        const std::wstring &path, const Options &options);
+    static std::unique_ptr<ConsoleTrace> openReplay(const std::wstring &path);
+    ~ConsoleTrace();
+
+    ConsoleTrace(const ConsoleTrace &other) = delete;
+    ConsoleTrace &operator=(const ConsoleTrace &other) = delete;
+
+    bool replaying() const { return m_replaying; }
+    const Options &options() const { return m_options; }
+
+    // Recording.
+    void recordScrape(const ChangedRegion &changed);
+    void recordBufferInfo(const CONSOLE_SCREEN_BUFFER_INFO &info);
+    void recordRead(const SMALL_RECT &rect, const CHAR_INFO *data);
+
+    // Replaying.  The buffer refers to the trace, which must outlive it.
+    std::unique_ptr<ConsoleBuffer> createReplayBuffer();
+    bool nextScrape(ChangedRegion &changed);
+    ConsoleScreenBufferInfo &replayInfo() { return m_info; }
+    void replayRead(const SmallRect &rect, CHAR_INFO *data);
+    void replayWrite(const SmallRect &rect, const CHAR_INFO *data);
+    void replayFill(int row, int count, WORD attributes);
+    void replayResize(const Coord &size);
+
+private:
+    ConsoleTrace() {}
+    void writeRecord(uint32_t type, const void *data, size_t size);
+    bool readRecord(uint32_t &type, const char *&data, uint32_t &size);
+    bool applyRecord(uint32_t type, const char *data, uint32_t size);
+    CHAR_INFO *cellAt(int x, int y);
+
+    bool m_replaying = false;
+    Options m_options;
+    FILE *m_file = nullptr;
+
+    std::string m_data;
+    size_t m_pos = 0;
+    ConsoleScreenBufferInfo m_info;
+    std::vector<CHAR_INFO> m_cells;
+};
+
+#endif // AGENT_CONSOLE_TRACE_H
@@ -21,8 +21,11 @@
 #ifndef DEFAULT_INPUT_MAP_H
 #define DEFAULT_INPUT_MAP_H
 
-class InputMap;
+#include "InputMap.h"
 
 void addDefaultEntriesToInputMap(InputMap &inputMap);
 
+// The default entries, compiled into a table by GenInputMapTable.cc.
+extern const InputMap::Table kDefaultInputMapTable;
+
 #endif // DEFAULT_INPUT_MAP_H
@@ -0,0 +1,3522 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Generated by GenInputMapTable.cc from DefaultInputMap.cc.  Do not edit.
+
+#include "DefaultInputMap.h"
+
+#include <windows.h>
+
+#include "InputMap.h"
+
+namespace {
+
+// { firstChild, childCount, { virtualKey, unicodeChar, keyState } }
+const InputMap::TableNode kNodes[] = {
+    { 1, 3, { 0, 0, 0 } },
+    { 4, 0, { 'C', 0x03, LEFT_CTRL_PRESSED } },
+    { 4, 4, { 0, 0, 0 } },
+    { 8, 0, { VK_BACK, 0x08, 0 } },
+    { 8, 2, { 0, 0, 0 } },
+    { 10, 39, { 0, 0, 0 } },
+    { 49, 38, { 0, 0, 0 } },
+    { 87, 0, { VK_BACK, 0x08, LEFT_ALT_PRESSED } },
+    { 87, 34, { 0, 0, 0 } },
+    { 121, 37, { 0, 0, 0 } },
+    { 158, 1, { 0, 0, 0 } },
+    { 159, 20, { 0, 0, 0 } },
+    { 179, 20, { 0, 0, 0 } },
+    { 199, 20, { 0, 0, 0 } },
+    { 219, 20, { 0, 0, 0 } },
+    { 239, 20, { 0, 0, 0 } },
+    { 259, 20, { 0, 0, 0 } },
+    { 279, 20, { 0, 0, 0 } },
+    { 299, 0, { VK_UP, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_DOWN, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_RIGHT, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_LEFT, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_END, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_CLEAR, 0, 0 } },
+    { 299, 0, { VK_HOME, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_RETURN, 0x0d, 0 } },
+    { 299, 0, { VK_F1, 0, 0 } },
+    { 299, 0, { VK_F2, 0, 0 } },
+    { 299, 0, { VK_F3, 0, 0 } },
+    { 299, 0, { VK_F4, 0, 0 } },
+    { 299, 0, { VK_UP, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 299, 0, { VK_DOWN, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 299, 0, { VK_RIGHT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 299, 0, { VK_LEFT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 299, 0, { VK_MULTIPLY, 0x2a, 0 } },
+    { 299, 0, { VK_ADD, 0x2b, 0 } },
+    { 299, 0, { VK_SUBTRACT, 0x2d, 0 } },
+    { 299, 0, { VK_DELETE, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_DIVIDE, 0x2f, 0 } },
+    { 299, 0, { VK_INSERT, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_END, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_DOWN, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_NEXT, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_LEFT, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_CLEAR, 0, 0 } },
+    { 299, 0, { VK_RIGHT, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_HOME, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_UP, 0, ENHANCED_KEY } },
+    { 299, 0, { VK_PRIOR, 0, ENHANCED_KEY } },
+    { 299, 13, { 0, 0, 0 } },
+    { 312, 19, { 0, 0, 0 } },
+    { 331, 15, { 0, 0, 0 } },
+    { 346, 11, { 0, 0, 0 } },
+    { 357, 11, { 0, 0, 0 } },
+    { 368, 11, { 0, 0, 0 } },
+    { 379, 11, { 0, 0, 0 } },
+    { 390, 11, { 0, 0, 0 } },
+    { 401, 0, { VK_UP, 0, ENHANCED_KEY } },
+    { 401, 0, { VK_DOWN, 0, ENHANCED_KEY } },
+    { 401, 0, { VK_RIGHT, 0, ENHANCED_KEY } },
+    { 401, 0, { VK_LEFT, 0, ENHANCED_KEY } },
+    { 401, 0, { VK_CLEAR, 0, 0 } },
+    { 401, 0, { VK_END, 0, ENHANCED_KEY } },
+    { 401, 0, { VK_CLEAR, 0, 0 } },
+    { 401, 0, { VK_HOME, 0, ENHANCED_KEY } },
+    { 401, 0, { VK_RETURN, 0x0d, 0 } },
+    { 401, 0, { VK_TAB, 0x09, SHIFT_PRESSED } },
+    { 401, 5, { 0, 0, 0 } },
+    { 406, 0, { VK_UP, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 406, 0, { VK_DOWN, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 406, 0, { VK_RIGHT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 406, 0, { VK_LEFT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 406, 0, { VK_MULTIPLY, 0x2a, 0 } },
+    { 406, 0, { VK_ADD, 0x2b, 0 } },
+    { 406, 0, { VK_SUBTRACT, 0x2d, 0 } },
+    { 406, 0, { VK_DELETE, 0, ENHANCED_KEY } },
+    { 406, 0, { VK_DIVIDE, 0x2f, 0 } },
+    { 406, 0, { VK_INSERT, 0, ENHANCED_KEY } },
+    { 406, 0, { VK_END, 0, ENHANCED_KEY } },
+    { 406, 0, { VK_DOWN, 0, ENHANCED_KEY } },
+    { 406, 0, { VK_NEXT, 0, ENHANCED_KEY } },
+    { 406, 0, { VK_LEFT, 0, ENHANCED_KEY } },
+    { 406, 0, { VK_CLEAR, 0, 0 } },
+    { 406, 0, { VK_RIGHT, 0, ENHANCED_KEY } },
+    { 406, 0, { VK_HOME, 0, ENHANCED_KEY } },
+    { 406, 0, { VK_UP, 0, ENHANCED_KEY } },
+    { 406, 0, { VK_PRIOR, 0, ENHANCED_KEY } },
+    { 406, 16, { 0, 0, 0 } },
+    { 422, 16, { 0, 0, 0 } },
+    { 438, 16, { 0, 0, 0 } },
+    { 454, 16, { 0, 0, 0 } },
+    { 470, 16, { 0, 0, 0 } },
+    { 486, 16, { 0, 0, 0 } },
+    { 502, 16, { 0, 0, 0 } },
+    { 518, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 518, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_RETURN, 0x0d, LEFT_ALT_PRESSED } },
+    { 518, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_MULTIPLY, 0x2a, LEFT_ALT_PRESSED } },
+    { 518, 0, { VK_ADD, 0x2b, LEFT_ALT_PRESSED } },
+    { 518, 0, { VK_SUBTRACT, 0x2d, LEFT_ALT_PRESSED } },
+    { 518, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_DIVIDE, 0x2f, LEFT_ALT_PRESSED } },
+    { 518, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 518, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 518, 13, { 0, 0, 0 } },
+    { 531, 19, { 0, 0, 0 } },
+    { 550, 15, { 0, 0, 0 } },
+    { 565, 11, { 0, 0, 0 } },
+    { 576, 11, { 0, 0, 0 } },
+    { 587, 11, { 0, 0, 0 } },
+    { 598, 11, { 0, 0, 0 } },
+    { 609, 11, { 0, 0, 0 } },
+    { 620, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 620, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 620, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 620, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 620, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 620, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 620, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 620, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 620, 0, { VK_RETURN, 0x0d, LEFT_ALT_PRESSED } },
+    { 620, 5, { 0, 0, 0 } },
+    { 625, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_MULTIPLY, 0x2a, LEFT_ALT_PRESSED } },
+    { 625, 0, { VK_ADD, 0x2b, LEFT_ALT_PRESSED } },
+    { 625, 0, { VK_SUBTRACT, 0x2d, LEFT_ALT_PRESSED } },
+    { 625, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_DIVIDE, 0x2f, LEFT_ALT_PRESSED } },
+    { 625, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 625, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 625, 7, { 0, 0, 0 } },
+    { 632, 0, { VK_RETURN, 0x0d, SHIFT_PRESSED } },
+    { 632, 0, { VK_F1, 0, SHIFT_PRESSED } },
+    { 632, 0, { VK_F2, 0, SHIFT_PRESSED } },
+    { 632, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 632, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 632, 0, { VK_MULTIPLY, 0x2a, SHIFT_PRESSED } },
+    { 632, 0, { VK_ADD, 0x2b, SHIFT_PRESSED } },
+    { 632, 0, { VK_SUBTRACT, 0x2d, SHIFT_PRESSED } },
+    { 632, 0, { VK_DELETE, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DIVIDE, 0x2f, SHIFT_PRESSED } },
+    { 632, 0, { VK_INSERT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DOWN, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_NEXT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_LEFT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_CLEAR, 0, SHIFT_PRESSED } },
+    { 632, 0, { VK_RIGHT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_UP, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_PRIOR, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_RETURN, 0x0d, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_F1, 0, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_F2, 0, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_F3, 0, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_F4, 0, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_MULTIPLY, 0x2a, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_ADD, 0x2b, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_SUBTRACT, 0x2d, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DIVIDE, 0x2f, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_RETURN, 0x0d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_MULTIPLY, 0x2a, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_ADD, 0x2b, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_SUBTRACT, 0x2d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DIVIDE, 0x2f, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 632, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_RETURN, 0x0a, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F1, 0, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F2, 0, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F3, 0, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F4, 0, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_MULTIPLY, 0, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_ADD, 0, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_SUBTRACT, 0, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_DELETE, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DIVIDE, 0, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_INSERT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DOWN, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_NEXT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_LEFT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_CLEAR, 0, LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_RIGHT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_UP, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_PRIOR, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_RETURN, 0x0a, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_MULTIPLY, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_ADD, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_SUBTRACT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DIVIDE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_RETURN, 0x0a, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_MULTIPLY, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_ADD, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_SUBTRACT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DIVIDE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_RETURN, 0x0a, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_MULTIPLY, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_ADD, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_SUBTRACT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DIVIDE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 632, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 632, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 632, 5, { 0, 0, 0 } },
+    { 637, 5, { 0, 0, 0 } },
+    { 642, 5, { 0, 0, 0 } },
+    { 647, 5, { 0, 0, 0 } },
+    { 652, 5, { 0, 0, 0 } },
+    { 657, 5, { 0, 0, 0 } },
+    { 662, 5, { 0, 0, 0 } },
+    { 667, 5, { 0, 0, 0 } },
+    { 672, 7, { 0, 0, 0 } },
+    { 679, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 679, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 679, 0, { VK_HOME, 0, ENHANCED_KEY } },
+    { 679, 0, { VK_INSERT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 679, 5, { 0, 0, 0 } },
+    { 684, 5, { 0, 0, 0 } },
+    { 689, 5, { 0, 0, 0 } },
+    { 694, 5, { 0, 0, 0 } },
+    { 699, 5, { 0, 0, 0 } },
+    { 704, 5, { 0, 0, 0 } },
+    { 709, 5, { 0, 0, 0 } },
+    { 714, 5, { 0, 0, 0 } },
+    { 719, 7, { 0, 0, 0 } },
+    { 726, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 726, 0, { VK_UP, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 726, 0, { VK_DOWN, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 726, 0, { VK_RIGHT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 726, 0, { VK_LEFT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 726, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 726, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 726, 0, { VK_INSERT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 726, 0, { VK_INSERT, 0, ENHANCED_KEY } },
+    { 726, 0, { VK_DELETE, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 726, 5, { 0, 0, 0 } },
+    { 731, 5, { 0, 0, 0 } },
+    { 736, 5, { 0, 0, 0 } },
+    { 741, 5, { 0, 0, 0 } },
+    { 746, 7, { 0, 0, 0 } },
+    { 753, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 753, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 753, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 753, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 753, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 753, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 753, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 753, 0, { VK_DELETE, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 753, 0, { VK_DELETE, 0, ENHANCED_KEY } },
+    { 753, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 753, 7, { 0, 0, 0 } },
+    { 760, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 760, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 760, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 760, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 760, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 760, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 760, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 760, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 760, 0, { VK_END, 0, ENHANCED_KEY } },
+    { 760, 0, { VK_PRIOR, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 760, 7, { 0, 0, 0 } },
+    { 767, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 767, 0, { VK_UP, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 767, 0, { VK_DOWN, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 767, 0, { VK_RIGHT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 767, 0, { VK_LEFT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 767, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 767, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 767, 0, { VK_PRIOR, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 767, 0, { VK_PRIOR, 0, ENHANCED_KEY } },
+    { 767, 0, { VK_NEXT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 767, 7, { 0, 0, 0 } },
+    { 774, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 774, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 774, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 774, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 774, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 774, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 774, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 774, 0, { VK_NEXT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 774, 0, { VK_NEXT, 0, ENHANCED_KEY } },
+    { 774, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 774, 7, { 0, 0, 0 } },
+    { 781, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 781, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 781, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 781, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 781, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 781, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 781, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 781, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 781, 0, { VK_HOME, 0, ENHANCED_KEY } },
+    { 781, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 781, 7, { 0, 0, 0 } },
+    { 788, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, ENHANCED_KEY } },
+    { 788, 0, { VK_F1, 0, 0 } },
+    { 788, 0, { VK_F2, 0, 0 } },
+    { 788, 0, { VK_F3, 0, 0 } },
+    { 788, 0, { VK_F4, 0, 0 } },
+    { 788, 0, { VK_F5, 0, 0 } },
+    { 788, 0, { VK_RETURN, 0x0d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_MULTIPLY, 0x2a, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_ADD, 0x2b, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_SUBTRACT, 0x2d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DIVIDE, 0x2f, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_RETURN, 0x0d, LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_MULTIPLY, 0x2a, LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_ADD, 0x2b, LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_SUBTRACT, 0x2d, LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DIVIDE, 0x2f, LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_RETURN, 0x0d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_MULTIPLY, 0x2a, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_ADD, 0x2b, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_SUBTRACT, 0x2d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DIVIDE, 0x2f, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 788, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_RETURN, 0x0a, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_MULTIPLY, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_ADD, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_SUBTRACT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DIVIDE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_RETURN, 0x0a, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_MULTIPLY, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_ADD, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_SUBTRACT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DIVIDE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_RETURN, 0x0a, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_MULTIPLY, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_ADD, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_SUBTRACT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DIVIDE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_RETURN, 0x0a, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_MULTIPLY, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_ADD, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_SUBTRACT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DIVIDE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 788, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 788, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 788, 5, { 0, 0, 0 } },
+    { 793, 5, { 0, 0, 0 } },
+    { 798, 5, { 0, 0, 0 } },
+    { 803, 5, { 0, 0, 0 } },
+    { 808, 5, { 0, 0, 0 } },
+    { 813, 5, { 0, 0, 0 } },
+    { 818, 5, { 0, 0, 0 } },
+    { 823, 5, { 0, 0, 0 } },
+    { 828, 7, { 0, 0, 0 } },
+    { 835, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 835, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 835, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 835, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 835, 5, { 0, 0, 0 } },
+    { 840, 5, { 0, 0, 0 } },
+    { 845, 5, { 0, 0, 0 } },
+    { 850, 5, { 0, 0, 0 } },
+    { 855, 5, { 0, 0, 0 } },
+    { 860, 5, { 0, 0, 0 } },
+    { 865, 5, { 0, 0, 0 } },
+    { 870, 5, { 0, 0, 0 } },
+    { 875, 7, { 0, 0, 0 } },
+    { 882, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 882, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 882, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 882, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 882, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 882, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 882, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 882, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 882, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 882, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 882, 5, { 0, 0, 0 } },
+    { 887, 5, { 0, 0, 0 } },
+    { 892, 5, { 0, 0, 0 } },
+    { 897, 5, { 0, 0, 0 } },
+    { 902, 7, { 0, 0, 0 } },
+    { 909, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 909, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 909, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 909, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 909, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 909, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 909, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 909, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 909, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 909, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 909, 7, { 0, 0, 0 } },
+    { 916, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 916, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 916, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 916, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 916, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 916, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 916, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 916, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 916, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 916, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 916, 7, { 0, 0, 0 } },
+    { 923, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 923, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 923, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 923, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 923, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 923, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 923, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 923, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 923, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 923, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 923, 7, { 0, 0, 0 } },
+    { 930, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 930, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 930, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 930, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 930, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 930, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 930, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 930, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 930, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 930, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 930, 7, { 0, 0, 0 } },
+    { 937, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 937, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 937, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 937, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 937, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 937, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 937, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 937, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 937, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 937, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 937, 7, { 0, 0, 0 } },
+    { 944, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 944, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 944, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 944, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 944, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 944, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 944, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 944, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 944, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 944, 0, { VK_F1, 0, LEFT_ALT_PRESSED } },
+    { 944, 0, { VK_F2, 0, LEFT_ALT_PRESSED } },
+    { 944, 0, { VK_F3, 0, LEFT_ALT_PRESSED } },
+    { 944, 0, { VK_F4, 0, LEFT_ALT_PRESSED } },
+    { 944, 0, { VK_F5, 0, LEFT_ALT_PRESSED } },
+    { 944, 4, { 0, 0, 0 } },
+    { 948, 4, { 0, 0, 0 } },
+    { 952, 4, { 0, 0, 0 } },
+    { 956, 4, { 0, 0, 0 } },
+    { 960, 4, { 0, 0, 0 } },
+    { 964, 4, { 0, 0, 0 } },
+    { 968, 4, { 0, 0, 0 } },
+    { 972, 0, { VK_F1, 0, SHIFT_PRESSED } },
+    { 972, 7, { 0, 0, 0 } },
+    { 979, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 979, 0, { VK_F1, 0, LEFT_CTRL_PRESSED } },
+    { 979, 0, { VK_F1, 0, 0 } },
+    { 979, 0, { VK_F2, 0, SHIFT_PRESSED } },
+    { 979, 7, { 0, 0, 0 } },
+    { 986, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 986, 0, { VK_F2, 0, LEFT_CTRL_PRESSED } },
+    { 986, 0, { VK_F2, 0, 0 } },
+    { 986, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 986, 7, { 0, 0, 0 } },
+    { 993, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 993, 0, { VK_F3, 0, LEFT_CTRL_PRESSED } },
+    { 993, 0, { VK_F3, 0, 0 } },
+    { 993, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 993, 7, { 0, 0, 0 } },
+    { 1000, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1000, 0, { VK_F4, 0, LEFT_CTRL_PRESSED } },
+    { 1000, 0, { VK_F4, 0, 0 } },
+    { 1000, 0, { VK_F5, 0, SHIFT_PRESSED } },
+    { 1000, 7, { 0, 0, 0 } },
+    { 1007, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1007, 0, { VK_F5, 0, LEFT_CTRL_PRESSED } },
+    { 1007, 0, { VK_F5, 0, 0 } },
+    { 1007, 0, { VK_F6, 0, SHIFT_PRESSED } },
+    { 1007, 7, { 0, 0, 0 } },
+    { 1014, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1014, 0, { VK_F6, 0, LEFT_CTRL_PRESSED } },
+    { 1014, 0, { VK_F6, 0, 0 } },
+    { 1014, 0, { VK_F7, 0, SHIFT_PRESSED } },
+    { 1014, 7, { 0, 0, 0 } },
+    { 1021, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1021, 0, { VK_F7, 0, LEFT_CTRL_PRESSED } },
+    { 1021, 0, { VK_F7, 0, 0 } },
+    { 1021, 0, { VK_F8, 0, SHIFT_PRESSED } },
+    { 1021, 7, { 0, 0, 0 } },
+    { 1028, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1028, 0, { VK_F8, 0, LEFT_CTRL_PRESSED } },
+    { 1028, 0, { VK_F8, 0, 0 } },
+    { 1028, 32, { 0, 0, 0 } },
+    { 1060, 32, { 0, 0, 0 } },
+    { 1092, 32, { 0, 0, 0 } },
+    { 1124, 32, { 0, 0, 0 } },
+    { 1156, 32, { 0, 0, 0 } },
+    { 1188, 32, { 0, 0, 0 } },
+    { 1220, 32, { 0, 0, 0 } },
+    { 1252, 0, { VK_F9, 0, SHIFT_PRESSED } },
+    { 1252, 7, { 0, 0, 0 } },
+    { 1259, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1259, 0, { VK_F9, 0, LEFT_CTRL_PRESSED } },
+    { 1259, 0, { VK_F9, 0, 0 } },
+    { 1259, 0, { VK_F10, 0, SHIFT_PRESSED } },
+    { 1259, 7, { 0, 0, 0 } },
+    { 1266, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1266, 0, { VK_F10, 0, LEFT_CTRL_PRESSED } },
+    { 1266, 0, { VK_F10, 0, 0 } },
+    { 1266, 0, { VK_F11, 0, SHIFT_PRESSED } },
+    { 1266, 7, { 0, 0, 0 } },
+    { 1273, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1273, 0, { VK_F11, 0, LEFT_CTRL_PRESSED } },
+    { 1273, 0, { VK_F11, 0, 0 } },
+    { 1273, 0, { VK_F12, 0, SHIFT_PRESSED } },
+    { 1273, 7, { 0, 0, 0 } },
+    { 1280, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1280, 0, { VK_F12, 0, LEFT_CTRL_PRESSED } },
+    { 1280, 0, { VK_F12, 0, 0 } },
+    { 1280, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 1280, 7, { 0, 0, 0 } },
+    { 1287, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1287, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1287, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 1287, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 1287, 7, { 0, 0, 0 } },
+    { 1294, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1294, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1294, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 1294, 0, { VK_F5, 0, SHIFT_PRESSED } },
+    { 1294, 7, { 0, 0, 0 } },
+    { 1301, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1301, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1301, 0, { VK_F5, 0, SHIFT_PRESSED } },
+    { 1301, 0, { VK_F6, 0, SHIFT_PRESSED } },
+    { 1301, 7, { 0, 0, 0 } },
+    { 1308, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1308, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1308, 0, { VK_F6, 0, SHIFT_PRESSED } },
+    { 1308, 4, { 0, 0, 0 } },
+    { 1312, 4, { 0, 0, 0 } },
+    { 1316, 4, { 0, 0, 0 } },
+    { 1320, 4, { 0, 0, 0 } },
+    { 1324, 4, { 0, 0, 0 } },
+    { 1328, 4, { 0, 0, 0 } },
+    { 1332, 4, { 0, 0, 0 } },
+    { 1336, 0, { VK_F7, 0, SHIFT_PRESSED } },
+    { 1336, 7, { 0, 0, 0 } },
+    { 1343, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1343, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1343, 0, { VK_F7, 0, SHIFT_PRESSED } },
+    { 1343, 0, { VK_F8, 0, SHIFT_PRESSED } },
+    { 1343, 7, { 0, 0, 0 } },
+    { 1350, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1350, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1350, 0, { VK_F8, 0, SHIFT_PRESSED } },
+    { 1350, 0, { VK_F9, 0, SHIFT_PRESSED } },
+    { 1350, 7, { 0, 0, 0 } },
+    { 1357, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1357, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1357, 0, { VK_F9, 0, SHIFT_PRESSED } },
+    { 1357, 0, { VK_F10, 0, SHIFT_PRESSED } },
+    { 1357, 7, { 0, 0, 0 } },
+    { 1364, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1364, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1364, 0, { VK_F10, 0, SHIFT_PRESSED } },
+    { 1364, 4, { 0, 0, 0 } },
+    { 1368, 4, { 0, 0, 0 } },
+    { 1372, 4, { 0, 0, 0 } },
+    { 1376, 4, { 0, 0, 0 } },
+    { 1380, 4, { 0, 0, 0 } },
+    { 1384, 4, { 0, 0, 0 } },
+    { 1388, 4, { 0, 0, 0 } },
+    { 1392, 4, { 0, 0, 0 } },
+    { 1396, 4, { 0, 0, 0 } },
+    { 1400, 4, { 0, 0, 0 } },
+    { 1404, 4, { 0, 0, 0 } },
+    { 1408, 4, { 0, 0, 0 } },
+    { 1412, 4, { 0, 0, 0 } },
+    { 1416, 4, { 0, 0, 0 } },
+    { 1420, 4, { 0, 0, 0 } },
+    { 1424, 4, { 0, 0, 0 } },
+    { 1428, 4, { 0, 0, 0 } },
+    { 1432, 4, { 0, 0, 0 } },
+    { 1436, 4, { 0, 0, 0 } },
+    { 1440, 4, { 0, 0, 0 } },
+    { 1444, 4, { 0, 0, 0 } },
+    { 1448, 4, { 0, 0, 0 } },
+    { 1452, 4, { 0, 0, 0 } },
+    { 1456, 4, { 0, 0, 0 } },
+    { 1460, 4, { 0, 0, 0 } },
+    { 1464, 4, { 0, 0, 0 } },
+    { 1468, 4, { 0, 0, 0 } },
+    { 1472, 4, { 0, 0, 0 } },
+    { 1476, 4, { 0, 0, 0 } },
+    { 1480, 4, { 0, 0, 0 } },
+    { 1484, 4, { 0, 0, 0 } },
+    { 1488, 4, { 0, 0, 0 } },
+    { 1492, 4, { 0, 0, 0 } },
+    { 1496, 4, { 0, 0, 0 } },
+    { 1500, 4, { 0, 0, 0 } },
+    { 1504, 4, { 0, 0, 0 } },
+    { 1508, 4, { 0, 0, 0 } },
+    { 1512, 4, { 0, 0, 0 } },
+    { 1516, 4, { 0, 0, 0 } },
+    { 1520, 4, { 0, 0, 0 } },
+    { 1524, 4, { 0, 0, 0 } },
+    { 1528, 4, { 0, 0, 0 } },
+    { 1532, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1532, 7, { 0, 0, 0 } },
+    { 1539, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1539, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1539, 0, { VK_F1, 0, LEFT_ALT_PRESSED } },
+    { 1539, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1539, 7, { 0, 0, 0 } },
+    { 1546, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1546, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1546, 0, { VK_F2, 0, LEFT_ALT_PRESSED } },
+    { 1546, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1546, 7, { 0, 0, 0 } },
+    { 1553, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1553, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1553, 0, { VK_F3, 0, LEFT_ALT_PRESSED } },
+    { 1553, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1553, 7, { 0, 0, 0 } },
+    { 1560, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1560, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1560, 0, { VK_F4, 0, LEFT_ALT_PRESSED } },
+    { 1560, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1560, 7, { 0, 0, 0 } },
+    { 1567, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1567, 0, { VK_F5, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1567, 0, { VK_F5, 0, LEFT_ALT_PRESSED } },
+    { 1567, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1567, 7, { 0, 0, 0 } },
+    { 1574, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1574, 0, { VK_F6, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1574, 0, { VK_F6, 0, LEFT_ALT_PRESSED } },
+    { 1574, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1574, 7, { 0, 0, 0 } },
+    { 1581, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1581, 0, { VK_F7, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1581, 0, { VK_F7, 0, LEFT_ALT_PRESSED } },
+    { 1581, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1581, 7, { 0, 0, 0 } },
+    { 1588, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1588, 0, { VK_F8, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1588, 0, { VK_F8, 0, LEFT_ALT_PRESSED } },
+    { 1588, 32, { 0, 0, 0 } },
+    { 1620, 32, { 0, 0, 0 } },
+    { 1652, 32, { 0, 0, 0 } },
+    { 1684, 32, { 0, 0, 0 } },
+    { 1716, 32, { 0, 0, 0 } },
+    { 1748, 32, { 0, 0, 0 } },
+    { 1780, 32, { 0, 0, 0 } },
+    { 1812, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1812, 7, { 0, 0, 0 } },
+    { 1819, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1819, 0, { VK_F9, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1819, 0, { VK_F9, 0, LEFT_ALT_PRESSED } },
+    { 1819, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1819, 7, { 0, 0, 0 } },
+    { 1826, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1826, 0, { VK_F10, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1826, 0, { VK_F10, 0, LEFT_ALT_PRESSED } },
+    { 1826, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1826, 7, { 0, 0, 0 } },
+    { 1833, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1833, 0, { VK_F11, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1833, 0, { VK_F11, 0, LEFT_ALT_PRESSED } },
+    { 1833, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1833, 7, { 0, 0, 0 } },
+    { 1840, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1840, 0, { VK_F12, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1840, 0, { VK_F12, 0, LEFT_ALT_PRESSED } },
+    { 1840, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1840, 7, { 0, 0, 0 } },
+    { 1847, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1847, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1847, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1847, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1847, 7, { 0, 0, 0 } },
+    { 1854, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1854, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1854, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1854, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1854, 7, { 0, 0, 0 } },
+    { 1861, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1861, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1861, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1861, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1861, 7, { 0, 0, 0 } },
+    { 1868, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1868, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1868, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1868, 4, { 0, 0, 0 } },
+    { 1872, 4, { 0, 0, 0 } },
+    { 1876, 4, { 0, 0, 0 } },
+    { 1880, 4, { 0, 0, 0 } },
+    { 1884, 4, { 0, 0, 0 } },
+    { 1888, 4, { 0, 0, 0 } },
+    { 1892, 4, { 0, 0, 0 } },
+    { 1896, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1896, 7, { 0, 0, 0 } },
+    { 1903, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1903, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1903, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1903, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1903, 7, { 0, 0, 0 } },
+    { 1910, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1910, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1910, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1910, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1910, 7, { 0, 0, 0 } },
+    { 1917, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1917, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1917, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1917, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1917, 7, { 0, 0, 0 } },
+    { 1924, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1924, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 1924, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 1924, 4, { 0, 0, 0 } },
+    { 1928, 4, { 0, 0, 0 } },
+    { 1932, 4, { 0, 0, 0 } },
+    { 1936, 4, { 0, 0, 0 } },
+    { 1940, 4, { 0, 0, 0 } },
+    { 1944, 4, { 0, 0, 0 } },
+    { 1948, 4, { 0, 0, 0 } },
+    { 1952, 4, { 0, 0, 0 } },
+    { 1956, 4, { 0, 0, 0 } },
+    { 1960, 4, { 0, 0, 0 } },
+    { 1964, 4, { 0, 0, 0 } },
+    { 1968, 4, { 0, 0, 0 } },
+    { 1972, 4, { 0, 0, 0 } },
+    { 1976, 4, { 0, 0, 0 } },
+    { 1980, 4, { 0, 0, 0 } },
+    { 1984, 4, { 0, 0, 0 } },
+    { 1988, 4, { 0, 0, 0 } },
+    { 1992, 4, { 0, 0, 0 } },
+    { 1996, 4, { 0, 0, 0 } },
+    { 2000, 4, { 0, 0, 0 } },
+    { 2004, 4, { 0, 0, 0 } },
+    { 2008, 4, { 0, 0, 0 } },
+    { 2012, 4, { 0, 0, 0 } },
+    { 2016, 4, { 0, 0, 0 } },
+    { 2020, 4, { 0, 0, 0 } },
+    { 2024, 4, { 0, 0, 0 } },
+    { 2028, 4, { 0, 0, 0 } },
+    { 2032, 4, { 0, 0, 0 } },
+    { 2036, 4, { 0, 0, 0 } },
+    { 2040, 4, { 0, 0, 0 } },
+    { 2044, 4, { 0, 0, 0 } },
+    { 2048, 4, { 0, 0, 0 } },
+    { 2052, 4, { 0, 0, 0 } },
+    { 2056, 4, { 0, 0, 0 } },
+    { 2060, 4, { 0, 0, 0 } },
+    { 2064, 4, { 0, 0, 0 } },
+    { 2068, 4, { 0, 0, 0 } },
+    { 2072, 4, { 0, 0, 0 } },
+    { 2076, 4, { 0, 0, 0 } },
+    { 2080, 4, { 0, 0, 0 } },
+    { 2084, 4, { 0, 0, 0 } },
+    { 2088, 4, { 0, 0, 0 } },
+    { 2092, 0, { VK_F1, 0, SHIFT_PRESSED } },
+    { 2092, 0, { VK_F2, 0, SHIFT_PRESSED } },
+    { 2092, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 2092, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 2092, 0, { VK_F1, 0, LEFT_ALT_PRESSED } },
+    { 2092, 0, { VK_F2, 0, LEFT_ALT_PRESSED } },
+    { 2092, 0, { VK_F3, 0, LEFT_ALT_PRESSED } },
+    { 2092, 0, { VK_F4, 0, LEFT_ALT_PRESSED } },
+    { 2092, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2092, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2092, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2092, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2092, 0, { VK_F1, 0, LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F2, 0, LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F3, 0, LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F4, 0, LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2092, 4, { 0, 0, 0 } },
+    { 2096, 4, { 0, 0, 0 } },
+    { 2100, 4, { 0, 0, 0 } },
+    { 2104, 4, { 0, 0, 0 } },
+    { 2108, 4, { 0, 0, 0 } },
+    { 2112, 4, { 0, 0, 0 } },
+    { 2116, 4, { 0, 0, 0 } },
+    { 2120, 4, { 0, 0, 0 } },
+    { 2124, 4, { 0, 0, 0 } },
+    { 2128, 4, { 0, 0, 0 } },
+    { 2132, 4, { 0, 0, 0 } },
+    { 2136, 4, { 0, 0, 0 } },
+    { 2140, 4, { 0, 0, 0 } },
+    { 2144, 4, { 0, 0, 0 } },
+    { 2148, 4, { 0, 0, 0 } },
+    { 2152, 4, { 0, 0, 0 } },
+    { 2156, 4, { 0, 0, 0 } },
+    { 2160, 4, { 0, 0, 0 } },
+    { 2164, 4, { 0, 0, 0 } },
+    { 2168, 4, { 0, 0, 0 } },
+    { 2172, 4, { 0, 0, 0 } },
+    { 2176, 4, { 0, 0, 0 } },
+    { 2180, 4, { 0, 0, 0 } },
+    { 2184, 4, { 0, 0, 0 } },
+    { 2188, 4, { 0, 0, 0 } },
+    { 2192, 4, { 0, 0, 0 } },
+    { 2196, 4, { 0, 0, 0 } },
+    { 2200, 4, { 0, 0, 0 } },
+    { 2204, 4, { 0, 0, 0 } },
+    { 2208, 4, { 0, 0, 0 } },
+    { 2212, 4, { 0, 0, 0 } },
+    { 2216, 4, { 0, 0, 0 } },
+    { 2220, 4, { 0, 0, 0 } },
+    { 2224, 4, { 0, 0, 0 } },
+    { 2228, 4, { 0, 0, 0 } },
+    { 2232, 4, { 0, 0, 0 } },
+    { 2236, 4, { 0, 0, 0 } },
+    { 2240, 4, { 0, 0, 0 } },
+    { 2244, 4, { 0, 0, 0 } },
+    { 2248, 4, { 0, 0, 0 } },
+    { 2252, 4, { 0, 0, 0 } },
+    { 2256, 4, { 0, 0, 0 } },
+    { 2260, 4, { 0, 0, 0 } },
+    { 2264, 4, { 0, 0, 0 } },
+    { 2268, 4, { 0, 0, 0 } },
+    { 2272, 4, { 0, 0, 0 } },
+    { 2276, 4, { 0, 0, 0 } },
+    { 2280, 4, { 0, 0, 0 } },
+    { 2284, 4, { 0, 0, 0 } },
+    { 2288, 4, { 0, 0, 0 } },
+    { 2292, 4, { 0, 0, 0 } },
+    { 2296, 4, { 0, 0, 0 } },
+    { 2300, 4, { 0, 0, 0 } },
+    { 2304, 4, { 0, 0, 0 } },
+    { 2308, 4, { 0, 0, 0 } },
+    { 2312, 4, { 0, 0, 0 } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RIGHT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED } },
+    { 2316, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RETURN, 0x0d, SHIFT_PRESSED } },
+    { 2316, 0, { VK_F1, 0, SHIFT_PRESSED } },
+    { 2316, 0, { VK_F2, 0, SHIFT_PRESSED } },
+    { 2316, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 2316, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_MULTIPLY, 0x2a, SHIFT_PRESSED } },
+    { 2316, 0, { VK_ADD, 0x2b, SHIFT_PRESSED } },
+    { 2316, 0, { VK_SUBTRACT, 0x2d, SHIFT_PRESSED } },
+    { 2316, 0, { VK_DELETE, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DIVIDE, 0x2f, SHIFT_PRESSED } },
+    { 2316, 0, { VK_INSERT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_NEXT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED } },
+    { 2316, 0, { VK_RIGHT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_PRIOR, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RETURN, 0x0d, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_F1, 0, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_F2, 0, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_F3, 0, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_F4, 0, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_MULTIPLY, 0x2a, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_ADD, 0x2b, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_SUBTRACT, 0x2d, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DIVIDE, 0x2f, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RETURN, 0x0d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_MULTIPLY, 0x2a, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_ADD, 0x2b, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_SUBTRACT, 0x2d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DIVIDE, 0x2f, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2316, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RIGHT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RETURN, 0x0a, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F1, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F2, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F3, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F4, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_MULTIPLY, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_ADD, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_SUBTRACT, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_DELETE, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DIVIDE, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_INSERT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_NEXT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_RIGHT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_PRIOR, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RETURN, 0x0a, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_MULTIPLY, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_ADD, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_SUBTRACT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DIVIDE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RETURN, 0x0a, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_MULTIPLY, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_ADD, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_SUBTRACT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DIVIDE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_RETURN, 0x0a, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_MULTIPLY, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_ADD, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_SUBTRACT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DIVIDE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2316, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2316, 4, { 0, 0, 0 } },
+    { 2320, 4, { 0, 0, 0 } },
+    { 2324, 4, { 0, 0, 0 } },
+    { 2328, 4, { 0, 0, 0 } },
+    { 2332, 4, { 0, 0, 0 } },
+    { 2336, 4, { 0, 0, 0 } },
+    { 2340, 4, { 0, 0, 0 } },
+    { 2344, 4, { 0, 0, 0 } },
+    { 2348, 4, { 0, 0, 0 } },
+    { 2352, 4, { 0, 0, 0 } },
+    { 2356, 4, { 0, 0, 0 } },
+    { 2360, 4, { 0, 0, 0 } },
+    { 2364, 4, { 0, 0, 0 } },
+    { 2368, 4, { 0, 0, 0 } },
+    { 2372, 4, { 0, 0, 0 } },
+    { 2376, 4, { 0, 0, 0 } },
+    { 2380, 4, { 0, 0, 0 } },
+    { 2384, 4, { 0, 0, 0 } },
+    { 2388, 4, { 0, 0, 0 } },
+    { 2392, 4, { 0, 0, 0 } },
+    { 2396, 4, { 0, 0, 0 } },
+    { 2400, 4, { 0, 0, 0 } },
+    { 2404, 4, { 0, 0, 0 } },
+    { 2408, 4, { 0, 0, 0 } },
+    { 2412, 4, { 0, 0, 0 } },
+    { 2416, 4, { 0, 0, 0 } },
+    { 2420, 4, { 0, 0, 0 } },
+    { 2424, 4, { 0, 0, 0 } },
+    { 2428, 4, { 0, 0, 0 } },
+    { 2432, 4, { 0, 0, 0 } },
+    { 2436, 4, { 0, 0, 0 } },
+    { 2440, 4, { 0, 0, 0 } },
+    { 2444, 4, { 0, 0, 0 } },
+    { 2448, 4, { 0, 0, 0 } },
+    { 2452, 4, { 0, 0, 0 } },
+    { 2456, 4, { 0, 0, 0 } },
+    { 2460, 4, { 0, 0, 0 } },
+    { 2464, 4, { 0, 0, 0 } },
+    { 2468, 4, { 0, 0, 0 } },
+    { 2472, 4, { 0, 0, 0 } },
+    { 2476, 4, { 0, 0, 0 } },
+    { 2480, 4, { 0, 0, 0 } },
+    { 2484, 4, { 0, 0, 0 } },
+    { 2488, 4, { 0, 0, 0 } },
+    { 2492, 4, { 0, 0, 0 } },
+    { 2496, 4, { 0, 0, 0 } },
+    { 2500, 4, { 0, 0, 0 } },
+    { 2504, 4, { 0, 0, 0 } },
+    { 2508, 4, { 0, 0, 0 } },
+    { 2512, 4, { 0, 0, 0 } },
+    { 2516, 4, { 0, 0, 0 } },
+    { 2520, 4, { 0, 0, 0 } },
+    { 2524, 4, { 0, 0, 0 } },
+    { 2528, 4, { 0, 0, 0 } },
+    { 2532, 4, { 0, 0, 0 } },
+    { 2536, 4, { 0, 0, 0 } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2540, 4, { 0, 0, 0 } },
+    { 2544, 4, { 0, 0, 0 } },
+    { 2548, 4, { 0, 0, 0 } },
+    { 2552, 4, { 0, 0, 0 } },
+    { 2556, 4, { 0, 0, 0 } },
+    { 2560, 4, { 0, 0, 0 } },
+    { 2564, 4, { 0, 0, 0 } },
+    { 2568, 4, { 0, 0, 0 } },
+    { 2572, 4, { 0, 0, 0 } },
+    { 2576, 4, { 0, 0, 0 } },
+    { 2580, 4, { 0, 0, 0 } },
+    { 2584, 4, { 0, 0, 0 } },
+    { 2588, 4, { 0, 0, 0 } },
+    { 2592, 4, { 0, 0, 0 } },
+    { 2596, 4, { 0, 0, 0 } },
+    { 2600, 4, { 0, 0, 0 } },
+    { 2604, 4, { 0, 0, 0 } },
+    { 2608, 4, { 0, 0, 0 } },
+    { 2612, 4, { 0, 0, 0 } },
+    { 2616, 4, { 0, 0, 0 } },
+    { 2620, 4, { 0, 0, 0 } },
+    { 2624, 4, { 0, 0, 0 } },
+    { 2628, 4, { 0, 0, 0 } },
+    { 2632, 4, { 0, 0, 0 } },
+    { 2636, 4, { 0, 0, 0 } },
+    { 2640, 4, { 0, 0, 0 } },
+    { 2644, 4, { 0, 0, 0 } },
+    { 2648, 4, { 0, 0, 0 } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2652, 4, { 0, 0, 0 } },
+    { 2656, 4, { 0, 0, 0 } },
+    { 2660, 4, { 0, 0, 0 } },
+    { 2664, 4, { 0, 0, 0 } },
+    { 2668, 4, { 0, 0, 0 } },
+    { 2672, 4, { 0, 0, 0 } },
+    { 2676, 4, { 0, 0, 0 } },
+    { 2680, 4, { 0, 0, 0 } },
+    { 2684, 4, { 0, 0, 0 } },
+    { 2688, 4, { 0, 0, 0 } },
+    { 2692, 4, { 0, 0, 0 } },
+    { 2696, 4, { 0, 0, 0 } },
+    { 2700, 4, { 0, 0, 0 } },
+    { 2704, 4, { 0, 0, 0 } },
+    { 2708, 4, { 0, 0, 0 } },
+    { 2712, 4, { 0, 0, 0 } },
+    { 2716, 4, { 0, 0, 0 } },
+    { 2720, 4, { 0, 0, 0 } },
+    { 2724, 4, { 0, 0, 0 } },
+    { 2728, 4, { 0, 0, 0 } },
+    { 2732, 4, { 0, 0, 0 } },
+    { 2736, 4, { 0, 0, 0 } },
+    { 2740, 4, { 0, 0, 0 } },
+    { 2744, 4, { 0, 0, 0 } },
+    { 2748, 4, { 0, 0, 0 } },
+    { 2752, 4, { 0, 0, 0 } },
+    { 2756, 4, { 0, 0, 0 } },
+    { 2760, 4, { 0, 0, 0 } },
+    { 2764, 4, { 0, 0, 0 } },
+    { 2768, 4, { 0, 0, 0 } },
+    { 2772, 4, { 0, 0, 0 } },
+    { 2776, 4, { 0, 0, 0 } },
+    { 2780, 4, { 0, 0, 0 } },
+    { 2784, 4, { 0, 0, 0 } },
+    { 2788, 4, { 0, 0, 0 } },
+    { 2792, 4, { 0, 0, 0 } },
+    { 2796, 4, { 0, 0, 0 } },
+    { 2800, 4, { 0, 0, 0 } },
+    { 2804, 4, { 0, 0, 0 } },
+    { 2808, 4, { 0, 0, 0 } },
+    { 2812, 4, { 0, 0, 0 } },
+    { 2816, 4, { 0, 0, 0 } },
+    { 2820, 4, { 0, 0, 0 } },
+    { 2824, 4, { 0, 0, 0 } },
+    { 2828, 4, { 0, 0, 0 } },
+    { 2832, 4, { 0, 0, 0 } },
+    { 2836, 4, { 0, 0, 0 } },
+    { 2840, 4, { 0, 0, 0 } },
+    { 2844, 4, { 0, 0, 0 } },
+    { 2848, 4, { 0, 0, 0 } },
+    { 2852, 4, { 0, 0, 0 } },
+    { 2856, 4, { 0, 0, 0 } },
+    { 2860, 4, { 0, 0, 0 } },
+    { 2864, 4, { 0, 0, 0 } },
+    { 2868, 4, { 0, 0, 0 } },
+    { 2872, 4, { 0, 0, 0 } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RETURN, 0x0d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_MULTIPLY, 0x2a, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_ADD, 0x2b, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_SUBTRACT, 0x2d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DIVIDE, 0x2f, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RETURN, 0x0d, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F1, 0, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F2, 0, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F3, 0, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F4, 0, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_MULTIPLY, 0x2a, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_ADD, 0x2b, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_SUBTRACT, 0x2d, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DIVIDE, 0x2f, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RETURN, 0x0d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_MULTIPLY, 0x2a, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_ADD, 0x2b, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_SUBTRACT, 0x2d, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DIVIDE, 0x2f, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 2876, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RETURN, 0x0a, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_MULTIPLY, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_ADD, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_SUBTRACT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DIVIDE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RETURN, 0x0a, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_MULTIPLY, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_ADD, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_SUBTRACT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DIVIDE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RETURN, 0x0a, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_MULTIPLY, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_ADD, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_SUBTRACT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DIVIDE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_RIGHT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_RETURN, 0x0a, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_MULTIPLY, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_ADD, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_SUBTRACT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DIVIDE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_DOWN, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_LEFT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_CLEAR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 2876, 0, { VK_RIGHT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_UP, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 2876, 4, { 0, 0, 0 } },
+    { 2880, 4, { 0, 0, 0 } },
+    { 2884, 4, { 0, 0, 0 } },
+    { 2888, 4, { 0, 0, 0 } },
+    { 2892, 4, { 0, 0, 0 } },
+    { 2896, 4, { 0, 0, 0 } },
+    { 2900, 4, { 0, 0, 0 } },
+    { 2904, 4, { 0, 0, 0 } },
+    { 2908, 4, { 0, 0, 0 } },
+    { 2912, 4, { 0, 0, 0 } },
+    { 2916, 4, { 0, 0, 0 } },
+    { 2920, 4, { 0, 0, 0 } },
+    { 2924, 4, { 0, 0, 0 } },
+    { 2928, 4, { 0, 0, 0 } },
+    { 2932, 4, { 0, 0, 0 } },
+    { 2936, 4, { 0, 0, 0 } },
+    { 2940, 4, { 0, 0, 0 } },
+    { 2944, 4, { 0, 0, 0 } },
+    { 2948, 4, { 0, 0, 0 } },
+    { 2952, 4, { 0, 0, 0 } },
+    { 2956, 4, { 0, 0, 0 } },
+    { 2960, 4, { 0, 0, 0 } },
+    { 2964, 4, { 0, 0, 0 } },
+    { 2968, 4, { 0, 0, 0 } },
+    { 2972, 4, { 0, 0, 0 } },
+    { 2976, 4, { 0, 0, 0 } },
+    { 2980, 4, { 0, 0, 0 } },
+    { 2984, 4, { 0, 0, 0 } },
+    { 2988, 4, { 0, 0, 0 } },
+    { 2992, 4, { 0, 0, 0 } },
+    { 2996, 4, { 0, 0, 0 } },
+    { 3000, 4, { 0, 0, 0 } },
+    { 3004, 4, { 0, 0, 0 } },
+    { 3008, 4, { 0, 0, 0 } },
+    { 3012, 4, { 0, 0, 0 } },
+    { 3016, 4, { 0, 0, 0 } },
+    { 3020, 4, { 0, 0, 0 } },
+    { 3024, 4, { 0, 0, 0 } },
+    { 3028, 4, { 0, 0, 0 } },
+    { 3032, 4, { 0, 0, 0 } },
+    { 3036, 4, { 0, 0, 0 } },
+    { 3040, 4, { 0, 0, 0 } },
+    { 3044, 4, { 0, 0, 0 } },
+    { 3048, 4, { 0, 0, 0 } },
+    { 3052, 4, { 0, 0, 0 } },
+    { 3056, 4, { 0, 0, 0 } },
+    { 3060, 4, { 0, 0, 0 } },
+    { 3064, 4, { 0, 0, 0 } },
+    { 3068, 4, { 0, 0, 0 } },
+    { 3072, 4, { 0, 0, 0 } },
+    { 3076, 4, { 0, 0, 0 } },
+    { 3080, 4, { 0, 0, 0 } },
+    { 3084, 4, { 0, 0, 0 } },
+    { 3088, 4, { 0, 0, 0 } },
+    { 3092, 4, { 0, 0, 0 } },
+    { 3096, 4, { 0, 0, 0 } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 0, { VK_INSERT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3100, 4, { 0, 0, 0 } },
+    { 3104, 4, { 0, 0, 0 } },
+    { 3108, 4, { 0, 0, 0 } },
+    { 3112, 4, { 0, 0, 0 } },
+    { 3116, 4, { 0, 0, 0 } },
+    { 3120, 4, { 0, 0, 0 } },
+    { 3124, 4, { 0, 0, 0 } },
+    { 3128, 4, { 0, 0, 0 } },
+    { 3132, 4, { 0, 0, 0 } },
+    { 3136, 4, { 0, 0, 0 } },
+    { 3140, 4, { 0, 0, 0 } },
+    { 3144, 4, { 0, 0, 0 } },
+    { 3148, 4, { 0, 0, 0 } },
+    { 3152, 4, { 0, 0, 0 } },
+    { 3156, 4, { 0, 0, 0 } },
+    { 3160, 4, { 0, 0, 0 } },
+    { 3164, 4, { 0, 0, 0 } },
+    { 3168, 4, { 0, 0, 0 } },
+    { 3172, 4, { 0, 0, 0 } },
+    { 3176, 4, { 0, 0, 0 } },
+    { 3180, 4, { 0, 0, 0 } },
+    { 3184, 4, { 0, 0, 0 } },
+    { 3188, 4, { 0, 0, 0 } },
+    { 3192, 4, { 0, 0, 0 } },
+    { 3196, 4, { 0, 0, 0 } },
+    { 3200, 4, { 0, 0, 0 } },
+    { 3204, 4, { 0, 0, 0 } },
+    { 3208, 4, { 0, 0, 0 } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_DELETE, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_PRIOR, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_NEXT, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_HOME, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_END, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED | ENHANCED_KEY } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F1, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F2, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F11, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F12, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F3, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F4, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F5, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F6, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F7, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F8, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F9, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+    { 3212, 0, { VK_F10, 0, SHIFT_PRESSED | LEFT_ALT_PRESSED | LEFT_CTRL_PRESSED } },
+};
+
+const unsigned char kChars[] = {
+    0x00, 0x03, 0x1b, 0x7f, 0x1b, 0x4f, 0x5b, 0x7f, 0x4f, 0x5b, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x41, 0x42, 0x43, 0x44, 0x46, 0x47,
+    0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x61, 0x62, 0x63, 0x64, 0x6a, 0x6b,
+    0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x5a, 0x5b, 0x61, 0x62, 0x63, 0x64,
+    0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x41, 0x42,
+    0x43, 0x44, 0x46, 0x47, 0x48, 0x4d, 0x61, 0x62, 0x63, 0x64, 0x6a, 0x6b,
+    0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x5b, 0x61, 0x62, 0x63, 0x64, 0x6a,
+    0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x3b, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x6a, 0x6b, 0x6d, 0x6e,
+    0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x4d,
+    0x50, 0x51, 0x52, 0x53, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x4d, 0x50, 0x51, 0x52, 0x53,
+    0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x6a, 0x6b, 0x6d, 0x6e,
+    0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x4d,
+    0x50, 0x51, 0x52, 0x53, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x4d, 0x50, 0x51, 0x52, 0x53,
+    0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x6a, 0x6b, 0x6d, 0x6e,
+    0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x24,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x37, 0x38, 0x39, 0x3b, 0x40, 0x5e, 0x7e,
+    0x24, 0x30, 0x31, 0x33, 0x34, 0x35, 0x36, 0x38, 0x39, 0x3b, 0x40, 0x41,
+    0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24, 0x31, 0x32, 0x33, 0x34,
+    0x3b, 0x40, 0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24, 0x3b,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24, 0x3b, 0x40,
+    0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x41,
+    0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x41, 0x42, 0x43,
+    0x44, 0x46, 0x48, 0x5e, 0x7e, 0x41, 0x42, 0x43, 0x44, 0x45, 0x4d, 0x6a,
+    0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x4d, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x4d, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x4d, 0x6a,
+    0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x4d, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x4d, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x4d, 0x6a,
+    0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x24, 0x31, 0x32, 0x33, 0x34, 0x35, 0x37, 0x38, 0x39, 0x3b,
+    0x40, 0x5e, 0x7e, 0x24, 0x30, 0x31, 0x33, 0x34, 0x35, 0x36, 0x38, 0x39,
+    0x3b, 0x40, 0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24, 0x31,
+    0x32, 0x33, 0x34, 0x3b, 0x40, 0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e,
+    0x7e, 0x24, 0x3b, 0x40, 0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e,
+    0x24, 0x3b, 0x40, 0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24,
+    0x3b, 0x40, 0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24, 0x3b,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x24, 0x3b, 0x40,
+    0x41, 0x42, 0x43, 0x44, 0x46, 0x48, 0x5e, 0x7e, 0x41, 0x42, 0x43, 0x44,
+    0x45, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x24, 0x3b, 0x40, 0x5e,
+    0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24,
+    0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40,
+    0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x24, 0x3b, 0x40, 0x5e, 0x7e,
+    0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b,
+    0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e,
+    0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24,
+    0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40,
+    0x5e, 0x7e, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x24, 0x3b, 0x40, 0x5e,
+    0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24,
+    0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40,
+    0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x24, 0x3b, 0x40, 0x5e, 0x7e,
+    0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b,
+    0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e,
+    0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24,
+    0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40, 0x5e, 0x7e, 0x24, 0x3b, 0x40,
+    0x5e, 0x7e, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x50, 0x51, 0x52, 0x53,
+    0x50, 0x51, 0x52, 0x53, 0x50, 0x51, 0x52, 0x53, 0x50, 0x51, 0x52, 0x53,
+    0x50, 0x51, 0x52, 0x53, 0x50, 0x51, 0x52, 0x53, 0x50, 0x51, 0x52, 0x53,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x24, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e,
+    0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7e, 0x24, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e, 0x6a, 0x6b, 0x6d, 0x6e,
+    0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7e,
+    0x24, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x50,
+    0x51, 0x52, 0x53, 0x5e, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7e, 0x24, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e,
+    0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7e, 0x24, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e, 0x6a, 0x6b, 0x6d, 0x6e,
+    0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7e,
+    0x24, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x50,
+    0x51, 0x52, 0x53, 0x5e, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7e, 0x24, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e,
+    0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7e, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x24, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e, 0x6a, 0x6b, 0x6d, 0x6e,
+    0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7e,
+    0x24, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x50,
+    0x51, 0x52, 0x53, 0x5e, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7e, 0x24, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e,
+    0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7e, 0x24, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e, 0x6a, 0x6b, 0x6d, 0x6e,
+    0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7e,
+    0x24, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x50,
+    0x51, 0x52, 0x53, 0x5e, 0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7e, 0x24, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e,
+    0x6a, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7e, 0x24, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x4d, 0x50, 0x51, 0x52, 0x53, 0x5e, 0x6a, 0x6b, 0x6d, 0x6e,
+    0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7e,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+    0x24, 0x40, 0x5e, 0x7e, 0x24, 0x40, 0x5e, 0x7e,
+};
+
+} // anonymous namespace
+
+const InputMap::Table kDefaultInputMapTable = {
+    kNodes, kChars, sizeof(kNodes) / sizeof(kNodes[0])
+};
@@ -0,0 +1,186 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "EtwTrace.h"
+
+#include <string.h>
+
+#include "../shared/DebugClient.h"
+
+const EtwEvent kEtwPollTimeout          = { "PollTimeout", nullptr, nullptr };
+const EtwEvent kEtwSyncConsole          = { "SyncConsole", "forceResize", nullptr };
+const EtwEvent kEtwLargeConsoleRead     = { "LargeConsoleRead", "rows", nullptr };
+const EtwEvent kEtwSendLines            = { "SendLines", nullptr, "lines" };
+const EtwEvent kEtwPipeRead             = { "PipeRead", "bytes", nullptr };
+const EtwEvent kEtwPipeWrite            = { "PipeWrite", "bytes", nullptr };
+const EtwEvent kEtwFlushInputRecords    = { "FlushInputRecords", "records", nullptr };
+
+volatile LONG g_etwEnabled;
+
+namespace {
+
+// Local copies of the evntprov.h declarations, which are hidden when
+// _WIN32_WINNT targets XP.
+struct EtwEventDescriptor {
+    USHORT Id;
+    UCHAR Version;
+    UCHAR Channel;
+    UCHAR Level;
+    UCHAR Opcode;
+    USHORT Task;
+    ULONGLONG Keyword;
+};
+
+struct EtwDataDescriptor {
+    ULONGLONG Ptr;
+    ULONG Size;
+    ULONG Type;
+};
+
+typedef VOID NTAPI EtwEnableCallback(
+    LPCGUID SourceId, ULONG IsEnabled, UCHAR Level,
+    ULONGLONG MatchAnyKeyword, ULONGLONG MatchAllKeyword,
+    PVOID FilterData, PVOID CallbackContext);
+typedef ULONG WINAPI EventRegister_t(
+    LPCGUID ProviderId, EtwEnableCallback *EnableCallback,
+    PVOID CallbackContext, ULONGLONG *RegHandle);
+typedef ULONG WINAPI EventSetInformation_t(
+    ULONGLONG RegHandle, int InformationClass,
+    PVOID EventInformation, ULONG InformationLength);
+typedef ULONG WINAPI EventWriteTransfer_t(
+    ULONGLONG RegHandle, const EtwEventDescriptor *EventDescriptor,
+    LPCGUID ActivityId, LPCGUID RelatedActivityId,
+    ULONG UserDataCount, EtwDataDescriptor *UserData);
+
+// {23553cd3-a58d-5c16-a149-25de7b45f541}
+const GUID kProviderGuid = {
+    0x23553cd3, 0xa58d, 0x5c16,
+    { 0xa1, 0x49, 0x25, 0xde, 0x7b, 0x45, 0xf5, 0x41 }
+};
+const char kProviderName[] = "winpty-agent";
+
+const int kEventProviderSetTraits = 2;
+const ULONG kDataTypeEventMetadata = 1;
+const ULONG kDataTypeProviderMetadata = 2;
+const UCHAR kTraceLoggingChannel = 11;
+const UCHAR kLevelVerbose = 5;
+const UCHAR kTlgInUINT32 = 8;
+
+ULONGLONG g_regHandle;
+EventWriteTransfer_t *g_eventWriteTransfer;
+
+// The TraceLogging provider traits: a 16-bit total size and the name.
+struct ProviderTraits {
+    ProviderTraits() {
+        const USHORT size = sizeof(data);
+        memcpy(data, &size, 2);
+        memcpy(data + 2, kProviderName, sizeof(kProviderName));
+    }
+    char data[2 + sizeof(kProviderName)];
+} g_providerTraits;
+
+VOID NTAPI enableCallback(
+        LPCGUID, ULONG isEnabled, UCHAR level, ULONGLONG, ULONGLONG,
+        PVOID, PVOID) {
+    const bool enabled =
+        isEnabled != 0 && (level == 0 || level >= kLevelVerbose);
+    InterlockedExchange(&g_etwEnabled, enabled ? 1 : 0);
+}
+
+int appendString(char *out, int pos, const char *str) {
+    const int len = static_cast<int>(strlen(str)) + 1;
+    memcpy(out + pos, str, len);
+    return pos + len;
+}
+
+} // anonymous namespace
+
+void registerEtwProvider() {
+    // The module is never freed.
+    const HMODULE advapi32 = LoadLibraryW(L"advapi32.dll");
+    if (advapi32 == nullptr) {
+        return;
+    }
+    const auto pEventRegister = reinterpret_cast<EventRegister_t*>(
+        GetProcAddress(advapi32, "EventRegister"));
+    const auto pEventSetInformation = reinterpret_cast<EventSetInformation_t*>(
+        GetProcAddress(advapi32, "EventSetInformation"));
+    const auto pEventWriteTransfer = reinterpret_cast<EventWriteTransfer_t*>(
+        GetProcAddress(advapi32, "EventWriteTransfer"));
+    if (pEventRegister == nullptr || pEventWriteTransfer == nullptr) {
+        trace("ETW is unavailable");
+        return;
+    }
+    g_eventWriteTransfer = pEventWriteTransfer;
+    // The enable callback can run inside EventRegister, so the write
+    // function must already be set.
+    if (pEventRegister(&kProviderGuid, enableCallback, nullptr,
+                       &g_regHandle) != ERROR_SUCCESS) {
+        trace("EventRegister failed");
+        g_regHandle = 0;
+        InterlockedExchange(&g_etwEnabled, 0);
+        return;
+    }
+    if (pEventSetInformation != nullptr) {
+        // Windows 8 and up.  Earlier versions read the traits from each
+        // event instead.
+        pEventSetInformation(g_regHandle, kEventProviderSetTraits,
+                             g_providerTraits.data,
+                             sizeof(g_providerTraits.data));
+    }
+}
+
+void writeEtwEvent(const EtwEvent &event, EtwOpcode opcode, uint32_t value) {
+    if (g_regHandle == 0) {
+        return;
+    }
+    const char *const field =
+        opcode == kEtwOpcodeStop ? event.stopField : event.startField;
+
+    // TraceLogging event metadata: a 16-bit total size, a tag byte, the
+    // event name, then each field's name and type.
+    char metadata[128];
+    int size = 2;
+    metadata[size++] = 0;
+    size = appendString(metadata, size, event.name);
+    if (field != nullptr) {
+        size = appendString(metadata, size, field);
+        metadata[size++] = kTlgInUINT32;
+    }
+    const USHORT metadataSize = static_cast<USHORT>(size);
+    memcpy(metadata, &metadataSize, 2);
+
+    EtwEventDescriptor descriptor = {};
+    descriptor.Channel = kTraceLoggingChannel;
+    descriptor.Level = kLevelVerbose;
+    descriptor.Opcode = static_cast<UCHAR>(opcode);
+
+    EtwDataDescriptor data[3] = {};
+    data[0].Ptr = reinterpret_cast<uintptr_t>(g_providerTraits.data);
+    data[0].Size = sizeof(g_providerTraits.data);
+    data[0].Type = kDataTypeProviderMetadata;
+    data[1].Ptr = reinterpret_cast<uintptr_t>(metadata);
+    data[1].Size = size;
+    data[1].Type = kDataTypeEventMetadata;
+    data[2].Ptr = reinterpret_cast<uintptr_t>(&value);
+    data[2].Size = sizeof(value);
+    g_eventWriteTransfer(g_regHandle, &descriptor, nullptr, nullptr,
+                         field != nullptr ? 3 : 2, data);
+}
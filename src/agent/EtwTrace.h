@@ -0,0 +1,111 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_ETW_TRACE_H
+#define AGENT_ETW_TRACE_H
+
+#include <windows.h>
+#include <stdint.h>
+
+// Begin/end events for Event Tracing for Windows (ETW), so that Windows
+// Performance Recorder can capture agent stalls alongside conhost and the
+// child processes.  The events use the self-describing TraceLogging format, so
+// WPA decodes them without a manifest.  The provider is "winpty-agent", and
+// its GUID, {23553cd3-a58d-5c16-a149-25de7b45f541}, is the usual hash of that
+// name, so a WPR profile can name it as "*winpty-agent".
+//
+// The ETW APIs are loaded at runtime, because Windows XP lacks them.  Until
+// a session enables the provider, each event costs a load-and-test.
+
+struct EtwEvent {
+    const char *name;
+    // The names of the optional UINT32 fields of the start and stop events
+    // (or of the single event, for an info event).  NULL means no field.
+    const char *startField;
+    const char *stopField;
+};
+
+extern const EtwEvent kEtwPollTimeout;
+extern const EtwEvent kEtwSyncConsole;
+extern const EtwEvent kEtwLargeConsoleRead;
+extern const EtwEvent kEtwSendLines;
+extern const EtwEvent kEtwPipeRead;
+extern const EtwEvent kEtwPipeWrite;
+extern const EtwEvent kEtwFlushInputRecords;
+
+enum EtwOpcode {
+    kEtwOpcodeInfo = 0,
+    kEtwOpcodeStart = 1,
+    kEtwOpcodeStop = 2,
+};
+
+extern volatile LONG g_etwEnabled;
+
+void registerEtwProvider();
+void writeEtwEvent(const EtwEvent &event, EtwOpcode opcode, uint32_t value);
+
+inline bool isEtwEnabled() { return g_etwEnabled != 0; }
+
+inline void etwInfo(const EtwEvent &event, uint32_t value) {
+    if (isEtwEnabled()) {
+        writeEtwEvent(event, kEtwOpcodeInfo, value);
+    }
+}
+
+inline void etwStart(const EtwEvent &event, uint32_t value=0) {
+    if (isEtwEnabled()) {
+        writeEtwEvent(event, kEtwOpcodeStart, value);
+    }
+}
+
+inline void etwStop(const EtwEvent &event, uint32_t value=0) {
+    if (isEtwEnabled()) {
+        writeEtwEvent(event, kEtwOpcodeStop, value);
+    }
+}
+
+// Writes a start event on construction and the matching stop event on
+// destruction.  If no session was listening at the start, neither is written.
+class EtwScope {
+public:
+    explicit EtwScope(const EtwEvent &event, uint32_t startValue=0) :
+        m_event(event), m_active(isEtwEnabled())
+    {
+        if (m_active) {
+            writeEtwEvent(m_event, kEtwOpcodeStart, startValue);
+        }
+    }
+    ~EtwScope() {
+        if (m_active) {
+            writeEtwEvent(m_event, kEtwOpcodeStop, m_stopValue);
+        }
+    }
+    void setStopValue(uint32_t value) { m_stopValue = value; }
+
+    EtwScope(const EtwScope &other) = delete;
+    EtwScope &operator=(const EtwScope &other) = delete;
+
+private:
+    const EtwEvent &m_event;
+    const bool m_active;
+    uint32_t m_stopValue = 0;
+};
+
+#endif // AGENT_ETW_TRACE_H
@@ -23,39 +23,151 @@
 #include <algorithm>
 
 #include "NamedPipe.h"
+#include "OutputThread.h"
 #include "../shared/DebugClient.h"
+#include "../shared/OsModule.h"
+#include "../shared/TimeMeasurement.h"
 #include "../shared/WinptyAssert.h"
 
+namespace {
+
+// CreateWaitableTimerExW is newer than the Windows version the headers
+// target, and its high-resolution flag arrived in Windows 10 1803.
+typedef HANDLE WINAPI CreateWaitableTimerExW_t(
+    LPSECURITY_ATTRIBUTES lpTimerAttributes,
+    LPCWSTR lpTimerName,
+    DWORD dwFlags,
+    DWORD dwDesiredAccess);
+const DWORD AGENT_CREATE_WAITABLE_TIMER_HIGH_RESOLUTION = 0x00000002;
+
+int64_t nowUs() {
+    static const uint64_t freq = TimeMeasurement::frequency();
+    const uint64_t ticks = TimeMeasurement::ticks();
+    return static_cast<int64_t>(
+        ticks / freq * 1000000 + ticks % freq * 1000000 / freq);
+}
+
+// A high-resolution timer expires within a millisecond or so of its due time.
+// Earlier versions of Windows reject the flag, and an ordinary timer is
+// still no worse than a wait timeout.
+HANDLE createWaitTimer() {
+    const auto createEx = reinterpret_cast<CreateWaitableTimerExW_t*>(
+        loadedModuleProc(L"kernel32.dll", "CreateWaitableTimerExW"));
+    if (createEx != nullptr) {
+        HANDLE ret = createEx(nullptr, nullptr,
+                              AGENT_CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                              TIMER_ALL_ACCESS);
+        if (ret != nullptr) {
+            return ret;
+        }
+        trace("High-resolution waitable timer unavailable: error %u",
+              static_cast<unsigned int>(GetLastError()));
+    }
+    return CreateWaitableTimerW(nullptr, FALSE, nullptr);
+}
+
+// The wheel's tick for a deadline the given number of milliseconds away,
+// rounded up so that a timer never fires early.
+int64_t deadlineTick(int ms) {
+    return (nowUs() + ms * 1000LL + 999) / 1000;
+}
+
+} // anonymous namespace
+
+EventLoop::EventLoop() : m_timers(nowUs() / 1000)
+{
+    HANDLE event = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    ASSERT(event != nullptr && "CreateEventW failed");
+    m_wakeEvent = OwnedHandle(event);
+    HANDLE timer = createWaitTimer();
+    ASSERT(timer != nullptr && "CreateWaitableTimerW failed");
+    m_waitTimer = OwnedHandle(timer);
+}
+
 EventLoop::~EventLoop() {
+    cancelHandleWatch();
+    if (m_waitTimerWait != nullptr) {
+        UnregisterWaitEx(m_waitTimerWait, INVALID_HANDLE_VALUE);
+        m_waitTimerWait = nullptr;
+    }
     for (NamedPipe *pipe : m_pipes) {
         delete pipe;
     }
     m_pipes.clear();
+    for (NamedPipe *pipe : m_deletedPipes) {
+        delete pipe;
+    }
+    m_deletedPipes.clear();
 }
 
 // Enter the event loop.  Runs until the I/O or timeout handler calls exit().
 void EventLoop::run()
 {
     std::vector<HANDLE> waitHandles;
-    DWORD lastTime = GetTickCount();
+    int64_t lastPollUs = nowUs();
     while (!m_exiting) {
         bool didSomething = false;
 
-        // Attempt to make progress with the pipes.
+        // Attempt to make progress with the pipes.  With a completion port,
+        // only the pipes that saw a completion or have new I/O to start are
+        // serviced.
+        const bool useCompletionPort = m_completionPort.get() != nullptr;
         waitHandles.clear();
         for (size_t i = 0; i < m_pipes.size(); ++i) {
+            if (useCompletionPort && !m_pipes[i]->needsService()) {
+                continue;
+            }
             if (m_pipes[i]->serviceIo(&waitHandles)) {
                 onPipeIo(*m_pipes[i]);
                 didSomething = true;
             }
         }
 
+        // Dispatch window messages.  Nothing in the agent creates a window,
+        // but out-of-context WinEvent hooks are delivered through the queue.
+        MSG msg;
+        while (PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE)) {
+            DispatchMessageW(&msg);
+        }
+
+        if (m_watchSignaled) {
+            cancelHandleWatch();
+            m_pollRequested = true;
+        }
+
+        if (InterlockedExchange(&m_wakeRequested, 0)) {
+            onWake();
+            didSomething = true;
+        }
+
+        // Expire the timers that are due.  A handler may arm or cancel any
+        // timer, including one that expired with it.
+        m_timers.advance(nowUs() / 1000);
+        while (Timer *timer = m_timers.popExpired()) {
+            if (timer == &m_pollSoonTimer) {
+                m_pollRequested = true;
+            } else if (timer == &m_oneShotTimer) {
+                onTimer();
+                didSomething = true;
+            } else {
+                onTimerExpired(*timer);
+                didSomething = true;
+            }
+        }
+
         // Call the timeout if enough time has elapsed.
         if (m_pollInterval > 0) {
-            int elapsed = GetTickCount() - lastTime;
-            if (elapsed >= m_pollInterval) {
+            const int64_t elapsedUs = nowUs() - lastPollUs;
+            if (elapsedUs >= m_pollInterval * 1000LL || m_pollRequested) {
+                m_pollRequested = false;
                 onPollTimeout();
-                lastTime = GetTickCount();
+                lastPollUs = nowUs();
+                if (!m_sawPollActivity) {
+                    // Back off exponentially while nothing is happening.
+                    m_pollInterval = std::min(m_pollInterval * 2,
+                                              m_maxPollInterval);
+                }
+                m_sawPollActivity = false;
                 didSomething = true;
             }
         }
@@ -64,33 +176,263 @@ void EventLoop::run()
             continue;
 
         // If there's nothing to do, wait.
-        DWORD timeout = INFINITE;
-        if (m_pollInterval > 0)
-            timeout = std::max(0, (int)(lastTime + m_pollInterval - GetTickCount()));
-        if (waitHandles.size() == 0) {
-            ASSERT(timeout != INFINITE);
-            if (timeout > 0)
-                Sleep(timeout);
-        } else {
-            DWORD result = WaitForMultipleObjects(waitHandles.size(),
-                                                  waitHandles.data(),
-                                                  FALSE,
-                                                  timeout);
-            ASSERT(result != WAIT_FAILED);
+        int64_t deadlineUs = INT64_MAX;
+        if (m_pollInterval > 0) {
+            deadlineUs = lastPollUs + m_pollInterval * 1000LL;
+        }
+        const int64_t timerTick = m_timers.nextDeadline();
+        if (timerTick != TimerWheel::kNever) {
+            deadlineUs = std::min(deadlineUs, timerTick * 1000);
+        }
+        const DWORD timeout = armWaitTimer(deadlineUs);
+        if (useCompletionPort) {
+            waitForCompletions(timeout);
+            continue;
+        }
+        waitHandles.push_back(m_wakeEvent.get());
+        waitHandles.push_back(m_waitTimer.get());
+        const size_t watchIndex = waitHandles.size();
+        if (m_watchedHandle != nullptr) {
+            waitHandles.push_back(m_watchedHandle);
+        }
+        ASSERT(waitHandles.size() < MAXIMUM_WAIT_OBJECTS);
+        DWORD result = MsgWaitForMultipleObjectsEx(waitHandles.size(),
+                                                   waitHandles.data(),
+                                                   timeout,
+                                                   QS_ALLINPUT,
+                                                   MWMO_INPUTAVAILABLE);
+        ASSERT(result != WAIT_FAILED);
+        if (m_watchedHandle != nullptr &&
+                result == WAIT_OBJECT_0 + watchIndex) {
+            m_watchSignaled = 1;
         }
     }
 }
 
+// Dispatch pipe I/O through an I/O completion port rather than waiting on
+// each pipe's event handles, which costs time linear in the number of pipes
+// and is capped at MAXIMUM_WAIT_OBJECTS.  The port can't wake the loop for
+// window messages, so this must not be combined with a WinEvent hook.  It
+// must be called before any pipes are created.
+void EventLoop::useCompletionPort()
+{
+    ASSERT(m_pipes.empty() && "useCompletionPort called after createNamedPipe");
+    HANDLE port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+    ASSERT(port != nullptr && "CreateIoCompletionPort failed");
+    m_completionPort = OwnedHandle(port);
+    const BOOL success = RegisterWaitForSingleObject(
+        &m_waitTimerWait, m_waitTimer.get(), onWaitTimerFired, this,
+        INFINITE, WT_EXECUTEINWAITTHREAD);
+    ASSERT(success && "RegisterWaitForSingleObject failed");
+}
+
+// Sets the wait timer to fire at the deadline, and returns the timeout for
+// the wait, which is INFINITE unless the deadline has passed.  A wake for
+// another reason leaves the timer set, and the next call replaces it, so at
+// worst a stale expiration costs one idle pass through the loop.
+DWORD EventLoop::armWaitTimer(int64_t deadlineUs)
+{
+    if (deadlineUs == INT64_MAX) {
+        CancelWaitableTimer(m_waitTimer.get());
+        return INFINITE;
+    }
+    const int64_t remainingUs = deadlineUs - nowUs();
+    if (remainingUs <= 0) {
+        return 0;
+    }
+    // A negative due time is relative, in 100ns units.
+    LARGE_INTEGER dueTime;
+    dueTime.QuadPart = -remainingUs * 10;
+    if (!SetWaitableTimer(m_waitTimer.get(), &dueTime, 0,
+                          nullptr, nullptr, FALSE)) {
+        trace("SetWaitableTimer failed: error %u",
+              static_cast<unsigned int>(GetLastError()));
+        return static_cast<DWORD>((remainingUs + 999) / 1000);
+    }
+    return INFINITE;
+}
+
+// Wait for at least one completion packet (or the timeout), then collect any
+// others already queued.  A packet only identifies the pipe; the pipe's
+// workers retrieve the I/O result themselves with GetOverlappedResult.
+void EventLoop::waitForCompletions(DWORD timeout)
+{
+    // The pipes deleted so far finished their I/O before they were removed,
+    // so their packets are already queued.
+    const size_t deletedCount = m_deletedPipes.size();
+    while (true) {
+        DWORD actual = 0;
+        ULONG_PTR key = 0;
+        OVERLAPPED *over = nullptr;
+        GetQueuedCompletionStatus(m_completionPort.get(),
+                                  &actual, &key, &over, timeout);
+        if (over == nullptr) {
+            ASSERT(GetLastError() == WAIT_TIMEOUT &&
+                "GetQueuedCompletionStatus failed");
+            for (size_t i = 0; i < deletedCount; ++i) {
+                delete m_deletedPipes[i];
+            }
+            m_deletedPipes.erase(m_deletedPipes.begin(),
+                                 m_deletedPipes.begin() + deletedCount);
+            return;
+        }
+        // A zero key comes from onWatchedHandleSignaled or wake, which have
+        // already set their flags.
+        if (key != 0) {
+            reinterpret_cast<NamedPipe*>(key)->m_ioCompleted = true;
+        }
+        timeout = 0;
+    }
+}
+
+// Call onPollTimeout as soon as the handle is signaled (e.g. when a process
+// exits) rather than on the next poll tick.  The watch fires once, and it
+// replaces any earlier watch.  Pass nullptr to cancel it, which must be done
+// before the handle is closed.
+void EventLoop::requestPollOnSignal(HANDLE handle)
+{
+    cancelHandleWatch();
+    m_watchSignaled = 0;
+    m_watchedHandle = handle;
+    if (handle != nullptr && m_completionPort.get() != nullptr) {
+        const BOOL success = RegisterWaitForSingleObject(
+            &m_watchWait, handle, onWatchedHandleSignaled, this,
+            INFINITE, WT_EXECUTEONLYONCE);
+        ASSERT(success && "RegisterWaitForSingleObject failed");
+    }
+}
+
+void EventLoop::cancelHandleWatch()
+{
+    if (m_watchWait != nullptr) {
+        // Wait for a running callback to finish, so it can't touch the loop
+        // after it's gone.
+        UnregisterWaitEx(m_watchWait, INVALID_HANDLE_VALUE);
+        m_watchWait = nullptr;
+    }
+    m_watchedHandle = nullptr;
+}
+
+// Runs on a thread pool thread.
+void CALLBACK EventLoop::onWatchedHandleSignaled(PVOID param, BOOLEAN timedOut)
+{
+    EventLoop *const self = static_cast<EventLoop*>(param);
+    InterlockedExchange(&self->m_watchSignaled, 1);
+    PostQueuedCompletionStatus(self->m_completionPort.get(), 0, 0,
+                               &self->m_watchOver);
+}
+
+// Runs on the thread pool's wait thread.
+void CALLBACK EventLoop::onWaitTimerFired(PVOID param, BOOLEAN timedOut)
+{
+    EventLoop *const self = static_cast<EventLoop*>(param);
+    PostQueuedCompletionStatus(self->m_completionPort.get(), 0, 0,
+                               &self->m_waitTimerOver);
+}
+
+void EventLoop::wake()
+{
+    InterlockedExchange(&m_wakeRequested, 1);
+    if (m_completionPort.get() != nullptr) {
+        PostQueuedCompletionStatus(m_completionPort.get(), 0, 0,
+                                   &m_wakeOver);
+    } else {
+        SetEvent(m_wakeEvent.get());
+    }
+}
+
 NamedPipe &EventLoop::createNamedPipe()
 {
     NamedPipe *ret = new NamedPipe();
+    ret->m_completionPort = m_completionPort.get();
     m_pipes.push_back(ret);
     return *ret;
 }
 
+// Removes a closed pipe from the loop and deletes it.  A handler may call it,
+// even for the pipe whose I/O it is handling, as long as it doesn't touch the
+// pipe afterwards.
+void EventLoop::deleteNamedPipe(NamedPipe &pipe)
+{
+    ASSERT(pipe.isClosed() && "deleteNamedPipe called on an open pipe");
+    const auto it = std::find(m_pipes.begin(), m_pipes.end(), &pipe);
+    ASSERT(it != m_pipes.end() && "deleteNamedPipe: unknown pipe");
+    m_pipes.erase(it);
+    if (m_completionPort.get() != nullptr) {
+        // Closing the pipe canceled its I/O, and the port may still hold the
+        // completion packets, which are keyed by the pipe's address.
+        m_deletedPipes.push_back(&pipe);
+    } else {
+        delete &pipe;
+    }
+}
+
+// Has the pipe's writes issued on a thread of their own, which keeps them
+// going while this loop is busy.  It must be called before the pipe is
+// opened.
+void EventLoop::useOutputThread(NamedPipe &pipe)
+{
+    ASSERT(pipe.isClosed() && "useOutputThread called on an open pipe");
+    if (m_outputThread == nullptr) {
+        m_outputThread.reset(new OutputThread(*this));
+    }
+    pipe.m_outputThread = m_outputThread.get();
+}
+
 void EventLoop::setPollInterval(int ms)
 {
-    m_pollInterval = ms;
+    setPollIntervalRange(ms, ms);
+}
+
+// The poll interval starts at the minimum and doubles after each poll that
+// wasn't accompanied by a call to notePollActivity, up to the maximum.
+void EventLoop::setPollIntervalRange(int minMs, int maxMs)
+{
+    ASSERT(minMs <= maxMs);
+    m_minPollInterval = minMs;
+    m_maxPollInterval = maxMs;
+    m_pollInterval = minMs;
+}
+
+// Return to the minimum poll interval, e.g. because there was new output or
+// input.
+void EventLoop::notePollActivity()
+{
+    m_pollInterval = m_minPollInterval;
+    m_sawPollActivity = true;
+}
+
+// Call onPollTimeout after the given number of milliseconds, unless the
+// regular poll comes first.  If an earlier request is still pending, the
+// sooner of the two wins.  Unlike requestPoll, this doesn't wait for the
+// current poll to finish, so a caller can space out a few quick polls without
+// shortening the poll interval.
+void EventLoop::requestPollIn(int ms)
+{
+    ASSERT(ms >= 0);
+    const int64_t deadline = deadlineTick(ms);
+    if (m_pollSoonTimer.armed() && m_pollSoonTimer.deadline() <= deadline) {
+        return;
+    }
+    m_timers.arm(m_pollSoonTimer, deadline);
+}
+
+// Call onTimer once, after the given number of milliseconds, replacing any
+// timer that hasn't fired yet.
+void EventLoop::setTimer(int ms)
+{
+    ASSERT(ms >= 0);
+    m_timers.arm(m_oneShotTimer, deadlineTick(ms));
+}
+
+// Call onTimerExpired once, after the given number of milliseconds.  An
+// armed timer moves to the new deadline.  The timer belongs to the caller,
+// who must keep it alive while it's armed (its destructor cancels it).  Any
+// number of timers may be armed, and arming or cancelling one is O(1).
+void EventLoop::armTimer(Timer &timer, int ms)
+{
+    ASSERT(ms >= 0);
+    m_timers.arm(timer, deadlineTick(ms));
 }
 
 void EventLoop::shutdown()
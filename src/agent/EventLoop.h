@@ -21,27 +21,98 @@
 #ifndef EVENTLOOP_H
 #define EVENTLOOP_H
 
+#include <windows.h>
+#include <stdint.h>
+
+#include <memory>
 #include <vector>
 
+#include "TimerWheel.h"
+#include "../shared/OwnedHandle.h"
+
 class NamedPipe;
+class OutputThread;
 
 class EventLoop
 {
 public:
+    typedef TimerWheel::Timer Timer;
+
+    EventLoop();
     virtual ~EventLoop();
     void run();
+    // Call onWake from the loop's thread soon.  Any thread may call it.
+    void wake();
 
 protected:
+    void useCompletionPort();
     NamedPipe &createNamedPipe();
+    void deleteNamedPipe(NamedPipe &pipe);
+    void useOutputThread(NamedPipe &pipe);
     void setPollInterval(int ms);
+    void setPollIntervalRange(int minMs, int maxMs);
+    void notePollActivity();
+    void requestPoll() { m_pollRequested = true; }
+    void requestPollIn(int ms);
+    void requestPollOnSignal(HANDLE handle);
+    void setTimer(int ms);
+    void armTimer(Timer &timer, int ms);
+    void cancelTimer(Timer &timer) { m_timers.cancel(timer); }
     void shutdown();
     virtual void onPollTimeout()                    {}
+    virtual void onTimer()                          {}
+    virtual void onTimerExpired(Timer &timer)       {}
     virtual void onPipeIo(NamedPipe &namedPipe)     {}
+    virtual void onWake()                           {}
 
 private:
+    void waitForCompletions(DWORD timeout);
+    DWORD armWaitTimer(int64_t deadlineUs);
+    void cancelHandleWatch();
+    static void CALLBACK onWatchedHandleSignaled(PVOID param,
+                                                 BOOLEAN timedOut);
+    static void CALLBACK onWaitTimerFired(PVOID param, BOOLEAN timedOut);
+
     bool m_exiting = false;
+    OwnedHandle m_completionPort;
     std::vector<NamedPipe*> m_pipes;
+    // Pipes removed by deleteNamedPipe that the completion port may still
+    // hold packets for.  waitForCompletions deletes them once it has emptied
+    // the port.
+    std::vector<NamedPipe*> m_deletedPipes;
     int m_pollInterval = 0;
+    int m_minPollInterval = 0;
+    int m_maxPollInterval = 0;
+    bool m_sawPollActivity = false;
+    bool m_pollRequested = false;
+    // Every deadline but the poll interval's, in milliseconds on the
+    // QueryPerformanceCounter clock.  m_pollSoonTimer is requestPollIn's, and
+    // m_oneShotTimer is setTimer's.
+    TimerWheel m_timers;
+    Timer m_pollSoonTimer;
+    Timer m_oneShotTimer;
+    // The loop sleeps until its next deadline on this waitable timer rather
+    // than with a wait timeout, which is rounded to the system timer's tick.
+    // Without a completion port, it's in the wait set.  With one, a thread
+    // pool wait posts a packet with a zero key when it fires.
+    OwnedHandle m_waitTimer;
+    HANDLE m_waitTimerWait = nullptr;
+    OVERLAPPED m_waitTimerOver = {};
+    // See requestPollOnSignal.  Without a completion port, the handle joins
+    // the wait set.  With one, a thread pool wait sets m_watchSignaled and
+    // posts a packet with a zero key to wake the loop.
+    HANDLE m_watchedHandle = nullptr;
+    HANDLE m_watchWait = nullptr;
+    volatile LONG m_watchSignaled = 0;
+    OVERLAPPED m_watchOver = {};
+    // See wake.  Without a completion port, m_wakeEvent is always in the
+    // wait set.  With one, wake posts a packet with a zero key instead.
+    OwnedHandle m_wakeEvent;
+    volatile LONG m_wakeRequested = 0;
+    OVERLAPPED m_wakeOver = {};
+    // Started by the first useOutputThread call.  The pipes are deleted
+    // before it, in the destructor's body.
+    std::unique_ptr<OutputThread> m_outputThread;
 };
 
 #endif // EVENTLOOP_H
@@ -0,0 +1,43 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_FULL_WIDTH_TABLE_H
+#define AGENT_FULL_WIDTH_TABLE_H
+
+#include <stdint.h>
+
+// A bitmap of the BMP code points that a console might display in two cells:
+// the East Asian Wide, Fullwidth, and Ambiguous characters, the characters
+// that are double-byte in a Windows CJK code page, and the surrogates.  The
+// console's cell attributes decide whether one of these actually is
+// full-width, but every other code point is always a single cell.  It's
+// split into 256-character blocks, and identical blocks are shared.
+// Generated by GenFullWidthTable.cc.
+extern const uint8_t kFullWidthBlockIndex[256];
+extern const uint8_t kFullWidthBlocks[][32];
+
+inline bool mayBeFullWidth(wchar_t ch)
+{
+    const unsigned int cp = static_cast<uint16_t>(ch);
+    const uint8_t *block = kFullWidthBlocks[kFullWidthBlockIndex[cp >> 8]];
+    return (block[(cp & 0xFF) >> 3] >> (cp & 7)) & 1;
+}
+
+#endif // AGENT_FULL_WIDTH_TABLE_H
@@ -0,0 +1,186 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Generates FullWidthTable.cc, the bitmap of the BMP characters that a
+// console might display in two cells, from the Unicode EastAsianWidth.txt
+// file and the CJK code pages installed in Windows.  Rerun it when
+// updating to a new Unicode version:
+//
+//     GenFullWidthTable EastAsianWidth.txt > FullWidthTable.cc
+//
+// It needs no other winpty code.
+
+#include <windows.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+static const char kLicense[] =
+    "// Copyright (c) 2016 Ryan Prichard\n"
+    "//\n"
+    "// Permission is hereby granted, free of charge, to any person obtaining a copy\n"
+    "// of this software and associated documentation files (the \"Software\"), to\n"
+    "// deal in the Software without restriction, including without limitation the\n"
+    "// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or\n"
+    "// sell copies of the Software, and to permit persons to whom the Software is\n"
+    "// furnished to do so, subject to the following conditions:\n"
+    "//\n"
+    "// The above copyright notice and this permission notice shall be included in\n"
+    "// all copies or substantial portions of the Software.\n"
+    "//\n"
+    "// THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR\n"
+    "// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n"
+    "// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n"
+    "// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n"
+    "// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING\n"
+    "// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS\n"
+    "// IN THE SOFTWARE.\n";
+
+// Marks the characters of each line like "1100..115F;W" whose width is W, F,
+// or A.  Newer versions of the file pad the fields with spaces.
+static bool readEastAsianWidth(const char *path, std::vector<bool> &marks)
+{
+    FILE *fp = fopen(path, "r");
+    if (fp == nullptr) {
+        return false;
+    }
+    char line[1024];
+    while (fgets(line, sizeof(line), fp) != nullptr) {
+        std::string text;
+        for (const char *p = line; *p != '\0' && *p != '#'; ++p) {
+            if (*p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') {
+                text.push_back(*p);
+            }
+        }
+        const size_t semi = text.find(';');
+        if (semi == std::string::npos) {
+            continue;
+        }
+        const std::string width = text.substr(semi + 1);
+        if (width != "W" && width != "F" && width != "A") {
+            continue;
+        }
+        const std::string range = text.substr(0, semi);
+        const size_t dots = range.find("..");
+        const unsigned long first = strtoul(range.c_str(), nullptr, 16);
+        const unsigned long last = dots == std::string::npos
+            ? first
+            : strtoul(range.c_str() + dots + 2, nullptr, 16);
+        for (unsigned long cp = first; cp <= last && cp < 0x10000; ++cp) {
+            marks[cp] = true;
+        }
+    }
+    fclose(fp);
+    return true;
+}
+
+// Marks the characters that encode to two bytes in one of the CJK code pages
+// (Japanese, Simplified Chinese, Korean, and Traditional Chinese).
+static void markDoubleByteCharacters(std::vector<bool> &marks)
+{
+    static const UINT kCodePages[] = { 932, 936, 949, 950 };
+    for (UINT codePage : kCodePages) {
+        for (unsigned int cp = 0; cp < 0x10000; ++cp) {
+            if (cp >= 0xD800 && cp <= 0xDFFF) {
+                continue;
+            }
+            const wchar_t ch = static_cast<wchar_t>(cp);
+            char bytes[8];
+            BOOL usedDefault = FALSE;
+            const int len = WideCharToMultiByte(
+                codePage, WC_NO_BEST_FIT_CHARS, &ch, 1,
+                bytes, sizeof(bytes), nullptr, &usedDefault);
+            if (len == 2 && !usedDefault) {
+                marks[cp] = true;
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s EastAsianWidth.txt\n", argv[0]);
+        return 1;
+    }
+    std::vector<bool> marks(0x10000);
+    if (!readEastAsianWidth(argv[1], marks)) {
+        fprintf(stderr, "Could not read %s\n", argv[1]);
+        return 1;
+    }
+    markDoubleByteCharacters(marks);
+    for (unsigned int cp = 0xD800; cp <= 0xDFFF; ++cp) {
+        marks[cp] = true;
+    }
+
+    std::vector<std::string> blocks;
+    std::vector<size_t> index;
+    for (unsigned int b = 0; b < 256; ++b) {
+        std::string bits(32, '\0');
+        for (unsigned int i = 0; i < 256; ++i) {
+            if (marks[b * 256 + i]) {
+                bits[i / 8] |= static_cast<char>(1 << (i % 8));
+            }
+        }
+        size_t j = 0;
+        while (j < blocks.size() && blocks[j] != bits) {
+            ++j;
+        }
+        if (j == blocks.size()) {
+            blocks.push_back(bits);
+        }
+        index.push_back(j);
+    }
+
+    fputs(kLicense, stdout);
+    printf("\n");
+    printf("// Generated by GenFullWidthTable.cc from EastAsianWidth.txt and "
+           "the Windows\n// CJK code pages.  Do not edit.\n");
+    printf("\n");
+    printf("#include \"FullWidthTable.h\"\n");
+    printf("\n");
+    printf("const uint8_t kFullWidthBlockIndex[256] = {\n");
+    for (size_t i = 0; i < index.size(); i += 16) {
+        printf("   ");
+        for (size_t j = i; j < i + 16; ++j) {
+            printf(" %u,", static_cast<unsigned int>(index[j]));
+        }
+        printf("\n");
+    }
+    printf("};\n");
+    printf("\n");
+    printf("const uint8_t kFullWidthBlocks[][32] = {\n");
+    for (const auto &bits : blocks) {
+        for (size_t i = 0; i < 32; i += 16) {
+            printf(i == 0 ? "    {" : "     ");
+            for (size_t j = i; j < i + 16; ++j) {
+                printf(" 0x%02x,",
+                       static_cast<unsigned char>(bits[j]));
+            }
+            printf(i + 16 == 32 ? " },\n" : "\n");
+        }
+    }
+    printf("};\n");
+    return 0;
+}
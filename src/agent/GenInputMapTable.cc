@@ -0,0 +1,218 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Generates DefaultInputMapTable.cc, the agent's compiled-in table of the
+// default input map, from the encodings in DefaultInputMap.cc.  Rerun it
+// after changing DefaultInputMap.cc:
+//
+//     GenInputMapTable > DefaultInputMapTable.cc
+//
+// With the "check" argument, it instead verifies that the table compiled
+// into the program matches DefaultInputMap.cc.
+//
+// Build it with the agent's InputMap, DefaultInputMap,
+// DefaultInputMapTable, and DebugShowInput code, and the shared DebugClient
+// and WinptyAssert code.
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "DefaultInputMap.h"
+#include "InputMap.h"
+
+static const char kLicense[] =
+    "// Copyright (c) 2016 Ryan Prichard\n"
+    "//\n"
+    "// Permission is hereby granted, free of charge, to any person obtaining a copy\n"
+    "// of this software and associated documentation files (the \"Software\"), to\n"
+    "// deal in the Software without restriction, including without limitation the\n"
+    "// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or\n"
+    "// sell copies of the Software, and to permit persons to whom the Software is\n"
+    "// furnished to do so, subject to the following conditions:\n"
+    "//\n"
+    "// The above copyright notice and this permission notice shall be included in\n"
+    "// all copies or substantial portions of the Software.\n"
+    "//\n"
+    "// THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR\n"
+    "// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n"
+    "// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n"
+    "// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n"
+    "// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING\n"
+    "// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS\n"
+    "// IN THE SOFTWARE.\n";
+
+static std::string virtualKeyName(uint16_t virtualKey)
+{
+    static const struct {
+        uint16_t virtualKey;
+        const char *name;
+    } kNames[] = {
+#define WINPTY_VK_NAME(x) { VK_##x, "VK_" #x },
+        WINPTY_VK_NAME(BACK)        WINPTY_VK_NAME(TAB)
+        WINPTY_VK_NAME(CLEAR)       WINPTY_VK_NAME(RETURN)
+        WINPTY_VK_NAME(PRIOR)       WINPTY_VK_NAME(NEXT)
+        WINPTY_VK_NAME(END)         WINPTY_VK_NAME(HOME)
+        WINPTY_VK_NAME(LEFT)        WINPTY_VK_NAME(UP)
+        WINPTY_VK_NAME(RIGHT)       WINPTY_VK_NAME(DOWN)
+        WINPTY_VK_NAME(INSERT)      WINPTY_VK_NAME(DELETE)
+        WINPTY_VK_NAME(MULTIPLY)    WINPTY_VK_NAME(ADD)
+        WINPTY_VK_NAME(SUBTRACT)    WINPTY_VK_NAME(DIVIDE)
+        WINPTY_VK_NAME(F1)          WINPTY_VK_NAME(F2)
+        WINPTY_VK_NAME(F3)          WINPTY_VK_NAME(F4)
+        WINPTY_VK_NAME(F5)          WINPTY_VK_NAME(F6)
+        WINPTY_VK_NAME(F7)          WINPTY_VK_NAME(F8)
+        WINPTY_VK_NAME(F9)          WINPTY_VK_NAME(F10)
+        WINPTY_VK_NAME(F11)         WINPTY_VK_NAME(F12)
+#undef WINPTY_VK_NAME
+    };
+    for (const auto &entry : kNames) {
+        if (entry.virtualKey == virtualKey) {
+            return entry.name;
+        }
+    }
+    char buf[16];
+    if (virtualKey == 0) {
+        return "0";
+    } else if ((virtualKey >= 'A' && virtualKey <= 'Z') ||
+            (virtualKey >= '0' && virtualKey <= '9')) {
+        sprintf(buf, "'%c'", virtualKey);
+    } else {
+        sprintf(buf, "0x%02x", virtualKey);
+    }
+    return buf;
+}
+
+static std::string keyStateName(uint16_t keyState)
+{
+    static const struct {
+        uint16_t flag;
+        const char *name;
+    } kNames[] = {
+        { SHIFT_PRESSED,        "SHIFT_PRESSED" },
+        { LEFT_ALT_PRESSED,     "LEFT_ALT_PRESSED" },
+        { LEFT_CTRL_PRESSED,    "LEFT_CTRL_PRESSED" },
+        { RIGHT_ALT_PRESSED,    "RIGHT_ALT_PRESSED" },
+        { RIGHT_CTRL_PRESSED,   "RIGHT_CTRL_PRESSED" },
+        { ENHANCED_KEY,         "ENHANCED_KEY" },
+    };
+    std::string ret;
+    for (const auto &entry : kNames) {
+        if (keyState & entry.flag) {
+            ret += ret.empty() ? "" : " | ";
+            ret += entry.name;
+            keyState &= ~entry.flag;
+        }
+    }
+    if (ret.empty() && keyState == 0) {
+        return "0";
+    }
+    if (keyState != 0) {
+        char buf[16];
+        sprintf(buf, "0x%x", keyState);
+        ret += ret.empty() ? "" : " | ";
+        ret += buf;
+    }
+    return ret;
+}
+
+static bool sameKey(const InputMap::Key &a, const InputMap::Key &b)
+{
+    return a.virtualKey == b.virtualKey &&
+           a.unicodeChar == b.unicodeChar &&
+           a.keyState == b.keyState;
+}
+
+static int check(const std::vector<InputMap::TableNode> &nodes,
+                 const std::vector<unsigned char> &chars)
+{
+    const InputMap::Table &table = kDefaultInputMapTable;
+    bool ok = table.nodeCount == static_cast<int>(nodes.size());
+    for (int i = 0; ok && i < table.nodeCount; ++i) {
+        ok = table.nodes[i].firstChild == nodes[i].firstChild &&
+             table.nodes[i].childCount == nodes[i].childCount &&
+             sameKey(table.nodes[i].key, nodes[i].key) &&
+             table.chars[i] == chars[i];
+    }
+    printf("%s\n", ok ? "ok" : "DefaultInputMapTable.cc is out of date");
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    InputMap inputMap;
+    addDefaultEntriesToInputMap(inputMap);
+    std::vector<InputMap::TableNode> nodes;
+    std::vector<unsigned char> chars;
+    inputMap.compile(nodes, chars);
+
+    if (argc == 2 && !strcmp(argv[1], "check")) {
+        return check(nodes, chars);
+    }
+
+    fputs(kLicense, stdout);
+    printf("\n");
+    printf("// Generated by GenInputMapTable.cc from DefaultInputMap.cc.  "
+           "Do not edit.\n");
+    printf("\n");
+    printf("#include \"DefaultInputMap.h\"\n");
+    printf("\n");
+    printf("#include <windows.h>\n");
+    printf("\n");
+    printf("#include \"InputMap.h\"\n");
+    printf("\n");
+    printf("namespace {\n");
+    printf("\n");
+    printf("// { firstChild, childCount, { virtualKey, unicodeChar, "
+           "keyState } }\n");
+    printf("const InputMap::TableNode kNodes[] = {\n");
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const auto &node = nodes[i];
+        char unicodeChar[16];
+        sprintf(unicodeChar, node.key.unicodeChar == 0 ? "0" : "0x%02x",
+                node.key.unicodeChar);
+        printf("    { %u, %u, { %s, %s, %s } },\n",
+               node.firstChild, node.childCount,
+               virtualKeyName(node.key.virtualKey).c_str(),
+               unicodeChar,
+               keyStateName(node.key.keyState).c_str());
+    }
+    printf("};\n");
+    printf("\n");
+    printf("const unsigned char kChars[] = {\n");
+    for (size_t i = 0; i < chars.size(); i += 12) {
+        printf("   ");
+        for (size_t j = i; j < chars.size() && j < i + 12; ++j) {
+            printf(" 0x%02x,", chars[j]);
+        }
+        printf("\n");
+    }
+    printf("};\n");
+    printf("\n");
+    printf("} // anonymous namespace\n");
+    printf("\n");
+    printf("const InputMap::Table kDefaultInputMapTable = {\n");
+    printf("    kNodes, kChars, sizeof(kNodes) / sizeof(kNodes[0])\n");
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,413 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "HistoryStore.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "../shared/DebugClient.h"
+#include "../shared/WinptyAssert.h"
+
+namespace {
+
+// Appends are written once this much is buffered.
+const size_t kFlushSize = 64 * 1024;
+
+// Reads map at least this much of a file at a time, so reading consecutive
+// lines reuses one view.
+const size_t kViewSize = 1024 * 1024;
+
+// Each line's record is this header, then its AttributeRuns, then its text.
+struct RecordHeader {
+    uint16_t width;
+    uint16_t textLength;
+    uint16_t runCount;
+    // The attributes of the trimmed cells past textLength.
+    uint16_t blankAttributes;
+};
+
+struct AttributeRun {
+    uint16_t start;
+    uint16_t attributes;
+};
+
+// Each block of this many lines has a Bloom filter of this many bytes.  Two
+// bits per trigram keep false positives rare for queries of a few trigrams,
+// even in blocks of long lines.
+const uint64_t kSearchBlockLines = 64;
+const size_t kBloomBytes = 2048;
+
+inline WCHAR foldCase(WCHAR ch) {
+    return ch >= L'A' && ch <= L'Z'
+        ? static_cast<WCHAR>(ch + (L'a' - L'A'))
+        : ch;
+}
+
+// The text of a line, without the second cell of each full-width character
+// or the line's trailing blanks.
+void lineText(const CHAR_INFO *cells, int width, std::wstring &out) {
+    out.clear();
+    for (int i = 0; i < width; ++i) {
+        if (!(cells[i].Attributes & COMMON_LVB_TRAILING_BYTE)) {
+            out.push_back(cells[i].Char.UnicodeChar);
+        }
+    }
+    while (!out.empty() && out.back() == L' ') {
+        out.pop_back();
+    }
+}
+
+// The two filter bits of the case-folded trigram at `text`.
+void trigramBits(const WCHAR *text, uint32_t (&bits)[2]) {
+    const uint64_t key =
+        (static_cast<uint64_t>(foldCase(text[0])) << 32) |
+        (static_cast<uint64_t>(foldCase(text[1])) << 16) |
+        foldCase(text[2]);
+    const uint64_t hash = key * 0x9E3779B97F4A7C15ull;
+    const uint32_t mask = kBloomBytes * 8 - 1;
+    bits[0] = static_cast<uint32_t>(hash >> 40) & mask;
+    bits[1] = static_cast<uint32_t>(hash >> 20) & mask;
+}
+
+DWORD allocationGranularity() {
+    static const DWORD ret = []() {
+        SYSTEM_INFO info = {};
+        GetSystemInfo(&info);
+        return info.dwAllocationGranularity;
+    }();
+    return ret;
+}
+
+} // anonymous namespace
+
+bool HistoryStore::MappedFile::create() {
+    wchar_t tempPath[MAX_PATH];
+    wchar_t path[MAX_PATH];
+    const DWORD len = GetTempPathW(MAX_PATH, tempPath);
+    if (len == 0 || len >= MAX_PATH ||
+            GetTempFileNameW(tempPath, L"wph", 0, path) == 0) {
+        return false;
+    }
+    const HANDLE file = CreateFileW(
+        path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+        FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        DeleteFileW(path);
+        return false;
+    }
+    m_file = OwnedHandle(file);
+    return true;
+}
+
+bool HistoryStore::MappedFile::append(const void *data, size_t size) {
+    m_pending.append(static_cast<const char*>(data), size);
+    return m_pending.size() < kFlushSize || flush();
+}
+
+bool HistoryStore::MappedFile::flush() {
+    size_t done = 0;
+    while (done < m_pending.size()) {
+        DWORD written = 0;
+        const DWORD amount = static_cast<DWORD>(m_pending.size() - done);
+        if (!WriteFile(m_file.get(), &m_pending[done], amount, &written,
+                       nullptr) || written == 0) {
+            m_pending.erase(0, done);
+            m_size += done;
+            return false;
+        }
+        done += written;
+    }
+    m_size += done;
+    m_pending.clear();
+    return true;
+}
+
+void HistoryStore::MappedFile::unmap() {
+    if (m_view != nullptr) {
+        UnmapViewOfFile(m_view);
+        m_view = nullptr;
+        m_viewSize = 0;
+    }
+}
+
+const char *HistoryStore::MappedFile::view(uint64_t offset, size_t size) {
+    ASSERT(size > 0 && offset + size <= this->size());
+    if (offset + size > m_size && !flush()) {
+        return nullptr;
+    }
+    if (m_view != nullptr && offset >= m_viewOffset &&
+            offset + size <= m_viewOffset + m_viewSize) {
+        return m_view + (offset - m_viewOffset);
+    }
+    unmap();
+    if (offset + size > m_mappingSize) {
+        // A mapping of size 0 covers the whole file as it is now.
+        m_mapping = OwnedHandle(CreateFileMappingW(
+            m_file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+        if (m_mapping.get() == nullptr) {
+            m_mappingSize = 0;
+            return nullptr;
+        }
+        m_mappingSize = m_size;
+    }
+    const uint64_t base = offset & ~static_cast<uint64_t>(
+        allocationGranularity() - 1);
+    const uint64_t end = std::min<uint64_t>(
+        m_mappingSize, std::max<uint64_t>(offset + size, base + kViewSize));
+    const size_t viewSize = static_cast<size_t>(end - base);
+    m_view = static_cast<char*>(MapViewOfFile(
+        m_mapping.get(), FILE_MAP_READ,
+        static_cast<DWORD>(base >> 32), static_cast<DWORD>(base),
+        viewSize));
+    if (m_view == nullptr) {
+        return nullptr;
+    }
+    m_viewOffset = base;
+    m_viewSize = viewSize;
+    return m_view + (offset - base);
+}
+
+std::unique_ptr<HistoryStore> HistoryStore::create() {
+    std::unique_ptr<HistoryStore> ret(new HistoryStore);
+    if (!ret->m_lines.create() || !ret->m_index.create() ||
+            !ret->m_blooms.create()) {
+        trace("Could not create the history store files: error %u",
+              static_cast<unsigned>(GetLastError()));
+        return std::unique_ptr<HistoryStore>();
+    }
+    ret->m_bloom.assign(kBloomBytes, 0);
+    return ret;
+}
+
+void HistoryStore::append(const CHAR_INFO *cells, int width) {
+    if (m_failed) {
+        return;
+    }
+    ASSERT(width >= 0 && width <= 0xFFFF);
+    RecordHeader header = {};
+    header.width = static_cast<uint16_t>(width);
+    header.blankAttributes = width > 0 ? cells[width - 1].Attributes : 7;
+    int textLength = width;
+    while (textLength > 0 &&
+            cells[textLength - 1].Char.UnicodeChar == L' ' &&
+            cells[textLength - 1].Attributes == header.blankAttributes) {
+        --textLength;
+    }
+    header.textLength = static_cast<uint16_t>(textLength);
+
+    m_record.resize(sizeof(header));
+    for (int i = 0; i < textLength; ++i) {
+        if (i == 0 || cells[i].Attributes != cells[i - 1].Attributes) {
+            const AttributeRun run = {
+                static_cast<uint16_t>(i), cells[i].Attributes
+            };
+            m_record.append(reinterpret_cast<const char*>(&run), sizeof(run));
+            header.runCount++;
+        }
+    }
+    for (int i = 0; i < textLength; ++i) {
+        const WCHAR ch = cells[i].Char.UnicodeChar;
+        m_record.append(reinterpret_cast<const char*>(&ch), sizeof(ch));
+    }
+    memcpy(&m_record[0], &header, sizeof(header));
+
+    lineText(cells, width, m_text);
+    addToBloom(m_text);
+
+    // A failed write before the line is counted leaves only unreferenced
+    // bytes (or filter bits) behind.
+    const uint64_t offset = m_lines.size();
+    const bool blockDone = (m_lineCount + 1) % kSearchBlockLines == 0;
+    if (!m_lines.append(m_record.data(), m_record.size()) ||
+            !m_index.append(&offset, sizeof(offset)) ||
+            (blockDone && !m_blooms.append(m_bloom.data(), kBloomBytes))) {
+        trace("History store write failed: error %u -- history stops at "
+              "line %lld", static_cast<unsigned>(GetLastError()),
+              static_cast<long long>(m_lineCount));
+        m_failed = true;
+        return;
+    }
+    m_lineCount++;
+    if (blockDone) {
+        std::fill(m_bloom.begin(), m_bloom.end(), 0);
+    }
+}
+
+void HistoryStore::addToBloom(const std::wstring &text) {
+    uint32_t bits[2];
+    for (size_t i = 0; i + 3 <= text.size(); ++i) {
+        trigramBits(&text[i], bits);
+        m_bloom[bits[0] / 8] |= static_cast<uint8_t>(1 << (bits[0] % 8));
+        m_bloom[bits[1] / 8] |= static_cast<uint8_t>(1 << (bits[1] % 8));
+    }
+}
+
+// Returns the filter of the given block, or NULL if it can't be read.  The
+// filter of the last, partly filled block is the one in memory.
+const uint8_t *HistoryStore::blockBloom(uint64_t block) {
+    if (block == m_lineCount / kSearchBlockLines) {
+        return m_bloom.data();
+    }
+    return reinterpret_cast<const uint8_t*>(
+        m_blooms.view(block * kBloomBytes, kBloomBytes));
+}
+
+bool HistoryStore::searchLine(uint64_t line, const std::wstring &query,
+                              bool ignoreCase) {
+    if (!readLine(line, m_searchLine)) {
+        return false;
+    }
+    lineText(m_searchLine.data(), static_cast<int>(m_searchLine.size()),
+             m_text);
+    if (ignoreCase) {
+        for (WCHAR &ch : m_text) {
+            ch = foldCase(ch);
+        }
+    }
+    return m_text.find(query) != std::wstring::npos;
+}
+
+void HistoryStore::search(const std::wstring &query, bool ignoreCase,
+                          bool backward, uint64_t fromLine,
+                          size_t maxResults, std::vector<uint64_t> &out) {
+    if (query.empty() || m_lineCount == 0) {
+        return;
+    }
+    if (fromLine >= m_lineCount) {
+        if (!backward) {
+            return;
+        }
+        fromLine = m_lineCount - 1;
+    }
+    // A query shorter than a trigram has no bits, so every block is read.
+    std::vector<uint32_t> queryBits;
+    for (size_t i = 0; i + 3 <= query.size(); ++i) {
+        uint32_t bits[2];
+        trigramBits(&query[i], bits);
+        queryBits.push_back(bits[0]);
+        queryBits.push_back(bits[1]);
+    }
+    std::wstring pattern = query;
+    if (ignoreCase) {
+        for (WCHAR &ch : pattern) {
+            ch = foldCase(ch);
+        }
+    }
+
+    uint64_t block = fromLine / kSearchBlockLines;
+    while (out.size() < maxResults) {
+        const uint8_t *const bloom = blockBloom(block);
+        if (bloom == nullptr) {
+            return;
+        }
+        bool candidate = true;
+        for (uint32_t bit : queryBits) {
+            if (!(bloom[bit / 8] & (1 << (bit % 8)))) {
+                candidate = false;
+                break;
+            }
+        }
+        if (candidate) {
+            const uint64_t first = block * kSearchBlockLines;
+            const uint64_t stop =
+                std::min(first + kSearchBlockLines, m_lineCount);
+            if (!backward) {
+                for (uint64_t line = std::max(first, fromLine);
+                        line < stop && out.size() < maxResults; ++line) {
+                    if (searchLine(line, pattern, ignoreCase)) {
+                        out.push_back(line);
+                    }
+                }
+            } else {
+                for (uint64_t line = std::min(stop, fromLine + 1);
+                        line > first && out.size() < maxResults; --line) {
+                    if (searchLine(line - 1, pattern, ignoreCase)) {
+                        out.push_back(line - 1);
+                    }
+                }
+            }
+        }
+        if (backward) {
+            if (block == 0) {
+                break;
+            }
+            --block;
+        } else {
+            ++block;
+            if (block * kSearchBlockLines >= m_lineCount) {
+                break;
+            }
+        }
+    }
+}
+
+bool HistoryStore::readLine(uint64_t line, std::vector<CHAR_INFO> &out) {
+    if (line >= m_lineCount) {
+        return false;
+    }
+    const char *const indexEntry =
+        m_index.view(line * sizeof(uint64_t), sizeof(uint64_t));
+    if (indexEntry == nullptr) {
+        return false;
+    }
+    uint64_t offset = 0;
+    memcpy(&offset, indexEntry, sizeof(offset));
+    const char *data = m_lines.view(offset, sizeof(RecordHeader));
+    if (data == nullptr) {
+        return false;
+    }
+    RecordHeader header;
+    memcpy(&header, data, sizeof(header));
+    const size_t runsSize = header.runCount * sizeof(AttributeRun);
+    data = m_lines.view(offset, sizeof(header) + runsSize +
+                                header.textLength * sizeof(WCHAR));
+    if (data == nullptr) {
+        return false;
+    }
+    const char *const runs = data + sizeof(header);
+    const char *const text = runs + runsSize;
+
+    out.resize(header.width);
+    size_t runIndex = 0;
+    WORD attributes = header.blankAttributes;
+    for (int i = 0; i < header.width; ++i) {
+        CHAR_INFO &cell = out[i];
+        if (i < header.textLength) {
+            while (runIndex < header.runCount) {
+                AttributeRun run;
+                memcpy(&run, runs + runIndex * sizeof(run), sizeof(run));
+                if (run.start > i) {
+                    break;
+                }
+                attributes = run.attributes;
+                ++runIndex;
+            }
+            memcpy(&cell.Char.UnicodeChar, text + i * sizeof(WCHAR),
+                   sizeof(WCHAR));
+            cell.Attributes = attributes;
+        } else {
+            cell.Char.UnicodeChar = L' ';
+            cell.Attributes = header.blankAttributes;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_HISTORY_STORE_H
+#define AGENT_HISTORY_STORE_H
+
+#include <windows.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../shared/OwnedHandle.h"
+
+// With WINPTY_FLAG_HISTORY_STORE, the lines that scroll above the console
+// window are appended here, so a client can fetch old output from the agent
+// instead of keeping all of it.  The lines are kept in a temporary file, in
+// the compact form ConsoleLine uses (UTF-16 text with trailing blanks
+// trimmed, plus runs of attributes), and a second file holds the offset of
+// each line, so any line is found in constant time.  Both files are read
+// through a mapped view, so the history costs little memory however long it
+// grows.  The files are deleted when the agent exits.
+//
+// For search, each block of 64 lines has a Bloom filter of the
+// case-folded trigrams of its lines' text, kept in a third file.  A search
+// reads only the blocks whose filters hold every trigram of the query.
+class HistoryStore {
+public:
+    // Creates the store's files.  Returns NULL on failure.
+    static std::unique_ptr<HistoryStore> create();
+
+    void append(const CHAR_INFO *cells, int width);
+    uint64_t lineCount() const { return m_lineCount; }
+    // Decodes the given line into `out`, which is resized to the line's
+    // width.  Returns false if the line can't be read.
+    bool readLine(uint64_t line, std::vector<CHAR_INFO> &out);
+    // Appends to `out` the lines containing `query`, from `fromLine` toward
+    // the end of the history (or, if `backward`, toward line 0), until `out`
+    // holds maxResults lines.
+    void search(const std::wstring &query, bool ignoreCase, bool backward,
+                uint64_t fromLine, size_t maxResults,
+                std::vector<uint64_t> &out);
+
+    HistoryStore(const HistoryStore &other) = delete;
+    HistoryStore &operator=(const HistoryStore &other) = delete;
+
+private:
+    // A temporary file that grows by appends and is read through a mapped
+    // view.  Appends are buffered until the buffer fills or a read needs
+    // them.
+    class MappedFile {
+    public:
+        MappedFile() {}
+        ~MappedFile() { unmap(); }
+        bool create();
+        bool append(const void *data, size_t size);
+        uint64_t size() const { return m_size + m_pending.size(); }
+        // Returns the given range of the file, or NULL on failure.  The
+        // pointer is valid until the next call.
+        const char *view(uint64_t offset, size_t size);
+    private:
+        bool flush();
+        void unmap();
+        OwnedHandle m_file;
+        OwnedHandle m_mapping;
+        // The bytes written to the file, and the size of m_mapping.
+        uint64_t m_size = 0;
+        uint64_t m_mappingSize = 0;
+        std::string m_pending;
+        char *m_view = nullptr;
+        uint64_t m_viewOffset = 0;
+        size_t m_viewSize = 0;
+    };
+
+    HistoryStore() {}
+    void addToBloom(const std::wstring &text);
+    const uint8_t *blockBloom(uint64_t block);
+    bool searchLine(uint64_t line, const std::wstring &query,
+                    bool ignoreCase);
+
+    MappedFile m_lines;
+    MappedFile m_index;
+    MappedFile m_blooms;
+    uint64_t m_lineCount = 0;
+    // The filter of the block being filled, which isn't in m_blooms yet.
+    std::vector<uint8_t> m_bloom;
+    std::wstring m_text;
+    std::vector<CHAR_INFO> m_searchLine;
+    // Once a write fails, the store stops growing.
+    bool m_failed = false;
+    std::string m_record;
+};
+
+#endif // AGENT_HISTORY_STORE_H
@@ -0,0 +1,333 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Benchmarks and fuzzes ConsoleInput, the parser that turns terminal input
+// bytes into console INPUT_RECORDs, without a console input buffer: records
+// are collected in memory instead of written to CONIN.
+//
+//     InputBenchmark [STREAM...] [FILE...]
+//         Feeds each stream through ConsoleInput in 4KiB chunks, like the
+//         agent's CONIN reads, and reports MB/s and records per KiB.  The
+//         built-in streams are paste, utf8, mouse, and vim.  Any other
+//         argument names a file holding recorded terminal input.
+//
+//     InputBenchmark -fuzz ITERATIONS [SEED]
+//         Feeds random mixtures of escape sequence fragments, mouse reports,
+//         and bytes, and checks that a whole feed and a randomly split feed
+//         produce the same key records, that the mouse records stay in the
+//         window, and that the byte queue drains.  Mouse records aren't
+//         compared because motion coalescing depends on the batching.
+//
+// Build it with -DCONSOLE_INPUT_TESTING and the agent's ConsoleInput,
+// ConsoleInputReencoding, DebugShowInput, DefaultInputMap, InputMap,
+// EtwTrace, Profiler, and Win32Console code, and the shared CpuFeatures, DebugClient,
+// StringBuilder, UnicodeTranscode, and WinptyAssert code.  Defining CONSOLE_INPUT_FUZZER instead builds a
+// libFuzzer entry point.  Win32Console needs a console window, so one is
+// allocated if the process has none.
+
+#include <windows.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../include/winpty_constants.h"
+#include "../shared/TimeMeasurement.h"
+
+#include "ConsoleInput.h"
+#include "DsrSender.h"
+#include "Win32Console.h"
+
+namespace {
+
+const int kCols = 80;
+const int kRows = 25;
+const size_t kChunkSize = 4096;
+const double kMinSeconds = 0.5;
+
+class StubDsrSender : public DsrSender {
+public:
+    virtual void sendDsr() override { ++m_count; }
+private:
+    int m_count = 0;
+};
+
+Win32Console &stubConsole() {
+    if (GetConsoleWindow() == nullptr) {
+        AllocConsole();
+    }
+    static Win32Console console;
+    return console;
+}
+
+// A ConsoleInput with mouse input enabled, so mouse reports are decoded.
+struct Parser {
+    StubDsrSender dsrSender;
+    std::vector<INPUT_RECORD> records;
+    ConsoleInput input;
+
+    Parser() :
+        input(nullptr, WINPTY_MOUSE_MODE_AUTO, 0, dsrSender, stubConsole())
+    {
+        input.setRecordSink(&records);
+        input.setMouseWindowRect(SmallRect(0, 0, kCols, kRows));
+        input.updateInputFlags(ENABLE_EXTENDED_FLAGS | ENABLE_MOUSE_INPUT);
+    }
+
+    // Feeds `data` in pieces ending at each of `splits`, then flushes any
+    // incomplete escape sequence, as the agent's escape timeout would.
+    void feed(const std::string &data, const std::vector<size_t> &splits) {
+        size_t pos = 0;
+        for (size_t split : splits) {
+            input.writeInput(data.substr(pos, split - pos));
+            pos = split;
+        }
+        input.writeInput(data.substr(pos));
+        input.flushIncompleteEscapeCode();
+    }
+};
+
+std::string repeat(const std::string &text, size_t size) {
+    std::string ret;
+    while (ret.size() < size) {
+        ret += text;
+    }
+    return ret;
+}
+
+std::string makeStream(const std::string &name) {
+    const size_t size = 256 * 1024;
+    std::string ret;
+    if (name == "paste") {
+        ret = repeat("for (int i = 0; i < count; ++i) { total += i; }\r", size);
+    } else if (name == "utf8") {
+        ret = repeat("caf\xC3\xA9 \xE4\xB8\xAD\xE6\x96\x87 "
+                     "\xF0\x9F\x98\x80 na\xC3\xAFve\r", size);
+    } else if (name == "mouse") {
+        // SGR motion reports with a button held, then a release.
+        while (ret.size() < size) {
+            char buf[32];
+            const int n = static_cast<int>(ret.size() / 16);
+            sprintf(buf, "\x1B[<32;%d;%dM", 1 + n % kCols, 1 + n / 7 % kRows);
+            ret += buf;
+            if (n % 50 == 0) {
+                ret += "\x1B[<0;1;1m";
+            }
+        }
+    } else if (name == "vim") {
+        // Cursor movement, function keys, Alt chords, bare Escapes, and
+        // short insertions, as in an editing session.
+        ret = repeat("\x1B[A\x1B[A\x1BOB\x1B[C\x1B[1;5C\x1B[15~"
+                     "\x1Bj\x1B" "dd\x1B[3~\x1B[H\x1B[F" "ihello\x1B"
+                     "\x1B[5~\x1B[6~\x7F\x7F\x08:wq\r", size);
+    }
+    return ret;
+}
+
+bool readFile(const char *path, std::string &out) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == nullptr) {
+        return false;
+    }
+    char buf[64 * 1024];
+    size_t amount = 0;
+    while ((amount = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        out.append(buf, amount);
+    }
+    fclose(fp);
+    return true;
+}
+
+void benchmarkStream(const char *name, const std::string &data) {
+    std::vector<size_t> splits;
+    for (size_t pos = kChunkSize; pos < data.size(); pos += kChunkSize) {
+        splits.push_back(pos);
+    }
+    Parser parser;
+    int64_t bytes = 0;
+    int64_t records = 0;
+    TimeMeasurement tm;
+    double elapsed = 0.0;
+    do {
+        parser.feed(data, splits);
+        bytes += data.size();
+        records += parser.records.size();
+        parser.records.clear();
+    } while ((elapsed = tm.elapsed()) < kMinSeconds);
+    printf("%-12s %9.2f MB/s %9.1f records/KiB\n",
+           name, bytes / elapsed / (1024.0 * 1024.0),
+           bytes == 0 ? 0.0 : records * 1024.0 / bytes);
+}
+
+// Pieces of the sequences the parser recognizes, so random input reaches
+// more than the printable-character path.
+const char *const kFragments[] = {
+    "\x1B", "\x1B[", "\x1BO", "\x1B[<", "\x1B[M", "[", ";", "~", "M", "m",
+    "A", "B", "1", "5", "64", "\x1B[1;5C", "\x1B[15~", "\x1B[<0;10;5M",
+    "\x1B[<35;200;300M", "\x1B[32;1R", "\x03", "\x7F", "\r", "\xC3",
+    "\xA9", "\xE4\xB8", "\xF0\x9F\x98\x80", "hello",
+};
+
+std::string randomInput(uint32_t &seed) {
+    auto next = [&]() {
+        seed = seed * 1103515245u + 12345u;
+        return seed >> 16;
+    };
+    std::string ret;
+    const int pieces = 1 + next() % 64;
+    for (int i = 0; i < pieces; ++i) {
+        if (next() % 4 == 0) {
+            ret.push_back(static_cast<char>(next() % 256));
+        } else {
+            ret += kFragments[next() % (sizeof(kFragments) /
+                                        sizeof(kFragments[0]))];
+        }
+    }
+    return ret;
+}
+
+std::vector<KEY_EVENT_RECORD> keyRecords(
+        const std::vector<INPUT_RECORD> &records) {
+    std::vector<KEY_EVENT_RECORD> ret;
+    for (const auto &rec : records) {
+        if (rec.EventType == KEY_EVENT) {
+            ret.push_back(rec.Event.KeyEvent);
+        }
+    }
+    return ret;
+}
+
+bool sameKeys(const std::vector<KEY_EVENT_RECORD> &a,
+              const std::vector<KEY_EVENT_RECORD> &b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (memcmp(&a[i], &b[i], sizeof(a[i])) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void dumpInput(const std::string &data) {
+    for (unsigned char ch : data) {
+        fprintf(stderr, "%02X ", ch);
+    }
+    fprintf(stderr, "\n");
+}
+
+// Returns false, after describing the problem, if `data` breaks one of the
+// invariants listed at the top of the file.
+bool checkInput(const std::string &data, uint32_t &seed) {
+    std::vector<size_t> splits;
+    for (size_t pos = 0; pos < data.size(); ) {
+        seed = seed * 1103515245u + 12345u;
+        pos += 1 + (seed >> 16) % 8;
+        if (pos < data.size()) {
+            splits.push_back(pos);
+        }
+    }
+    Parser whole;
+    whole.feed(data, {});
+    Parser split;
+    split.feed(data, splits);
+    for (const Parser *parser : { &whole, &split }) {
+        if (parser->input.queuedByteCount() != 0) {
+            fprintf(stderr, "Error: input left queued after flush: ");
+            dumpInput(data);
+            return false;
+        }
+        for (const auto &rec : parser->records) {
+            if (rec.EventType != MOUSE_EVENT) {
+                continue;
+            }
+            const COORD pos = rec.Event.MouseEvent.dwMousePosition;
+            if (pos.X < 0 || pos.X >= kCols || pos.Y < 0 || pos.Y >= kRows) {
+                fprintf(stderr, "Error: mouse record outside the window: ");
+                dumpInput(data);
+                return false;
+            }
+        }
+    }
+    if (!sameKeys(keyRecords(whole.records), keyRecords(split.records))) {
+        fprintf(stderr, "Error: split input produced different keys: ");
+        dumpInput(data);
+        return false;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+#ifdef CONSOLE_INPUT_FUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    uint32_t seed = static_cast<uint32_t>(size);
+    if (!checkInput(std::string(reinterpret_cast<const char*>(data), size),
+                    seed)) {
+        abort();
+    }
+    return 0;
+}
+
+#else
+
+int main(int argc, char *argv[]) {
+    if (argc >= 3 && !strcmp(argv[1], "-fuzz")) {
+        const int iterations = atoi(argv[2]);
+        uint32_t seed = argc >= 4
+            ? static_cast<uint32_t>(strtoul(argv[3], nullptr, 10))
+            : GetTickCount();
+        printf("seed %u\n", seed);
+        for (int i = 0; i < iterations; ++i) {
+            if (!checkInput(randomInput(seed), seed)) {
+                return 1;
+            }
+        }
+        printf("%d inputs OK\n", iterations);
+        return 0;
+    }
+
+    const char *const kStreams[] = { "paste", "utf8", "mouse", "vim" };
+    bool success = true;
+    if (argc < 2) {
+        for (const char *name : kStreams) {
+            benchmarkStream(name, makeStream(name));
+        }
+    }
+    for (int i = 1; i < argc; ++i) {
+        std::string data = makeStream(argv[i]);
+        if (data.empty() && !readFile(argv[i], data)) {
+            fprintf(stderr, "Error: could not read %s\n", argv[i]);
+            success = false;
+            continue;
+        }
+        benchmarkStream(argv[i], data);
+    }
+    return success ? 0 : 1;
+}
+
+#endif // CONSOLE_INPUT_FUZZER
@@ -25,8 +25,18 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WINPTY_INPUT_MAP_SSE2 1
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
 #include "DebugShowInput.h"
-#include "SimplePool.h"
 #include "../shared/DebugClient.h"
 #include "../shared/UnixCtrlChars.h"
 #include "../shared/WinptyAssert.h"
@@ -110,6 +120,67 @@ static const char *getVirtualKeyString(int virtualKey)
     }
 }
 
+static bool hasKey(const InputMap::Key &key)
+{
+    return key.virtualKey != 0 || key.unicodeChar != 0;
+}
+
+static void appendEncodingByte(std::string &encoding, int ch)
+{
+    if (!encoding.empty()) {
+        encoding.push_back(' ');
+    }
+    char ctrlChar = decodeUnixCtrlChar(ch);
+    if (ctrlChar != '\0') {
+        encoding.push_back('^');
+        encoding.push_back(static_cast<char>(ctrlChar));
+    } else if (ch == ' ') {
+        encoding.append("' '");
+    } else {
+        encoding.push_back(static_cast<char>(ch));
+    }
+}
+
+// Returns the index of `ch` among the `count` sorted bytes starting at
+// chars[first], or -1.  `charsSize` bounds the array, so a 16-byte load
+// is only used when it stays in range.
+static int findTableChild(const unsigned char *chars, int charsSize,
+                          int first, int count, unsigned char ch)
+{
+#ifdef WINPTY_INPUT_MAP_SSE2
+    if (count <= 16 && first + 16 <= charsSize) {
+        const __m128i v = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(&chars[first]));
+        const unsigned int mask = static_cast<unsigned int>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(
+                v, _mm_set1_epi8(static_cast<char>(ch))))) &
+            ((1u << count) - 1);
+        if (mask == 0) {
+            return -1;
+        }
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+#endif
+    if (count <= 8) {
+        for (int i = 0; i < count; ++i) {
+            if (chars[first + i] == ch) {
+                return i;
+            }
+        }
+        return -1;
+    }
+    const unsigned char *const begin = &chars[first];
+    const unsigned char *const end = begin + count;
+    const unsigned char *const it = std::lower_bound(begin, end, ch);
+    return it != end && *it == ch ? static_cast<int>(it - begin) : -1;
+}
+
 } // anonymous namespace
 
 std::string InputMap::Key::toString() const {
@@ -169,18 +240,18 @@ InputMap::Node &InputMap::getOrCreateChild(Node &node, unsigned char ch) {
             node.u.tiny.children[j] = node.u.tiny.children[j - 1];
         }
         node.u.tiny.values[insertIndex] = ch;
-        node.u.tiny.children[insertIndex] = ret = m_nodePool.alloc();
+        node.u.tiny.children[insertIndex] = ret = m_trieArena.create<Node>();
         ++node.childCount;
         return *ret;
     }
     if (node.childCount == Node::kTinyCount) {
-        Branch *branch = m_branchPool.alloc();
+        Branch *branch = m_trieArena.create<Branch>();
         for (int i = 0; i < node.childCount; ++i) {
             branch->children[node.u.tiny.values[i]] = node.u.tiny.children[i];
         }
         node.u.branch = branch;
     }
-    node.u.branch->children[ch] = ret = m_nodePool.alloc();
+    node.u.branch->children[ch] = ret = m_trieArena.create<Node>();
     ++node.childCount;
     return *ret;
 }
@@ -188,6 +259,31 @@ InputMap::Node &InputMap::getOrCreateChild(Node &node, unsigned char ch) {
 // Find the longest matching key and node.
 int InputMap::lookupKey(const char *input, int inputSize,
                         Key &keyOut, bool &incompleteOut) const {
+    if (m_table == nullptr) {
+        return lookupTrieKey(input, inputSize, keyOut, incompleteOut);
+    }
+    const int tableLen =
+        lookupTableKey(input, inputSize, keyOut, incompleteOut);
+    if (m_root.childCount == 0) {
+        return tableLen;
+    }
+    // Search the overrides too.  The longer match wins, and an override
+    // wins a tie.  The input is incomplete if either layer could still
+    // match a longer sequence.
+    Key overrideKey;
+    bool overrideIncomplete = false;
+    const int overrideLen =
+        lookupTrieKey(input, inputSize, overrideKey, overrideIncomplete);
+    incompleteOut = incompleteOut || overrideIncomplete;
+    if (overrideLen > 0 && overrideLen >= tableLen) {
+        keyOut = overrideKey;
+        return overrideLen;
+    }
+    return tableLen;
+}
+
+int InputMap::lookupTrieKey(const char *input, int inputSize,
+                            Key &keyOut, bool &incompleteOut) const {
     keyOut = kKeyZero;
     incompleteOut = false;
 
@@ -211,11 +307,92 @@ int InputMap::lookupKey(const char *input, int inputSize,
     return longestMatchLen;
 }
 
+// The same search as lookupKey, over the table.
+int InputMap::lookupTableKey(const char *input, int inputSize,
+                             Key &keyOut, bool &incompleteOut) const {
+    const TableNode *const nodes = m_table->nodes;
+    const unsigned char *const chars = m_table->chars;
+    incompleteOut = false;
+
+    int node = 0;
+    InputMap::Key longestMatch = kKeyZero;
+    int longestMatchLen = 0;
+
+    for (int i = 0; i < inputSize; ++i) {
+        const int child = findTableChild(chars, m_table->nodeCount,
+                                         nodes[node].firstChild,
+                                         nodes[node].childCount, input[i]);
+        if (child < 0) {
+            keyOut = longestMatch;
+            return longestMatchLen;
+        }
+        node = nodes[node].firstChild + child;
+        if (hasKey(nodes[node].key)) {
+            longestMatchLen = i + 1;
+            longestMatch = nodes[node].key;
+        }
+    }
+    keyOut = longestMatch;
+    incompleteOut = nodes[node].childCount > 0;
+    return longestMatchLen;
+}
+
+// Converts the map to its table form, numbering the nodes breadth-first so
+// that each node's children are contiguous.
+void InputMap::compile(std::vector<TableNode> &nodesOut,
+                       std::vector<unsigned char> &charsOut) const {
+    ASSERT(m_table == nullptr);
+    std::vector<const Node*> queue;
+    queue.push_back(&m_root);
+    nodesOut.clear();
+    charsOut.clear();
+    charsOut.push_back(0);
+    for (size_t i = 0; i < queue.size(); ++i) {
+        const Node &node = *queue[i];
+        TableNode tableNode = {};
+        tableNode.firstChild = static_cast<uint16_t>(queue.size());
+        tableNode.childCount = static_cast<uint16_t>(node.childCount);
+        tableNode.key = node.key;
+        for (int ch = 0; ch < 256; ++ch) {
+            const Node *child = getChild(node, ch);
+            if (child != NULL) {
+                queue.push_back(child);
+                charsOut.push_back(static_cast<unsigned char>(ch));
+            }
+        }
+        ASSERT(queue.size() <= 0xFFFF && "InputMap is too large for a table");
+        nodesOut.push_back(tableNode);
+    }
+}
+
 void InputMap::dumpInputMap() const {
     std::string encoding;
+    if (m_table != nullptr) {
+        dumpTableHelper(0, encoding);
+        if (m_root.childCount == 0) {
+            return;
+        }
+        trace("overrides:");
+    }
     dumpInputMapHelper(m_root, encoding);
 }
 
+void InputMap::dumpTableHelper(int index, std::string &encoding) const {
+    const TableNode &node = m_table->nodes[index];
+    if (hasKey(node.key)) {
+        trace("%s -> %s",
+            encoding.c_str(),
+            node.key.toString().c_str());
+    }
+    for (int i = 0; i < node.childCount; ++i) {
+        const int child = node.firstChild + i;
+        size_t oldSize = encoding.size();
+        appendEncodingByte(encoding, m_table->chars[child]);
+        dumpTableHelper(child, encoding);
+        encoding.resize(oldSize);
+    }
+}
+
 void InputMap::dumpInputMapHelper(
         const Node &node, std::string &encoding) const {
     if (node.hasKey()) {
@@ -227,18 +404,7 @@ void InputMap::dumpInputMapHelper(
         const Node *child = getChild(node, i);
         if (child != NULL) {
             size_t oldSize = encoding.size();
-            if (!encoding.empty()) {
-                encoding.push_back(' ');
-            }
-            char ctrlChar = decodeUnixCtrlChar(i);
-            if (ctrlChar != '\0') {
-                encoding.push_back('^');
-                encoding.push_back(static_cast<char>(ctrlChar));
-            } else if (i == ' ') {
-                encoding.append("' '");
-            } else {
-                encoding.push_back(static_cast<char>(i));
-            }
+            appendEncodingByte(encoding, i);
             dumpInputMapHelper(*child, encoding);
             encoding.resize(oldSize);
         }
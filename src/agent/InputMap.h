@@ -26,8 +26,9 @@
 #include <string.h>
 
 #include <string>
+#include <vector>
 
-#include "SimplePool.h"
+#include "Arena.h"
 #include "../shared/WinptyAssert.h"
 
 class InputMap {
@@ -40,6 +41,23 @@ public:
         std::string toString() const;
     };
 
+    // A read-only form of an InputMap that uses indices instead of pointers,
+    // so it can be compiled into the agent's read-only data (see
+    // DefaultInputMapTable.cc) and shared by every agent process mapping the
+    // image.  Node 0 is the root.  The children of each node are contiguous
+    // and sorted by byte, and chars[i] is the byte that leads to node i.
+    struct TableNode {
+        uint16_t firstChild;
+        uint16_t childCount;
+        Key key;
+    };
+
+    struct Table {
+        const TableNode *nodes;
+        const unsigned char *chars;
+        int nodeCount;
+    };
+
 private:
     struct Node;
 
@@ -74,15 +92,29 @@ private:
     };
 
 private:
-    SimplePool<Node, 256> m_nodePool;
-    SimplePool<Branch, 8> m_branchPool;
+    // Holds the trie's nodes and branches, which are only freed together.
+    Arena m_trieArena { 16 * 1024 };
     Node m_root;
+    const Table *m_table = nullptr;
 
 public:
+    InputMap() {}
+    InputMap(const InputMap &other) = delete;
+    InputMap &operator=(const InputMap &other) = delete;
+    // The map is backed by the table.  Entries added with set() are kept
+    // in a separate trie that overrides the table.
+    explicit InputMap(const Table &table) : m_table(&table) {}
     void set(const char *encoding, int encodingLen, const Key &key);
     int lookupKey(const char *input, int inputSize,
                   Key &keyOut, bool &incompleteOut) const;
     void dumpInputMap() const;
+    void compile(std::vector<TableNode> &nodesOut,
+                 std::vector<unsigned char> &charsOut) const;
+    // The heap bytes held by the trie.  A table passed to the constructor
+    // isn't counted.
+    size_t memoryUsage() const {
+        return m_trieArena.memoryUsage();
+    }
 
 private:
     Node *getChild(Node &node, unsigned char ch) {
@@ -104,7 +136,12 @@ private:
 
     void setHelper(Node &node, const char *encoding, int encodingLen, const Key &key);
     Node &getOrCreateChild(Node &node, unsigned char ch);
+    int lookupTrieKey(const char *input, int inputSize,
+                      Key &keyOut, bool &incompleteOut) const;
+    int lookupTableKey(const char *input, int inputSize,
+                       Key &keyOut, bool &incompleteOut) const;
     void dumpInputMapHelper(const Node &node, std::string &encoding) const;
+    void dumpTableHelper(int index, std::string &encoding) const;
 };
 
 const InputMap::Key kKeyZero = { 0, 0, 0 };
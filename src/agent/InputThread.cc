@@ -0,0 +1,191 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "InputThread.h"
+
+#include "../shared/DebugClient.h"
+#include "../shared/WinptyAssert.h"
+
+#include "ConsoleInput.h"
+#include "NamedPipe.h"
+
+namespace {
+
+uint64_t packRect(const SmallRect &rect)
+{
+    return static_cast<uint64_t>(static_cast<uint16_t>(rect.Left)) |
+           static_cast<uint64_t>(static_cast<uint16_t>(rect.Top)) << 16 |
+           static_cast<uint64_t>(static_cast<uint16_t>(rect.Right)) << 32 |
+           static_cast<uint64_t>(static_cast<uint16_t>(rect.Bottom)) << 48;
+}
+
+SmallRect unpackRect(uint64_t value)
+{
+    SmallRect rect;
+    rect.Left = static_cast<SHORT>(value & 0xFFFF);
+    rect.Top = static_cast<SHORT>((value >> 16) & 0xFFFF);
+    rect.Right = static_cast<SHORT>((value >> 32) & 0xFFFF);
+    rect.Bottom = static_cast<SHORT>((value >> 48) & 0xFFFF);
+    return rect;
+}
+
+} // anonymous namespace
+
+InputThread::InputThread(EventLoop &owner, HANDLE conin, int mouseMode,
+                         int escapeTimeoutMs, Win32Console &console) :
+    m_owner(owner)
+{
+    // Nothing on this thread needs window messages.
+    useCompletionPort();
+    m_consoleInput.reset(
+        new ConsoleInput(conin, mouseMode, escapeTimeoutMs, *this, console));
+    m_appliedInputMode = m_consoleInput->inputMode();
+    m_inputMode = m_appliedInputMode;
+}
+
+InputThread::~InputThread()
+{
+    stop();
+}
+
+void InputThread::start(NamedPipe &pipe)
+{
+    ASSERT(m_thread == nullptr && "InputThread already started");
+    m_pipe = &pipe;
+    m_thread = CreateThread(nullptr, 0, threadProc, this, 0, nullptr);
+    ASSERT(m_thread != nullptr && "Could not create the input thread");
+}
+
+void InputThread::stop()
+{
+    if (m_thread == nullptr) {
+        return;
+    }
+    m_stopRequested = true;
+    wake();
+    WaitForSingleObject(m_thread, INFINITE);
+    CloseHandle(m_thread);
+    m_thread = nullptr;
+}
+
+void InputThread::setMouseWindowRect(const SmallRect &rect)
+{
+    m_mouseWindowRect = packRect(rect);
+}
+
+InputThread::Stats InputThread::stats() const
+{
+    Stats ret;
+    ret.bytesRead = m_bytesRead;
+    ret.queuedBytes = m_queuedBytes;
+    ret.recordsWritten = m_recordsWritten;
+    ret.inputMapMemory = m_inputMapMemory;
+    ret.pipeMemory = m_pipeMemory;
+    return ret;
+}
+
+DWORD WINAPI InputThread::threadProc(LPVOID param)
+{
+    InputThread &self = *static_cast<InputThread*>(param);
+    trace("Input thread started");
+    self.run();
+    trace("Input thread exiting");
+    return 0;
+}
+
+// Called by m_consoleInput, on this thread.  The DSR is written to CONOUT,
+// which belongs to the owner.
+void InputThread::sendDsr()
+{
+    m_dsrRequested = true;
+    m_owner.wake();
+}
+
+// Bring m_consoleInput up to date with the owner's latest poll.
+void InputThread::applyConsoleState()
+{
+    const DWORD mode = m_inputMode;
+    if (mode != m_appliedInputMode) {
+        m_consoleInput->updateInputFlags(mode);
+        m_appliedInputMode = mode;
+    }
+    const uint64_t rect = m_mouseWindowRect;
+    if (rect != m_appliedMouseWindowRect) {
+        m_consoleInput->setMouseWindowRect(unpackRect(rect));
+        m_appliedMouseWindowRect = rect;
+    }
+}
+
+void InputThread::onPipeIo(NamedPipe &namedPipe)
+{
+    if (namedPipe.bytesAvailable() > 0) {
+        applyConsoleState();
+        // See Agent::pollConinPipe.
+        const bool separateBytes = hasDebugFlag("input_separated_bytes");
+        size_t size = 0;
+        while (const char *data = namedPipe.peekFront(size)) {
+            if (separateBytes) {
+                for (size_t i = 0; i < size; ++i) {
+                    m_consoleInput->writeInput(data + i, 1);
+                }
+            } else {
+                m_consoleInput->writeInput(data, size);
+            }
+            namedPipe.skip(size);
+        }
+        scheduleEscapeFlush();
+        m_inputDelivered = true;
+        m_owner.wake();
+    }
+    publishStats();
+}
+
+void InputThread::onTimer()
+{
+    applyConsoleState();
+    m_consoleInput->flushIncompleteEscapeCode();
+    scheduleEscapeFlush();
+    publishStats();
+}
+
+void InputThread::onWake()
+{
+    if (m_stopRequested) {
+        shutdown();
+    }
+}
+
+void InputThread::scheduleEscapeFlush()
+{
+    const int delayMs = m_consoleInput->incompleteEscapeDelay();
+    if (delayMs >= 0) {
+        setTimer(delayMs);
+    }
+}
+
+void InputThread::publishStats()
+{
+    m_bytesRead = m_pipe->bytesRead();
+    m_queuedBytes =
+        m_pipe->bytesAvailable() + m_consoleInput->queuedByteCount();
+    m_recordsWritten = m_consoleInput->inputRecordsWritten();
+    m_inputMapMemory = m_consoleInput->inputMapMemoryUsage();
+    m_pipeMemory = m_pipe->memoryUsage();
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef INPUTTHREAD_H
+#define INPUTTHREAD_H
+
+#include <windows.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+#include "DsrSender.h"
+#include "EventLoop.h"
+#include "SmallRect.h"
+
+class ConsoleInput;
+class NamedPipe;
+class Win32Console;
+
+// With WINPTY_FLAG_INPUT_THREAD, the CONIN pipe and the ConsoleInput that
+// translates its bytes are serviced by this event loop on a thread of its
+// own, so input doesn't wait for a scrape or a console freeze.
+//
+// The owning loop passes the console's input mode and window rect through
+// atomics.  In the other direction, the thread sets a flag and wakes the
+// owner when input was delivered or a DSR should be sent, and publishes its
+// statistics through atomics.
+class InputThread : public EventLoop, public DsrSender
+{
+public:
+    struct Stats {
+        uint64_t bytesRead;
+        uint64_t queuedBytes;
+        int64_t recordsWritten;
+        uint64_t inputMapMemory;
+        uint64_t pipeMemory;
+    };
+
+    InputThread(EventLoop &owner, HANDLE conin, int mouseMode,
+                int escapeTimeoutMs, Win32Console &console);
+    virtual ~InputThread();
+    // Called before start.  The pipe belongs to this loop.
+    NamedPipe &createPipe() { return createNamedPipe(); }
+    void start(NamedPipe &pipe);
+    void stop();
+
+    // These are called on the owner's thread.
+    void setInputMode(DWORD mode) { m_inputMode = mode; }
+    void setMouseWindowRect(const SmallRect &rect);
+    bool takeDsrRequest() { return m_dsrRequested.exchange(false); }
+    bool takeInputDelivered() { return m_inputDelivered.exchange(false); }
+    uint64_t bytesRead() const { return m_bytesRead; }
+    Stats stats() const;
+
+    void sendDsr() override;
+
+protected:
+    virtual void onTimer() override;
+    virtual void onPipeIo(NamedPipe &namedPipe) override;
+    virtual void onWake() override;
+
+private:
+    static DWORD WINAPI threadProc(LPVOID param);
+    void applyConsoleState();
+    void scheduleEscapeFlush();
+    void publishStats();
+
+    EventLoop &m_owner;
+    std::unique_ptr<ConsoleInput> m_consoleInput;
+    NamedPipe *m_pipe = nullptr;
+    HANDLE m_thread = nullptr;
+    std::atomic<bool> m_stopRequested { false };
+    std::atomic<bool> m_dsrRequested { false };
+    std::atomic<bool> m_inputDelivered { false };
+    // The console state, as last set by the owner and as last applied to
+    // m_consoleInput.  The rect is packed into one value so it is never seen
+    // half-updated.
+    std::atomic<DWORD> m_inputMode { 0 };
+    std::atomic<uint64_t> m_mouseWindowRect { 0 };
+    DWORD m_appliedInputMode = 0;
+    uint64_t m_appliedMouseWindowRect = 0;
+    std::atomic<uint64_t> m_bytesRead { 0 };
+    std::atomic<uint64_t> m_queuedBytes { 0 };
+    std::atomic<int64_t> m_recordsWritten { 0 };
+    std::atomic<uint64_t> m_inputMapMemory { 0 };
+    std::atomic<uint64_t> m_pipeMemory { 0 };
+};
+
+#endif // INPUTTHREAD_H
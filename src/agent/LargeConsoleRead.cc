@@ -21,51 +21,440 @@
 #include "LargeConsoleRead.h"
 
 #include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
 
 #include "../shared/WindowsVersion.h"
+#include "CharInfoScan.h"
+#include "ConsoleBuffer.h"
+#include "EtwTrace.h"
+#include "FullWidthTable.h"
+#include "Profiler.h"
 #include "Scraper.h"
-#include "Win32ConsoleBuffer.h"
+
+namespace {
+
+// Text-only reads keep only these attribute bits (the full-width flags,
+// COMMON_LVB_LEADING_BYTE and COMMON_LVB_TRAILING_BYTE), on top of the
+// default attributes.
+const WORD kTextOnlyKeptBits = 0x300;
+
+// An all-space line that isn't blank, because its own attributes differ
+// from those of the previous line's last cell, gets this attribute in its
+// first cell instead, so that it isn't blank after normalizing either.
+const WORD kTextOnlyNotBlankAttributes = 0;
+
+// Before Windows 8, a ReadConsoleOutputW call must fit in the console's RPC
+// buffer, which holds about 32KB, though how much of it is free varies.  A
+// legacy read starts with this many cells per call, and whenever a call is
+// rejected, the limit is halved for the rest of the session and the call is
+// retried, down to kLegacyMinReadCells.  A line wider than the limit is read
+// in several column tiles.
+const int kLegacyReadBytes = 30 * 1024;
+const int kLegacyMinReadCells = 1024;
+int g_legacyReadCells = static_cast<int>(kLegacyReadBytes / sizeof(CHAR_INFO));
+
+// Later consoles accept a read of any size, but conhost copies the whole
+// read into a temporary buffer of its own, so a large window is read in
+// bands of at most this many cells (4MiB of CHAR_INFO).  The text-only read
+// path, which needs a text buffer the size of the area, is skipped for areas
+// larger than one band.
+const int kMaxReadTileCells = 1024 * 1024;
+
+} // anonymous namespace
 
 LargeConsoleReadBuffer::LargeConsoleReadBuffer() :
     m_rect(0, 0, 0, 0), m_rectWidth(0)
 {
 }
 
-void largeConsoleRead(LargeConsoleReadBuffer &out,
-                      Win32ConsoleBuffer &buffer,
+// Frees the buffer's storage, leaving it empty until the next read.
+void LargeConsoleReadBuffer::release()
+{
+    m_rect = SmallRect(0, 0, 0, 0);
+    m_rectWidth = 0;
+    std::vector<CHAR_INFO>().swap(m_data);
+    std::vector<uint64_t>().swap(m_lineHashes);
+    std::vector<char>().swap(m_lineBlank);
+    std::vector<wchar_t>().swap(m_text);
+    std::vector<WORD>().swap(m_attributes);
+    std::vector<CHAR_INFO>().swap(m_narrowData);
+}
+
+void LargeConsoleReadBuffer::swap(LargeConsoleReadBuffer &other)
+{
+    std::swap(m_rect, other.m_rect);
+    std::swap(m_rectWidth, other.m_rectWidth);
+    m_data.swap(other.m_data);
+    m_lineHashes.swap(other.m_lineHashes);
+    m_lineBlank.swap(other.m_lineBlank);
+    m_text.swap(other.m_text);
+    m_attributes.swap(other.m_attributes);
+    m_narrowData.swap(other.m_narrowData);
+    std::swap(m_narrowEdgeNotBlank, other.m_narrowEdgeNotBlank);
+}
+
+void LargeConsoleReadBuffer::updateLine(int line, int column,
+                                        const CHAR_INFO *cells, int count)
+{
+    ASSERT(column >= 0 && count >= 0 && column + count <= m_rectWidth);
+    CHAR_INFO *const data = lineDataMut(line);
+    std::copy(cells, cells + count, data + column);
+    m_lineHashes[line - m_rect.Top] = charInfoLineHash(data, m_rectWidth);
+}
+
+void LargeConsoleReadBuffer::moveLines(int dstLine, int srcLine, int count)
+{
+    if (count <= 0 || dstLine == srcLine) {
+        return;
+    }
+    validateLineNumber(dstLine);
+    validateLineNumber(dstLine + count - 1);
+    validateLineNumber(srcLine);
+    validateLineNumber(srcLine + count - 1);
+    // memmove handles the overlap in either direction.
+    memmove(lineDataMut(dstLine), lineDataMut(srcLine),
+            sizeof(CHAR_INFO) * m_rectWidth * count);
+    memmove(&m_lineHashes[dstLine - m_rect.Top],
+            &m_lineHashes[srcLine - m_rect.Top],
+            sizeof(uint64_t) * count);
+}
+
+// Masks the attributes of lines [top, bottom], then summarizes each one, in a
+// single pass per line while the line is still in the cache.
+void LargeConsoleReadBuffer::finishLines(int top, int bottom,
+                                         WORD attributesMask)
+{
+    if (attributesMask == static_cast<WORD>(~0)) {
+        finishLinesImpl<false>(top, bottom, attributesMask);
+    } else {
+        finishLinesImpl<true>(top, bottom, attributesMask);
+    }
+}
+
+template <bool Masked>
+void LargeConsoleReadBuffer::finishLinesImpl(int top, int bottom,
+                                             WORD attributesMask)
+{
+    const int width = m_rectWidth;
+    for (int line = top; line <= bottom; ++line) {
+        CHAR_INFO *const data = lineDataMut(line);
+        // Usually, no cell has the masked-out bits (e.g. the LVB bits), and
+        // the read-only probe avoids writing the line back.
+        if (Masked && charInfoAnyAttributes(data, width,
+                                           static_cast<WORD>(~attributesMask))) {
+            charInfoMaskAttributes(data, width, attributesMask);
+        }
+        const int index = line - m_rect.Top;
+        m_lineHashes[index] = charInfoLineHash(data, width);
+        m_lineBlank[index] = line > m_rect.Top &&
+            charInfoLineBlank(data, width, data[-1].Attributes);
+    }
+}
+
+// Reads the area's characters with one call, then probes the attributes of
+// just the all-space lines, since those are the only ones whose blankness
+// depends on the attributes.  Each run of such lines is probed with one call,
+// starting at the last cell of the line above it.  It fails (and the caller
+// reads the cells) if a character might be full-width, because the
+// characters alone can't say which cells it covers.
+bool LargeConsoleReadBuffer::readTextOnly(ConsoleBuffer &buffer,
+                                          WORD attributesMask)
+{
+    const int width = m_rectWidth;
+    const size_t count = width * m_rect.height();
+    if (m_text.size() < count) {
+        m_text.resize(count);
+    }
+    if (!buffer.readText(m_rect, m_text.data())) {
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (mayBeFullWidth(m_text[i])) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        m_data[i].Char.UnicodeChar = m_text[i];
+        m_data[i].Attributes = ConsoleBuffer::kDefaultAttributes;
+    }
+    int line = m_rect.Top + 1;
+    while (line <= m_rect.Bottom) {
+        if (!charInfoLineBlank(lineData(line), width,
+                               ConsoleBuffer::kDefaultAttributes)) {
+            ++line;
+            continue;
+        }
+        int runEnd = line;
+        while (runEnd < m_rect.Bottom &&
+                charInfoLineBlank(lineData(runEnd + 1), width,
+                                  ConsoleBuffer::kDefaultAttributes)) {
+            ++runEnd;
+        }
+        const int probeCount = 1 + (runEnd + 1 - line) * width;
+        if (m_attributes.size() < static_cast<size_t>(probeCount)) {
+            m_attributes.resize(probeCount);
+        }
+        if (!buffer.readAttributes(Coord(m_rect.Left + width - 1, line - 1),
+                                   probeCount, m_attributes.data())) {
+            return false;
+        }
+        for (int i = 0; i < probeCount; ++i) {
+            m_attributes[i] &= attributesMask;
+        }
+        for (int row = line; row <= runEnd; ++row) {
+            const WORD *const previous =
+                &m_attributes[(row - line) * width];
+            for (int i = 1; i <= width; ++i) {
+                if (previous[i] != previous[0]) {
+                    lineDataMut(row)[0].Attributes =
+                        kTextOnlyNotBlankAttributes;
+                    break;
+                }
+            }
+        }
+        line = runEnd + 1;
+    }
+    return true;
+}
+
+// Gives the cells of a normal read the attributes a text-only read would
+// have given them.  It works upward, so each line's blankness is decided from
+// the original attributes.
+void LargeConsoleReadBuffer::normalizeTextOnly(WORD attributesMask)
+{
+    const int width = m_rectWidth;
+    for (int line = m_rect.Bottom; line >= m_rect.Top; --line) {
+        CHAR_INFO *const data = lineDataMut(line);
+        if (charInfoAnyAttributes(data, width,
+                                  static_cast<WORD>(~attributesMask))) {
+            charInfoMaskAttributes(data, width, attributesMask);
+        }
+        if (line > m_rect.Top) {
+            data[-1].Attributes &= attributesMask;
+        }
+        const bool blank = line > m_rect.Top &&
+            charInfoLineBlank(data, width, data[-1].Attributes);
+        for (int i = 0; i < width; ++i) {
+            data[i].Attributes = ConsoleBuffer::kDefaultAttributes |
+                (data[i].Attributes & kTextOnlyKeptBits);
+        }
+        if (line > m_rect.Top && !blank &&
+                charInfoLineBlank(data, width,
+                                  ConsoleBuffer::kDefaultAttributes)) {
+            data[0].Attributes = kTextOnlyNotBlankAttributes;
+        }
+    }
+}
+
+namespace {
+
+// Called after a legacy read of `area` failed.  Halves the per-call cell
+// limit and returns true, so the caller retries the read, unless the limit
+// is already as small as it goes.
+bool shrinkLegacyReadLimit(const SmallRect &area)
+{
+    const int cells = area.width() * area.height();
+    if (cells <= kLegacyMinReadCells) {
+        return false;
+    }
+    g_legacyReadCells = std::max(kLegacyMinReadCells, cells / 2);
+    trace("largeConsoleRead: a %d-cell read failed; reading at most %d "
+          "cells per call", cells, g_legacyReadCells);
+    return true;
+}
+
+// Reads one line of readArea that is wider than a legacy read allows, in
+// column tiles of at most g_legacyReadCells cells.
+template <typename FitsInBuffer>
+bool readLegacyWideLine(CHAR_INFO *data,
+                        ConsoleBuffer &buffer,
+                        const SmallRect &readArea,
+                        int line,
+                        const FitsInBuffer &fitsInBuffer)
+{
+    int column = 0;
+    while (column < readArea.width()) {
+        const SmallRect tile(
+            readArea.Left + column,
+            line,
+            std::min(g_legacyReadCells, readArea.width() - column),
+            1);
+        if (!fitsInBuffer(tile)) {
+            return false;
+        }
+        if (!buffer.read(tile, data + column) &&
+                shrinkLegacyReadLimit(tile)) {
+            continue;
+        }
+        column += tile.width();
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+// Reads the first `columns` columns of m_rect, in bands, and widens each
+// line to the full rect by repeating its last cell read.
+bool LargeConsoleReadBuffer::readNarrowed(ConsoleBuffer &buffer, int columns,
+                                          WORD attributesMask,
+                                          bool checkBounds)
+{
+    static const bool useLargeReads = isAtLeastWindows8();
+    m_narrowEdgeNotBlank = false;
+    int line = m_rect.Top;
+    while (line <= m_rect.Bottom) {
+        const int maxCells =
+            useLargeReads ? kMaxReadTileCells : g_legacyReadCells;
+        const int bandLines = std::max(1, maxCells / columns);
+        const SmallRect band(
+            m_rect.Left,
+            line,
+            columns,
+            std::min(bandLines, m_rect.Bottom + 1 - line));
+        if (checkBounds) {
+            const Coord size = buffer.bufferInfo().bufferSize();
+            if (band.Right >= size.X || band.Bottom >= size.Y) {
+                return false;
+            }
+        }
+        const size_t count = columns * band.height();
+        if (m_narrowData.size() < count) {
+            m_narrowData.resize(count);
+        }
+        if (!buffer.read(band, m_narrowData.data()) && !useLargeReads &&
+                shrinkLegacyReadLimit(band)) {
+            continue;
+        }
+        for (int i = 0; i < band.height(); ++i) {
+            const CHAR_INFO *const src = &m_narrowData[i * columns];
+            CHAR_INFO *const dst = lineDataMut(band.Top + i);
+            std::copy(src, src + columns, dst);
+            std::fill(dst + columns, dst + m_rectWidth, src[columns - 1]);
+            if (src[columns - 1].Char.UnicodeChar != L' ') {
+                m_narrowEdgeNotBlank = true;
+            }
+        }
+        finishLines(band.Top, band.Bottom, attributesMask);
+        line = band.Bottom + 1;
+    }
+    return true;
+}
+
+bool largeConsoleRead(LargeConsoleReadBuffer &out,
+                      ConsoleBuffer &buffer,
                       const SmallRect &readArea,
-                      WORD attributesMask) {
+                      WORD attributesMask,
+                      bool checkBounds,
+                      bool textOnly,
+                      int readColumns) {
     ASSERT(readArea.Left >= 0 &&
            readArea.Top >= 0 &&
            readArea.Right >= readArea.Left &&
            readArea.Bottom >= readArea.Top &&
            readArea.width() <= MAX_CONSOLE_WIDTH);
+    EtwScope etwScope(kEtwLargeConsoleRead, readArea.height());
+    PROFILE_ZONE("scrape.read");
     const size_t count = readArea.width() * readArea.height();
     if (out.m_data.size() < count) {
         out.m_data.resize(count);
     }
     out.m_rect = readArea;
     out.m_rectWidth = readArea.width();
+    out.m_narrowEdgeNotBlank = false;
+    if (out.m_lineHashes.size() < static_cast<size_t>(readArea.height())) {
+        out.m_lineHashes.resize(readArea.height());
+        out.m_lineBlank.resize(readArea.height());
+    }
+
+    const auto fitsInBuffer = [&](const SmallRect &area) -> bool {
+        if (!checkBounds) {
+            return true;
+        }
+        const Coord size = buffer.bufferInfo().bufferSize();
+        return area.Right < size.X && area.Bottom < size.Y;
+    };
 
     static const bool useLargeReads = isAtLeastWindows8();
+    if (readColumns > 0 && readColumns < readArea.width() &&
+            (useLargeReads || readColumns <= g_legacyReadCells)) {
+        ASSERT(!textOnly);
+        return out.readNarrowed(buffer, readColumns, attributesMask,
+                                checkBounds);
+    }
+
+    // After a text-only read or normalizing, there's nothing left to mask.
+    const WORD finishMask = textOnly ? static_cast<WORD>(~0) : attributesMask;
     if (useLargeReads) {
-        buffer.read(readArea, out.m_data.data());
+        if (!fitsInBuffer(readArea)) {
+            return false;
+        }
+        // The probes could run past a buffer that shrank, so a bounds-checked
+        // read takes the cells in one call.
+        if (textOnly && !checkBounds &&
+                count <= static_cast<size_t>(kMaxReadTileCells) &&
+                out.readTextOnly(buffer, attributesMask)) {
+            out.finishLines(readArea.Top, readArea.Bottom, finishMask);
+            return true;
+        }
+        const int bandLines =
+            std::max(1, kMaxReadTileCells / readArea.width());
+        for (int curLine = readArea.Top; curLine <= readArea.Bottom;
+                curLine += bandLines) {
+            const SmallRect band(
+                readArea.Left,
+                curLine,
+                readArea.width(),
+                std::min(bandLines, readArea.Bottom + 1 - curLine));
+            buffer.read(band, out.lineDataMut(curLine));
+            if (!textOnly) {
+                out.finishLines(band.Top, band.Bottom, attributesMask);
+            }
+        }
+        if (textOnly) {
+            out.normalizeTextOnly(attributesMask);
+            out.finishLines(readArea.Top, readArea.Bottom, finishMask);
+        }
     } else {
-        const int maxReadLines = std::max(1, MAX_CONSOLE_WIDTH / readArea.width());
         int curLine = readArea.Top;
         while (curLine <= readArea.Bottom) {
+            if (readArea.width() > g_legacyReadCells) {
+                if (!readLegacyWideLine(out.lineDataMut(curLine), buffer,
+                                        readArea, curLine, fitsInBuffer)) {
+                    return false;
+                }
+                if (!textOnly) {
+                    out.finishLines(curLine, curLine, attributesMask);
+                }
+                ++curLine;
+                continue;
+            }
+            const int maxReadLines =
+                std::max(1, g_legacyReadCells / readArea.width());
             const SmallRect subReadArea(
                 readArea.Left,
                 curLine,
                 readArea.width(),
                 std::min(maxReadLines, readArea.Bottom + 1 - curLine));
-            buffer.read(subReadArea, out.lineDataMut(curLine));
+            if (!fitsInBuffer(subReadArea)) {
+                return false;
+            }
+            if (!buffer.read(subReadArea, out.lineDataMut(curLine)) &&
+                    shrinkLegacyReadLimit(subReadArea)) {
+                continue;
+            }
+            if (!textOnly) {
+                out.finishLines(subReadArea.Top, subReadArea.Bottom,
+                                attributesMask);
+            }
             curLine = subReadArea.Bottom + 1;
         }
-    }
-    if (attributesMask != static_cast<WORD>(~0)) {
-        for (size_t i = 0; i < count; ++i) {
-            out.m_data[i].Attributes &= attributesMask;
+        if (textOnly) {
+            out.normalizeTextOnly(attributesMask);
+            out.finishLines(readArea.Top, readArea.Bottom, finishMask);
         }
     }
+    return true;
 }
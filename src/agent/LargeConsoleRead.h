@@ -22,6 +22,7 @@
 #define LARGE_CONSOLE_READ_H
 
 #include <windows.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include <vector>
@@ -30,18 +31,68 @@
 #include "../shared/DebugClient.h"
 #include "../shared/WinptyAssert.h"
 
-class Win32ConsoleBuffer;
+class ConsoleBuffer;
 
 class LargeConsoleReadBuffer {
 public:
     LargeConsoleReadBuffer();
+    void release();
+    void swap(LargeConsoleReadBuffer &other);
+    size_t memoryUsage() const {
+        return m_data.capacity() * sizeof(CHAR_INFO) +
+            m_lineHashes.capacity() * sizeof(uint64_t) +
+            m_lineBlank.capacity() +
+            m_text.capacity() * sizeof(wchar_t) +
+            m_attributes.capacity() * sizeof(WORD) +
+            m_narrowData.capacity() * sizeof(CHAR_INFO);
+    }
     const SmallRect &rect() const { return m_rect; }
     const CHAR_INFO *lineData(int line) const {
         validateLineNumber(line);
         return &m_data[(line - m_rect.Top) * m_rectWidth];
     }
 
+    // Each line is summarized as it's read, so the scraper doesn't have to
+    // sweep the buffer again.
+
+    // The hash of the whole line (see charInfoLineHash).
+    uint64_t lineHash(int line) const {
+        validateLineNumber(line);
+        return m_lineHashes[line - m_rect.Top];
+    }
+
+    // Whether every cell is a space with the attributes of the previous
+    // line's last cell.  Always false for the first line.
+    bool lineBlank(int line) const {
+        validateLineNumber(line);
+        return m_lineBlank[line - m_rect.Top] != 0;
+    }
+
+    // After a read limited to its first columns (see largeConsoleRead),
+    // whether any line's last cell read wasn't a space, i.e. whether the
+    // line's text may continue past the columns read.
+    bool narrowEdgeNotBlank() const { return m_narrowEdgeNotBlank; }
+
+    // A buffer can also keep the frame a scraper last sent, and be patched
+    // to match the terminal's changes.  These update the line hashes, but
+    // not lineBlank.
+
+    // Overwrites `count` cells of a line, starting at `column` (relative to
+    // the rect's left edge).
+    void updateLine(int line, int column, const CHAR_INFO *cells, int count);
+    // Copies `count` whole lines from `srcLine` to `dstLine`.  The ranges
+    // may overlap.
+    void moveLines(int dstLine, int srcLine, int count);
+
 private:
+    void finishLines(int top, int bottom, WORD attributesMask);
+    template <bool Masked>
+    void finishLinesImpl(int top, int bottom, WORD attributesMask);
+    bool readTextOnly(ConsoleBuffer &buffer, WORD attributesMask);
+    bool readNarrowed(ConsoleBuffer &buffer, int columns,
+                      WORD attributesMask, bool checkBounds);
+    void normalizeTextOnly(WORD attributesMask);
+
     CHAR_INFO *lineDataMut(int line) {
         validateLineNumber(line);
         return &m_data[(line - m_rect.Top) * m_rectWidth];
@@ -58,11 +109,47 @@ private:
     SmallRect m_rect;
     int m_rectWidth;
     std::vector<CHAR_INFO> m_data;
+    std::vector<uint64_t> m_lineHashes;
+    std::vector<char> m_lineBlank;
+    // Scratch space for a text-only read.
+    std::vector<wchar_t> m_text;
+    std::vector<WORD> m_attributes;
+    // Scratch space for a narrowed read.
+    std::vector<CHAR_INFO> m_narrowData;
+    bool m_narrowEdgeNotBlank = false;
 
-    friend void largeConsoleRead(LargeConsoleReadBuffer &out,
-                                 Win32ConsoleBuffer &buffer,
+    friend bool largeConsoleRead(LargeConsoleReadBuffer &out,
+                                 ConsoleBuffer &buffer,
                                  const SmallRect &readArea,
-                                 WORD attributesMask);
+                                 WORD attributesMask,
+                                 bool checkBounds,
+                                 bool textOnly,
+                                 int readColumns);
 };
 
+// Reads an area of the screen buffer, splitting it into several
+// ReadConsoleOutputW calls if needed.  With checkBounds, the buffer size is
+// rechecked before each call, and if the area no longer fits, the read stops
+// and returns false.  Otherwise, it returns true.
+//
+// With textOnly, the caller has no use for colors, and the area must span
+// whole rows of the buffer.  Every attribute is then replaced with the
+// default one, keeping only the full-width bits.  lineBlank still matches a
+// normal read, and the line hashes don't depend on how the cells were read.
+// This lets the characters be read alone, at half the cost (see
+// readTextOnly).
+//
+// With a readColumns less than the area's width, only the area's first
+// readColumns columns are read, and the rest of each line is filled with
+// copies of the line's last cell read, as if the line ended in a uniform run
+// of cells.  narrowEdgeNotBlank then says whether that might be wrong.  It
+// can't be combined with textOnly.
+bool largeConsoleRead(LargeConsoleReadBuffer &out,
+                      ConsoleBuffer &buffer,
+                      const SmallRect &readArea,
+                      WORD attributesMask,
+                      bool checkBounds=false,
+                      bool textOnly=false,
+                      int readColumns=0);
+
 #endif // LARGE_CONSOLE_READ_H
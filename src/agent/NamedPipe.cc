@@ -22,9 +22,14 @@
 
 #include <algorithm>
 
+#include "EtwTrace.h"
 #include "EventLoop.h"
 #include "NamedPipe.h"
+#include "OutputJournal.h"
+#include "SessionRecorder.h"
 #include "../shared/DebugClient.h"
+#include "../shared/OutputCompression.h"
+#include "../shared/SharedRing.h"
 #include "../shared/StringUtil.h"
 #include "../shared/WindowsSecurity.h"
 #include "../shared/WinptyAssert.h"
@@ -36,6 +41,10 @@ bool NamedPipe::serviceIo(std::vector<HANDLE> *waitHandles)
     const auto kError = ServiceResult::Error;
     const auto kProgress = ServiceResult::Progress;
     const auto kNoProgress = ServiceResult::NoProgress;
+    m_ioCompleted = false;
+    if (m_sharedRing != nullptr) {
+        return serviceSharedRing(waitHandles);
+    }
     if (m_handle == NULL) {
         return false;
     }
@@ -63,8 +72,15 @@ bool NamedPipe::serviceIo(std::vector<HANDLE> *waitHandles)
             justConnected = true;
         }
     }
+    if (m_outputChannel != nullptr) {
+        if (m_outputChannel->failed()) {
+            closePipe();
+            return true;
+        }
+        handOffOutput();
+    }
     const auto readProgress = m_inputWorker ? m_inputWorker->service() : kNoProgress;
-    const auto writeProgress = m_outputWorker ? m_outputWorker->service() : kNoProgress;
+    const auto writeProgress = serviceOutputWorkers();
     if (readProgress == kError || writeProgress == kError) {
         closePipe();
         return true;
@@ -72,14 +88,130 @@ bool NamedPipe::serviceIo(std::vector<HANDLE> *waitHandles)
     if (m_inputWorker && m_inputWorker->getWaitEvent() != nullptr) {
         waitHandles->push_back(m_inputWorker->getWaitEvent());
     }
-    if (m_outputWorker && m_outputWorker->getWaitEvent() != nullptr) {
-        waitHandles->push_back(m_outputWorker->getWaitEvent());
+    for (const auto &worker : m_outputWorkers) {
+        if (worker->getWaitEvent() != nullptr) {
+            waitHandles->push_back(worker->getWaitEvent());
+        }
     }
     return justConnected
         || readProgress == kProgress
         || writeProgress == kProgress;
 }
 
+// Used with a completion port.  Returns true if an I/O operation on the pipe
+// has completed, or if a worker is idle but has I/O it could start (e.g.
+// because output was written or input was read from the queue).
+bool NamedPipe::needsService()
+{
+    if (m_sharedRing != nullptr) {
+        return m_ringDataOffset < m_ringData.size() ||
+            (!m_outQueue.empty() && !m_outQueue.isTailReserved());
+    }
+    if (m_handle == nullptr) {
+        return false;
+    }
+    if (m_ioCompleted) {
+        return true;
+    }
+    if (m_inputWorker && !m_inputWorker->isPending() &&
+            m_inQueue.size() < m_readBufferSize) {
+        return true;
+    }
+    if (m_outputChannel != nullptr &&
+            (m_outputChannel->failed() ||
+             (hasWritableOutput() && m_outputChannel->hasSpace()))) {
+        return true;
+    }
+    if (!m_outputWorkers.empty() && hasWritableOutput()) {
+        for (const auto &worker : m_outputWorkers) {
+            if (!worker->isPending()) {
+                return true;
+            }
+        }
+        if (m_outputWorkers.size() < kMaxPendingWrites) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// A byte-mode pipe completes writes in the order they were issued, so the
+// workers may have several writes pending at once without reordering the
+// output.  A new worker is only started once the existing ones are all busy,
+// so an idle pipe keeps a single worker (and event).
+NamedPipe::ServiceResult NamedPipe::serviceOutputWorkers()
+{
+    auto ret = ServiceResult::NoProgress;
+    if (m_outputWorkers.empty()) {
+        return ret;
+    }
+    size_t i = 0;
+    while (true) {
+        const auto progress = m_outputWorkers[i]->service();
+        if (progress == ServiceResult::Error) {
+            return progress;
+        } else if (progress == ServiceResult::Progress) {
+            ret = progress;
+        }
+        ++i;
+        if (i == m_outputWorkers.size()) {
+            if (!hasWritableOutput() ||
+                    m_outputWorkers.size() >= kMaxPendingWrites) {
+                break;
+            }
+            m_outputWorkers.emplace_back(new OutputWorker(*this));
+        }
+    }
+    return ret;
+}
+
+// Copies queued output into the shared ring until the queue is empty or the
+// ring is full.  A full ring arms its space event and adds it to the wait
+// list.  (With a completion port, the event isn't waited on, and the copy
+// resumes on the next pass through the event loop instead.)
+bool NamedPipe::serviceSharedRing(std::vector<HANDLE> *waitHandles)
+{
+    bool progress = false;
+    while (true) {
+        if (m_ringDataOffset == m_ringData.size()) {
+            if (m_outQueue.empty() || m_outQueue.isTailReserved()) {
+                break;
+            }
+            m_outQueue.popFront(m_ringData);
+            m_ringDataOffset = 0;
+        }
+        const size_t amount = m_sharedRing->write(
+            m_ringData.data() + m_ringDataOffset,
+            m_ringData.size() - m_ringDataOffset);
+        if (amount == 0) {
+            if (m_sharedRing->checkSpaceOrArm()) {
+                continue;
+            }
+            waitHandles->push_back(m_sharedRing->spaceEvent());
+            break;
+        }
+        TRACE_CAT(kTracePipe, "pipe [%s]: wrote %u bytes to shared ring",
+            utf8FromWide(m_name).c_str(),
+            static_cast<unsigned int>(amount));
+        m_ringDataOffset += amount;
+        m_bytesWritten += amount;
+        etwInfo(kEtwPipeWrite, static_cast<uint32_t>(amount));
+        progress = true;
+    }
+    return progress;
+}
+
+void NamedPipe::associateCompletionPort()
+{
+    if (m_completionPort != nullptr) {
+        HANDLE ret = CreateIoCompletionPort(
+            m_handle, m_completionPort,
+            reinterpret_cast<ULONG_PTR>(this), 0);
+        ASSERT(ret == m_completionPort &&
+            "Could not associate pipe with completion port");
+    }
+}
+
 // manual reset, initially unset
 static OwnedHandle createEvent() {
     HANDLE ret = CreateEventW(nullptr, TRUE, FALSE, nullptr);
@@ -116,14 +248,15 @@ NamedPipe::ServiceResult NamedPipe::IoWorker::service()
     }
     DWORD nextSize = 0;
     bool isRead = false;
-    while (shouldIssueIo(&nextSize, &isRead)) {
+    char *buffer = nullptr;
+    while (shouldIssueIo(&buffer, &nextSize, &isRead)) {
         m_currentIoSize = nextSize;
         DWORD actual = 0;
         memset(&m_over, 0, sizeof(m_over));
         m_over.hEvent = m_event.get();
         BOOL ret = isRead
-                ? ReadFile(m_namedPipe.m_handle, m_buffer, nextSize, &actual, &m_over)
-                : WriteFile(m_namedPipe.m_handle, m_buffer, nextSize, &actual, &m_over);
+                ? ReadFile(m_namedPipe.m_handle, buffer, nextSize, &actual, &m_over)
+                : WriteFile(m_namedPipe.m_handle, buffer, nextSize, &actual, &m_over);
         if (!ret) {
             if (GetLastError() == ERROR_IO_PENDING) {
                 // There is a pending I/O.
@@ -161,17 +294,28 @@ HANDLE NamedPipe::IoWorker::getWaitEvent()
 
 void NamedPipe::InputWorker::completeIo(DWORD size)
 {
-    m_namedPipe.m_inQueue.append(m_buffer, size);
+    TRACE_CAT(kTracePipe, "pipe [%s]: read %u bytes",
+        utf8FromWide(m_namedPipe.name()).c_str(),
+        static_cast<unsigned int>(size));
+    m_namedPipe.m_bytesRead += size;
+    etwInfo(kEtwPipeRead, size);
+    m_namedPipe.m_inQueue.append(m_buffer.data(), size);
 }
 
-bool NamedPipe::InputWorker::shouldIssueIo(DWORD *size, bool *isRead)
+bool NamedPipe::InputWorker::shouldIssueIo(char **buffer, DWORD *size,
+                                           bool *isRead)
 {
     *isRead = true;
     ASSERT(!m_namedPipe.isConnecting());
     if (m_namedPipe.isClosed()) {
         return false;
     } else if (m_namedPipe.m_inQueue.size() < m_namedPipe.readBufferSize()) {
-        *size = kIoSize;
+        // No read is pending, so the buffer can be resized.
+        if (m_buffer.size() != m_namedPipe.m_ioSize) {
+            m_buffer.resize(m_namedPipe.m_ioSize);
+        }
+        *buffer = m_buffer.data();
+        *size = static_cast<DWORD>(m_buffer.size());
         return true;
     } else {
         return false;
@@ -180,24 +324,47 @@ bool NamedPipe::InputWorker::shouldIssueIo(DWORD *size, bool *isRead)
 
 void NamedPipe::OutputWorker::completeIo(DWORD size)
 {
+    TRACE_CAT(kTracePipe, "pipe [%s]: wrote %u bytes",
+        utf8FromWide(m_namedPipe.name()).c_str(),
+        static_cast<unsigned int>(size));
     ASSERT(size == m_currentIoSize);
+    m_namedPipe.m_bytesWritten += size;
+    etwInfo(kEtwPipeWrite, size);
 }
 
-bool NamedPipe::OutputWorker::shouldIssueIo(DWORD *size, bool *isRead)
+bool NamedPipe::OutputWorker::shouldIssueIo(char **buffer, DWORD *size,
+                                            bool *isRead)
 {
     *isRead = false;
-    if (!m_namedPipe.m_outQueue.empty()) {
-        auto &out = m_namedPipe.m_outQueue;
-        const DWORD writeSize = std::min<size_t>(out.size(), kIoSize);
-        std::copy(&out[0], &out[writeSize], m_buffer);
-        out.erase(0, writeSize);
-        *size = writeSize;
+    auto &out = m_namedPipe.m_outQueue;
+    if (!out.empty() && !out.isTailReserved()) {
+        // Write one chunk at a time.  Popping the chunk hands the previous
+        // write's storage back to the queue, so in the steady state neither
+        // side reallocates.
+        out.popFront(m_writeData);
+        ASSERT(m_writeData.size() <= MAXDWORD && "Output chunk is too large");
+        *buffer = &m_writeData[0];
+        *size = static_cast<DWORD>(m_writeData.size());
         return true;
     } else {
         return false;
     }
 }
 
+void NamedPipe::InputWorker::releaseBuffer()
+{
+    if (!m_pending) {
+        std::vector<char>().swap(m_buffer);
+    }
+}
+
+void NamedPipe::OutputWorker::releaseBuffer()
+{
+    if (!m_pending) {
+        std::string().swap(m_writeData);
+    }
+}
+
 DWORD NamedPipe::OutputWorker::getPendingIoSize()
 {
     return m_pending ? m_currentIoSize : 0;
@@ -212,7 +379,7 @@ void NamedPipe::openServerPipe(LPCWSTR pipeName, OpenMode::t openMode,
             | ((openMode & OpenMode::Writing) ? PIPE_ACCESS_OUTBOUND : 0)
             | FILE_FLAG_FIRST_PIPE_INSTANCE
             | FILE_FLAG_OVERLAPPED;
-    const auto sd = createPipeSecurityDescriptorOwnerFullControl();
+    const auto sd = sharedPipeSecurityDescriptorOwnerFullControl();
     ASSERT(sd && "error creating data pipe SECURITY_DESCRIPTOR");
     SECURITY_ATTRIBUTES sa = {};
     sa.nLength = sizeof(sa);
@@ -232,6 +399,7 @@ void NamedPipe::openServerPipe(LPCWSTR pipeName, OpenMode::t openMode,
     m_name = pipeName;
     m_handle = handle;
     m_openMode = openMode;
+    associateCompletionPort();
 
     // Start an asynchronous connection attempt.
     m_connectEvent = createEvent();
@@ -269,25 +437,127 @@ void NamedPipe::connectToServer(LPCWSTR pipeName, OpenMode::t openMode)
     m_name = pipeName;
     m_handle = handle;
     m_openMode = openMode;
+    associateCompletionPort();
     startPipeWorkers();
 }
 
+// Sends output through a shared-memory ring rather than a pipe handle.  The
+// "pipe" is connected immediately, and closing it closes the ring.
+void NamedPipe::openSharedRing(std::unique_ptr<SharedRing> ring)
+{
+    ASSERT(isClosed());
+    ASSERT(ring != nullptr);
+    m_name = L"conout-shared-ring";
+    m_openMode = OpenMode::Writing;
+    m_sharedRing = std::move(ring);
+}
+
+// Sets the largest single read or write on the pipe.  It may be called at any
+// time; a read already pending keeps its original size.
+void NamedPipe::setIoSize(size_t size)
+{
+    ASSERT(size > 0 && size <= MAXDWORD);
+    m_ioSize = size;
+    m_outQueue.setChunkSize(size);
+}
+
 void NamedPipe::startPipeWorkers()
 {
     if (m_openMode & OpenMode::Reading) {
         m_inputWorker.reset(new InputWorker(*this));
     }
     if (m_openMode & OpenMode::Writing) {
-        m_outputWorker.reset(new OutputWorker(*this));
+        if (m_outputThread != nullptr) {
+            m_outputChannel = m_outputThread->openChannel(m_handle);
+            handOffOutput();
+        } else {
+            m_outputWorkers.emplace_back(new OutputWorker(*this));
+        }
     }
 }
 
 size_t NamedPipe::bytesToSend()
 {
     ASSERT(m_openMode & OpenMode::Writing);
-    auto ret = m_outQueue.size();
-    if (m_outputWorker != NULL) {
-        ret += m_outputWorker->getPendingIoSize();
+    auto ret = m_outQueue.size() + (m_ringData.size() - m_ringDataOffset);
+    for (const auto &worker : m_outputWorkers) {
+        ret += worker->getPendingIoSize();
+    }
+    if (m_outputChannel != nullptr) {
+        ret += m_outputChannel->bytesPending();
+    }
+    return ret;
+}
+
+uint64_t NamedPipe::bytesWritten() const
+{
+    return m_bytesWritten +
+        (m_outputChannel != nullptr ? m_outputChannel->bytesWritten() : 0);
+}
+
+// Blocks until all queued output is written, the pipe fails, or the timeout
+// elapses, servicing the pipe outside the event loop.  Returns true if
+// everything was written.
+bool NamedPipe::flushOutput(DWORD timeoutMs)
+{
+    const DWORD start = GetTickCount();
+    std::vector<HANDLE> waitHandles;
+    while (true) {
+        waitHandles.clear();
+        serviceIo(&waitHandles);
+        if (isClosed() || bytesToSend() == 0) {
+            break;
+        }
+        const DWORD elapsed = GetTickCount() - start;
+        if (elapsed >= timeoutMs) {
+            trace("pipe [%s]: flush timed out",
+                utf8FromWide(m_name).c_str());
+            return false;
+        }
+        if (waitHandles.empty()) {
+            Sleep(1);
+        } else {
+            WaitForMultipleObjects(waitHandles.size(), waitHandles.data(),
+                                   FALSE, timeoutMs - elapsed);
+        }
+    }
+    return !isClosed();
+}
+
+// Frees the storage of the empty queues and of the workers without a pending
+// I/O.  A read is normally pending on a connected pipe, so its buffer stays.
+void NamedPipe::releaseIdleBuffers()
+{
+    m_inQueue.trim();
+    m_outQueue.trim();
+    if (m_ringDataOffset == m_ringData.size()) {
+        std::string().swap(m_ringData);
+        m_ringDataOffset = 0;
+    }
+    if (!m_frameReserved) {
+        std::string().swap(m_frame);
+    }
+    std::string().swap(m_compressedData);
+    std::string().swap(m_handoffData);
+    if (m_inputWorker) {
+        m_inputWorker->releaseBuffer();
+    }
+    for (const auto &worker : m_outputWorkers) {
+        worker->releaseBuffer();
+    }
+}
+
+// The bytes allocated for the queues and I/O buffers.
+size_t NamedPipe::memoryUsage() const
+{
+    size_t ret = m_inQueue.memoryUsage() + m_outQueue.memoryUsage() +
+        m_ringData.capacity() + m_frame.capacity() +
+        m_compressedData.capacity() + m_handoffData.capacity();
+    if (m_inputWorker) {
+        ret += m_inputWorker->bufferCapacity();
+    }
+    for (const auto &worker : m_outputWorkers) {
+        ret += worker->bufferCapacity();
     }
     return ret;
 }
@@ -295,7 +565,70 @@ size_t NamedPipe::bytesToSend()
 void NamedPipe::write(const void *data, size_t size)
 {
     ASSERT(m_openMode & OpenMode::Writing);
-    m_outQueue.append(reinterpret_cast<const char*>(data), size);
+    ASSERT(!m_outQueue.isTailReserved() && !m_frameReserved &&
+        "write called during reserveWrite");
+    if (m_recorder != nullptr) {
+        m_recorder->recordOutput(reinterpret_cast<const char*>(data), size);
+    }
+    if (m_compressed) {
+        m_compressedData.clear();
+        OutputCompression::appendFrames(
+            reinterpret_cast<const char*>(data), size, m_compressedData);
+        queueOutput(m_compressedData.data(), m_compressedData.size());
+    } else {
+        queueOutput(reinterpret_cast<const char*>(data), size);
+    }
+}
+
+void NamedPipe::queueOutput(const char *data, size_t size)
+{
+    m_outQueue.append(data, size);
+    noteQueuedOutput(data, size);
+    if (m_outputChannel != nullptr) {
+        handOffOutput();
+    }
+}
+
+// Moves queued output onto the output thread's channel until the queue is
+// empty or the channel is full.  A full channel wakes the loop as it frees
+// a slot, and the pipe is serviced again.  Handing output over as soon as it
+// is queued, rather than on the loop's next pass, keeps the pipe busy while
+// the loop is scraping.
+void NamedPipe::handOffOutput()
+{
+    while (hasWritableOutput() && m_outputChannel->checkSpaceOrArm()) {
+        m_outQueue.popFront(m_handoffData);
+        m_outputChannel->push(m_handoffData);
+    }
+}
+
+// Passes bytes just added to the output queue on to the journal and the
+// mirrors.
+void NamedPipe::noteQueuedOutput(const char *data, size_t size)
+{
+    if (m_journal != nullptr) {
+        m_journal->append(data, size);
+    }
+    for (NamedPipe *mirror : m_mirrors) {
+        mirror->m_outQueue.append(data, size);
+    }
+}
+
+// From now on, every byte queued on this pipe is queued on `mirror` too, so
+// output that is encoded once reaches several readers.  Each mirror has its
+// own queue and drains at its own pace.
+void NamedPipe::addMirror(NamedPipe &mirror)
+{
+    ASSERT(&mirror != this && (mirror.m_openMode & OpenMode::Writing));
+    m_mirrors.push_back(&mirror);
+}
+
+// Stops mirroring to `mirror`, and drops the output still queued on it.
+void NamedPipe::removeMirror(NamedPipe &mirror)
+{
+    m_mirrors.erase(std::remove(m_mirrors.begin(), m_mirrors.end(), &mirror),
+                    m_mirrors.end());
+    mirror.m_outQueue.clear();
 }
 
 void NamedPipe::write(const char *text)
@@ -303,6 +636,56 @@ void NamedPipe::write(const char *text)
     write(text, strlen(text));
 }
 
+// Returns the last chunk of the output queue so that a caller can encode
+// output directly onto its end rather than into a buffer of its own.
+// Nothing appended is sent until commitWrite is called, and the caller must
+// not modify the chunk's existing contents.
+std::string &NamedPipe::reserveWrite()
+{
+    ASSERT(m_openMode & OpenMode::Writing);
+    ASSERT(!m_outQueue.isTailReserved() && !m_frameReserved &&
+        "reserveWrite called twice");
+    if (m_compressed) {
+        // The frame is compressed as a whole by commitWrite.
+        m_frameReserved = true;
+        m_frame.clear();
+        return m_frame;
+    }
+    std::string &ret = m_outQueue.reserveTail();
+    m_reservedTail = &ret;
+    m_reservedTailSize = ret.size();
+    return ret;
+}
+
+void NamedPipe::commitWrite()
+{
+    if (m_compressed) {
+        ASSERT(m_frameReserved && "commitWrite called without reserveWrite");
+        m_frameReserved = false;
+        if (m_recorder != nullptr) {
+            m_recorder->recordOutput(m_frame.data(), m_frame.size());
+        }
+        m_compressedData.clear();
+        OutputCompression::appendFrames(
+            m_frame.data(), m_frame.size(), m_compressedData);
+        queueOutput(m_compressedData.data(), m_compressedData.size());
+        return;
+    }
+    ASSERT(m_outQueue.isTailReserved() &&
+        "commitWrite called without reserveWrite");
+    const std::string &tail = *m_reservedTail;
+    if (m_recorder != nullptr) {
+        m_recorder->recordOutput(tail.data() + m_reservedTailSize,
+                                 tail.size() - m_reservedTailSize);
+    }
+    noteQueuedOutput(tail.data() + m_reservedTailSize,
+                     tail.size() - m_reservedTailSize);
+    m_outQueue.commitTail();
+    if (m_outputChannel != nullptr) {
+        handOffOutput();
+    }
+}
+
 size_t NamedPipe::readBufferSize()
 {
     ASSERT(m_openMode & OpenMode::Reading);
@@ -324,41 +707,68 @@ size_t NamedPipe::bytesAvailable()
 size_t NamedPipe::peek(void *data, size_t size)
 {
     ASSERT(m_openMode & OpenMode::Reading);
-    const auto out = reinterpret_cast<char*>(data);
-    const size_t ret = std::min(size, m_inQueue.size());
-    std::copy(&m_inQueue[0], &m_inQueue[ret], out);
-    return ret;
+    return m_inQueue.peek(data, size);
+}
+
+// Returns the next `size` input bytes without copying them, if they're
+// stored contiguously, or nullptr.  The bytes stay valid until the pipe is
+// next read or serviced.
+const char *NamedPipe::peekInPlace(size_t size)
+{
+    ASSERT(m_openMode & OpenMode::Reading);
+    return m_inQueue.peekInPlace(size);
+}
+
+// Returns the input bytes that are stored contiguously at the front of the
+// input queue, without copying them, or nullptr if there is no input.  Like
+// peekInPlace, the bytes stay valid until the pipe is next read or serviced.
+const char *NamedPipe::peekFront(size_t &size)
+{
+    ASSERT(m_openMode & OpenMode::Reading);
+    return m_inQueue.peekFront(size);
 }
 
 size_t NamedPipe::read(void *data, size_t size)
 {
     size_t ret = peek(data, size);
-    m_inQueue.erase(0, ret);
+    m_inQueue.consume(ret);
     return ret;
 }
 
+// Discards `size` input bytes, which must be available.
+void NamedPipe::skip(size_t size)
+{
+    ASSERT(m_openMode & OpenMode::Reading);
+    m_inQueue.consume(size);
+}
+
 std::string NamedPipe::readToString(size_t size)
 {
     ASSERT(m_openMode & OpenMode::Reading);
-    size_t retSize = std::min(size, m_inQueue.size());
-    std::string ret = m_inQueue.substr(0, retSize);
-    m_inQueue.erase(0, retSize);
-    return ret;
+    return m_inQueue.take(size);
 }
 
 std::string NamedPipe::readAllToString()
 {
     ASSERT(m_openMode & OpenMode::Reading);
-    std::string ret = m_inQueue;
-    m_inQueue.clear();
-    return ret;
+    return m_inQueue.take(m_inQueue.size());
 }
 
 void NamedPipe::closePipe()
 {
+    if (m_sharedRing != nullptr) {
+        m_sharedRing->close();
+        m_sharedRing.reset();
+        return;
+    }
     if (m_handle == NULL) {
         return;
     }
+    if (m_outputChannel != nullptr) {
+        m_bytesWritten += m_outputChannel->bytesWritten();
+        m_outputThread->closeChannel(m_outputChannel);
+        m_outputChannel = nullptr;
+    }
     CancelIo(m_handle);
     if (m_connectEvent.get() != nullptr) {
         DWORD actual = 0;
@@ -369,10 +779,10 @@ void NamedPipe::closePipe()
         m_inputWorker->waitForCanceledIo();
         m_inputWorker.reset();
     }
-    if (m_outputWorker) {
-        m_outputWorker->waitForCanceledIo();
-        m_outputWorker.reset();
+    for (const auto &worker : m_outputWorkers) {
+        worker->waitForCanceledIo();
     }
+    m_outputWorkers.clear();
     CloseHandle(m_handle);
     m_handle = NULL;
 }
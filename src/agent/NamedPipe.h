@@ -22,14 +22,20 @@
 #define NAMEDPIPE_H
 
 #include <windows.h>
+#include <stdint.h>
 
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "ChunkedQueue.h"
+#include "OutputThread.h"
 #include "../shared/OwnedHandle.h"
 
 class EventLoop;
+class OutputJournal;
+class SessionRecorder;
+class SharedRing;
 
 class NamedPipe
 {
@@ -39,9 +45,19 @@ private:
     NamedPipe() {}
     ~NamedPipe() { closePipe(); }
     bool serviceIo(std::vector<HANDLE> *waitHandles);
+    bool needsService();
+    void associateCompletionPort();
     void startPipeWorkers();
+    bool serviceSharedRing(std::vector<HANDLE> *waitHandles);
 
     enum class ServiceResult { NoProgress, Error, Progress };
+    ServiceResult serviceOutputWorkers();
+    bool hasWritableOutput() {
+        return !m_outQueue.empty() && !m_outQueue.isTailReserved();
+    }
+    void queueOutput(const char *data, size_t size);
+    void noteQueuedOutput(const char *data, size_t size);
+    void handOffOutput();
 
 private:
     class IoWorker
@@ -52,25 +68,35 @@ private:
         ServiceResult service();
         void waitForCanceledIo();
         HANDLE getWaitEvent();
+        bool isPending() { return m_pending; }
+        virtual void releaseBuffer() {}
+        virtual size_t bufferCapacity() const { return 0; }
     protected:
         NamedPipe &m_namedPipe;
         bool m_pending = false;
         DWORD m_currentIoSize = 0;
         OwnedHandle m_event;
         OVERLAPPED m_over = {};
-        enum { kIoSize = 64 * 1024 };
-        char m_buffer[kIoSize];
         virtual void completeIo(DWORD size) = 0;
-        virtual bool shouldIssueIo(DWORD *size, bool *isRead) = 0;
+        virtual bool shouldIssueIo(char **buffer, DWORD *size,
+                                   bool *isRead) = 0;
     };
 
     class InputWorker : public IoWorker
     {
     public:
         InputWorker(NamedPipe &namedPipe) : IoWorker(namedPipe) {}
+        virtual void releaseBuffer() override;
+        virtual size_t bufferCapacity() const override {
+            return m_buffer.capacity();
+        }
     protected:
         virtual void completeIo(DWORD size) override;
-        virtual bool shouldIssueIo(DWORD *size, bool *isRead) override;
+        virtual bool shouldIssueIo(char **buffer, DWORD *size,
+                                   bool *isRead) override;
+    private:
+        // Sized to the pipe's I/O size before each read.
+        std::vector<char> m_buffer;
     };
 
     class OutputWorker : public IoWorker
@@ -78,9 +104,18 @@ private:
     public:
         OutputWorker(NamedPipe &namedPipe) : IoWorker(namedPipe) {}
         DWORD getPendingIoSize();
+        virtual void releaseBuffer() override;
+        virtual size_t bufferCapacity() const override {
+            return m_writeData.capacity();
+        }
     protected:
         virtual void completeIo(DWORD size) override;
-        virtual bool shouldIssueIo(DWORD *size, bool *isRead) override;
+        virtual bool shouldIssueIo(char **buffer, DWORD *size,
+                                   bool *isRead) override;
+    private:
+        // The front chunk of the output queue is swapped in here and written
+        // in place, so queued bytes aren't copied again before WriteFile.
+        std::string m_writeData;
     };
 
 public:
@@ -93,21 +128,53 @@ public:
     void openServerPipe(LPCWSTR pipeName, OpenMode::t openMode,
                         int outBufferSize, int inBufferSize);
     void connectToServer(LPCWSTR pipeName, OpenMode::t openMode);
+    void openSharedRing(std::unique_ptr<SharedRing> ring);
+    void setIoSize(size_t size);
+    void setJournal(OutputJournal *journal) { m_journal = journal; }
+    void setRecorder(SessionRecorder *recorder) { m_recorder = recorder; }
+    void setCompressed(bool compressed) { m_compressed = compressed; }
+    void addMirror(NamedPipe &mirror);
+    void removeMirror(NamedPipe &mirror);
     size_t bytesToSend();
+    bool flushOutput(DWORD timeoutMs);
+    void releaseIdleBuffers();
+    size_t memoryUsage() const;
+    uint64_t bytesRead() const { return m_bytesRead; }
+    uint64_t bytesWritten() const;
     void write(const void *data, size_t size);
     void write(const char *text);
+    std::string &reserveWrite();
+    void commitWrite();
     size_t readBufferSize();
     void setReadBufferSize(size_t size);
     size_t bytesAvailable();
     size_t peek(void *data, size_t size);
+    const char *peekInPlace(size_t size);
+    const char *peekFront(size_t &size);
     size_t read(void *data, size_t size);
+    void skip(size_t size);
     std::string readToString(size_t size);
     std::string readAllToString();
     void closePipe();
-    bool isClosed() { return m_handle == nullptr; }
+    bool isClosed() { return m_handle == nullptr && m_sharedRing == nullptr; }
     bool isConnected() { return !isClosed() && !isConnecting(); }
     bool isConnecting() { return m_connectEvent.get() != nullptr; }
 
+#ifdef NAMED_PIPE_TESTING
+    // A pipe that is never opened, for benchmarks.  Writes accumulate in the
+    // output queue until discardOutput is called.  The pipe is never freed.
+    static NamedPipe &createSink() {
+        NamedPipe *ret = new NamedPipe;
+        ret->m_openMode = OpenMode::Writing;
+        return *ret;
+    }
+    size_t discardOutput() {
+        const size_t ret = m_outQueue.size();
+        m_outQueue.clear();
+        return ret;
+    }
+#endif // NAMED_PIPE_TESTING
+
 private:
     // Input/output buffers
     std::wstring m_name;
@@ -115,11 +182,54 @@ private:
     OwnedHandle m_connectEvent;
     OpenMode::t m_openMode = OpenMode::None;
     size_t m_readBufferSize = 64 * 1024;
-    std::string m_inQueue;
-    std::string m_outQueue;
+    // The largest read the InputWorker issues, and the chunk size of the
+    // output queue, which bounds each write.
+    size_t m_ioSize = 64 * 1024;
+    ChunkedQueue m_inQueue;
+    ChunkedQueue m_outQueue;
+    // Totals of the bytes the I/O workers have transferred.  bytesWritten
+    // adds the output channel's count.
+    uint64_t m_bytesRead = 0;
+    uint64_t m_bytesWritten = 0;
     HANDLE m_handle = nullptr;
+    HANDLE m_completionPort = nullptr;
+    bool m_ioCompleted = false;
     std::unique_ptr<InputWorker> m_inputWorker;
-    std::unique_ptr<OutputWorker> m_outputWorker;
+    // Each OutputWorker has at most one write pending.  Workers are added,
+    // up to kMaxPendingWrites, while output is queued and every worker is
+    // busy, so a burst keeps several writes in flight.
+    enum { kMaxPendingWrites = 4 };
+    std::vector<std::unique_ptr<OutputWorker>> m_outputWorkers;
+    // With WINPTY_FLAG_OUTPUT_THREAD, the EventLoop sets m_outputThread, and
+    // once the pipe connects, its writes are issued on that thread instead
+    // of by OutputWorkers.  Queued output is handed over a chunk at a time
+    // through m_handoffData.
+    OutputThread *m_outputThread = nullptr;
+    OutputThread::Channel *m_outputChannel = nullptr;
+    std::string m_handoffData;
+    // With WINPTY_FLAG_SHARED_MEMORY_OUTPUT, output goes to this ring instead
+    // of a pipe handle.  Like the OutputWorker, the pipe swaps the front chunk
+    // of the output queue into m_ringData, then copies it into the ring as
+    // space allows.
+    std::unique_ptr<SharedRing> m_sharedRing;
+    std::string m_ringData;
+    size_t m_ringDataOffset = 0;
+    // If set, every write is also recorded here.  m_reservedTailSize is the
+    // size of the reserved chunk when reserveWrite returned it.
+    OutputJournal *m_journal = nullptr;
+    // If set, every write is also recorded here, before compression.
+    SessionRecorder *m_recorder = nullptr;
+    // Pipes that receive a copy of everything queued here (see addMirror).
+    std::vector<NamedPipe*> m_mirrors;
+    std::string *m_reservedTail = nullptr;
+    size_t m_reservedTailSize = 0;
+    // With WINPTY_FLAG_COMPRESSED_OUTPUT, reserveWrite hands out m_frame
+    // instead of the queue's tail, and each write is queued as compressed
+    // frames.
+    bool m_compressed = false;
+    bool m_frameReserved = false;
+    std::string m_frame;
+    std::string m_compressedData;
 };
 
 #endif // NAMEDPIPE_H
@@ -0,0 +1,60 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "OutputJournal.h"
+
+#include <algorithm>
+
+void OutputJournal::append(const char *data, size_t size)
+{
+    if (size == 0) {
+        return;
+    }
+    m_writes.push_back(Write { m_endOffset, std::string(data, size) });
+    m_size += size;
+    m_endOffset += size;
+    // Always keep the newest write, even if it alone exceeds the capacity.
+    while (m_size > m_capacity && m_writes.size() > 1) {
+        m_size -= m_writes.front().data.size();
+        m_writes.pop_front();
+    }
+}
+
+bool OutputJournal::readFrom(uint64_t offset, size_t maxSize,
+                             std::string &out) const
+{
+    if (offset < startOffset() || offset > m_endOffset) {
+        return false;
+    }
+    // Find the first write that ends after `offset`.
+    auto it = std::upper_bound(
+        m_writes.begin(), m_writes.end(), offset,
+        [](uint64_t value, const Write &write) {
+            return value < write.offset + write.data.size();
+        });
+    for (; it != m_writes.end() && maxSize > 0; ++it) {
+        const size_t skip = static_cast<size_t>(offset - it->offset);
+        const size_t n = std::min(maxSize, it->data.size() - skip);
+        out.append(it->data, skip, n);
+        offset += n;
+        maxSize -= n;
+    }
+    return true;
+}
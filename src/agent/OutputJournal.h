@@ -0,0 +1,62 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_OUTPUT_JOURNAL_H
+#define AGENT_OUTPUT_JOURNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <string>
+
+// Retains the most recent output written to a pipe, so that a client that
+// lost some of it can ask for it again (see WINPTY_FLAG_OUTPUT_JOURNAL).
+// Output is identified by its byte offset from the start of the stream.
+// Each write is kept whole, and the oldest writes are dropped once the
+// journal holds more than its capacity.
+class OutputJournal
+{
+public:
+    explicit OutputJournal(size_t capacity) : m_capacity(capacity) {}
+
+    void append(const char *data, size_t size);
+
+    // The offsets of the oldest retained byte and of the end of the stream.
+    uint64_t startOffset() const { return m_endOffset - m_size; }
+    uint64_t endOffset() const { return m_endOffset; }
+
+    // Appends up to maxSize bytes of output, starting at `offset`, to `out`.
+    // Returns false if the output at `offset` is no longer retained (or
+    // hasn't been written yet).
+    bool readFrom(uint64_t offset, size_t maxSize, std::string &out) const;
+
+private:
+    struct Write {
+        uint64_t offset;
+        std::string data;
+    };
+    const size_t m_capacity;
+    std::deque<Write> m_writes;
+    size_t m_size = 0;
+    uint64_t m_endOffset = 0;
+};
+
+#endif // AGENT_OUTPUT_JOURNAL_H
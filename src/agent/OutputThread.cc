@@ -0,0 +1,267 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "OutputThread.h"
+
+#include "../shared/DebugClient.h"
+#include "../shared/WinptyAssert.h"
+
+#include "EtwTrace.h"
+#include "EventLoop.h"
+
+namespace {
+
+// initially unset
+OwnedHandle createEvent(BOOL manualReset) {
+    HANDLE ret = CreateEventW(nullptr, manualReset, FALSE, nullptr);
+    ASSERT(ret != nullptr && "CreateEventW failed");
+    return OwnedHandle(ret);
+}
+
+} // anonymous namespace
+
+OutputThread::Channel::Channel(OutputThread &thread, HANDLE handle) :
+    m_thread(thread),
+    m_handle(handle),
+    m_closedEvent(createEvent(TRUE)),
+    m_writeEvent(createEvent(TRUE))
+{
+}
+
+bool OutputThread::Channel::hasSpace() const
+{
+    return m_head.load(std::memory_order_relaxed) -
+        m_tail.load(std::memory_order_acquire) < kSlots;
+}
+
+// Returns true if the ring has space.  Otherwise, the thread will wake the
+// owner once it has.
+bool OutputThread::Channel::checkSpaceOrArm()
+{
+    if (hasSpace()) {
+        return true;
+    }
+    m_spaceWanted = true;
+    // Check again, in case the thread took a chunk before it could see the
+    // flag.
+    return m_head.load(std::memory_order_relaxed) - m_tail < kSlots;
+}
+
+// Hands the chunk to the output thread, leaving `chunk` holding a spare
+// buffer in exchange.  The channel must have space.
+void OutputThread::Channel::push(std::string &chunk)
+{
+    ASSERT(hasSpace() && "OutputThread::Channel is full");
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    m_bytesPending += chunk.size();
+    m_slots[head % kSlots].swap(chunk);
+    // A sequentially consistent store, paired with the thread's store to
+    // m_sleeping, so either the thread sees this slot before it waits or
+    // notify sees that it's waiting.
+    m_head.store(head + 1);
+    m_thread.notify();
+}
+
+OutputThread::OutputThread(EventLoop &owner) :
+    m_owner(owner),
+    m_wakeEvent(createEvent(FALSE))
+{
+    m_thread = CreateThread(nullptr, 0, threadProc, this, 0, nullptr);
+    ASSERT(m_thread != nullptr && "Could not create the output thread");
+}
+
+OutputThread::~OutputThread()
+{
+    ASSERT(m_channels.empty() && "OutputThread destroyed with open channels");
+    m_stopRequested = true;
+    SetEvent(m_wakeEvent.get());
+    WaitForSingleObject(m_thread, INFINITE);
+    CloseHandle(m_thread);
+}
+
+// Starts writing the chunks pushed onto the returned channel to `handle`,
+// an overlapped pipe handle.  Only this thread issues I/O on the handle
+// until the channel is closed.
+OutputThread::Channel *OutputThread::openChannel(HANDLE handle)
+{
+    Channel *const channel = new Channel(*this, handle);
+    LockGuard<Mutex> lock(m_channelsMutex);
+    m_channels.push_back(channel);
+    return channel;
+}
+
+// Cancels the channel's pending write, if any, waits for this thread to
+// drop it, and frees it.  Chunks not yet written are discarded.
+void OutputThread::closeChannel(Channel *channel)
+{
+    channel->m_closeRequested = true;
+    SetEvent(m_wakeEvent.get());
+    WaitForSingleObject(channel->m_closedEvent.get(), INFINITE);
+    delete channel;
+}
+
+DWORD WINAPI OutputThread::threadProc(LPVOID param)
+{
+    OutputThread &self = *static_cast<OutputThread*>(param);
+    trace("Output thread started");
+    self.run();
+    trace("Output thread exiting");
+    return 0;
+}
+
+void OutputThread::notify()
+{
+    if (m_sleeping) {
+        SetEvent(m_wakeEvent.get());
+    }
+}
+
+void OutputThread::run()
+{
+    std::vector<Channel*> channels;
+    std::vector<HANDLE> waitHandles;
+    while (!m_stopRequested) {
+        {
+            LockGuard<Mutex> lock(m_channelsMutex);
+            for (auto it = m_channels.begin(); it != m_channels.end();) {
+                Channel &channel = **it;
+                if (!channel.m_closeRequested) {
+                    ++it;
+                    continue;
+                }
+                // CancelIo only cancels the I/O this thread issued, which
+                // is why the owner can't do it.
+                if (channel.m_pending) {
+                    CancelIo(channel.m_handle);
+                    DWORD actual = 0;
+                    GetOverlappedResult(channel.m_handle, &channel.m_over,
+                                        &actual, TRUE);
+                    channel.m_pending = false;
+                }
+                SetEvent(channel.m_closedEvent.get());
+                it = m_channels.erase(it);
+            }
+            channels = m_channels;
+        }
+
+        bool progress = false;
+        for (Channel *channel : channels) {
+            progress = serviceChannel(*channel) || progress;
+        }
+        if (progress) {
+            continue;
+        }
+
+        waitHandles.clear();
+        waitHandles.push_back(m_wakeEvent.get());
+        for (Channel *channel : channels) {
+            if (channel->m_pending) {
+                waitHandles.push_back(channel->m_writeEvent.get());
+            }
+        }
+        ASSERT(waitHandles.size() <= MAXIMUM_WAIT_OBJECTS &&
+            "Too many output channels");
+        m_sleeping = true;
+        // Check the rings again now that a push would signal m_wakeEvent.
+        bool ready = false;
+        for (Channel *channel : channels) {
+            if (!channel->m_pending && !channel->m_failed &&
+                    channel->m_tail.load(std::memory_order_relaxed) !=
+                        channel->m_head) {
+                ready = true;
+            }
+        }
+        if (!ready) {
+            WaitForMultipleObjects(waitHandles.size(), waitHandles.data(),
+                                   FALSE, INFINITE);
+        }
+        m_sleeping = false;
+    }
+}
+
+// Finishes the channel's pending write, if it's done, then writes chunks
+// off its ring until one pends.  Returns true if anything happened.
+bool OutputThread::serviceChannel(Channel &channel)
+{
+    if (channel.m_failed) {
+        return false;
+    }
+    bool progress = false;
+    if (channel.m_pending) {
+        DWORD actual = 0;
+        if (!GetOverlappedResult(channel.m_handle, &channel.m_over,
+                                 &actual, FALSE)) {
+            if (GetLastError() == ERROR_IO_INCOMPLETE) {
+                return false;
+            }
+            channel.m_pending = false;
+            channel.m_failed = true;
+            m_owner.wake();
+            return true;
+        }
+        ASSERT(actual == channel.m_writeData.size());
+        channel.m_pending = false;
+        channel.m_bytesWritten += actual;
+        channel.m_bytesPending -= actual;
+        etwInfo(kEtwPipeWrite, actual);
+        progress = true;
+    }
+    while (true) {
+        const size_t tail = channel.m_tail.load(std::memory_order_relaxed);
+        if (tail == channel.m_head.load(std::memory_order_acquire)) {
+            break;
+        }
+        // The slot gets the storage of the last write, which is complete.
+        channel.m_writeData.swap(channel.m_slots[tail % Channel::kSlots]);
+        channel.m_tail.store(tail + 1);
+        if (channel.m_spaceWanted.exchange(false)) {
+            m_owner.wake();
+        }
+        progress = true;
+        const std::string &data = channel.m_writeData;
+        if (data.empty()) {
+            continue;
+        }
+        ASSERT(data.size() <= MAXDWORD && "Output chunk is too large");
+        const DWORD size = static_cast<DWORD>(data.size());
+        channel.m_over = {};
+        // Setting the event's low bit keeps the write from queueing a packet
+        // to the completion port the owner's loop may have associated with
+        // the handle.
+        channel.m_over.hEvent = reinterpret_cast<HANDLE>(
+            reinterpret_cast<ULONG_PTR>(channel.m_writeEvent.get()) | 1);
+        DWORD actual = 0;
+        if (!WriteFile(channel.m_handle, data.data(), size, &actual,
+                       &channel.m_over)) {
+            if (GetLastError() == ERROR_IO_PENDING) {
+                channel.m_pending = true;
+            } else {
+                channel.m_failed = true;
+                m_owner.wake();
+            }
+            break;
+        }
+        ASSERT(actual == size);
+        channel.m_bytesWritten += actual;
+        channel.m_bytesPending -= actual;
+        etwInfo(kEtwPipeWrite, actual);
+    }
+    return progress;
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_OUTPUT_THREAD_H
+#define AGENT_OUTPUT_THREAD_H
+
+#include <windows.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../shared/Mutex.h"
+#include "../shared/OwnedHandle.h"
+
+class EventLoop;
+
+// With WINPTY_FLAG_OUTPUT_THREAD, the writes to the CONOUT and CONERR pipes
+// are issued from this thread, so a pipe keeps draining while the event loop
+// is busy with a long scrape or a console freeze.
+//
+// Each pipe hands its output over through a Channel, a single-producer,
+// single-consumer ring of chunks.  The loop's thread swaps a chunk into a
+// free slot and publishes it with a release store, and this thread swaps it
+// out again, so no byte is copied and no lock is taken on the data path.  A
+// slot keeps the storage of the chunk last written from it, which goes back
+// to the pipe's queue with the next chunk handed over.  When a full ring
+// frees a slot, or a write fails, this thread wakes the owning loop.
+// Adding and closing a channel take a lock and wait for this thread.
+class OutputThread
+{
+public:
+    class Channel
+    {
+    public:
+        // These are called on the owning loop's thread.
+        bool hasSpace() const;
+        bool checkSpaceOrArm();
+        void push(std::string &chunk);
+        uint64_t bytesPending() const { return m_bytesPending; }
+        uint64_t bytesWritten() const { return m_bytesWritten; }
+        bool failed() const { return m_failed; }
+
+    private:
+        friend class OutputThread;
+        enum { kSlots = 16 };
+        Channel(OutputThread &thread, HANDLE handle);
+
+        OutputThread &m_thread;
+        const HANDLE m_handle;
+        std::string m_slots[kSlots];
+        // m_head is the next slot the producer fills, and m_tail the next
+        // one the consumer takes.  Each counts up without wrapping.
+        std::atomic<size_t> m_head { 0 };
+        std::atomic<size_t> m_tail { 0 };
+        std::atomic<uint64_t> m_bytesPending { 0 };
+        std::atomic<uint64_t> m_bytesWritten { 0 };
+        std::atomic<bool> m_failed { false };
+        std::atomic<bool> m_closeRequested { false };
+        // Set by checkSpaceOrArm, so the thread wakes the owner as it takes
+        // a chunk.
+        std::atomic<bool> m_spaceWanted { false };
+        OwnedHandle m_closedEvent;
+        // The consumer's state.
+        std::string m_writeData;
+        bool m_pending = false;
+        OwnedHandle m_writeEvent;
+        OVERLAPPED m_over = {};
+    };
+
+    explicit OutputThread(EventLoop &owner);
+    ~OutputThread();
+    OutputThread(const OutputThread &other) = delete;
+    OutputThread &operator=(const OutputThread &other) = delete;
+    Channel *openChannel(HANDLE handle);
+    void closeChannel(Channel *channel);
+
+private:
+    static DWORD WINAPI threadProc(LPVOID param);
+    void run();
+    void notify();
+    bool serviceChannel(Channel &channel);
+
+    EventLoop &m_owner;
+    HANDLE m_thread = nullptr;
+    OwnedHandle m_wakeEvent;
+    std::atomic<bool> m_stopRequested { false };
+    // Set by this thread before it waits, so a producer knows to signal
+    // m_wakeEvent.
+    std::atomic<bool> m_sleeping { false };
+    Mutex m_channelsMutex;
+    std::vector<Channel*> m_channels;
+};
+
+#endif // AGENT_OUTPUT_THREAD_H
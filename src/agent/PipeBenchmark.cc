@@ -0,0 +1,235 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Benchmarks NamedPipe and EventLoop::run without a console.  Each run
+// creates a server pipe and a client pipe connected to it inside one
+// EventLoop.  The server end writes fixed-size messages, keeping up to
+// DEPTH of them queued, and the client end consumes whatever arrives.  Each
+// run reports MB/s, messages per second, and the p50 and p99 time from a
+// message's write call to the read of its last byte.
+//
+//     PipeBenchmark [-seconds S] [-events|-iocp]
+//         Runs every combination of message size (64 bytes, 4KiB, and
+//         64KiB), queue depth (1 and 16), and pipe buffer size (4KiB and
+//         64KiB), once with the loop waiting on each pipe's events and once
+//         with an I/O completion port (EventLoop::useCompletionPort).
+//         -events or -iocp limits the runs to one backend.
+//
+// Build it with the agent's EventLoop, NamedPipe, ChunkedQueue, EtwTrace,
+// OutputJournal, OutputThread, SessionRecorder, and TimerWheel code, and the
+// shared DebugClient, OutputCompression, OwnedHandle, SharedRing,
+// StringUtil, WindowsSecurity, and WinptyAssert code.
+
+#include <windows.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "EventLoop.h"
+#include "NamedPipe.h"
+
+namespace {
+
+const size_t kMessageSizes[] = { 64, 4096, 65536 };
+const size_t kDepths[] = { 1, 16 };
+const int kPipeBufferSizes[] = { 4096, 65536 };
+
+int64_t qpcValue() {
+    LARGE_INTEGER ret;
+    QueryPerformanceCounter(&ret);
+    return ret.QuadPart;
+}
+
+double qpcUs(int64_t ticks) {
+    static const int64_t freq = []() {
+        LARGE_INTEGER ret;
+        QueryPerformanceFrequency(&ret);
+        return ret.QuadPart;
+    }();
+    return static_cast<double>(ticks) * 1000000.0 /
+        static_cast<double>(freq);
+}
+
+struct Result {
+    double seconds = 0.0;
+    uint64_t bytes = 0;
+    uint64_t messages = 0;
+    std::vector<double> latencyUs;
+};
+
+class PipeBench : public EventLoop {
+public:
+    PipeBench(bool iocp, size_t messageSize, size_t depth, int bufferSize,
+              double seconds);
+    Result measure();
+
+protected:
+    virtual void onPollTimeout() override { checkDone(); }
+    virtual void onPipeIo(NamedPipe &namedPipe) override;
+
+private:
+    void fillWriter();
+    void checkDone();
+
+    const size_t m_messageSize;
+    const size_t m_depth;
+    const double m_seconds;
+    NamedPipe *m_writer = nullptr;
+    NamedPipe *m_reader = nullptr;
+    std::string m_message;
+    // The write time of each message not yet fully read.
+    std::deque<int64_t> m_writeTimes;
+    size_t m_partialBytes = 0;
+    int64_t m_startTime = 0;
+    Result m_result;
+};
+
+PipeBench::PipeBench(bool iocp, size_t messageSize, size_t depth,
+                     int bufferSize, double seconds) :
+    m_messageSize(messageSize),
+    m_depth(depth),
+    m_seconds(seconds),
+    m_message(messageSize, 'x')
+{
+    static int pipeCount = 0;
+    if (iocp) {
+        useCompletionPort();
+    }
+    wchar_t name[128];
+    swprintf(name, 128, L"\\\\.\\pipe\\winpty-pipe-benchmark-%u-%d",
+             static_cast<unsigned int>(GetCurrentProcessId()), pipeCount++);
+    m_writer = &createNamedPipe();
+    m_writer->openServerPipe(name, NamedPipe::OpenMode::Duplex,
+                             bufferSize, bufferSize);
+    m_reader = &createNamedPipe();
+    m_reader->connectToServer(name, NamedPipe::OpenMode::Duplex);
+    setPollInterval(10);
+}
+
+Result PipeBench::measure() {
+    m_startTime = qpcValue();
+    fillWriter();
+    run();
+    m_result.seconds = qpcUs(qpcValue() - m_startTime) / 1000000.0;
+    return m_result;
+}
+
+// Queue messages until DEPTH of them are waiting to be written.
+void PipeBench::fillWriter() {
+    while (m_writer->bytesToSend() + m_message.size() <=
+            m_depth * m_messageSize) {
+        m_writeTimes.push_back(qpcValue());
+        m_writer->write(m_message.data(), m_message.size());
+    }
+}
+
+void PipeBench::onPipeIo(NamedPipe &namedPipe) {
+    size_t size = 0;
+    while (m_reader->peekFront(size) != nullptr) {
+        m_reader->skip(size);
+        m_result.bytes += size;
+        m_partialBytes += size;
+        while (m_partialBytes >= m_messageSize) {
+            m_partialBytes -= m_messageSize;
+            const int64_t now = qpcValue();
+            m_result.latencyUs.push_back(qpcUs(now - m_writeTimes.front()));
+            m_writeTimes.pop_front();
+            ++m_result.messages;
+        }
+    }
+    fillWriter();
+    checkDone();
+}
+
+void PipeBench::checkDone() {
+    if (qpcUs(qpcValue() - m_startTime) >= m_seconds * 1000000.0 ||
+            m_writer->isClosed() || m_reader->isClosed()) {
+        shutdown();
+    }
+}
+
+double percentile(const std::vector<double> &sorted, int pct) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    return sorted[(sorted.size() - 1) * pct / 100];
+}
+
+void runBackend(bool iocp, double seconds) {
+    for (size_t messageSize : kMessageSizes) {
+        for (size_t depth : kDepths) {
+            for (int bufferSize : kPipeBufferSizes) {
+                Result result;
+                {
+                    PipeBench bench(iocp, messageSize, depth, bufferSize,
+                                    seconds);
+                    result = bench.measure();
+                }
+                std::sort(result.latencyUs.begin(), result.latencyUs.end());
+                printf("%-7s %8u %6u %8d %10.1f %12.0f %8.1f %8.1f\n",
+                       iocp ? "iocp" : "events",
+                       static_cast<unsigned int>(messageSize),
+                       static_cast<unsigned int>(depth),
+                       bufferSize,
+                       result.bytes / result.seconds / 1000000.0,
+                       result.messages / result.seconds,
+                       percentile(result.latencyUs, 50),
+                       percentile(result.latencyUs, 99));
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    double seconds = 0.5;
+    bool runEvents = true;
+    bool runIocp = true;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-seconds") && i + 1 < argc) {
+            seconds = std::max(0.01, atof(argv[++i]));
+        } else if (!strcmp(argv[i], "-events")) {
+            runIocp = false;
+        } else if (!strcmp(argv[i], "-iocp")) {
+            runEvents = false;
+        } else {
+            fprintf(stderr, "Error: unrecognized argument: '%s'\n", argv[i]);
+            return 1;
+        }
+    }
+
+    printf("%-7s %8s %6s %8s %10s %12s %8s %8s\n",
+           "backend", "msg-size", "depth", "pipe-buf", "MB/s", "msgs/s",
+           "p50-us", "p99-us");
+    if (runEvents) {
+        runBackend(false, seconds);
+    }
+    if (runIocp) {
+        runBackend(true, seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,172 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "Profiler.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "../shared/DebugClient.h"
+#include "../shared/Mutex.h"
+
+volatile LONG g_profileEnabled = 0;
+
+namespace {
+
+const size_t kMaxProfileZones = 64;
+
+// Only the owning thread writes its counters, so the samples need no
+// read-modify-write.  The counters are atomic so that dumpProfile can read
+// them from another thread.
+struct ProfileCounter {
+    std::atomic<uint64_t> count { 0 };
+    std::atomic<uint64_t> ticks { 0 };
+    std::atomic<uint64_t> maxTicks { 0 };
+};
+
+struct ProfileTable {
+    ProfileCounter counters[kMaxProfileZones];
+};
+
+Mutex g_profileMutex;
+DWORD g_tlsIndex = TLS_OUT_OF_INDEXES;
+// Guarded by g_profileMutex.  The tables are never freed, because a thread
+// might still be recording into one.
+std::vector<ProfileTable*> g_tables;
+std::vector<const char*> g_zoneNames;
+
+LONG registerZone(ProfileZone &zone) {
+    LockGuard<Mutex> guard(g_profileMutex);
+    if (zone.index >= 0) {
+        return zone.index;
+    }
+    // Zones with the same name share a counter, so one name can cover
+    // several call sites.
+    size_t index = 0;
+    while (index < g_zoneNames.size() &&
+            strcmp(g_zoneNames[index], zone.name) != 0) {
+        ++index;
+    }
+    if (index == g_zoneNames.size()) {
+        if (index == kMaxProfileZones) {
+            trace("profile: too many zones, ignoring %s", zone.name);
+            return -1;
+        }
+        g_zoneNames.push_back(zone.name);
+    }
+    InterlockedExchange(&zone.index, static_cast<LONG>(index));
+    return static_cast<LONG>(index);
+}
+
+ProfileTable *currentTable() {
+    auto table = static_cast<ProfileTable*>(TlsGetValue(g_tlsIndex));
+    if (table == nullptr) {
+        table = new ProfileTable;
+        TlsSetValue(g_tlsIndex, table);
+        LockGuard<Mutex> guard(g_profileMutex);
+        g_tables.push_back(table);
+    }
+    return table;
+}
+
+int64_t ticksToUs(uint64_t ticks) {
+    static const double freq =
+        static_cast<double>(TimeMeasurement::frequency());
+    return static_cast<int64_t>(static_cast<double>(ticks) * 1000000.0 / freq);
+}
+
+} // anonymous namespace
+
+// Called once from main, before the agent starts any threads.
+void initProfiler() {
+    if (!hasDebugFlag("profile")) {
+        return;
+    }
+    g_tlsIndex = TlsAlloc();
+    if (g_tlsIndex == TLS_OUT_OF_INDEXES) {
+        trace("profile: TlsAlloc failed");
+        return;
+    }
+    InterlockedExchange(&g_profileEnabled, 1);
+}
+
+void recordProfileSample(ProfileZone &zone, uint64_t ticks) {
+    LONG index = zone.index;
+    if (index < 0) {
+        index = registerZone(zone);
+        if (index < 0) {
+            return;
+        }
+    }
+    ProfileCounter &counter = currentTable()->counters[index];
+    const auto relaxed = std::memory_order_relaxed;
+    counter.count.store(counter.count.load(relaxed) + 1, relaxed);
+    counter.ticks.store(counter.ticks.load(relaxed) + ticks, relaxed);
+    if (ticks > counter.maxTicks.load(relaxed)) {
+        counter.maxTicks.store(ticks, relaxed);
+    }
+}
+
+// Writes each zone's totals across all threads to the trace, busiest first.
+void dumpProfile(const char *reason) {
+    if (!isProfilingEnabled()) {
+        return;
+    }
+    struct ZoneTotal {
+        const char *name;
+        uint64_t count;
+        uint64_t ticks;
+        uint64_t maxTicks;
+    };
+    std::vector<ZoneTotal> totals;
+    {
+        LockGuard<Mutex> guard(g_profileMutex);
+        for (size_t i = 0; i < g_zoneNames.size(); ++i) {
+            ZoneTotal total = { g_zoneNames[i], 0, 0, 0 };
+            for (const ProfileTable *table : g_tables) {
+                const ProfileCounter &counter = table->counters[i];
+                total.count += counter.count.load();
+                total.ticks += counter.ticks.load();
+                total.maxTicks =
+                    std::max<uint64_t>(total.maxTicks, counter.maxTicks.load());
+            }
+            totals.push_back(total);
+        }
+    }
+    std::sort(totals.begin(), totals.end(),
+        [](const ZoneTotal &a, const ZoneTotal &b) {
+            return a.ticks > b.ticks;
+        });
+    trace("profile (%s): %d zones", reason, static_cast<int>(totals.size()));
+    for (const ZoneTotal &total : totals) {
+        const int64_t totalUs = ticksToUs(total.ticks);
+        trace("profile: %-20s count=%lld total=%lldus avg=%lldus max=%lldus",
+              total.name,
+              static_cast<long long>(total.count),
+              static_cast<long long>(totalUs),
+              static_cast<long long>(
+                  total.count == 0 ? 0 :
+                      totalUs / static_cast<int64_t>(total.count)),
+              static_cast<long long>(ticksToUs(total.maxTicks)));
+    }
+}
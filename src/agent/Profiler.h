@@ -0,0 +1,84 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_PROFILER_H
+#define AGENT_PROFILER_H
+
+#include <windows.h>
+#include <stdint.h>
+
+#include "../shared/TimeMeasurement.h"
+
+// A flat profile of the agent's hot paths.  Each PROFILE_ZONE("name") times
+// the rest of its enclosing scope and adds the interval to the zone's count,
+// total, and maximum in the calling thread's table, so threads never contend
+// on a sample.  Nested zones each count their whole interval.
+// WINPTY_DEBUG=profile enables it, and the agent traces the merged tables
+// (via dumpProfile) on each GetStats request and at exit.  While it is
+// disabled, a zone costs a load-and-test.
+//
+// Zone names say what part of the agent they time, e.g. "scrape.read".
+
+struct ProfileZone {
+    const char *name;
+    // An index into the thread tables, assigned on the zone's first sample.
+    volatile LONG index;
+};
+
+extern volatile LONG g_profileEnabled;
+
+void initProfiler();
+void recordProfileSample(ProfileZone &zone, uint64_t ticks);
+void dumpProfile(const char *reason);
+
+inline bool isProfilingEnabled() { return g_profileEnabled != 0; }
+
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileZone &zone) :
+        m_zone(zone),
+        m_start(isProfilingEnabled() ? TimeMeasurement::ticks() : 0)
+    {
+    }
+    ~ProfileScope() {
+        if (m_start != 0) {
+            recordProfileSample(m_zone, TimeMeasurement::ticks() - m_start);
+        }
+    }
+
+    ProfileScope(const ProfileScope &other) = delete;
+    ProfileScope &operator=(const ProfileScope &other) = delete;
+
+private:
+    ProfileZone &m_zone;
+    const uint64_t m_start;
+};
+
+#define PROFILE_CONCAT_(a, b) a ## b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+
+// The zone is a constant-initialized static, so declaring it costs nothing.
+#define PROFILE_ZONE(name)                                                  \
+    static ProfileZone PROFILE_CONCAT(profileZone_, __LINE__) = {          \
+        (name), -1 };                                                       \
+    ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(                   \
+        PROFILE_CONCAT(profileZone_, __LINE__))
+
+#endif // AGENT_PROFILER_H
@@ -0,0 +1,174 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "PseudoConsole.h"
+
+#include "../shared/DebugClient.h"
+#include "../shared/OsModule.h"
+#include "../shared/WinptyAssert.h"
+
+namespace {
+
+typedef HRESULT WINAPI CreatePseudoConsole_t(
+    COORD size, HANDLE hInput, HANDLE hOutput, DWORD dwFlags, void **phPC);
+typedef HRESULT WINAPI ResizePseudoConsole_t(void *hPC, COORD size);
+typedef void WINAPI ClosePseudoConsole_t(void *hPC);
+typedef BOOL WINAPI InitializeProcThreadAttributeList_t(
+    void *lpAttributeList,
+    DWORD dwAttributeCount, DWORD dwFlags, PSIZE_T lpSize);
+typedef BOOL WINAPI UpdateProcThreadAttribute_t(
+    void *lpAttributeList, DWORD dwFlags,
+    DWORD_PTR Attribute, PVOID lpValue, SIZE_T cbSize,
+    PVOID lpPreviousValue, PSIZE_T lpReturnSize);
+typedef void WINAPI DeleteProcThreadAttributeList_t(
+    void *lpAttributeList);
+
+// ProcThreadAttributeValue(22, FALSE, TRUE, FALSE)
+const DWORD_PTR kProcThreadAttributePseudoConsole = 0x00020016;
+
+#define GET_KERNEL32_PROC(funcName) \
+    m_##funcName = reinterpret_cast<funcName##_t*>( \
+        loadedModuleProc(L"kernel32.dll", #funcName))
+
+#define DEFINE_ACCESSOR(funcName) \
+    funcName##_t &funcName() const { \
+        ASSERT(valid()); \
+        return *m_##funcName; \
+    }
+
+class PseudoConsoleAPI {
+public:
+    PseudoConsoleAPI() {
+        GET_KERNEL32_PROC(CreatePseudoConsole);
+        GET_KERNEL32_PROC(ResizePseudoConsole);
+        GET_KERNEL32_PROC(ClosePseudoConsole);
+        GET_KERNEL32_PROC(InitializeProcThreadAttributeList);
+        GET_KERNEL32_PROC(UpdateProcThreadAttribute);
+        GET_KERNEL32_PROC(DeleteProcThreadAttributeList);
+    }
+
+    bool valid() const {
+        return m_CreatePseudoConsole != NULL &&
+            m_ResizePseudoConsole != NULL &&
+            m_ClosePseudoConsole != NULL &&
+            m_InitializeProcThreadAttributeList != NULL &&
+            m_UpdateProcThreadAttribute != NULL &&
+            m_DeleteProcThreadAttributeList != NULL;
+    }
+
+    DEFINE_ACCESSOR(CreatePseudoConsole)
+    DEFINE_ACCESSOR(ResizePseudoConsole)
+    DEFINE_ACCESSOR(ClosePseudoConsole)
+    DEFINE_ACCESSOR(InitializeProcThreadAttributeList)
+    DEFINE_ACCESSOR(UpdateProcThreadAttribute)
+    DEFINE_ACCESSOR(DeleteProcThreadAttributeList)
+
+private:
+    CreatePseudoConsole_t *m_CreatePseudoConsole = nullptr;
+    ResizePseudoConsole_t *m_ResizePseudoConsole = nullptr;
+    ClosePseudoConsole_t *m_ClosePseudoConsole = nullptr;
+    InitializeProcThreadAttributeList_t *m_InitializeProcThreadAttributeList =
+        nullptr;
+    UpdateProcThreadAttribute_t *m_UpdateProcThreadAttribute = nullptr;
+    DeleteProcThreadAttributeList_t *m_DeleteProcThreadAttributeList =
+        nullptr;
+};
+
+#undef GET_KERNEL32_PROC
+#undef DEFINE_ACCESSOR
+
+const PseudoConsoleAPI &api() {
+    static const PseudoConsoleAPI s_api;
+    return s_api;
+}
+
+} // anonymous namespace
+
+bool PseudoConsole::isSupported()
+{
+    return api().valid();
+}
+
+std::unique_ptr<PseudoConsole> PseudoConsole::create(
+        COORD size, HANDLE input, HANDLE output)
+{
+    if (!isSupported()) {
+        return nullptr;
+    }
+    void *hpc = nullptr;
+    const HRESULT hr =
+        api().CreatePseudoConsole()(size, input, output, 0, &hpc);
+    if (FAILED(hr)) {
+        trace("CreatePseudoConsole failed: 0x%08x",
+              static_cast<unsigned int>(hr));
+        return nullptr;
+    }
+    return std::unique_ptr<PseudoConsole>(new PseudoConsole(hpc));
+}
+
+// The caller must stop draining the output pipe (e.g. by closing its end)
+// first.  On some versions of Windows, ClosePseudoConsole waits for conhost
+// to write its final output.
+PseudoConsole::~PseudoConsole()
+{
+    api().ClosePseudoConsole()(m_hpc);
+}
+
+void PseudoConsole::resize(COORD size)
+{
+    const HRESULT hr = api().ResizePseudoConsole()(m_hpc, size);
+    if (FAILED(hr)) {
+        trace("ResizePseudoConsole failed: 0x%08x",
+              static_cast<unsigned int>(hr));
+    }
+}
+
+bool PseudoConsole::initStartupInfo(StartupInfo &sui,
+                                    std::vector<char> &storage)
+{
+    SIZE_T size = 0;
+    api().InitializeProcThreadAttributeList()(nullptr, 1, 0, &size);
+    storage.resize(size);
+    void *const list = storage.data();
+    if (!api().InitializeProcThreadAttributeList()(list, 1, 0, &size)) {
+        trace("InitializeProcThreadAttributeList failed: %u",
+              static_cast<unsigned int>(GetLastError()));
+        return false;
+    }
+    if (!api().UpdateProcThreadAttribute()(
+            list, 0, kProcThreadAttributePseudoConsole,
+            m_hpc, sizeof(m_hpc), nullptr, nullptr)) {
+        trace("UpdateProcThreadAttribute failed: %u",
+              static_cast<unsigned int>(GetLastError()));
+        api().DeleteProcThreadAttributeList()(list);
+        return false;
+    }
+    sui.StartupInfo.cb = sizeof(sui);
+    sui.lpAttributeList = list;
+    return true;
+}
+
+void PseudoConsole::freeStartupInfo(StartupInfo &sui)
+{
+    if (sui.lpAttributeList != nullptr) {
+        api().DeleteProcThreadAttributeList()(sui.lpAttributeList);
+        sui.lpAttributeList = nullptr;
+    }
+}
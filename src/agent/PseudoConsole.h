@@ -0,0 +1,73 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_PSEUDO_CONSOLE_H
+#define AGENT_PSEUDO_CONSOLE_H
+
+#include <windows.h>
+
+#include <memory>
+#include <vector>
+
+// A Windows pseudoconsole (CreatePseudoConsole, in Windows 10 1809 and
+// later).  The pseudoconsole's conhost reads VT input from one pipe and
+// writes VT output to another, so with WINPTY_FLAG_PSEUDOCONSOLE, the agent
+// relays bytes between those pipes and the data pipes instead of scraping.
+//
+// The API is looked up at runtime, since winpty still runs on versions of
+// Windows that lack it.
+class PseudoConsole
+{
+public:
+    // Local copies of the STARTUPINFOEXW declarations, which are hidden when
+    // _WIN32_WINNT targets XP.
+    struct StartupInfo {
+        STARTUPINFOW StartupInfo;
+        void *lpAttributeList;
+    };
+    static const DWORD kExtendedStartupInfoPresent = 0x00080000;
+
+    static bool isSupported();
+
+    // The pseudoconsole reads input from `input` and writes output to
+    // `output`.  It duplicates both, so the caller may close them afterward.
+    // Returns NULL if the pseudoconsole can't be created.
+    static std::unique_ptr<PseudoConsole> create(
+        COORD size, HANDLE input, HANDLE output);
+
+    ~PseudoConsole();
+    void resize(COORD size);
+
+    // Prepares `sui` to start a process attached to the pseudoconsole.  The
+    // attribute list is stored in `storage`, which must outlive the
+    // CreateProcess call.  Returns false if the list can't be built.
+    bool initStartupInfo(StartupInfo &sui, std::vector<char> &storage);
+    static void freeStartupInfo(StartupInfo &sui);
+
+    PseudoConsole(const PseudoConsole &other) = delete;
+    PseudoConsole &operator=(const PseudoConsole &other) = delete;
+
+private:
+    explicit PseudoConsole(void *hpc) : m_hpc(hpc) {}
+    // An HPCON, which older SDK headers don't define.
+    void *m_hpc = nullptr;
+};
+
+#endif // AGENT_PSEUDO_CONSOLE_H
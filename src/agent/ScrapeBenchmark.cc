@@ -0,0 +1,194 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Microbenchmarks for the CPU-bound parts of a scrape, using synthetic
+// CHAR_INFO frames rather than a console:
+//  - summarizing each line read from the console, as largeConsoleRead does
+//    for scanForDirtyLines (the attribute mask, line hash, and blank check)
+//  - ConsoleLine::detectChangeAndSetLine
+//  - Terminal::sendLine, writing into a pipe that discards its output
+// Each reports millions of cells per second.
+//
+// Build it with the agent's Terminal, ConsoleLine, CharInfoScan, EtwTrace,
+// Profiler, NamedPipe, ChunkedQueue, and UnicodeEncoding code, and the shared
+// CpuFeatures, DebugClient, and WinptyAssert code.
+
+#define NAMED_PIPE_TESTING
+
+#include <windows.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "CharInfoScan.h"
+#include "ConsoleLine.h"
+#include "NamedPipe.h"
+#include "Terminal.h"
+#include "../shared/TimeMeasurement.h"
+
+static const int kWidth = 120;
+static const int kHeight = 50;
+static const int kFrames = 16;
+static const double kMinSeconds = 0.5;
+
+// Frames of the (simulated) console window.  Consecutive frames differ in a
+// few cells of every line, like a busy console between scrapes.
+typedef std::vector<CHAR_INFO> Frame;
+
+static CHAR_INFO makeCell(wchar_t ch, WORD attr)
+{
+    CHAR_INFO ret;
+    ret.Char.UnicodeChar = ch;
+    ret.Attributes = attr;
+    return ret;
+}
+
+static Frame makeFrame(const char *kind, int seed)
+{
+    Frame ret(kWidth * kHeight);
+    for (int y = 0; y < kHeight; ++y) {
+        CHAR_INFO *line = &ret[y * kWidth];
+        for (int x = 0; x < kWidth; ++x) {
+            // Most of each line stays the same from frame to frame.
+            const int v = (x % 17 == y % 17) ? x + y + seed : x + y;
+            if (!strcmp(kind, "ascii")) {
+                line[x] = makeCell(L'!' + v % 94, 7);
+            } else if (!strcmp(kind, "color")) {
+                line[x] = makeCell(L'a' + v % 26,
+                                   static_cast<WORD>((v * 7 + seed) % 256));
+            } else if (!strcmp(kind, "surrogate")) {
+                // A surrogate pair (U+1F600 and up) takes two cells.
+                const unsigned int code =
+                    0x1F600 + (x / 2 + v) % 64 - 0x10000;
+                const unsigned int unit = (x % 2 == 0)
+                    ? 0xD800 + (code >> 10)
+                    : 0xDC00 + (code & 0x3FF);
+                line[x] = makeCell(static_cast<wchar_t>(unit), 7);
+            } else {
+                // Full-width CJK, with the leading/trailing byte attributes.
+                const int col = x / 2;
+                const wchar_t ch = static_cast<wchar_t>(
+                    0x4E00 + (col + (col % 9 == y % 9 ? seed : 0) + y) % 2000);
+                line[x] = makeCell(ch, (x % 2 == 0) ? 0x107 : 0x207);
+            }
+        }
+    }
+    return ret;
+}
+
+template <typename F>
+static void runBenchmark(const char *name, const char *kind, F func)
+{
+    int64_t cells = 0;
+    TimeMeasurement tm;
+    double elapsed = 0.0;
+    do {
+        cells += func();
+    } while ((elapsed = tm.elapsed()) < kMinSeconds);
+    printf("%-12s %-10s %9.2f Mcells/s\n",
+           name, kind, cells / elapsed / 1000000.0);
+}
+
+static void benchmarkKind(const char *kind)
+{
+    std::vector<Frame> frames;
+    for (int i = 0; i < kFrames; ++i) {
+        frames.push_back(makeFrame(kind, i));
+    }
+
+    // The per-line summary computed while reading the console.
+    {
+        Frame buffer(kWidth * kHeight);
+        int frameIndex = 0;
+        runBenchmark("scan", kind, [&]() -> int64_t {
+            buffer = frames[frameIndex++ % kFrames];
+            int dirtyLines = 0;
+            for (int y = 0; y < kHeight; ++y) {
+                CHAR_INFO *line = &buffer[y * kWidth];
+                if (charInfoAnyAttributes(line, kWidth, 0xFF00)) {
+                    charInfoMaskAttributes(line, kWidth, 0x00FF);
+                }
+                volatile uint64_t hash = charInfoLineHash(line, kWidth);
+                (void)hash;
+                if (y == 0 ||
+                        !charInfoLineBlank(line, kWidth, line[-1].Attributes)) {
+                    dirtyLines = y + 1;
+                }
+            }
+            return dirtyLines > 0 ? kWidth * kHeight : 0;
+        });
+    }
+
+    // Diffing each line against the previous frame's.
+    {
+        std::vector<ConsoleLine> lines(kHeight);
+        std::vector<uint64_t> hashes(kFrames * kHeight);
+        for (int i = 0; i < kFrames; ++i) {
+            for (int y = 0; y < kHeight; ++y) {
+                hashes[i * kHeight + y] =
+                    charInfoLineHash(&frames[i][y * kWidth], kWidth);
+            }
+        }
+        int frameIndex = 0;
+        runBenchmark("consoleline", kind, [&]() -> int64_t {
+            const int i = frameIndex++ % kFrames;
+            for (int y = 0; y < kHeight; ++y) {
+                lines[y].detectChangeAndSetLine(
+                    &frames[i][y * kWidth], kWidth, hashes[i * kHeight + y]);
+            }
+            return kWidth * kHeight;
+        });
+    }
+
+    // Encoding each changed line for the terminal.
+    {
+        NamedPipe &sink = NamedPipe::createSink();
+        Terminal terminal(sink, false, true);
+        int frameIndex = 0;
+        int64_t bytes = 0;
+        runBenchmark("terminal", kind, [&]() -> int64_t {
+            const int i = frameIndex++ % kFrames;
+            const Frame &prev = frames[(i + kFrames - 1) % kFrames];
+            for (int y = 0; y < kHeight; ++y) {
+                terminal.sendLine(y, &frames[i][y * kWidth], kWidth, -1,
+                                  &prev[y * kWidth], kWidth);
+            }
+            terminal.flushFrame();
+            bytes += sink.discardOutput();
+            return kWidth * kHeight;
+        });
+        printf("%-12s %-10s %9.2f bytes/frame\n",
+               "", "", static_cast<double>(bytes) / frameIndex);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *const kinds[] = { "ascii", "color", "surrogate", "fullwidth" };
+    for (const char *kind : kinds) {
+        if (argc < 2 || !strcmp(argv[1], kind)) {
+            benchmarkKind(kind);
+        }
+    }
+    return 0;
+}
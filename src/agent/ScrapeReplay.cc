@@ -0,0 +1,173 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Replays a ConsoleTrace recorded by the agent's "console_trace" debug flag
+// (e.g. WINPTY_DEBUG=console_trace) through a Scraper and Terminal, with no
+// console, and reports the time spent scraping and the terminal output size.
+// The output is discarded.  Because the replay is deterministic, the numbers
+// can be compared across changes to the scraping, diffing, and encoding
+// code.
+//
+// Usage: ScrapeReplay TRACE [-flags HEX] [-repeat N]
+// -flags replaces the recorded WINPTY_FLAG_xxx bits, e.g. to compare output
+// modes on the same recording.
+//
+// Build it with -DWIN32_CONSOLE_TESTING and the agent's Scraper, Terminal,
+// ConsoleTrace, ConsoleLine, ConsoleSnapshot, ConsoleFont, CharInfoScan,
+// LargeConsoleRead, EtwTrace, Profiler, FullWidthTable, HistoryStore,
+// NamedPipe, ChunkedQueue, and Win32Console code, and the shared CpuFeatures, DebugClient,
+// StringBuilder, and WinptyAssert code.
+
+#define NAMED_PIPE_TESTING
+
+#include <windows.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <memory>
+#include <string>
+
+#include "../include/winpty_constants.h"
+#include "../shared/TimeMeasurement.h"
+
+#include "ConsoleSnapshot.h"
+#include "ConsoleTrace.h"
+#include "NamedPipe.h"
+#include "Profiler.h"
+#include "Scraper.h"
+#include "Terminal.h"
+#include "Win32Console.h"
+
+static bool replayOnce(const std::wstring &path, bool overrideFlags,
+                       uint64_t agentFlags)
+{
+    auto trace = ConsoleTrace::openReplay(path);
+    if (trace == nullptr) {
+        fprintf(stderr, "Error: could not read the trace\n");
+        return false;
+    }
+    const ConsoleTrace::Options &options = trace->options();
+    if (!overrideFlags) {
+        agentFlags = options.agentFlags;
+    }
+
+    // Derive the settings from the flags as the Agent constructor does.
+    const bool logOutput = (agentFlags & WINPTY_FLAG_LOG_OUTPUT) != 0;
+    const bool plainMode =
+        (agentFlags & WINPTY_FLAG_PLAIN_OUTPUT) != 0 || logOutput;
+    const bool cellStream =
+        (agentFlags & WINPTY_FLAG_CELL_STREAM_OUTPUT) != 0;
+    const bool outputColor =
+        !plainMode || ((agentFlags & WINPTY_FLAG_COLOR_ESCAPES) && !logOutput);
+    const bool synchronizedOutput =
+        (agentFlags & WINPTY_FLAG_SYNCHRONIZED_OUTPUT) != 0;
+    const bool terminalReflow =
+        (agentFlags & WINPTY_FLAG_TERMINAL_REFLOW) != 0 &&
+        !plainMode && !cellStream;
+
+    Win32Console console((Win32Console::Detached()));
+    console.setNewW10(options.newW10 != 0);
+    auto buffer = trace->createReplayBuffer();
+    NamedPipe &sink = NamedPipe::createSink();
+    std::unique_ptr<Terminal> terminal(new Terminal(
+        sink, plainMode, outputColor, synchronizedOutput, cellStream));
+    Scraper scraper(console, *buffer, std::move(terminal),
+                    Coord(options.cols, options.rows),
+                    options.bufferLineCount,
+                    (agentFlags & WINPTY_FLAG_LEGACY_TENTATIVE_SCRAPE) != 0,
+                    (agentFlags & WINPTY_FLAG_FINGERPRINT_SCROLL) != 0,
+                    terminalReflow);
+    scraper.setScrollbackBudget(options.scrollbackBudget);
+    scraper.setTextOnlyReads(!outputColor);
+    scraper.setTrimWideReads(
+        (agentFlags & WINPTY_FLAG_TRIM_WIDE_READS) != 0);
+    scraper.terminal().setRepeatCompression(
+        (agentFlags & WINPTY_FLAG_REPEAT_CHAR_OUTPUT) != 0);
+    scraper.terminal().setLogMode(logOutput);
+    sink.discardOutput();
+
+    int64_t scrapes = 0;
+    int64_t outputBytes = 0;
+    double elapsed = 0.0;
+    ChangedRegion changed;
+    while (trace->nextScrape(changed)) {
+        ConsoleSnapshot snapshot(nullptr);
+        ConsoleScreenBufferInfo info;
+        TimeMeasurement tm;
+        {
+            Win32Console::FreezeGuard guard(console, console.frozen());
+            scraper.scrapeBuffer(*buffer, snapshot, info, changed);
+        }
+        elapsed += tm.elapsed();
+        outputBytes += sink.discardOutput();
+        ++scrapes;
+    }
+
+    printf("%8lld scrapes %10.1f ms %8.1f us/scrape %10lld bytes "
+           "%8.1f bytes/scrape\n",
+           static_cast<long long>(scrapes),
+           elapsed * 1000.0,
+           scrapes == 0 ? 0.0 : elapsed * 1000000.0 / scrapes,
+           static_cast<long long>(outputBytes),
+           scrapes == 0 ? 0.0 : static_cast<double>(outputBytes) / scrapes);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *tracePath = nullptr;
+    bool overrideFlags = false;
+    uint64_t agentFlags = 0;
+    int repeat = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-flags") && i + 1 < argc) {
+            overrideFlags = true;
+            agentFlags = _strtoui64(argv[++i], nullptr, 16);
+        } else if (!strcmp(argv[i], "-repeat") && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (tracePath == nullptr) {
+            tracePath = argv[i];
+        } else {
+            fprintf(stderr, "Error: unrecognized argument: '%s'\n", argv[i]);
+            return 1;
+        }
+    }
+    if (tracePath == nullptr) {
+        fprintf(stderr, "Usage: %s TRACE [-flags HEX] [-repeat N]\n",
+                argv[0]);
+        return 1;
+    }
+    wchar_t path[MAX_PATH];
+    if (!MultiByteToWideChar(CP_ACP, 0, tracePath, -1, path, MAX_PATH)) {
+        fprintf(stderr, "Error: invalid path: '%s'\n", tracePath);
+        return 1;
+    }
+    // With WINPTY_DEBUG=trace,profile, the replay's zone totals are traced.
+    initProfiler();
+    for (int i = 0; i < repeat; ++i) {
+        if (!replayOnce(path, overrideFlags, agentFlags)) {
+            return 1;
+        }
+    }
+    dumpProfile("replay");
+    return 0;
+}
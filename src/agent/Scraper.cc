@@ -23,19 +23,33 @@
 #include <windows.h>
 
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <utility>
 
+#include "../shared/DebugClient.h"
+#include "../shared/TimeMeasurement.h"
 #include "../shared/WinptyAssert.h"
 #include "../shared/winpty_snprintf.h"
 
+#include "CharInfoScan.h"
+#include "ConsoleBuffer.h"
 #include "ConsoleFont.h"
+#include "ConsoleSnapshot.h"
+#include "EtwTrace.h"
+#include "HistoryStore.h"
+#include "Profiler.h"
 #include "Win32Console.h"
-#include "Win32ConsoleBuffer.h"
 
 namespace {
 
+// WINPTY_FLAG_TRIM_WIDE_READS: the columns read past the text's recent
+// extent, and how often the whole width is read to check it.
+const int kTrimReadMargin = 8;
+const DWORD kTrimCheckIntervalMs = 250;
+
 template <typename T>
 T constrained(T min, T val, T max) {
     ASSERT(min <= max);
@@ -44,20 +58,63 @@ T constrained(T min, T val, T max) {
 
 } // anonymous namespace
 
+int maxConsoleHeight(int bufferLineCount)
+{
+    return std::min(MAX_CONSOLE_HEIGHT,
+                    constrained(WINPTY_BUFFER_LINES_MIN,
+                                bufferLineCount,
+                                WINPTY_BUFFER_LINES_MAX)
+                        - MIN_SCROLLBACK_LINES);
+}
+
 Scraper::Scraper(
         Win32Console &console,
-        Win32ConsoleBuffer &buffer,
+        ConsoleBuffer &buffer,
         std::unique_ptr<Terminal> terminal,
-        Coord initialSize) :
+        Coord initialSize,
+        int bufferLineCount,
+        bool legacyTentativeScrape,
+        bool fingerprintScroll,
+        bool terminalReflow,
+        bool initBuffer) :
     m_console(console),
     m_terminal(std::move(terminal)),
+    m_bufferLineCount(constrained(WINPTY_BUFFER_LINES_MIN,
+                                  bufferLineCount,
+                                  WINPTY_BUFFER_LINES_MAX)),
+    m_legacyTentativeScrape(legacyTentativeScrape),
+    m_fingerprintScroll(fingerprintScroll),
+    m_terminalReflow(terminalReflow),
     m_ptySize(initialSize)
 {
+    std::fill(m_syncFingerprint, m_syncFingerprint + SYNC_FINGERPRINT_LEN, 0);
     m_consoleBuffer = &buffer;
 
-    resetConsoleTracking(Terminal::OmitClear, buffer.windowRect().top());
+    // A buffer that's already set up may hold output from its first row on,
+    // which the terminal hasn't seen.
+    resetConsoleTracking(Terminal::OmitClear,
+                         initBuffer ? buffer.windowRect().top() : 0);
 
-    m_bufferData.resize(BUFFER_LINE_COUNT);
+    m_bufferData.resize(m_bufferLineCount);
+
+    if (initBuffer) {
+        m_initialFontSetupUs =
+            setupBuffer(console, buffer, initialSize, bufferLineCount);
+    }
+
+    m_consoleBuffer = nullptr;
+}
+
+// Gives a new screen buffer the initial size that a Scraper expects, and
+// blanks it.  Returns the microseconds spent setting the font.
+int64_t Scraper::setupBuffer(Win32Console &console,
+                             ConsoleBuffer &buffer,
+                             Coord initialSize,
+                             int bufferLineCount)
+{
+    bufferLineCount = constrained(WINPTY_BUFFER_LINES_MIN,
+                                  bufferLineCount,
+                                  WINPTY_BUFFER_LINES_MAX);
 
     // Setup the initial screen buffer and window size.
     //
@@ -71,9 +128,11 @@ Scraper::Scraper(
     // While the small font intends to support large buffers, a user could
     // still hit a limit imposed by their monitor width, so cap the new window
     // size to GetLargestConsoleWindowSize().
-    setSmallFont(buffer.conout(), initialSize.X, m_console.isNewW10());
+    TimeMeasurement fontTime;
+    setSmallFont(buffer.conout(), initialSize.X, console.isNewW10());
+    const int64_t fontUs = fontTime.elapsedUs();
     buffer.moveWindow(SmallRect(0, 0, 1, 1));
-    buffer.resizeBufferRange(Coord(initialSize.X, BUFFER_LINE_COUNT));
+    buffer.resizeBufferRange(Coord(initialSize.X, bufferLineCount));
     const auto largest = GetLargestConsoleWindowSize(buffer.conout());
     buffer.moveWindow(SmallRect(
         0, 0,
@@ -83,10 +142,9 @@ Scraper::Scraper(
 
     // For the sake of the color translation heuristic, set the console color
     // to LtGray-on-Black.
-    buffer.setTextAttribute(Win32ConsoleBuffer::kDefaultAttributes);
-    buffer.clearAllLines(m_consoleBuffer->bufferInfo());
-
-    m_consoleBuffer = nullptr;
+    buffer.setTextAttribute(ConsoleBuffer::kDefaultAttributes);
+    buffer.clearAllLines(buffer.bufferInfo());
+    return fontUs;
 }
 
 Scraper::~Scraper()
@@ -94,37 +152,95 @@ Scraper::~Scraper()
 }
 
 // Whether or not the agent is frozen on entry, it will be frozen on exit.
-void Scraper::resizeWindow(Win32ConsoleBuffer &buffer,
+void Scraper::resizeWindow(ConsoleBuffer &buffer,
                            Coord newSize,
                            ConsoleScreenBufferInfo &finalInfoOut)
 {
+    ConsoleSnapshot snapshot(GetStdHandle(STD_INPUT_HANDLE));
     m_consoleBuffer = &buffer;
+    m_snapshot = &snapshot;
     m_ptySize = newSize;
     syncConsoleContentAndSize(true, finalInfoOut);
+    m_terminal->flushFrame();
     m_consoleBuffer = nullptr;
+    m_snapshot = nullptr;
 }
 
-// This function may freeze the agent, but it will not unfreeze it.
-void Scraper::scrapeBuffer(Win32ConsoleBuffer &buffer,
-                           ConsoleScreenBufferInfo &finalInfoOut)
+// Reads the cells of the console window, as the scraper would see them, for a
+// screen snapshot.  Nothing is sent to the terminal.  The caller should
+// freeze the console so that the window can't move during the read.
+void Scraper::readWindowSnapshot(ConsoleBuffer &buffer,
+                                 ConsoleScreenBufferInfo &infoOut,
+                                 bool &cursorVisibleOut,
+                                 LargeConsoleReadBuffer &out)
+{
+    ConsoleSnapshot snapshot(GetStdHandle(STD_INPUT_HANDLE));
+    m_consoleBuffer = &buffer;
+    m_snapshot = &snapshot;
+    infoOut = buffer.bufferInfo();
+    cursorVisibleOut = true;
+    CONSOLE_CURSOR_INFO cursorInfo = {};
+    if (GetConsoleCursorInfo(buffer.conout(), &cursorInfo)) {
+        cursorVisibleOut = cursorInfo.bVisible != 0;
+    }
+    largeConsoleRead(out, buffer, infoOut.windowRect(), attributesMask());
+    m_consoleBuffer = nullptr;
+    m_snapshot = nullptr;
+}
+
+// This function may freeze the agent.  It only unfreezes it if it froze the
+// agent itself, and then only once it has finished with the console, so the
+// freeze doesn't last through the terminal encoding.  Returns true if any
+// changed lines were sent to the terminal.
+//
+// If the caller knows which part of the buffer has changed since the
+// previous scrape, it can pass that region.  In scrolling mode, the scraper
+// then won't reread the unchanged rows at the top of the window, and in
+// direct mode, it reads only the changed rows and columns.  If no cell
+// changed, only the cursor is updated.
+bool Scraper::scrapeBuffer(ConsoleBuffer &buffer,
+                           ConsoleSnapshot &snapshot,
+                           ConsoleScreenBufferInfo &finalInfoOut,
+                           const ChangedRegion &changed)
 {
+    PROFILE_ZONE("scrape.buffer");
     m_consoleBuffer = &buffer;
-    syncConsoleContentAndSize(false, finalInfoOut);
+    m_snapshot = &snapshot;
+    m_scrapeCount++;
+    m_sentLines = false;
+    // A repaint rereads the whole window, so the changed region doesn't
+    // matter.
+    m_changed = m_repaintRequested ? ChangedRegion() : changed;
+    if (m_repaintRequested || !updateCursorOnly(finalInfoOut)) {
+        syncConsoleContentAndSize(false, finalInfoOut);
+    }
+    m_terminal->flushFrame();
+    TRACE_CAT(kTraceScrape, "scrapeBuffer: firstChangedRow=%d sentLines=%d",
+        changed.top, m_sentLines ? 1 : 0);
+    m_changed = ChangedRegion();
     m_consoleBuffer = nullptr;
+    m_snapshot = nullptr;
+    return m_sentLines;
 }
 
 void Scraper::resetConsoleTracking(
     Terminal::SendClearFlag sendClear, int64_t scrapedLineCount)
 {
+    TRACE_CAT(kTraceScrape, "resetConsoleTracking: scrapedLineCount=%lld",
+        static_cast<long long>(scrapedLineCount));
+    m_consoleResets++;
     for (ConsoleLine &line : m_bufferData) {
         line.reset();
     }
     m_syncRow = -1;
+    m_syncIsFingerprint = false;
     m_scrapedLineCount = scrapedLineCount;
     m_scrolledCount = 0;
     m_maxBufferedLine = -1;
     m_dirtyWindowTop = -1;
     m_dirtyLineCount = 0;
+    m_directScrapeSize = Coord();
+    m_frameValid = false;
     m_terminal->reset(sendClear, m_scrapedLineCount);
 }
 
@@ -137,28 +253,63 @@ void Scraper::markEntireWindowDirty(const SmallRect &windowRect)
                                 windowRect.top() + windowRect.height());
 }
 
+// Blanks the console buffer, moves the window and cursor to the top, and
+// clears the terminal to match.
+void Scraper::clearConsole(ConsoleBuffer &buffer)
+{
+    m_consoleBuffer = &buffer;
+    const ConsoleScreenBufferInfo info = buffer.bufferInfo();
+    const SmallRect windowRect = info.windowRect();
+    buffer.clearAllLines(info);
+    buffer.moveWindow(SmallRect(0, 0, windowRect.width(), windowRect.height()));
+    buffer.setCursorPosition(Coord(0, 0));
+    resetConsoleTracking(Terminal::SendClear, 0);
+    m_terminal->flushFrame();
+    m_consoleBuffer = nullptr;
+}
+
+// Frees the buffers that only hold data during a scrape.  The tracked lines
+// are kept, since they're needed to tell what changed.
+void Scraper::releaseScratchBuffers()
+{
+    m_readBuffer.release();
+    m_syncColumnBuffer.release();
+    std::vector<CHAR_INFO>().swap(m_replacedLineBuffer);
+}
+
+size_t Scraper::lineMemoryUsage() const
+{
+    size_t ret = m_bufferData.capacity() * sizeof(ConsoleLine);
+    for (const auto &line : m_bufferData) {
+        ret += line.memoryUsage();
+    }
+    return ret;
+}
+
+size_t Scraper::readBufferMemoryUsage() const
+{
+    return m_readBuffer.memoryUsage() +
+        m_frameBuffer.memoryUsage() +
+        m_staleFrameRows.capacity() +
+        m_syncColumnBuffer.memoryUsage() +
+        m_replacedLineBuffer.capacity() * sizeof(CHAR_INFO);
+}
+
 // Scan the screen buffer and advance the dirty line count when we find
 // non-empty lines.
 void Scraper::scanForDirtyLines(const SmallRect &windowRect)
 {
-    const int w = m_readBuffer.rect().width();
     ASSERT(m_dirtyLineCount >= 1);
-    const CHAR_INFO *const prevLine =
-        m_readBuffer.lineData(m_dirtyLineCount - 1);
-    WORD prevLineAttr = prevLine[w - 1].Attributes;
+    // largeConsoleRead already compared each line against the previous
+    // line's last attribute.  The read starts at or above the line before
+    // m_dirtyLineCount.
+    ASSERT(m_readBuffer.rect().top() < m_dirtyLineCount);
     const int stopLine = windowRect.top() + windowRect.height();
 
     for (int line = m_dirtyLineCount; line < stopLine; ++line) {
-        const CHAR_INFO *lineData = m_readBuffer.lineData(line);
-        for (int col = 0; col < w; ++col) {
-            const WORD colAttr = lineData[col].Attributes;
-            if (lineData[col].Char.UnicodeChar != L' ' ||
-                    colAttr != prevLineAttr) {
-                m_dirtyLineCount = line + 1;
-                break;
-            }
+        if (!m_readBuffer.lineBlank(line)) {
+            m_dirtyLineCount = line + 1;
         }
-        prevLineAttr = lineData[w - 1].Attributes;
     }
 }
 
@@ -172,8 +323,8 @@ void Scraper::clearBufferLines(
     for (int row = firstRow; row < firstRow + count; ++row) {
         const int64_t bufLine = row + m_scrolledCount;
         m_maxBufferedLine = std::max(m_maxBufferedLine, bufLine);
-        m_bufferData[bufLine % BUFFER_LINE_COUNT].blank(
-            Win32ConsoleBuffer::kDefaultAttributes);
+        m_bufferData[bufLine % m_bufferLineCount].blank(
+            ConsoleBuffer::kDefaultAttributes);
     }
 }
 
@@ -183,6 +334,94 @@ static bool cursorInWindow(const ConsoleScreenBufferInfo &info)
            info.dwCursorPosition.Y <= info.srWindow.Bottom;
 }
 
+// In direct mode, returns true if the terminal will still display the rows
+// it was sent after resizing to cols x rows.  Terminals differ in how they
+// handle a resize.  Many rewrap lines that no longer fit, and a shorter
+// terminal may scroll its content up.  The rows are safe to keep if the
+// terminal doesn't get shorter and the content of every row fits in both
+// widths.  When the height grows, the new rows are appended at the bottom.
+bool Scraper::canKeepDirectLines(int cols, int rows)
+{
+    const Coord sent = m_directScrapeSize;
+    if (sent.Y <= 0 || rows < sent.Y) {
+        return false;
+    }
+    if (cols == sent.X) {
+        return true;
+    }
+    const int width = std::min<int>(cols, sent.X);
+    for (int line = 0; line < sent.Y; ++line) {
+        const int contentWidth = m_bufferData[line].contentWidth();
+        if (contentWidth < 0 || contentWidth > width) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// With WINPTY_FLAG_TERMINAL_REFLOW, a narrower terminal splits each line
+// that no longer fits into several.  The Windows 10 console rewraps its
+// lines too, so the next scrape would otherwise find every line below the
+// first split one moved down, and resend them.  Instead, split the tracked
+// lines from `top` (a screen-buffer row) down the same way, so the scrape
+// only resends the lines that the console wrapped differently.  (The
+// console also rejoins lines it had wrapped itself, which it can't report,
+// so those lines are resent.)
+void Scraper::reflowTrackedLines(int top, int cols)
+{
+    ASSERT(!m_directMode && cols >= 1);
+    const int bottom = m_dirtyLineCount;
+    if (bottom <= top) {
+        return;
+    }
+    std::vector<int> lineCounts;
+    std::vector<ConsoleLine> reflowed;
+    std::vector<CHAR_INFO> cells;
+    for (int row = top; row < bottom; ++row) {
+        const ConsoleLine &line =
+            m_bufferData[(row + m_scrolledCount) % m_bufferLineCount];
+        if (line.data(cells) == nullptr) {
+            // The terminal's content is unknown, so resend as usual.
+            return;
+        }
+        const int length = line.length();
+        const int width = std::min(line.contentWidth(), length);
+        const int count = std::max(1, (width + cols - 1) / cols);
+        lineCounts.push_back(count);
+        if (count == 1) {
+            // ConsoleLine already handles a line that got shorter.
+            reflowed.push_back(line);
+            continue;
+        }
+        const int cellCount = count * cols;
+        if (cellCount > length) {
+            CHAR_INFO blank = cells[length - 1];
+            blank.Char.UnicodeChar = L' ';
+            cells.resize(std::max<size_t>(cells.size(), cellCount));
+            std::fill(cells.begin() + length, cells.begin() + cellCount,
+                      blank);
+        }
+        for (int i = 0; i < count; ++i) {
+            reflowed.push_back(ConsoleLine());
+            reflowed.back().setLine(&cells[i * cols], cols);
+        }
+    }
+    const int total = static_cast<int>(reflowed.size());
+    if (total == bottom - top || top + total > m_bufferLineCount) {
+        // Nothing was split, or the lines no longer fit in the buffer.
+        return;
+    }
+    for (int i = 0; i < total; ++i) {
+        m_bufferData[(top + i + m_scrolledCount) % m_bufferLineCount] =
+            reflowed[i];
+    }
+    m_dirtyLineCount = top + total;
+    m_maxBufferedLine = std::max<int64_t>(
+        m_maxBufferedLine, top + total - 1 + m_scrolledCount);
+    m_changed = ChangedRegion();
+    m_terminal->noteLinesReflowed(top + m_scrolledCount, lineCounts, cols);
+}
+
 void Scraper::resizeImpl(const ConsoleScreenBufferInfo &origInfo)
 {
     ASSERT(m_console.frozen());
@@ -206,19 +445,30 @@ void Scraper::resizeImpl(const ConsoleScreenBufferInfo &origInfo)
         const SmallRect origWindowRect = origInfo.windowRect();
 
         if (m_directMode) {
-            for (ConsoleLine &line : m_bufferData) {
-                line.reset();
+            // Only the rows the terminal hasn't displayed need sending,
+            // unless the resize could move the displayed content.
+            materializeDirectFrame();
+            const int keep = canKeepDirectLines(cols, rows)
+                ? m_directScrapeSize.Y : 0;
+            for (int line = keep; line < m_bufferLineCount; ++line) {
+                m_bufferData[line].reset();
             }
         } else {
             m_consoleBuffer->clearLines(0, origWindowRect.Top, origInfo);
             clearBufferLines(0, origWindowRect.Top);
+            // A fingerprint wouldn't survive Windows 10 rewrapping the
+            // lines, so always place a real marker here.
             if (m_syncRow != -1) {
                 createSyncMarker(std::min(
                     m_syncRow,
-                    BUFFER_LINE_COUNT - rows
+                    m_bufferLineCount - rows
                                       - SYNC_MARKER_LEN
                                       - SYNC_MARKER_MARGIN));
             }
+            if (m_terminalReflow && m_console.isNewW10() &&
+                    cols < origBufferSize.X) {
+                reflowTrackedLines(origWindowRect.Top, cols);
+            }
         }
 
         finalBufferSize = Coord(
@@ -320,31 +570,35 @@ void Scraper::syncConsoleContentAndSize(
     bool forceResize,
     ConsoleScreenBufferInfo &finalInfoOut)
 {
+    EtwScope etwScope(kEtwSyncConsole, forceResize ? 1 : 0);
+    PROFILE_ZONE("scrape.sync");
+
     // We'll try to avoid freezing the console by reading large chunks (or
     // all!) of the screen buffer without otherwise attempting to synchronize
-    // with the console application.  We can only do this on Windows 10 and up
-    // because:
+    // with the console application.  By default, we only do this on Windows
+    // 10 and up because:
     //  - Prior to Windows 8, the size of a ReadConsoleOutputW call was limited
     //    by the ~32KB RPC buffer.
     //  - Prior to Windows 10, an out-of-range read region crashes the caller.
     //    (See misc/WindowsBugCrashReader.cc.)
     //
-    if (!m_console.isNewW10() || forceResize) {
+    // With WINPTY_FLAG_LEGACY_TENTATIVE_SCRAPE, older consoles are scraped
+    // tentatively too.  largeConsoleRead already splits reads to fit the RPC
+    // buffer, and the tentative reads recheck the buffer size before each
+    // ReadConsoleOutputW call.
+    const bool canScrapeTentatively =
+        m_console.isNewW10() || m_legacyTentativeScrape;
+    const bool frozenOnEntry = m_console.frozen();
+    if (!canScrapeTentatively || forceResize) {
         m_console.setFrozen(true);
     }
 
     const ConsoleScreenBufferInfo info = m_consoleBuffer->bufferInfo();
-    bool cursorVisible = true;
-    CONSOLE_CURSOR_INFO cursorInfo = {};
-    if (!GetConsoleCursorInfo(GetStdHandle(STD_OUTPUT_HANDLE), &cursorInfo)) {
-        trace("GetConsoleCursorInfo failed");
-    } else {
-        cursorVisible = cursorInfo.bVisible != 0;
-    }
+    const bool cursorVisible = m_snapshot->cursorVisible();
 
     // If an app resizes the buffer height, then we enter "direct mode", where
     // we stop trying to track incremental console changes.
-    const bool newDirectMode = (info.bufferSize().Y != BUFFER_LINE_COUNT);
+    const bool newDirectMode = (info.bufferSize().Y != m_bufferLineCount);
     if (newDirectMode != m_directMode) {
         trace("Entering %s mode", newDirectMode ? "direct" : "scrolling");
         resetConsoleTracking(Terminal::SendClear,
@@ -357,9 +611,23 @@ void Scraper::syncConsoleContentAndSize(
             m_console.setFrozen(true);
             forceResize = true;
         }
+    } else if (m_repaintRequested) {
+        trace("Repainting the terminal");
+        resetConsoleTracking(Terminal::SendClear,
+                             m_directMode ? 0 : info.windowRect().top());
     }
+    m_repaintRequested = false;
+
+    // A resize needs the console again after the scrape, and the resize
+    // caller expects the console to stay frozen.
+    m_unfreezeBeforeEncode = !frozenOnEntry && !forceResize;
 
     if (m_directMode) {
+        // A direct-mode program may resize the buffer at any time, so the
+        // read is only safe on older consoles if the console is frozen.
+        if (needsBoundsCheck()) {
+            m_console.setFrozen(true);
+        }
         // In direct-mode, resizing the console redraws the terminal, so do it
         // before scraping.
         if (forceResize) {
@@ -369,6 +637,10 @@ void Scraper::syncConsoleContentAndSize(
     } else {
         if (!m_console.frozen()) {
             if (!scrollingScrapeOutput(info, cursorVisible, true)) {
+                m_console.noteTentativeScrapeAbort();
+                // The abandoned attempt may have updated the dirty-line
+                // tracking, so don't trust the changed-row hint anymore.
+                m_changed = ChangedRegion();
                 m_console.setFrozen(true);
             }
         }
@@ -384,6 +656,49 @@ void Scraper::syncConsoleContentAndSize(
     }
 
     finalInfoOut = forceResize ? m_consoleBuffer->bufferInfo() : info;
+    m_unfreezeBeforeEncode = false;
+}
+
+// Called once a scrape is done reading and writing the console, and has yet
+// to encode the terminal output.  Everything the encoding needs is already in
+// m_readBuffer, so the console application can continue meanwhile.
+void Scraper::endConsoleAccess()
+{
+    if (m_unfreezeBeforeEncode) {
+        m_console.setFrozen(false);
+    }
+}
+
+// When the event hook reports that no cell changed (e.g. an arrow key moved
+// the cursor at a shell prompt), the terminal only needs the new cursor
+// position, so skip the freeze, the read, and the line compare.  This only
+// applies in scrolling mode, with the window where the previous scrape left
+// it, and with the cursor on a row that scrape already sent.  Anything else
+// (even a new sync marker) takes the full path.
+bool Scraper::updateCursorOnly(ConsoleScreenBufferInfo &infoOut)
+{
+    if (m_changed.top != INT_MAX || m_directMode) {
+        return false;
+    }
+    const ConsoleScreenBufferInfo info = m_consoleBuffer->bufferInfo();
+    const Coord cursor = info.cursorPosition();
+    const SmallRect windowRect = info.windowRect();
+    const int newSyncRow =
+        static_cast<int>(windowRect.top()) - SYNC_MARKER_LEN - SYNC_MARKER_MARGIN;
+    if (info.bufferSize().Y != m_bufferLineCount ||
+            windowRect.top() != m_dirtyWindowTop ||
+            windowRect.top() + m_scrolledCount != m_scrapedLineCount ||
+            cursor.Y >= m_dirtyLineCount ||
+            newSyncRow >= m_syncRow + SYNC_MARKER_LEN + SYNC_MARKER_MARGIN) {
+        return false;
+    }
+    if (m_snapshot->cursorVisible() && windowRect.contains(cursor)) {
+        m_terminal->showTerminalCursor(cursor.X, cursor.Y + m_scrolledCount);
+    } else {
+        m_terminal->hideTerminalCursor();
+    }
+    infoOut = info;
+    return true;
 }
 
 // Try to match Windows' behavior w.r.t. to the LVB attribute flags.  In some
@@ -401,17 +716,11 @@ WORD Scraper::attributesMask()
     const auto WINPTY_COMMON_LVB_REVERSE_VIDEO           = 0x4000u;
     const auto WINPTY_COMMON_LVB_UNDERSCORE              = 0x8000u;
 
-    const auto cp = GetConsoleOutputCP();
+    ASSERT(m_consoleBuffer != nullptr && m_snapshot != nullptr);
+    const auto cp = m_snapshot->outputCodePage();
     const auto isCjk = (cp == 932 || cp == 936 || cp == 949 || cp == 950);
 
-    const DWORD outputMode = [this]{
-        ASSERT(this->m_consoleBuffer != nullptr);
-        DWORD mode = 0;
-        if (!GetConsoleMode(this->m_consoleBuffer->conout(), &mode)) {
-            mode = 0;
-        }
-        return mode;
-    }();
+    const DWORD outputMode = m_snapshot->outputMode(m_consoleBuffer->conout());
     const bool hasEnableLvbGridWorldwide =
         (outputMode & WINPTY_ENABLE_LVB_GRID_WORLDWIDE) != 0;
     const bool hasEnableVtProcessing =
@@ -434,6 +743,7 @@ WORD Scraper::attributesMask()
 void Scraper::directScrapeOutput(const ConsoleScreenBufferInfo &info,
                                  bool consoleCursorVisible)
 {
+    PROFILE_ZONE("scrape.direct");
     const SmallRect windowRect = info.windowRect();
 
     const SmallRect scrapeRect(
@@ -441,7 +751,7 @@ void Scraper::directScrapeOutput(const ConsoleScreenBufferInfo &info,
         std::min<SHORT>(std::min(windowRect.width(), m_ptySize.X),
                         MAX_CONSOLE_WIDTH),
         std::min<SHORT>(std::min(windowRect.height(), m_ptySize.Y),
-                        BUFFER_LINE_COUNT));
+                        m_bufferLineCount));
     const int w = scrapeRect.width();
     const int h = scrapeRect.height();
 
@@ -455,31 +765,300 @@ void Scraper::directScrapeOutput(const ConsoleScreenBufferInfo &info,
         m_terminal->hideTerminalCursor();
     }
 
-    largeConsoleRead(m_readBuffer, *m_consoleBuffer, scrapeRect, attributesMask());
+    // While the window keeps its size, the previous frame stands in for the
+    // tracked lines.  Otherwise, fall back to the lines.
+    const bool useFrame = m_frameValid && m_directScrapeSize == Coord(w, h);
+    if (!useFrame) {
+        materializeDirectFrame();
+    }
 
-    for (int line = 0; line < h; ++line) {
-        const CHAR_INFO *const curLine =
-            m_readBuffer.lineData(scrapeRect.top() + line);
-        ConsoleLine &bufLine = m_bufferData[line];
-        if (bufLine.detectChangeAndSetLine(curLine, w)) {
+    // If the previous scrape covered the same window, and the event hook
+    // knows what changed, read only the changed rows, and only the changed
+    // columns if every such row's previous content is known.
+    int firstLine = 0;
+    int lastLine = h - 1;
+    int firstColumn = 0;
+    int lastColumn = w - 1;
+    const bool partial =
+        m_changed.top != -1 &&
+        m_directScrapeSize == Coord(w, h) &&
+        m_directScrapeOrigin == Coord(scrapeRect.Left, scrapeRect.Top);
+    if (partial) {
+        firstLine = std::max(0, m_changed.top - scrapeRect.Top);
+        lastLine = std::min<int>(h - 1, m_changed.bottom - scrapeRect.Top);
+        firstColumn = std::max(0, m_changed.left - scrapeRect.Left);
+        lastColumn = std::min<int>(w - 1, m_changed.right - scrapeRect.Left);
+        for (int line = firstLine; line <= lastLine; ++line) {
+            const ConsoleLine &bufLine = m_bufferData[line];
+            const bool known = useFrame
+                ? !m_staleFrameRows[line]
+                : bufLine.length() == w && bufLine.contentWidth() >= 0;
+            if (!known) {
+                firstColumn = 0;
+                lastColumn = w - 1;
+                break;
+            }
+        }
+    }
+    const bool narrowed = firstColumn > 0 || lastColumn < w - 1;
+
+    if (firstLine <= lastLine && firstColumn <= lastColumn) {
+        const SmallRect readRect(
+            scrapeRect.Left + firstColumn, scrapeRect.Top + firstLine,
+            lastColumn - firstColumn + 1, lastLine - firstLine + 1);
+        const bool textOnly = m_textOnlyReads && readRect.Left == 0 &&
+            readRect.width() == info.bufferSize().X;
+        largeConsoleRead(m_readBuffer, *m_consoleBuffer, readRect,
+                         attributesMask(), false, textOnly);
+        endConsoleAccess();
+        if (!partial) {
+            detectDirectModeScroll(scrapeRect.top(), w, h, useFrame);
+        }
+        for (int line = firstLine; line <= lastLine; ++line) {
+            const int row = scrapeRect.top() + line;
             const int lineCursorColumn =
                 line == cursorLine ? cursorColumn : -1;
-            m_terminal->sendLine(line, curLine, w, lineCursorColumn);
+            if (useFrame) {
+                sendDirectFrameLine(line, row, w, firstColumn, lastColumn,
+                                    lineCursorColumn, partial);
+                continue;
+            }
+            ConsoleLine &bufLine = m_bufferData[line];
+            const CHAR_INFO *curLine = m_readBuffer.lineData(row);
+            bool changed = false;
+            if (narrowed) {
+                // Merge the changed columns into the line's previous content.
+                const bool known = bufLine.data(m_mergedLineBuffer) != nullptr;
+                ASSERT(known);
+                CHAR_INFO *const merged = m_mergedLineBuffer.data();
+                std::copy(curLine, curLine + (lastColumn - firstColumn + 1),
+                          merged + firstColumn);
+                curLine = merged;
+                changed = bufLine.detectChangeAndSetLine(curLine, w);
+            } else {
+                changed = bufLine.detectChangeAndSetLine(
+                    curLine, w, m_readBuffer.lineHash(row));
+            }
+            if (changed) {
+                m_terminal->sendLine(line, curLine, w, lineCursorColumn,
+                                     bufLine.replacedData(m_replacedLineBuffer),
+                                     bufLine.replacedLength());
+                m_sentLines = true;
+            }
+        }
+        if (!partial) {
+            // The read covers the whole window, and the terminal now shows
+            // it, so it becomes the frame the next scrape is diffed against,
+            // and the old frame's storage takes the next read.
+            m_frameBuffer.swap(m_readBuffer);
+            m_staleFrameRows.assign(h, 0);
+            if (!useFrame) {
+                for (int line = 0; line < h; ++line) {
+                    m_bufferData[line].reset();
+                }
+            }
+            m_frameValid = true;
         }
     }
 
     if (showTerminalCursor) {
         m_terminal->showTerminalCursor(cursorColumn, cursorLine);
     }
+    m_directScrapeSize = Coord(w, h);
+    m_directScrapeOrigin = Coord(scrapeRect.Left, scrapeRect.Top);
+}
+
+// Diffs one row of a direct-mode read against the previous frame, in place,
+// and sends it if it changed.  A full scrape leaves the frame alone, since
+// the read replaces it.  A partial scrape patches the frame to match, and
+// reads only columns [firstColumn, lastColumn] of a row whose previous
+// content is known, unless the read spans the whole row.
+void Scraper::sendDirectFrameLine(int line, int row, int width,
+                                  int firstColumn, int lastColumn,
+                                  int cursorColumn, bool partial)
+{
+    const int frameRow = m_frameBuffer.rect().top() + line;
+    const CHAR_INFO *const prevLine =
+        m_staleFrameRows[line] ? nullptr : m_frameBuffer.lineData(frameRow);
+    const CHAR_INFO *curLine = m_readBuffer.lineData(row);
+    const int readWidth = lastColumn - firstColumn + 1;
+    bool changed = true;
+    if (readWidth < width) {
+        ASSERT(prevLine != nullptr);
+        if (charInfoLinesEqual(prevLine + firstColumn, curLine, readWidth)) {
+            return;
+        }
+        m_mergedLineBuffer.resize(
+            std::max<size_t>(m_mergedLineBuffer.size(), width));
+        CHAR_INFO *const merged = m_mergedLineBuffer.data();
+        std::copy(prevLine, prevLine + width, merged);
+        std::copy(curLine, curLine + readWidth, merged + firstColumn);
+        curLine = merged;
+    } else if (prevLine != nullptr) {
+        changed = m_frameBuffer.lineHash(frameRow) !=
+                m_readBuffer.lineHash(row) ||
+            !charInfoLinesEqual(prevLine, curLine, width);
+    }
+    if (!changed) {
+        return;
+    }
+    m_terminal->sendLine(line, curLine, width, cursorColumn,
+                         prevLine, prevLine != nullptr ? width : 0);
+    m_sentLines = true;
+    if (partial) {
+        m_frameBuffer.updateLine(frameRow, firstColumn,
+                                 m_readBuffer.lineData(row), readWidth);
+        m_staleFrameRows[line] = 0;
+    }
+}
+
+// Copies the direct-mode frame into the tracked lines (e.g. before a resize,
+// which compares lines of different lengths), and stops using it until the
+// next full scrape.
+void Scraper::materializeDirectFrame()
+{
+    if (!m_frameValid) {
+        return;
+    }
+    const SmallRect rect = m_frameBuffer.rect();
+    for (int line = 0; line < rect.height(); ++line) {
+        const int row = rect.top() + line;
+        if (m_staleFrameRows[line]) {
+            m_bufferData[line].reset();
+        } else {
+            m_bufferData[line].setLine(m_frameBuffer.lineData(row),
+                                       rect.width(),
+                                       m_frameBuffer.lineHash(row));
+        }
+    }
+    m_frameValid = false;
+}
+
+// Full-screen programs often scroll part of the screen (e.g. a text editor
+// scrolling its document area).  Look for the largest block of rows that moved
+// vertically, in one direction, between the previously sent rows and the
+// current read buffer.  If there's one, scroll it in the terminal, and shift
+// the ConsoleLine tracking (or the frame) to match, so that the moved rows
+// don't have to be sent again.
+void Scraper::detectDirectModeScroll(int readTop, int width, int height,
+                                     bool useFrame)
+{
+    // Reusing fewer rows than this isn't worth the escape sequences.
+    const int kMinScrollRun = 2;
+    // Bound the work spent on rows that match many others (e.g. blank rows).
+    const int kMaxCandidates = 8;
+
+    const int frameTop = m_frameBuffer.rect().top();
+    const auto rowsEqual = [&](int oldRow, int newRow) -> bool {
+        const CHAR_INFO *const newLine = m_readBuffer.lineData(readTop + newRow);
+        if (useFrame) {
+            return !m_staleFrameRows[oldRow] &&
+                m_frameBuffer.lineHash(frameTop + oldRow) ==
+                    m_readBuffer.lineHash(readTop + newRow) &&
+                charInfoLinesEqual(
+                    m_frameBuffer.lineData(frameTop + oldRow), newLine, width);
+        }
+        return m_bufferData[oldRow].equals(newLine, width);
+    };
+
+    // Only the rows between the first and last changed rows can have moved.
+    int top = 0;
+    while (top < height && rowsEqual(top, top)) {
+        ++top;
+    }
+    int bottom = height;
+    while (bottom > top && rowsEqual(bottom - 1, bottom - 1)) {
+        --bottom;
+    }
+    if (bottom - top <= kMinScrollRun) {
+        return;
+    }
+
+    // A positive shift means the content moved up.
+    int bestShift = 0;
+    int bestRun = 0;
+    for (int direction = 1; direction >= -1; direction -= 2) {
+        int candidates = 0;
+        for (int k = 1; k < bottom - top && candidates < kMaxCandidates; ++k) {
+            const int oldStart = direction > 0 ? top + k : top;
+            const int newStart = direction > 0 ? top : top + k;
+            if (!rowsEqual(oldStart, newStart)) {
+                continue;
+            }
+            ++candidates;
+            int run = 1;
+            while (std::max(oldStart, newStart) + run < bottom &&
+                    rowsEqual(oldStart + run, newStart + run)) {
+                ++run;
+            }
+            if (run > bestRun) {
+                bestRun = run;
+                bestShift = direction * k;
+            }
+        }
+    }
+    if (bestRun < kMinScrollRun) {
+        return;
+    }
+
+    // The scrolled region ends just past the last reused row, and the rows
+    // below it are repainted normally.
+    const int shift = abs(bestShift);
+    const int regionBottom = std::min(bottom, top + shift + bestRun);
+    if (!m_terminal->scrollRegion(top, regionBottom, bestShift)) {
+        return;
+    }
+    if (useFrame) {
+        // The frame's vacated rows hold whatever the terminal scrolled in,
+        // so mark them stale to resend them.
+        const auto first = m_staleFrameRows.begin() + top;
+        const auto last = m_staleFrameRows.begin() + regionBottom;
+        if (bestShift > 0) {
+            m_frameBuffer.moveLines(frameTop + top, frameTop + top + shift,
+                                    regionBottom - top - shift);
+            std::rotate(first, first + shift, last);
+            std::fill(last - shift, last, 1);
+        } else {
+            m_frameBuffer.moveLines(frameTop + top + shift, frameTop + top,
+                                    regionBottom - top - shift);
+            std::rotate(first, last - shift, last);
+            std::fill(first, first + shift, 1);
+        }
+        return;
+    }
+    const auto first = m_bufferData.begin() + top;
+    const auto last = m_bufferData.begin() + regionBottom;
+    if (bestShift > 0) {
+        std::rotate(first, first + shift, last);
+        for (auto it = last - shift; it != last; ++it) {
+            it->reset();
+        }
+    } else {
+        std::rotate(first, last - shift, last);
+        for (auto it = first; it != first + shift; ++it) {
+            it->reset();
+        }
+    }
 }
 
 bool Scraper::scrollingScrapeOutput(const ConsoleScreenBufferInfo &info,
                                     bool consoleCursorVisible,
                                     bool tentative)
 {
+    PROFILE_ZONE("scrape.scrolling");
     const Coord cursor = info.cursorPosition();
     const SmallRect windowRect = info.windowRect();
 
+    // Rows above this one (in screen-buffer coordinates) are known to be
+    // unchanged since the previous scrape, which processed every row from the
+    // top of the window down to the old dirty line count.
+    int unchangedStopRow = -1;
+    if (m_changed.top != -1 && m_dirtyWindowTop == windowRect.top()) {
+        unchangedStopRow = std::min<int64_t>(
+            std::min(m_changed.top, m_dirtyLineCount),
+            m_maxBufferedLine + 1 - m_scrolledCount);
+    }
+
     if (m_syncRow != -1) {
         // If a synchronizing marker was placed into the history, look for it
         // and adjust the scroll count.
@@ -490,13 +1069,20 @@ bool Scraper::scrollingScrapeOutput(const ConsoleScreenBufferInfo &info,
                 // bail out.
                 return false;
             }
-            // Something has happened.  Reset the terminal.
-            trace("Sync marker has disappeared -- resetting the terminal"
-                  " (m_syncCounter=%u)",
-                  m_syncCounter);
-            resetConsoleTracking(Terminal::SendClear, windowRect.top());
+            // Something has happened.  Unless the window's content can be
+            // found among the lines already sent, reset the terminal.
+            if (!resyncByContent(info)) {
+                trace("Sync marker has disappeared -- resetting the terminal"
+                      " (m_syncCounter=%u)",
+                      m_syncCounter);
+                m_syncMarkerResets++;
+                resetConsoleTracking(Terminal::SendClear, windowRect.top());
+            }
+            unchangedStopRow = -1;
         } else if (markerRow != m_syncRow) {
             ASSERT(markerRow < m_syncRow);
+            unchangedStopRow = -1;
+            m_lastSyncShift = m_syncRow - markerRow;
             m_scrolledCount += (m_syncRow - markerRow);
             m_syncRow = markerRow;
             // If the buffer has scrolled, then the entire window is dirty.
@@ -534,10 +1120,13 @@ bool Scraper::scrollingScrapeOutput(const ConsoleScreenBufferInfo &info,
             // The window has moved upward.  This is generally not expected to
             // happen, but the CMD/PowerShell CLS command will move the window
             // to the top as part of clearing everything else in the console.
-            trace("Window moved upward -- resetting the terminal"
-                  " (m_syncCounter=%u)",
-                  m_syncCounter);
-            resetConsoleTracking(Terminal::SendClear, windowRect.top());
+            if (!resyncByContent(info)) {
+                trace("Window moved upward -- resetting the terminal"
+                      " (m_syncCounter=%u)",
+                      m_syncCounter);
+                resetConsoleTracking(Terminal::SendClear, windowRect.top());
+            }
+            unchangedStopRow = -1;
         }
     }
     m_dirtyWindowTop = windowRect.top();
@@ -548,8 +1137,27 @@ bool Scraper::scrollingScrapeOutput(const ConsoleScreenBufferInfo &info,
     ASSERT(m_dirtyLineCount >= 1);
 
     // The first line to scrape, in virtual line coordinates.
-    const int64_t firstVirtLine = std::min(m_scrapedLineCount,
-                                           windowRect.top() + m_scrolledCount);
+    int64_t firstVirtLine = std::min(m_scrapedLineCount,
+                                     windowRect.top() + m_scrolledCount);
+    if (unchangedStopRow != -1) {
+        firstVirtLine = std::max<int64_t>(
+            firstVirtLine,
+            std::min(unchangedStopRow,
+                     windowRect.top() + windowRect.height()) +
+                m_scrolledCount);
+    }
+
+    // During a flood, skip the lines that scrolled past the window since the
+    // last scrape if there are too many, provided the terminal holds none of
+    // the window's lines yet.  The terminal is told once the read succeeds.
+    const int64_t windowVirtTop = windowRect.top() + m_scrolledCount;
+    int64_t skippedCount = 0;
+    if (m_scrollbackBudget > 0 &&
+            windowVirtTop - firstVirtLine > m_scrollbackBudget &&
+            m_maxBufferedLine < windowVirtTop) {
+        skippedCount = windowVirtTop - firstVirtLine;
+        firstVirtLine = windowVirtTop;
+    }
 
     // Read all the data we will need from the console.  Start reading with the
     // first line to scrape, but adjust the the read area upward to account for
@@ -562,13 +1170,34 @@ bool Scraper::scrollingScrapeOutput(const ConsoleScreenBufferInfo &info,
     const int stopReadLine = std::max(windowRect.top() + windowRect.height(),
                                       m_dirtyLineCount);
     ASSERT(firstReadLine >= 0 && stopReadLine > firstReadLine);
-    largeConsoleRead(m_readBuffer,
-                     *m_consoleBuffer,
-                     SmallRect(0, firstReadLine,
-                               std::min<SHORT>(info.bufferSize().X,
-                                               MAX_CONSOLE_WIDTH),
-                               stopReadLine - firstReadLine),
-                     attributesMask());
+    const int bufferWidth =
+        std::min<SHORT>(info.bufferSize().X, MAX_CONSOLE_WIDTH);
+    const SmallRect readRect(0, firstReadLine, bufferWidth,
+                             stopReadLine - firstReadLine);
+    const bool textOnly =
+        m_textOnlyReads && info.bufferSize().X <= MAX_CONSOLE_WIDTH;
+    const int readColumns = textOnly
+        ? bufferWidth
+        : trimmedReadColumns(bufferWidth);
+    bool readOk = largeConsoleRead(m_readBuffer, *m_consoleBuffer, readRect,
+                                   attributesMask(),
+                                   tentative && needsBoundsCheck(),
+                                   textOnly, readColumns);
+    if (readOk && readColumns < bufferWidth &&
+            m_readBuffer.narrowEdgeNotBlank()) {
+        // Some line's text may run past the columns read.
+        readOk = largeConsoleRead(m_readBuffer, *m_consoleBuffer, readRect,
+                                  attributesMask(),
+                                  tentative && needsBoundsCheck());
+        noteFullWidthRead(bufferWidth);
+    } else if (readOk && readColumns == bufferWidth && m_trimWideReads) {
+        noteFullWidthRead(bufferWidth);
+    }
+    if (!readOk) {
+        // The buffer shrank under an unfrozen read.
+        ASSERT(tentative);
+        return false;
+    }
 
     // If we're scraping the buffer without freezing it, we have to query the
     // buffer position data separately from the buffer content, so the two
@@ -589,12 +1218,23 @@ bool Scraper::scrollingScrapeOutput(const ConsoleScreenBufferInfo &info,
 
     if (shouldCreateSyncRow) {
         ASSERT(!tentative);
-        createSyncMarker(newSyncRow);
+        if (!m_fingerprintScroll ||
+                !createSyncFingerprint(newSyncRow,
+                                       m_readBuffer.rect().width())) {
+            createSyncMarker(newSyncRow);
+        }
     }
 
     // At this point, we're finished interacting (reading or writing) the
     // console, and we just need to convert our collected data into terminal
     // output.
+    endConsoleAccess();
+
+    if (skippedCount > 0) {
+        m_skippedLines += skippedCount;
+        m_terminal->skipToLine(m_maxBufferedLine, windowVirtTop);
+        m_maxBufferedLine = windowVirtTop - 1;
+    }
 
     scanForDirtyLines(windowRect);
 
@@ -621,23 +1261,35 @@ bool Scraper::scrollingScrapeOutput(const ConsoleScreenBufferInfo &info,
     for (int64_t line = firstVirtLine; line < stopVirtLine; ++line) {
         const CHAR_INFO *curLine =
             m_readBuffer.lineData(line - m_scrolledCount);
-        ConsoleLine &bufLine = m_bufferData[line % BUFFER_LINE_COUNT];
+        ConsoleLine &bufLine = m_bufferData[line % m_bufferLineCount];
+        // A line past m_maxBufferedLine has never been sent, so the terminal
+        // can't diff against the (unrelated) content of the ConsoleLine slot.
+        bool isNewLine = false;
         if (line > m_maxBufferedLine) {
             m_maxBufferedLine = line;
             sawModifiedLine = true;
+            isNewLine = true;
         }
+        const uint64_t hash = m_readBuffer.lineHash(line - m_scrolledCount);
         if (sawModifiedLine) {
-            bufLine.setLine(curLine, w);
+            bufLine.setLine(curLine, w, hash);
         } else {
-            sawModifiedLine = bufLine.detectChangeAndSetLine(curLine, w);
+            sawModifiedLine = bufLine.detectChangeAndSetLine(curLine, w, hash);
         }
         if (sawModifiedLine) {
             const int lineCursorColumn =
                 line == cursorLine ? cursorColumn : -1;
-            m_terminal->sendLine(line, curLine, w, lineCursorColumn);
+            m_terminal->sendLine(line, curLine, w, lineCursorColumn,
+                                 isNewLine ? nullptr
+                                           : bufLine.replacedData(
+                                                 m_replacedLineBuffer),
+                                 isNewLine ? 0 : bufLine.replacedLength());
+            m_sentLines = true;
         }
     }
 
+    retireScrolledLines(std::min(firstVirtLine, m_scrapedLineCount),
+                        windowRect.top() + m_scrolledCount);
     m_scrapedLineCount = windowRect.top() + m_scrolledCount;
 
     if (showTerminalCursor) {
@@ -647,6 +1299,150 @@ bool Scraper::scrollingScrapeOutput(const ConsoleScreenBufferInfo &info,
     return true;
 }
 
+// Lines above the window are never scraped again, so only their hashes are
+// kept, once the history store (if any) has a copy.
+void Scraper::retireScrolledLines(int64_t firstLine, int64_t stopLine)
+{
+    for (int64_t line = firstLine; line < stopLine; ++line) {
+        ConsoleLine &bufLine = m_bufferData[line % m_bufferLineCount];
+        if (m_historyStore != nullptr) {
+            const CHAR_INFO *const cells = bufLine.data(m_replacedLineBuffer);
+            if (cells != nullptr) {
+                m_historyStore->append(cells, bufLine.length());
+            }
+        }
+        bufLine.dropContent();
+    }
+}
+
+// Called when the sync marker is lost or the window moves upward, which
+// leaves the scroll count unknown.  Looks for a scroll count at which the
+// window's rows line up with lines the terminal already shows, so the scrape
+// can go on from there instead of clearing the terminal and resending the
+// window.  A CLS followed by a redraw of the same screen, for example,
+// comes back at the top of the buffer with the content the terminal has.
+//
+// The window may only land at or below where it was, among lines still on
+// the terminal's screen.  Each candidate is scored by how many of the
+// window's rows match from the top, comparing hashes first, since the
+// scrape resends every row from the first changed one down.  The best one
+// wins if it matches a row with text.  Otherwise, this returns false and
+// leaves the tracking alone.
+bool Scraper::resyncByContent(const ConsoleScreenBufferInfo &info)
+{
+    if (m_dirtyWindowTop == -1) {
+        return false;
+    }
+    const SmallRect windowRect = info.windowRect();
+    const int top = windowRect.top();
+    const int height = windowRect.height();
+    // Scrolling only ever raises the scroll count.
+    const int64_t firstCandidate = std::max<int64_t>(
+        m_dirtyWindowTop + m_scrolledCount, top + m_scrolledCount);
+    if (firstCandidate > m_maxBufferedLine) {
+        return false;
+    }
+    const int width = std::min<SHORT>(info.bufferSize().X, MAX_CONSOLE_WIDTH);
+    if (!largeConsoleRead(m_readBuffer, *m_consoleBuffer,
+                          SmallRect(0, top, width, height),
+                          attributesMask())) {
+        return false;
+    }
+
+    int64_t bestTop = -1;
+    int bestCount = 0;
+    for (int64_t virtTop = firstCandidate; virtTop <= m_maxBufferedLine;
+            ++virtTop) {
+        // Lines past m_maxBufferedLine were never sent, and the limit only
+        // shrinks from here.
+        const int limit = static_cast<int>(
+            std::min<int64_t>(height, m_maxBufferedLine + 1 - virtTop));
+        if (limit <= bestCount) {
+            break;
+        }
+        int count = 0;
+        bool sawText = false;
+        while (count < limit) {
+            const int row = top + count;
+            const ConsoleLine &line =
+                m_bufferData[(virtTop + count) % m_bufferLineCount];
+            if (line.length() != width ||
+                    line.hash() != m_readBuffer.lineHash(row) ||
+                    !line.equals(m_readBuffer.lineData(row), width)) {
+                break;
+            }
+            sawText = sawText || line.contentWidth() > 0;
+            ++count;
+        }
+        if (sawText && count > bestCount) {
+            bestTop = virtTop;
+            bestCount = count;
+        }
+    }
+    if (bestTop == -1) {
+        return false;
+    }
+
+    trace("Resynchronized by content -- window top is line %lld"
+          " (%d of %d rows matched)",
+          static_cast<long long>(bestTop), bestCount, height);
+    m_contentResyncs++;
+    // The lines the window passed over scroll into the terminal's history.
+    retireScrolledLines(m_scrapedLineCount, bestTop);
+    m_syncRow = -1;
+    m_syncIsFingerprint = false;
+    m_scrolledCount = bestTop - top;
+    m_scrapedLineCount = bestTop;
+    m_dirtyWindowTop = top;
+    m_dirtyLineCount = top + height;
+    return true;
+}
+
+// Whether an unfrozen read could run past the end of the buffer and crash the
+// agent, i.e. before Windows 10.
+bool Scraper::needsBoundsCheck()
+{
+    return !m_console.isNewW10();
+}
+
+// With WINPTY_FLAG_TRIM_WIDE_READS, the number of columns the next
+// scrolling-mode read takes, or the buffer's whole width if the last
+// full-width read is too old or was of a different width.
+int Scraper::trimmedReadColumns(int bufferWidth)
+{
+    if (!m_trimWideReads || m_trimColumns <= 0 ||
+            m_trimBufferWidth != bufferWidth ||
+            GetTickCount() - m_trimCheckTick >= kTrimCheckIntervalMs) {
+        return bufferWidth;
+    }
+    return m_trimColumns;
+}
+
+// Finds how far the text in m_readBuffer, just read at full width, reaches.
+// Each line ends in a run of cells identical to its last cell, and a
+// narrowed read must take at least one cell of that run, so that it can
+// fill in the rest.
+void Scraper::noteFullWidthRead(int bufferWidth)
+{
+    const SmallRect rect = m_readBuffer.rect();
+    int needed = 1;
+    for (int line = rect.top(); line < rect.top() + rect.height(); ++line) {
+        const CHAR_INFO *const data = m_readBuffer.lineData(line);
+        int tail = bufferWidth - 1;
+        while (tail > 0 && memcmp(&data[tail - 1], &data[bufferWidth - 1],
+                                  sizeof(CHAR_INFO)) == 0) {
+            --tail;
+        }
+        needed = std::max(needed, tail + 1);
+        if (needed == bufferWidth) {
+            break;
+        }
+    }
+    m_trimColumns = std::min(bufferWidth, needed + kTrimReadMargin);
+    m_trimBufferWidth = bufferWidth;
+    m_trimCheckTick = GetTickCount();
+}
+
 void Scraper::syncMarkerText(CHAR_INFO (&output)[SYNC_MARKER_LEN])
 {
     // XXX: The marker text generated here could easily collide with ordinary
@@ -659,25 +1455,93 @@ void Scraper::syncMarkerText(CHAR_INFO (&output)[SYNC_MARKER_LEN])
     }
 }
 
+// The marker can only move up, and it usually moves by the same amount as in
+// the previous scrape (often zero), so probe that spot first.  The whole
+// column above the marker is only read on a miss.  Each marker's text is
+// unique, so probing out of order can't pick the wrong match.  (A fingerprint
+// isn't guaranteed unique, but repeated content at exactly the predicted spot
+// is unlikely enough to accept.)
 int Scraper::findSyncMarker()
 {
     ASSERT(m_syncRow >= 0);
+    const int kProbeMargin = 32;
+    int found = -1;
+    if (!searchSyncMarker(m_syncRow, m_syncRow, found)) {
+        return -1;
+    }
+    if (found == -1 && m_lastSyncShift > 0) {
+        const int predicted = m_syncRow - m_lastSyncShift;
+        const int top = std::max(0, predicted - kProbeMargin);
+        const int bottom = std::min(m_syncRow - 1, predicted + kProbeMargin);
+        if (top <= bottom && !searchSyncMarker(top, bottom, found)) {
+            return -1;
+        }
+    }
+    if (found == -1 && m_syncRow > 0 &&
+            !searchSyncMarker(0, m_syncRow - 1, found)) {
+        return -1;
+    }
+    return found;
+}
+
+// Searches for the marker at rows [top, bottom], starting at the bottom.
+// Returns false if the column couldn't be read.  A fingerprint that matches
+// at more than one row is treated as lost.
+bool Scraper::searchSyncMarker(int top, int bottom, int &found)
+{
+    found = -1;
+    if (m_syncIsFingerprint) {
+        SmallRect rect(0, top, m_syncFingerprintWidth,
+                       bottom - top + SYNC_FINGERPRINT_LEN);
+        if (!largeConsoleRead(m_syncColumnBuffer, *m_consoleBuffer, rect,
+                              static_cast<WORD>(~0), needsBoundsCheck())) {
+            return false;
+        }
+        for (int i = bottom; i >= top; --i) {
+            if (syncFingerprintAt(i)) {
+                if (found != -1) {
+                    trace("Sync fingerprint is ambiguous (rows %d and %d)",
+                          found, i);
+                    found = -1;
+                    return true;
+                }
+                found = i;
+            }
+        }
+        return true;
+    }
     CHAR_INFO marker[SYNC_MARKER_LEN];
-    CHAR_INFO column[BUFFER_LINE_COUNT];
     syncMarkerText(marker);
-    SmallRect rect(0, 0, 1, m_syncRow + SYNC_MARKER_LEN);
-    m_consoleBuffer->read(rect, column);
-    int i;
-    for (i = m_syncRow; i >= 0; --i) {
+    // With a large buffer, the column can be too tall for a single
+    // ReadConsoleOutputW call, so let largeConsoleRead split it up.
+    SmallRect rect(0, top, 1, bottom - top + SYNC_MARKER_LEN);
+    if (!largeConsoleRead(m_syncColumnBuffer, *m_consoleBuffer, rect,
+                          static_cast<WORD>(~0), needsBoundsCheck())) {
+        return false;
+    }
+    for (int i = bottom; i >= top; --i) {
         int j;
         for (j = 0; j < SYNC_MARKER_LEN; ++j) {
-            if (column[i + j].Char.UnicodeChar != marker[j].Char.UnicodeChar)
+            const CHAR_INFO &ch = *m_syncColumnBuffer.lineData(i + j);
+            if (ch.Char.UnicodeChar != marker[j].Char.UnicodeChar)
                 break;
         }
-        if (j == SYNC_MARKER_LEN)
-            return i;
+        if (j == SYNC_MARKER_LEN) {
+            found = i;
+            return true;
+        }
     }
-    return -1;
+    return true;
+}
+
+bool Scraper::syncFingerprintAt(int row)
+{
+    for (int i = 0; i < SYNC_FINGERPRINT_LEN; ++i) {
+        if (m_syncColumnBuffer.lineHash(row + i) != m_syncFingerprint[i]) {
+            return false;
+        }
+    }
+    return true;
 }
 
 void Scraper::createSyncMarker(int row)
@@ -694,6 +1558,37 @@ void Scraper::createSyncMarker(int row)
     CHAR_INFO marker[SYNC_MARKER_LEN];
     syncMarkerText(marker);
     m_syncRow = row;
+    m_syncIsFingerprint = false;
     SmallRect markerRect(0, m_syncRow, 1, SYNC_MARKER_LEN);
     m_consoleBuffer->write(markerRect, marker);
 }
+
+// Use the existing content at the row as the sync marker, which avoids
+// writing to the console.  The lines must be non-blank and distinct, or the
+// fingerprint would match too easily.  Returns false if they aren't.
+bool Scraper::createSyncFingerprint(int row, int width)
+{
+    ASSERT(row >= 1 && width >= 1);
+    if (!largeConsoleRead(m_syncColumnBuffer, *m_consoleBuffer,
+                          SmallRect(0, row, width, SYNC_FINGERPRINT_LEN),
+                          static_cast<WORD>(~0))) {
+        return false;
+    }
+    uint64_t hashes[SYNC_FINGERPRINT_LEN];
+    for (int i = 0; i < SYNC_FINGERPRINT_LEN; ++i) {
+        if (m_syncColumnBuffer.lineBlank(row + i)) {
+            return false;
+        }
+        hashes[i] = m_syncColumnBuffer.lineHash(row + i);
+        for (int j = 0; j < i; ++j) {
+            if (hashes[j] == hashes[i]) {
+                return false;
+            }
+        }
+    }
+    std::copy(hashes, hashes + SYNC_FINGERPRINT_LEN, m_syncFingerprint);
+    m_syncRow = row;
+    m_syncIsFingerprint = true;
+    m_syncFingerprintWidth = width;
+    return true;
+}
@@ -23,44 +23,110 @@
 
 #include <windows.h>
 
+#include <limits.h>
 #include <stdint.h>
 
 #include <memory>
 #include <vector>
 
+#include "../include/winpty_constants.h"
+
 #include "ConsoleLine.h"
 #include "Coord.h"
 #include "LargeConsoleRead.h"
 #include "SmallRect.h"
 #include "Terminal.h"
 
+class ConsoleBuffer;
 class ConsoleScreenBufferInfo;
+class ConsoleSnapshot;
+class HistoryStore;
 class Win32Console;
-class Win32ConsoleBuffer;
-
-// We must be able to issue a single ReadConsoleOutputW call of
-// MAX_CONSOLE_WIDTH characters, and a single read of approximately several
-// hundred fewer characters than BUFFER_LINE_COUNT.
-const int BUFFER_LINE_COUNT = 3000;
-const int MAX_CONSOLE_WIDTH = 2500;
-const int MAX_CONSOLE_HEIGHT = 2000;
+
+// The screen buffer height (the buffer line count) is configurable, between
+// WINPTY_BUFFER_LINES_MIN and WINPTY_BUFFER_LINES_MAX.  The window must be at
+// least MIN_SCROLLBACK_LINES shorter than the buffer, which leaves room for
+// the sync marker above it (see maxConsoleHeight).  largeConsoleRead splits
+// reads of wide or tall windows into tiles, so neither limit depends on how
+// much a single ReadConsoleOutputW call can return.
+const int DEFAULT_BUFFER_LINE_COUNT = WINPTY_BUFFER_LINES_MIN;
+const int MIN_SCROLLBACK_LINES = 1000;
+const int MAX_CONSOLE_WIDTH = 16384;
+const int MAX_CONSOLE_HEIGHT = WINPTY_BUFFER_LINES_MAX - MIN_SCROLLBACK_LINES;
 const int SYNC_MARKER_LEN = 16;
 const int SYNC_MARKER_MARGIN = 200;
+const int SYNC_FINGERPRINT_LEN = 4;
+
+// The tallest window a Scraper with the given buffer line count supports.
+int maxConsoleHeight(int bufferLineCount);
+
+// The part of the screen buffer that may have changed since the previous
+// scrape began reading it, in buffer coordinates with inclusive bounds, as
+// the console event hook reported it.  Because it starts before that read,
+// it covers any cell written while the read was in progress, so the scraper
+// may skip the rows outside it.  A top of -1 means that any cell may have
+// changed, and a top of INT_MAX that none did.
+struct ChangedRegion {
+    int top = -1;
+    int bottom = INT_MAX;
+    int left = 0;
+    int right = INT_MAX;
+};
 
 class Scraper {
 public:
     Scraper(
         Win32Console &console,
-        Win32ConsoleBuffer &buffer,
+        ConsoleBuffer &buffer,
         std::unique_ptr<Terminal> terminal,
-        Coord initialSize);
+        Coord initialSize,
+        int bufferLineCount=DEFAULT_BUFFER_LINE_COUNT,
+        bool legacyTentativeScrape=false,
+        bool fingerprintScroll=false,
+        bool terminalReflow=false,
+        bool initBuffer=true);
     ~Scraper();
-    void resizeWindow(Win32ConsoleBuffer &buffer,
+    // The constructor calls this unless told not to, e.g. because the caller
+    // already set the buffer up, and its content must be kept.
+    static int64_t setupBuffer(Win32Console &console,
+                               ConsoleBuffer &buffer,
+                               Coord initialSize,
+                               int bufferLineCount);
+    void resizeWindow(ConsoleBuffer &buffer,
                       Coord newSize,
                       ConsoleScreenBufferInfo &finalInfoOut);
-    void scrapeBuffer(Win32ConsoleBuffer &buffer,
-                      ConsoleScreenBufferInfo &finalInfoOut);
+    bool scrapeBuffer(ConsoleBuffer &buffer,
+                      ConsoleSnapshot &snapshot,
+                      ConsoleScreenBufferInfo &finalInfoOut,
+                      const ChangedRegion &changed=ChangedRegion());
+    void readWindowSnapshot(ConsoleBuffer &buffer,
+                            ConsoleScreenBufferInfo &infoOut,
+                            bool &cursorVisibleOut,
+                            LargeConsoleReadBuffer &out);
     Terminal &terminal() { return *m_terminal; }
+    int64_t initialFontSetupUs() const { return m_initialFontSetupUs; }
+    int64_t scrapeCount() const { return m_scrapeCount; }
+    int64_t syncMarkerResets() const { return m_syncMarkerResets; }
+    int64_t consoleResets() const { return m_consoleResets; }
+    int64_t contentResyncs() const { return m_contentResyncs; }
+    int64_t skippedLines() const { return m_skippedLines; }
+    // Whether the last scrape found a full-screen program's buffer.
+    bool directMode() const { return m_directMode; }
+    void setScrollbackBudget(int lines) { m_scrollbackBudget = lines; }
+    // When the terminal output has no colors, read the console's characters
+    // without their attributes where possible (see largeConsoleRead).
+    void setTextOnlyReads(bool textOnly) { m_textOnlyReads = textOnly; }
+    // Reads fewer columns of a wide buffer in scrolling mode (see
+    // WINPTY_FLAG_TRIM_WIDE_READS).
+    void setTrimWideReads(bool trim) { m_trimWideReads = trim; }
+    // Records each line that scrolls above the window in `store`.
+    void setHistoryStore(HistoryStore *store) { m_historyStore = store; }
+    void clearConsole(ConsoleBuffer &buffer);
+    // Makes the next scrape clear the terminal and resend the whole window.
+    void requestRepaint() { m_repaintRequested = true; }
+    void releaseScratchBuffers();
+    size_t lineMemoryUsage() const;
+    size_t readBufferMemoryUsage() const;
 
 private:
     void resetConsoleTracking(
@@ -69,35 +135,108 @@ private:
     void scanForDirtyLines(const SmallRect &windowRect);
     void clearBufferLines(int firstRow, int count);
     void resizeImpl(const ConsoleScreenBufferInfo &origInfo);
+    bool canKeepDirectLines(int cols, int rows);
+    void reflowTrackedLines(int top, int cols);
     void syncConsoleContentAndSize(bool forceResize,
                                    ConsoleScreenBufferInfo &finalInfoOut);
+    bool updateCursorOnly(ConsoleScreenBufferInfo &infoOut);
+    void endConsoleAccess();
     WORD attributesMask();
+    bool needsBoundsCheck();
     void directScrapeOutput(const ConsoleScreenBufferInfo &info,
                             bool consoleCursorVisible);
+    void sendDirectFrameLine(int line, int row, int width,
+                             int firstColumn, int lastColumn,
+                             int cursorColumn, bool partial);
+    void materializeDirectFrame();
+    void detectDirectModeScroll(int readTop, int width, int height,
+                                bool useFrame);
     bool scrollingScrapeOutput(const ConsoleScreenBufferInfo &info,
                                bool consoleCursorVisible,
                                bool tentative);
+    bool resyncByContent(const ConsoleScreenBufferInfo &info);
+    void retireScrolledLines(int64_t firstLine, int64_t stopLine);
+    int trimmedReadColumns(int bufferWidth);
+    void noteFullWidthRead(int bufferWidth);
     void syncMarkerText(CHAR_INFO (&output)[SYNC_MARKER_LEN]);
     int findSyncMarker();
+    bool searchSyncMarker(int top, int bottom, int &found);
+    bool syncFingerprintAt(int row);
     void createSyncMarker(int row);
+    bool createSyncFingerprint(int row, int width);
 
 private:
     Win32Console &m_console;
-    Win32ConsoleBuffer *m_consoleBuffer = nullptr;
+    ConsoleBuffer *m_consoleBuffer = nullptr;
+    ConsoleSnapshot *m_snapshot = nullptr;
     std::unique_ptr<Terminal> m_terminal;
+    const int m_bufferLineCount;
+    const bool m_legacyTentativeScrape;
+    const bool m_fingerprintScroll;
+    const bool m_terminalReflow;
 
     int m_syncRow = -1;
+    int m_lastSyncShift = 0;
     unsigned int m_syncCounter = 0;
+    // With m_fingerprintScroll, the row at m_syncRow may hold ordinary
+    // content instead of a marker, identified by the hashes of its first
+    // SYNC_FINGERPRINT_LEN lines.
+    bool m_syncIsFingerprint = false;
+    int m_syncFingerprintWidth = 0;
+    uint64_t m_syncFingerprint[SYNC_FINGERPRINT_LEN];
 
     bool m_directMode = false;
+    bool m_repaintRequested = false;
     Coord m_ptySize;
+    // The size of the region directScrapeOutput last sent, or 0x0 if the
+    // terminal's content is unknown.
+    Coord m_directScrapeSize;
+    int64_t m_initialFontSetupUs = 0;
+    int64_t m_scrapeCount = 0;
+    int64_t m_syncMarkerResets = 0;
+    int64_t m_consoleResets = 0;
+    int64_t m_contentResyncs = 0;
+    // If nonzero, a scrolling-mode scrape skips the lines that scrolled above
+    // the window when there are more than this many.
+    int m_scrollbackBudget = 0;
+    bool m_textOnlyReads = false;
+    // WINPTY_FLAG_TRIM_WIDE_READS state: the columns a scrolling-mode read
+    // needs, as of the last full-width read of a buffer m_trimBufferWidth
+    // columns wide, and when that read was.  Zero columns means unknown.
+    bool m_trimWideReads = false;
+    int m_trimColumns = 0;
+    int m_trimBufferWidth = 0;
+    DWORD m_trimCheckTick = 0;
+    HistoryStore *m_historyStore = nullptr;
+    int64_t m_skippedLines = 0;
     int64_t m_scrapedLineCount = 0;
     int64_t m_scrolledCount = 0;
     int64_t m_maxBufferedLine = -1;
     LargeConsoleReadBuffer m_readBuffer;
+    LargeConsoleReadBuffer m_syncColumnBuffer;
     std::vector<ConsoleLine> m_bufferData;
+    std::vector<CHAR_INFO> m_replacedLineBuffer;
     int m_dirtyWindowTop = -1;
     int m_dirtyLineCount = 0;
+    bool m_sentLines = false;
+    // Whether the scrape may unfreeze the console once it's finished reading
+    // (and writing) the console, before it encodes the terminal output.  It
+    // only does so if the freeze began during the scrape.
+    bool m_unfreezeBeforeEncode = false;
+    ChangedRegion m_changed;
+    // The window origin of the last direct scrape, whose size is
+    // m_directScrapeSize.
+    Coord m_directScrapeOrigin;
+    std::vector<CHAR_INFO> m_mergedLineBuffer;
+    // In direct mode, the window the terminal shows, as of the last full
+    // scrape, and patched since by partial scrapes and scrolls.  While it's
+    // valid, it stands in for the first m_directScrapeSize.Y tracked lines,
+    // which are left reset.  Each full scrape diffs its read against it,
+    // then swaps the two buffers, so no line is copied.  A nonzero
+    // m_staleFrameRows entry marks a row whose terminal content is unknown.
+    LargeConsoleReadBuffer m_frameBuffer;
+    std::vector<char> m_staleFrameRows;
+    bool m_frameValid = false;
 };
 
 #endif // AGENT_SCRAPER_H
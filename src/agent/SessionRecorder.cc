@@ -0,0 +1,278 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "SessionRecorder.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "../include/winpty_constants.h"
+
+#include "../shared/DebugClient.h"
+#include "../shared/StringBuilder.h"
+#include "../shared/WinptyAssert.h"
+
+namespace {
+
+// The writer wakes this often, or as soon as this much output is pending.
+const DWORD kFlushIntervalMs = 100;
+const size_t kFlushThreshold = 64 * 1024;
+
+const size_t kRecordHeaderSize = 16;
+const char kBinaryMagic[8] = { 'W', 'P', 'T', 'Y', 'R', 'E', 'C', '1' };
+
+int64_t qpcValue() {
+    LARGE_INTEGER ret;
+    QueryPerformanceCounter(&ret);
+    return ret.QuadPart;
+}
+
+// Seconds since the Unix epoch.
+int64_t unixTime() {
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+    const int64_t ticks =
+        (static_cast<int64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+    return (ticks - 116444736000000000LL) / 10000000;
+}
+
+template <typename T>
+void putRaw(std::string &out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T getRaw(const char *data) {
+    T ret;
+    memcpy(&ret, data, sizeof(ret));
+    return ret;
+}
+
+// Appends `data` as the body of a JSON string.  Output bytes at or above 0x80
+// are passed through, since the terminal output is UTF-8.
+void appendJsonEscaped(std::string &out, const char *data, size_t size) {
+    static const char hex[] = "0123456789abcdef";
+    for (size_t i = 0; i < size; ++i) {
+        const unsigned char ch = data[i];
+        if (ch == '"' || ch == '\\') {
+            out.push_back('\\');
+            out.push_back(ch);
+        } else if (ch < 0x20 || ch == 0x7f) {
+            out.append("\\u00");
+            out.push_back(hex[ch >> 4]);
+            out.push_back(hex[ch & 0xf]);
+        } else {
+            out.push_back(ch);
+        }
+    }
+}
+
+// Appends a microsecond count as seconds with six decimals.
+void appendSeconds(std::string &out, int64_t us) {
+    out.append(decOfInt(us / 1000000).c_str());
+    out.push_back('.');
+    out.append(decOfInt(us % 1000000 + 1000000).c_str() + 1);
+}
+
+} // anonymous namespace
+
+std::unique_ptr<SessionRecorder> SessionRecorder::create(
+        const std::wstring &path, int format, int cols, int rows,
+        DWORD &error)
+{
+    ASSERT(format == WINPTY_RECORDING_ASCIICAST ||
+           format == WINPTY_RECORDING_BINARY);
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_WRITE,
+                                    FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = GetLastError();
+        return nullptr;
+    }
+    std::unique_ptr<SessionRecorder> ret(new SessionRecorder(file, format));
+
+    // The header is written here, before the writer thread starts.
+    std::string header;
+    if (format == WINPTY_RECORDING_ASCIICAST) {
+        header.append("{\"version\": 2, \"width\": ");
+        header.append(decOfInt(cols).c_str());
+        header.append(", \"height\": ");
+        header.append(decOfInt(rows).c_str());
+        header.append(", \"timestamp\": ");
+        header.append(decOfInt(unixTime()).c_str());
+        header.append("}\n");
+    } else {
+        header.append(kBinaryMagic, sizeof(kBinaryMagic));
+        putRaw<int64_t>(header, unixTime());
+        putRaw<int32_t>(header, cols);
+        putRaw<int32_t>(header, rows);
+    }
+    ret->writeFile(header);
+
+    ret->m_thread = CreateThread(nullptr, 0, threadProc, ret.get(), 0,
+                                 nullptr);
+    ASSERT(ret->m_thread != nullptr && "Could not create the recorder thread");
+    error = 0;
+    return ret;
+}
+
+SessionRecorder::SessionRecorder(HANDLE file, int format) :
+    m_format(format),
+    m_file(file),
+    m_wakeEvent(CreateEventW(nullptr, FALSE, FALSE, nullptr))
+{
+    ASSERT(m_wakeEvent.get() != nullptr);
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    m_qpcFrequency = freq.QuadPart;
+    m_qpcStart = qpcValue();
+}
+
+// Writes whatever is still pending, then closes the file.
+SessionRecorder::~SessionRecorder()
+{
+    if (m_thread != nullptr) {
+        {
+            LockGuard<Mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        SetEvent(m_wakeEvent.get());
+        WaitForSingleObject(m_thread, INFINITE);
+        CloseHandle(m_thread);
+    }
+}
+
+void SessionRecorder::recordOutput(const char *data, size_t size)
+{
+    if (size > 0) {
+        appendRecord(Output, data, size);
+    }
+}
+
+void SessionRecorder::recordResize(int cols, int rows)
+{
+    char data[8];
+    memcpy(&data[0], &cols, 4);
+    memcpy(&data[4], &rows, 4);
+    appendRecord(Resize, data, sizeof(data));
+}
+
+// The bytes of output waiting for the writer thread.
+size_t SessionRecorder::memoryUsage()
+{
+    LockGuard<Mutex> lock(m_mutex);
+    return m_pending.capacity();
+}
+
+void SessionRecorder::appendRecord(RecordType type, const char *data,
+                                   size_t size)
+{
+    const int64_t us = (qpcValue() - m_qpcStart) * 1000000 / m_qpcFrequency;
+    bool wake;
+    {
+        LockGuard<Mutex> lock(m_mutex);
+        putRaw<int64_t>(m_pending, us);
+        putRaw<uint32_t>(m_pending, type);
+        putRaw<uint32_t>(m_pending, static_cast<uint32_t>(size));
+        m_pending.append(data, size);
+        wake = m_pending.size() >= kFlushThreshold;
+    }
+    if (wake) {
+        SetEvent(m_wakeEvent.get());
+    }
+}
+
+DWORD WINAPI SessionRecorder::threadProc(LPVOID param)
+{
+    static_cast<SessionRecorder*>(param)->writerLoop();
+    return 0;
+}
+
+void SessionRecorder::writerLoop()
+{
+    while (true) {
+        WaitForSingleObject(m_wakeEvent.get(), kFlushIntervalMs);
+        bool stopping;
+        {
+            LockGuard<Mutex> lock(m_mutex);
+            m_batch.clear();
+            m_batch.swap(m_pending);
+            stopping = m_stopping;
+        }
+        if (!m_batch.empty()) {
+            formatBatch();
+            writeFile(m_formatted);
+        }
+        if (stopping) {
+            break;
+        }
+    }
+}
+
+// Converts m_batch's records to the file format, in m_formatted.
+void SessionRecorder::formatBatch()
+{
+    if (m_format == WINPTY_RECORDING_BINARY) {
+        m_formatted.swap(m_batch);
+        m_batch.clear();
+        return;
+    }
+    m_formatted.clear();
+    size_t pos = 0;
+    while (pos < m_batch.size()) {
+        ASSERT(m_batch.size() - pos >= kRecordHeaderSize);
+        const char *const record = &m_batch[pos];
+        const int64_t us = getRaw<int64_t>(record);
+        const uint32_t type = getRaw<uint32_t>(record + 8);
+        const uint32_t size = getRaw<uint32_t>(record + 12);
+        const char *const data = record + kRecordHeaderSize;
+        m_formatted.push_back('[');
+        appendSeconds(m_formatted, us);
+        if (type == Output) {
+            m_formatted.append(", \"o\", \"");
+            appendJsonEscaped(m_formatted, data, size);
+        } else {
+            m_formatted.append(", \"r\", \"");
+            m_formatted.append(decOfInt(getRaw<int32_t>(data)).c_str());
+            m_formatted.push_back('x');
+            m_formatted.append(decOfInt(getRaw<int32_t>(data + 4)).c_str());
+        }
+        m_formatted.append("\"]\n");
+        pos += kRecordHeaderSize + size;
+    }
+}
+
+void SessionRecorder::writeFile(const std::string &data)
+{
+    size_t pos = 0;
+    while (!m_writeFailed && pos < data.size()) {
+        DWORD actual = 0;
+        const DWORD chunk = static_cast<DWORD>(
+            std::min<size_t>(data.size() - pos, 1024 * 1024));
+        if (!WriteFile(m_file.get(), data.data() + pos, chunk, &actual,
+                       nullptr)) {
+            trace("SessionRecorder: WriteFile failed: %u",
+                  static_cast<unsigned int>(GetLastError()));
+            m_writeFailed = true;
+        }
+        pos += actual;
+    }
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_SESSION_RECORDER_H
+#define AGENT_SESSION_RECORDER_H
+
+#include <windows.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "../shared/Mutex.h"
+#include "../shared/OwnedHandle.h"
+
+// Records the output written to CONOUT, with timestamps, to a file (see
+// winpty_set_output_recording).  The agent thread only appends a small
+// record to a pending buffer.  A thread of the recorder's own formats the
+// records and writes them to the file in batches, so a slow disk never stalls
+// the scraper.  Nothing is dropped: the pending buffer grows while the file
+// falls behind.
+class SessionRecorder
+{
+public:
+    // Returns null, and sets `error` to the Windows error, if the file can't
+    // be created.
+    static std::unique_ptr<SessionRecorder> create(
+        const std::wstring &path, int format, int cols, int rows,
+        DWORD &error);
+    ~SessionRecorder();
+
+    void recordOutput(const char *data, size_t size);
+    void recordResize(int cols, int rows);
+    size_t memoryUsage();
+
+private:
+    enum RecordType : uint32_t { Output = 0, Resize = 1 };
+
+    SessionRecorder(HANDLE file, int format);
+    static DWORD WINAPI threadProc(LPVOID param);
+    void writerLoop();
+    void appendRecord(RecordType type, const char *data, size_t size);
+    void formatBatch();
+    void writeFile(const std::string &data);
+
+    const int m_format;
+    OwnedHandle m_file;
+    OwnedHandle m_wakeEvent;
+    HANDLE m_thread = nullptr;
+    int64_t m_qpcStart = 0;
+    int64_t m_qpcFrequency = 1;
+    // Guarded by m_mutex.  Each record is an int64 time in microseconds since
+    // the recording started, a uint32 RecordType, a uint32 size, and the
+    // record's bytes, the same layout as WINPTY_RECORDING_BINARY.
+    Mutex m_mutex;
+    std::string m_pending;
+    bool m_stopping = false;
+    // Only used by the writer thread.
+    std::string m_batch;
+    std::string m_formatted;
+    bool m_writeFailed = false;
+};
+
+#endif // AGENT_SESSION_RECORDER_H
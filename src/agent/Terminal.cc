@@ -22,13 +22,23 @@
 
 #include <windows.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+#include <iterator>
 #include <string>
 
+#include "CharInfoScan.h"
+#include "EtwTrace.h"
+#include "FullWidthTable.h"
 #include "NamedPipe.h"
+#include "Profiler.h"
 #include "UnicodeEncoding.h"
+#include "../include/winpty_constants.h"
 #include "../shared/DebugClient.h"
+#include "../shared/StringUtil.h"
+#include "../shared/UnicodeTranscode.h"
 #include "../shared/WinptyAssert.h"
 #include "../shared/winpty_snprintf.h"
 
@@ -69,6 +79,10 @@ const int SGR_FORE_HI = 90;
 const int SGR_BACK = 40;
 const int SGR_BACK_HI = 100;
 
+// A frame that grows past this size is handed to the pipe in parts while the
+// scrape is still encoding it (see commitLargeFrame).
+const size_t kFramePartBytes = 256 * 1024;
+
 namespace {
 
 static void outUInt(std::string &out, unsigned int n)
@@ -211,6 +225,41 @@ static void outputSetColor(std::string &out, int color)
     out.push_back('m');
 }
 
+// Every SGR sequence the agent can emit depends only on the eight fore/back
+// color bits plus the reverse-video and underscore flags, so encode all 1024
+// combinations once and let the line encoders append the cached string.
+class SgrTable {
+public:
+    SgrTable() {
+        for (int i = 0; i < kSize; ++i) {
+            int color = i & 0xFF;
+            if (i & 0x100) color |= WINPTY_COMMON_LVB_REVERSE_VIDEO;
+            if (i & 0x200) color |= WINPTY_COMMON_LVB_UNDERSCORE;
+            outputSetColor(m_table[i], color);
+        }
+    }
+    const std::string &lookup(int color) const {
+        int index = color & 0xFF;
+        if (color & WINPTY_COMMON_LVB_REVERSE_VIDEO) index |= 0x100;
+        if (color & WINPTY_COMMON_LVB_UNDERSCORE) index |= 0x200;
+        return m_table[index];
+    }
+private:
+    static const int kSize = 0x400;
+    std::string m_table[kSize];
+};
+
+static const SgrTable &sgrTable()
+{
+    static const SgrTable table;
+    return table;
+}
+
+static inline void appendSetColor(std::string &out, int color)
+{
+    out.append(sgrTable().lookup(color));
+}
+
 static inline unsigned int fixSpecialCharacters(unsigned int ch)
 {
     if (ch <= 0x1b) {
@@ -248,7 +297,9 @@ static inline unsigned int fixSpecialCharacters(unsigned int ch)
 
 static inline bool isFullWidthCharacter(const CHAR_INFO *data, int width)
 {
-    if (width < 2) {
+    // Most characters can only ever be a single cell, and the table says so
+    // without looking at the attributes of two cells.
+    if (width < 2 || !mayBeFullWidth(data[0].Char.UnicodeChar)) {
         return false;
     }
     return
@@ -298,17 +349,241 @@ static inline void scanUnicodeScalarValue(
     }
 }
 
+// sendLine narrows runs of at least this many ASCII cells in bulk.
+const int kMinAsciiRun = 8;
+
+static inline bool isAsciiRunCandidate(const CHAR_INFO &cell)
+{
+    const wchar_t ch = cell.Char.UnicodeChar;
+    return ch >= 0x20 && ch <= 0x7E &&
+        !(cell.Attributes & (WINPTY_COMMON_LVB_LEADING_BYTE |
+                             WINPTY_COMMON_LVB_TRAILING_BYTE));
+}
+
+static inline void appendChar(std::string &out, unsigned int ch)
+{
+    ch = fixSpecialCharacters(ch);
+    char enc[4];
+    int enclen = encodeUtf8(enc, ch);
+    if (enclen == 0) {
+        enc[0] = '?';
+        enclen = 1;
+    }
+    out.append(enc, enclen);
+}
+
+// Clear the entries of `starts` for cells that continue a character begun in
+// an earlier cell.
+static void markCharacterStarts(std::vector<char> &starts,
+                                const CHAR_INFO *lineData, int width)
+{
+    int cellCount = 1;
+    for (int i = 0; i < width; i += cellCount) {
+        unsigned int ch;
+        scanUnicodeScalarValue(&lineData[i], width - i, cellCount, ch);
+        for (int j = 1; j < cellCount; ++j) {
+            starts[i + j] = 0;
+        }
+    }
+}
+
+// Cell-stream encoding (see WINPTY_FLAG_CELL_STREAM_OUTPUT).  The agent and
+// its clients are all little-endian, so values are appended as they are in
+// memory.
+template <typename T>
+static inline void appendRaw(std::string &out, T value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+static inline void replaceRaw(std::string &out, size_t offset, T value)
+{
+    ASSERT(offset + sizeof(value) <= out.size());
+    memcpy(&out[offset], &value, sizeof(value));
+}
+
+// Starts a record and returns the offset of its payload size, for
+// endCellRecord.
+static inline size_t beginCellRecord(std::string &out, uint8_t type)
+{
+    appendRaw<uint8_t>(out, type);
+    const size_t ret = out.size();
+    appendRaw<uint32_t>(out, 0);
+    return ret;
+}
+
+static inline void endCellRecord(std::string &out, size_t sizeOffset)
+{
+    replaceRaw<uint32_t>(out, sizeOffset, static_cast<uint32_t>(
+        out.size() - sizeOffset - sizeof(uint32_t)));
+}
+
+// The number of bytes of the graphic character at the start of the text that
+// may be repeated with REP, or 0 if it isn't one.  Only ASCII and the box
+// drawing and block elements (U+2500-U+259F) qualify: they are always one
+// cell wide, and they are what long runs in TUI borders are made of.
+static inline size_t repeatableGlyphSize(const char *text, size_t size)
+{
+    const unsigned char ch = text[0];
+    if (ch >= 0x20 && ch < 0x7F) {
+        return 1;
+    }
+    if (ch == 0xE2 && size >= 3) {
+        const unsigned int cp =
+            0x2000 |
+            ((static_cast<unsigned char>(text[1]) & 0x3F) << 6) |
+            (static_cast<unsigned char>(text[2]) & 0x3F);
+        if (cp >= 0x2500 && cp <= 0x259F) {
+            return 3;
+        }
+    }
+    return 0;
+}
+
+// Append VT line text to out, replacing each run of a repeated character
+// with one copy of it and a REPeat (REP), where that is shorter.  The runs
+// never span an escape sequence, so REP always repeats the character just
+// before it, in the current colors.
+static void appendWithRepeats(std::string &out, const char *text, size_t size)
+{
+    size_t i = 0;
+    while (i < size) {
+        if (text[i] == '\x1b') {
+            // Copy the escape sequence whole.  For CSI, that's up to and
+            // including the final byte (0x40-0x7E).
+            size_t end = i + 1;
+            if (end < size && text[end] == '[') {
+                ++end;
+                while (end < size &&
+                        (text[end] < 0x40 || text[end] > 0x7E)) {
+                    ++end;
+                }
+            }
+            end = std::min(end + 1, size);
+            out.append(text + i, end - i);
+            i = end;
+            continue;
+        }
+        const size_t glyphSize = repeatableGlyphSize(text + i, size - i);
+        if (glyphSize == 0) {
+            out.push_back(text[i++]);
+            continue;
+        }
+        size_t end = i + glyphSize;
+        unsigned int count = 1;
+        while (end + glyphSize <= size &&
+                memcmp(text + end, text + i, glyphSize) == 0) {
+            end += glyphSize;
+            ++count;
+        }
+        out.append(text + i, glyphSize);
+        if (count > 1) {
+            char buffer[32];
+            winpty_snprintf(buffer, CSI "%ub", count - 1);
+            const size_t repSize = strlen(buffer);
+            if (repSize < (count - 1) * glyphSize) {
+                out.append(buffer, repSize);
+            } else {
+                out.append(text + i + glyphSize, end - i - glyphSize);
+            }
+        }
+        i = end;
+    }
+}
+
 } // anonymous namespace
 
+// Terminal output is encoded directly onto the end of the pipe's output
+// queue.  The reservation is opened by the first output of a frame and
+// committed by flushFrame.
+std::string &Terminal::frame()
+{
+    if (m_frame == nullptr) {
+        m_frame = &m_output.reserveWrite();
+        m_framePartStart = m_frame->size();
+        m_frameLines = 0;
+        etwStart(kEtwSendLines);
+        if (m_cellStream) {
+            m_frameStart = m_frame->size();
+            appendRaw<uint32_t>(*m_frame, 0);
+        }
+        if (m_synchronizedOutput) {
+            // Begin Synchronized Update (BSU).
+            m_frame->append(CSI "?2026h");
+        }
+    }
+    return *m_frame;
+}
+
+// Commits the frame encoded so far once it passes kFramePartBytes, and
+// keeps encoding onto a fresh reservation.  A very large window (see
+// MAX_CONSOLE_WIDTH) then reaches the pipe in pieces, rather than in one
+// buffer that scales with the window's area.  The frame itself stays open,
+// so its synchronized-update markers still bracket all of it.  Cell-stream
+// frames are length-prefixed, so they're always committed whole.
+void Terminal::commitLargeFrame()
+{
+    if (m_frame != nullptr && !m_cellStream &&
+            m_frame->size() - m_framePartStart >= kFramePartBytes) {
+        m_output.commitWrite();
+        m_frame = &m_output.reserveWrite();
+        m_framePartStart = m_frame->size();
+    }
+}
+
+// Hand everything output since the last flush to the pipe in a single write.
+void Terminal::flushFrame()
+{
+    if (m_frame != nullptr) {
+        if (m_cellStream) {
+            replaceRaw<uint32_t>(*m_frame, m_frameStart,
+                static_cast<uint32_t>(
+                    m_frame->size() - m_frameStart - sizeof(uint32_t)));
+        }
+        if (m_synchronizedOutput) {
+            // End Synchronized Update (ESU).
+            m_frame->append(CSI "?2026l");
+        }
+        m_frame = nullptr;
+        m_output.commitWrite();
+        etwStop(kEtwSendLines, m_frameLines);
+    }
+}
+
 void Terminal::reset(SendClearFlag sendClearFirst, int64_t newLine)
 {
-    if (sendClearFirst == SendClear && !m_plainMode) {
+    TRACE_CAT(kTraceTerminal, "reset: clear=%d newLine=%lld",
+        sendClearFirst == SendClear ? 1 : 0, static_cast<long long>(newLine));
+    if (m_logMode) {
+        // What was logged stays.  The lines from newLine on are new, and
+        // they start on a line of their own.
+        flushLogLine();
+        if (m_logStarted) {
+            frame().append("\r\n");
+            m_logStarted = false;
+        }
+        m_logNextLine = newLine;
+        m_lineDataValid = true;
+    }
+    if (m_cellStream) {
+        if (sendClearFirst == SendClear) {
+            std::string &out = frame();
+            const size_t record =
+                beginCellRecord(out, WINPTY_CELL_RECORD_CLEAR);
+            appendRaw<int64_t>(out, newLine);
+            endCellRecord(out, record);
+            m_cellCursorLine = -1;
+            m_cellCursorColumn = -1;
+        }
+    } else if (sendClearFirst == SendClear && !m_plainMode) {
         // 0m   ==> reset SGR parameters
         // 1;1H ==> move cursor to top-left position
         // 2J   ==> clear the entire screen
-        m_output.write(CSI "0m" CSI "1;1H" CSI "2J");
+        frame().append(CSI "0m" CSI "1;1H" CSI "2J");
     }
     m_remoteLine = newLine;
+    m_remoteBottomLine = newLine;
     m_remoteColumn = 0;
     m_lineData.clear();
     m_cursorHidden = false;
@@ -316,10 +591,81 @@ void Terminal::reset(SendClearFlag sendClearFirst, int64_t newLine)
 }
 
 void Terminal::sendLine(int64_t line, const CHAR_INFO *lineData, int width,
-                        int cursorColumn)
+                        int cursorColumn,
+                        const CHAR_INFO *oldLineData, int oldWidth)
 {
+    PROFILE_ZONE("terminal.line");
     ASSERT(width >= 1);
+    TRACE_CAT(kTraceTerminal, "sendLine: line=%lld width=%d",
+        static_cast<long long>(line), width);
+    m_linesSent++;
+    m_frameLines++;
+
+    if (m_cellStream) {
+        sendCellLine(line, lineData, width, oldLineData, oldWidth);
+        return;
+    }
+    if (m_logMode) {
+        holdLogLine(line, lineData, width);
+        return;
+    }
+    sendTextLine(line, lineData, width, cursorColumn, oldLineData, oldWidth);
+    commitLargeFrame();
+}
+
+// Log mode (see WINPTY_FLAG_LOG_OUTPUT) holds back the last line sent, which
+// may still change, until a later line is sent.  Each line is then written
+// once, in order, and a line before the held one is never written again.
+void Terminal::holdLogLine(int64_t line, const CHAR_INFO *lineData, int width)
+{
+    if (line < m_logNextLine) {
+        return;
+    }
+    if (m_logLine != -1 && line > m_logLine) {
+        flushLogLine();
+    }
+    m_logLine = line;
+    m_logNextLine = line;
+    m_logLineData.assign(lineData, lineData + width);
+}
+
+void Terminal::flushLogLine()
+{
+    if (m_logLine == -1) {
+        return;
+    }
+    sendTextLine(m_logLine, m_logLineData.data(),
+                 static_cast<int>(m_logLineData.size()), -1, nullptr, 0);
+    m_logNextLine = m_logLine + 1;
+    m_logLine = -1;
+    m_logStarted = true;
+}
+
+// Write the held line, and end it, once the session's output is complete.
+void Terminal::finishLog()
+{
+    if (!m_logMode) {
+        return;
+    }
+    flushLogLine();
+    if (m_logStarted) {
+        frame().append("\r\n");
+        m_logStarted = false;
+    }
+    flushFrame();
+}
 
+// The text line encoder, specialized on the output mode so that the
+// per-cell loop carries no mode tests.  The constructor picks the
+// specialization (see selectTextLineEncoder).
+template <bool kPlainMode, bool kOutputColor>
+void Terminal::sendTextLineImpl(int64_t line, const CHAR_INFO *lineData,
+                                int width, int cursorColumn,
+                                const CHAR_INFO *oldLineData, int oldWidth)
+{
+    if (line != m_remoteLine) {
+        hideCursorForOutput();
+    }
     moveTerminalToLine(line);
 
     // If possible, see if we can append to what we've already output for this
@@ -333,51 +679,93 @@ void Terminal::sendLine(int64_t line, const CHAR_INFO *lineData, int width,
             // plain mode, we don't output that command, so we're OK with a
             // full line.
             bool okWidth = false;
-            if (m_plainMode) {
+            if (kPlainMode) {
                 okWidth = static_cast<size_t>(width) >= m_lineData.size();
             } else {
                 okWidth = static_cast<size_t>(width) > m_lineData.size();
             }
             if (!okWidth ||
-                    memcmp(m_lineData.data(), lineData,
-                           sizeof(CHAR_INFO) * m_lineData.size()) != 0) {
+                    !charInfoLinesEqual(m_lineData.data(), lineData,
+                                        m_lineData.size())) {
                 m_lineDataValid = false;
             }
         }
     }
-    if (!m_lineDataValid) {
-        // We can't reuse, so we must reset this line.
-        hideTerminalCursor();
-        if (m_plainMode) {
-            // We can't backtrack, so repeat this line.
-            m_output.write("\r\n");
-        } else {
-            m_output.write("\r");
-        }
-        m_lineDataValid = true;
-        m_lineData.clear();
-        m_remoteColumn = 0;
+    const int startColumn = m_lineDataValid ? m_lineData.size() : 0;
+
+    // If the terminal already displays the previous content of this line,
+    // then it may be cheaper to overwrite only the cells that changed.  The
+    // diff is encoded first, so the rewrite below can stop as soon as it's
+    // sure to cost more.  (Large repaints usually change only part of each
+    // row, so this avoids encoding most rows twice.)
+    const bool tryDiff =
+        !kPlainMode && oldLineData != nullptr && oldWidth == width;
+    std::string &diffLine = m_termDiffWorkingBuffer;
+    int diffColor = m_remoteColor;
+    int diffColumn = m_remoteColumn;
+    if (tryDiff) {
+        encodeLineDiff<kOutputColor>(diffLine, lineData, oldLineData,
+                                     width, diffColor, diffColumn);
     }
+    const size_t rewriteOverhead = m_lineDataValid ? 0 : 1;
+    bool useDiff = false;
 
     std::string &termLine = m_termLineWorkingBuffer;
     termLine.clear();
     size_t trimmedLineLength = 0;
-    int trimmedCellCount = m_lineData.size();
+    int trimmedCellCount = startColumn;
     bool alreadyErasedLine = false;
+    int color = m_remoteColor;
 
     int cellCount = 1;
-    for (int i = m_lineData.size(); i < width; i += cellCount) {
-        if (m_outputColor) {
-            int color = lineData[i].Attributes & COLOR_ATTRIBUTE_MASK;
-            if (color != m_remoteColor) {
-                outputSetColor(termLine, color);
+    for (int i = startColumn; i < width; i += cellCount) {
+        if (tryDiff &&
+                rewriteOverhead + trimmedLineLength +
+                    (alreadyErasedLine ? 0 : strlen(CSI "0K")) >
+                        diffLine.size()) {
+            // The trimmed output only grows, and the erase is still to come.
+            useDiff = true;
+            break;
+        }
+        if (kOutputColor) {
+            int cellColor = lineData[i].Attributes & COLOR_ATTRIBUTE_MASK;
+            if (cellColor != color) {
+                appendColorChange(termLine, color, cellColor);
                 trimmedLineLength = termLine.size();
-                m_remoteColor = color;
+                color = cellColor;
 
                 // All the cells just up to this color change will be output.
                 trimmedCellCount = i;
             }
         }
+        // Most cells are ASCII in runs of one attribute.  Narrow such a run
+        // in bulk, short of the line's last cell, which needs the special
+        // handling below.  Single-width ASCII needs none of the character
+        // fix-ups, and the attributes can't change within the run.
+        const int asciiLimit = width - 1 - i;
+        if (asciiLimit >= kMinAsciiRun &&
+                isAsciiRunCandidate(lineData[i])) {
+            const size_t runStart = termLine.size();
+            termLine.resize(runStart + asciiLimit);
+            const int runLength = charInfoNarrowAscii(
+                &lineData[i], asciiLimit, lineData[i].Attributes,
+                &termLine[runStart]);
+            termLine.resize(runStart + runLength);
+            if (runLength > 0) {
+                // As below, trailing spaces are only tentatively added.
+                int runTrimmed = runLength;
+                while (runTrimmed > 0 &&
+                        termLine[runStart + runTrimmed - 1] == ' ') {
+                    --runTrimmed;
+                }
+                if (runTrimmed > 0) {
+                    trimmedLineLength = runStart + runTrimmed;
+                    trimmedCellCount = i + runTrimmed;
+                }
+                cellCount = runLength;
+                continue;
+            }
+        }
         unsigned int ch;
         scanUnicodeScalarValue(&lineData[i], width - i, cellCount, ch);
         if (ch == ' ') {
@@ -393,19 +781,12 @@ void Terminal::sendLine(int64_t line, const CHAR_INFO *lineData, int width,
                 // issuing a CSI 0K at that point also erases the last cell in
                 // the line.  Work around this behavior by issuing the erase
                 // one character early in that case.
-                if (!m_plainMode) {
+                if (!kPlainMode) {
                     termLine.append(CSI "0K"); // Erase from cursor to EOL
                 }
                 alreadyErasedLine = true;
             }
-            ch = fixSpecialCharacters(ch);
-            char enc[4];
-            int enclen = encodeUtf8(enc, ch);
-            if (enclen == 0) {
-                enc[0] = '?';
-                enclen = 1;
-            }
-            termLine.append(enc, enclen);
+            appendChar(termLine, ch);
             trimmedLineLength = termLine.size();
 
             // All the cells up to and including this cell will be output.
@@ -413,17 +794,53 @@ void Terminal::sendLine(int64_t line, const CHAR_INFO *lineData, int width,
         }
     }
 
+    if (tryDiff && !useDiff) {
+        const size_t rewriteCost =
+            rewriteOverhead + trimmedLineLength +
+            (alreadyErasedLine ? 0 : strlen(CSI "0K"));
+        useDiff = diffLine.size() < rewriteCost;
+    }
+    if (useDiff) {
+        if (!diffLine.empty()) {
+            hideCursorForOutput();
+            appendLineText(diffLine.data(), diffLine.size());
+        }
+        m_remoteColor = diffColor;
+        m_remoteColumn = diffColumn;
+        m_lineDataValid = true;
+        m_lineData.assign(lineData, lineData + diffColumn);
+        return;
+    }
+
+    if (!m_lineDataValid) {
+        // We can't reuse, so we must reset this line.
+        hideCursorForOutput();
+        if (kPlainMode) {
+            // We can't backtrack, so repeat this line.
+            frame().append("\r\n");
+        } else {
+            frame().append("\r");
+        }
+        m_lineDataValid = true;
+        m_lineData.clear();
+        m_remoteColumn = 0;
+    }
+
     if (cursorColumn != -1 && trimmedCellCount > cursorColumn) {
         // The line content would run past the cursor, so hide it before we
         // output.
-        hideTerminalCursor();
+        hideCursorForOutput();
     }
 
-    m_output.write(termLine.data(), trimmedLineLength);
-    if (!alreadyErasedLine && !m_plainMode) {
-        m_output.write(CSI "0K"); // Erase from cursor to EOL
+    appendLineText(termLine.data(), trimmedLineLength);
+    if (!alreadyErasedLine && !kPlainMode) {
+        frame().append(CSI "0K"); // Erase from cursor to EOL
     }
 
+    // The color is only updated as far as the output was trimmed.  A color
+    // change is never trimmed.
+    m_remoteColor = color;
+
     ASSERT(trimmedCellCount <= width);
     m_lineData.insert(m_lineData.end(),
                       &lineData[m_lineData.size()],
@@ -431,20 +848,310 @@ void Terminal::sendLine(int64_t line, const CHAR_INFO *lineData, int width,
     m_remoteColumn = trimmedCellCount;
 }
 
-void Terminal::showTerminalCursor(int column, int64_t line)
+// Encode the cells of `lineData` that differ from `oldLineData`, which the
+// terminal is assumed to display already, as a series of CHA (CSI n G)
+// cursor movements and cell runs.  Runs separated by only a few unchanged
+// cells are merged, because repeating the cells is cheaper than moving the
+// cursor.  The run boundaries never split a full-width character or a
+// surrogate pair in either line.
+template <bool kOutputColor>
+void Terminal::encodeLineDiff(std::string &out,
+                              const CHAR_INFO *lineData,
+                              const CHAR_INFO *oldLineData,
+                              int width,
+                              int &color,
+                              int &column)
 {
-    moveTerminalToLine(line);
-    if (!m_plainMode) {
-        if (m_remoteColumn != column) {
+    const int kMaxMergedGap = 4;
+
+    out.clear();
+    std::vector<char> &starts = m_cellStartWorkingBuffer;
+    starts.assign(width + 1, 1);
+    markCharacterStarts(starts, lineData, width);
+    markCharacterStarts(starts, oldLineData, width);
+
+    int i = 0;
+    while (i < width) {
+        int begin = i + charInfoFirstDifference(
+            &oldLineData[i], &lineData[i], width - i);
+        if (begin == width) {
+            break;
+        }
+        int end = begin + 1;
+        for (int j = begin + 1; j < width && j - end < kMaxMergedGap; ++j) {
+            if (memcmp(&oldLineData[j], &lineData[j], sizeof(CHAR_INFO)) != 0) {
+                end = j + 1;
+            }
+        }
+        while (begin > i && !starts[begin]) {
+            --begin;
+        }
+        while (end < width && !starts[end]) {
+            ++end;
+        }
+
+        if (column != begin) {
             char buffer[32];
-            winpty_snprintf(buffer, CSI "%dG", column + 1);
-            m_output.write(buffer);
+            winpty_snprintf(buffer, CSI "%dG", begin + 1);
+            out.append(buffer);
+        }
+        int cellCount = 1;
+        for (int k = begin; k < end; k += cellCount) {
+            if (kOutputColor) {
+                const int cellColor =
+                    lineData[k].Attributes & COLOR_ATTRIBUTE_MASK;
+                if (cellColor != color) {
+                    appendColorChange(out, color, cellColor);
+                    color = cellColor;
+                }
+            }
+            unsigned int ch;
+            scanUnicodeScalarValue(&lineData[k], width - k, cellCount, ch);
+            appendChar(out, ch);
+            column = k + cellCount;
+        }
+        i = column;
+    }
+}
+
+Terminal::SendTextLineFn Terminal::selectTextLineEncoder(bool plainMode,
+                                                         bool outputColor)
+{
+    if (plainMode) {
+        return outputColor ? &Terminal::sendTextLineImpl<true, true>
+                           : &Terminal::sendTextLineImpl<true, false>;
+    } else {
+        return outputColor ? &Terminal::sendTextLineImpl<false, true>
+                           : &Terminal::sendTextLineImpl<false, false>;
+    }
+}
+
+// Send the cells of `lineData` as a WINPTY_CELL_RECORD_LINE.  If the client
+// already has `oldLineData`, only the span from the first changed cell to the
+// last one is sent, widened so it doesn't split a character in either line.
+void Terminal::sendCellLine(int64_t line, const CHAR_INFO *lineData,
+                            int width, const CHAR_INFO *oldLineData,
+                            int oldWidth)
+{
+    int begin = 0;
+    int end = width;
+    if (oldLineData != nullptr && oldWidth == width) {
+        begin = charInfoFirstDifference(oldLineData, lineData, width);
+        if (begin == width) {
+            return;
+        }
+        while (end > begin &&
+                memcmp(&oldLineData[end - 1], &lineData[end - 1],
+                       sizeof(CHAR_INFO)) == 0) {
+            --end;
+        }
+        std::vector<char> &starts = m_cellStartWorkingBuffer;
+        starts.assign(width + 1, 1);
+        markCharacterStarts(starts, lineData, width);
+        markCharacterStarts(starts, oldLineData, width);
+        while (begin > 0 && !starts[begin]) {
+            --begin;
+        }
+        while (end < width && !starts[end]) {
+            ++end;
+        }
+    }
+
+    std::string &out = frame();
+    const size_t record = beginCellRecord(out, WINPTY_CELL_RECORD_LINE);
+    appendRaw<int64_t>(out, line);
+    appendRaw<uint16_t>(out, static_cast<uint16_t>(begin));
+    appendRaw<uint16_t>(out, static_cast<uint16_t>(end - begin));
+    const size_t runCountOffset = out.size();
+    appendRaw<uint16_t>(out, 0);
+
+    int cellCount = 1;
+    for (int i = begin; i < end; i += cellCount) {
+        unsigned int ch;
+        scanUnicodeScalarValue(&lineData[i], width - i, cellCount, ch);
+        // A character can't run past the span, but it can run past a span
+        // that ends at the line's end.
+        cellCount = std::min(cellCount, end - i);
+        appendRaw<uint32_t>(out, fixSpecialCharacters(ch));
+        for (int j = 1; j < cellCount; ++j) {
+            appendRaw<uint32_t>(out, 0);
+        }
+    }
+
+    uint16_t runCount = 0;
+    for (int i = begin; i < end; ) {
+        const int attr = lineData[i].Attributes & COLOR_ATTRIBUTE_MASK;
+        int j = i + 1;
+        while (j < end &&
+                (lineData[j].Attributes & COLOR_ATTRIBUTE_MASK) == attr) {
+            ++j;
+        }
+        appendRaw<uint16_t>(out, static_cast<uint16_t>(attr));
+        appendRaw<uint16_t>(out, static_cast<uint16_t>(j - i));
+        ++runCount;
+        i = j;
+    }
+    replaceRaw<uint16_t>(out, runCountOffset, runCount);
+    endCellRecord(out, record);
+}
+
+void Terminal::sendCellCursor(int column, int64_t line, bool visible)
+{
+    if (column == m_cellCursorColumn && line == m_cellCursorLine &&
+            visible == m_cellCursorVisible) {
+        return;
+    }
+    std::string &out = frame();
+    const size_t record = beginCellRecord(out, WINPTY_CELL_RECORD_CURSOR);
+    appendRaw<int64_t>(out, line);
+    appendRaw<uint16_t>(out, static_cast<uint16_t>(std::max(column, 0)));
+    appendRaw<uint8_t>(out, visible ? 1 : 0);
+    endCellRecord(out, record);
+    m_cellCursorColumn = column;
+    m_cellCursorLine = line;
+    m_cellCursorVisible = visible;
+}
+
+void Terminal::setPalette(const COLORREF (&colorTable)[16])
+{
+    if (m_trueColor &&
+            std::equal(std::begin(colorTable), std::end(colorTable),
+                       m_palette)) {
+        return;
+    }
+    m_trueColor = true;
+    for (int i = 0; i < 16; ++i) {
+        m_palette[i] = colorTable[i];
+        std::string params;
+        outUInt(params, GetRValue(colorTable[i]));
+        params.push_back(';');
+        outUInt(params, GetGValue(colorTable[i]));
+        params.push_back(';');
+        outUInt(params, GetBValue(colorTable[i]));
+        m_foreParams[i] = "38;2;" + params;
+        m_backParams[i] = "48;2;" + params;
+    }
+    // The next color change restates everything.
+    m_remoteColor = -1;
+}
+
+void Terminal::appendColorChange(std::string &out, int oldColor,
+                                 int newColor)
+{
+    if (m_trueColor) {
+        appendTrueColorChange(out, oldColor, newColor);
+    } else {
+        appendSetColor(out, newColor);
+    }
+}
+
+// Append an SGR sequence that changes only the parameters that differ
+// between the two attributes, or that sets all of them if the terminal's
+// state is unknown (oldColor == -1).  Unlike the 16-color mapping, the
+// console's colors are sent exactly, and reverse video is left to the
+// terminal (SGR 7), which swaps the colors just as the console does.
+void Terminal::appendTrueColorChange(std::string &out, int oldColor,
+                                     int newColor)
+{
+    const bool restate = oldColor == -1;
+    // After SGR 0, underscore and reverse video are off.
+    const int oldFlags = restate ? 0 : oldColor;
+    bool first = !restate;
+    out.append(restate ? CSI "0" : CSI);
+    const auto param = [&](const char *text) {
+        if (!first) {
+            out.push_back(';');
+        }
+        out.append(text);
+        first = false;
+    };
+    const int fore = newColor & 0xF;
+    const int back = (newColor >> 4) & 0xF;
+    if (restate || fore != (oldColor & 0xF)) {
+        param(m_foreParams[fore].c_str());
+    }
+    if (restate || back != ((oldColor >> 4) & 0xF)) {
+        param(m_backParams[back].c_str());
+    }
+    const int underscore = newColor & WINPTY_COMMON_LVB_UNDERSCORE;
+    if (underscore != (oldFlags & WINPTY_COMMON_LVB_UNDERSCORE)) {
+        param(underscore ? "4" : "24");
+    }
+    const int reverse = newColor & WINPTY_COMMON_LVB_REVERSE_VIDEO;
+    if (reverse != (oldFlags & WINPTY_COMMON_LVB_REVERSE_VIDEO)) {
+        param(reverse ? "7" : "27");
+    }
+    out.push_back('m');
+}
+
+// Send the console title, as an OSC sequence or a cell-stream record.
+void Terminal::sendTitle(const std::wstring &title)
+{
+    if (m_cellStream) {
+        std::string &out = frame();
+        const size_t record = beginCellRecord(out, WINPTY_CELL_RECORD_TITLE);
+        appendUtf8FromUtf16(out, title.data(), title.size());
+        endCellRecord(out, record);
+        flushFrame();
+    } else if (!m_plainMode) {
+        // The OSC sequence goes outside any synchronized-update frame.  It's
+        // encoded onto the output queue rather than into a temporary.
+        flushFrame();
+        std::string &out = m_output.reserveWrite();
+        out.append("\x1b]0;");
+        appendUtf8FromUtf16(out, title.data(), title.size());
+        out.push_back('\x07');
+        m_output.commitWrite();
+    }
+}
+
+// Start a new terminal line below lastSentLine, the last line sent so far,
+// and number it `line`, leaving out the lines in between.  No line before
+// `line` may be sent afterward.  A cell-stream client places each line
+// itself, so its gap is simply never filled.
+void Terminal::skipToLine(int64_t lastSentLine, int64_t line)
+{
+    ASSERT(line > lastSentLine);
+    if (m_cellStream) {
+        return;
+    }
+    flushLogLine();
+    m_logNextLine = std::max(m_logNextLine, line);
+    hideCursorForOutput();
+    if (lastSentLine >= 0) {
+        moveTerminalToLine(lastSentLine);
+        frame().append("\r\n");
+    } else {
+        frame().append("\r");
+    }
+    m_remoteLine = line;
+    m_remoteBottomLine = line;
+    m_lineDataValid = true;
+    m_lineData.clear();
+    m_remoteColumn = 0;
+}
+
+void Terminal::showTerminalCursor(int column, int64_t line)
+{
+    if (m_cellStream) {
+        sendCellCursor(column, line, true);
+        return;
+    }
+    if (m_logMode) {
+        // The held line is written when it's complete, not when the cursor
+        // reaches the line after it.
+        return;
+    }
+    if (m_plainMode) {
+        moveTerminalToLine(line);
+    } else {
+        if (line != m_remoteLine || column != m_remoteColumn) {
+            moveTerminalCursor(line, column);
             m_lineDataValid = (column == 0);
             m_lineData.clear();
-            m_remoteColumn = column;
         }
         if (m_cursorHidden) {
-            m_output.write(CSI "?25h");
+            frame().append(CSI "?25h");
             m_cursorHidden = false;
         }
     }
@@ -452,47 +1159,107 @@ void Terminal::showTerminalCursor(int column, int64_t line)
 
 void Terminal::hideTerminalCursor()
 {
+    if (m_cellStream) {
+        if (m_cellCursorVisible) {
+            sendCellCursor(m_cellCursorColumn, m_cellCursorLine, false);
+        }
+        return;
+    }
     if (!m_plainMode) {
         if (m_cursorHidden) {
             return;
         }
-        m_output.write(CSI "?25l");
+        frame().append(CSI "?25l");
         m_cursorHidden = true;
     }
 }
 
-void Terminal::moveTerminalToLine(int64_t line)
+// With REP compression (see WINPTY_FLAG_REPEAT_CHAR_OUTPUT), runs of a
+// repeated character are shortened as the line is added to the frame.  The
+// byte counts that choose between a line's diff and its rewrite are still the
+// uncompressed ones.
+void Terminal::appendLineText(const char *text, size_t size)
 {
-    if (line == m_remoteLine) {
+    if (m_repeatCompression) {
+        appendWithRepeats(frame(), text, size);
+    } else {
+        frame().append(text, size);
+    }
+}
+
+// Hide the cursor before output that would otherwise be seen dragging it
+// across the screen.  The cursor stays hidden until the scrape ends with
+// showTerminalCursor, so a frame has at most one hide/show pair.  Merely
+// moving the cursor doesn't need it, and neither does a synchronized update,
+// which the terminal presents all at once.
+void Terminal::hideCursorForOutput()
+{
+    if (m_synchronizedOutput) {
         return;
     }
+    hideTerminalCursor();
+}
 
-    // Do not use CPL or CNL.  Konsole 2.5.4 does not support Cursor Previous
-    // Line (CPL) -- there are "Undecodable sequence" errors.  gnome-terminal
-    // 2.32.0 does handle it.  Cursor Next Line (CNL) does nothing if the
-    // cursor is on the last line already.
+// Scroll the terminal lines [top, bottom) up by `count` lines (or down, if
+// `count` is negative) using a scrolling region.  Lines scrolled into the
+// region are blank.  This is only meaningful in direct mode, where terminal
+// line N is screen row N, because DECSTBM homes the cursor.  Returns false if
+// the terminal can't do it (i.e. in plain mode).
+bool Terminal::scrollRegion(int64_t top, int64_t bottom, int count)
+{
+    ASSERT(top >= 0 && top < bottom && count != 0 &&
+           abs(count) < bottom - top);
+    if (m_cellStream) {
+        std::string &out = frame();
+        const size_t record = beginCellRecord(out, WINPTY_CELL_RECORD_SCROLL);
+        appendRaw<int64_t>(out, top);
+        appendRaw<int64_t>(out, bottom);
+        appendRaw<int32_t>(out, count);
+        endCellRecord(out, record);
+        return true;
+    }
+    if (m_plainMode) {
+        return false;
+    }
+    hideCursorForOutput();
+    char buffer[64];
+    // 0m   ==> reset SGR parameters, so the new lines have default colors
+    // t;br ==> set the scrolling region (DECSTBM)
+    // nS   ==> scroll up (SU) / nT ==> scroll down (SD)
+    // r    ==> reset the scrolling region
+    winpty_snprintf(buffer, CSI "0m" CSI "%u;%ur" CSI "%u%c" CSI "r",
+        static_cast<unsigned int>(top + 1),
+        static_cast<unsigned int>(bottom),
+        static_cast<unsigned int>(abs(count)),
+        count > 0 ? 'S' : 'T');
+    frame().append(buffer);
+    m_remoteColor = -1;
+    // Setting or resetting the scrolling region moves the cursor home.
+    m_remoteLine = 0;
+    m_remoteColumn = 0;
+    m_lineDataValid = true;
+    m_lineData.clear();
+    return true;
+}
 
-    hideTerminalCursor();
+void Terminal::moveTerminalToLine(int64_t line)
+{
+    if (line == m_remoteLine) {
+        return;
+    }
 
-    if (line < m_remoteLine) {
-        if (m_plainMode) {
-            // We can't backtrack, so instead repeat the lines again.
-            m_output.write("\r\n");
-            m_remoteLine = line;
-        } else {
-            // Backtrack and overwrite previous lines.
-            // CUrsor Up (CUU)
-            char buffer[32];
-            winpty_snprintf(buffer, "\r" CSI "%uA",
-                static_cast<unsigned int>(m_remoteLine - line));
-            m_output.write(buffer);
+    if (m_plainMode) {
+        // We can't backtrack, so instead repeat the lines again.
+        if (line < m_remoteLine) {
+            frame().append("\r\n");
             m_remoteLine = line;
         }
-    } else if (line > m_remoteLine) {
         while (line > m_remoteLine) {
-            m_output.write("\r\n");
+            frame().append("\r\n");
             m_remoteLine++;
         }
+    } else {
+        moveTerminalCursor(line, 0);
     }
 
     m_lineDataValid = true;
@@ -500,13 +1267,119 @@ void Terminal::moveTerminalToLine(int64_t line)
     m_remoteColumn = 0;
 }
 
+// Move the terminal cursor to the given line and column with the shortest
+// sequence, like curses does.  m_remoteColumn may be -1 (unknown), in which
+// case the column is set absolutely.
+//
+// Do not use CPL or CNL.  Konsole 2.5.4 does not support Cursor Previous Line
+// (CPL) -- there are "Undecodable sequence" errors.  gnome-terminal 2.32.0
+// does handle it.  Cursor Next Line (CNL) does nothing if the cursor is on
+// the last line already.  CUP isn't an option either, because the screen row
+// of a line isn't known once the terminal has scrolled.
+//
+// The vertical move is either CUU/CUD, which keep the column, or "\r" and a
+// run of "\n", which ends in column 0 whether or not the terminal translates
+// LF to CRLF.  Only the "\n" run can add lines at the bottom of the screen,
+// so CUD is only used to reach a line the cursor has already been on.
+void Terminal::moveTerminalCursor(int64_t line, int column)
+{
+    ASSERT(!m_plainMode && !m_cellStream);
+    ASSERT(column >= 0);
+
+    const auto appendCsiCount = [](std::string &out, int64_t n, char final) {
+        out.append(CSI);
+        if (n != 1) {
+            outUInt(out, static_cast<unsigned int>(n));
+        }
+        out.push_back(final);
+    };
+    const auto appendColumn = [&](std::string &out, int fromColumn) {
+        if (fromColumn == column) {
+            // Already there.
+        } else if (column == 0) {
+            out.push_back('\r');
+        } else {
+            // Cursor Horizontal Absolute (CHA)
+            appendCsiCount(out, column + 1, 'G');
+        }
+    };
+
+    std::string &best = m_cursorMoveWorkingBuffer;
+    best.clear();
+    if (line < m_remoteLine) {
+        // CUrsor Up (CUU)
+        appendCsiCount(best, m_remoteLine - line, 'A');
+        appendColumn(best, m_remoteColumn);
+    } else if (line == m_remoteLine) {
+        appendColumn(best, m_remoteColumn);
+    } else {
+        best.push_back('\r');
+        best.append(static_cast<size_t>(line - m_remoteLine), '\n');
+        appendColumn(best, 0);
+        if (line <= m_remoteBottomLine) {
+            // CUrsor Down (CUD)
+            std::string &candidate = m_cursorMoveCandidateBuffer;
+            candidate.clear();
+            appendCsiCount(candidate, line - m_remoteLine, 'B');
+            appendColumn(candidate, m_remoteColumn);
+            if (candidate.size() < best.size()) {
+                best.swap(candidate);
+            }
+        }
+    }
+
+    frame().append(best);
+    m_remoteLine = line;
+    m_remoteBottomLine = std::max(m_remoteBottomLine, line);
+    m_remoteColumn = column;
+}
+
+// The terminal has rewrapped its lines from firstLine down to the given
+// width, so that line firstLine + i now occupies lineCounts[i] lines.  Move
+// the tracked cursor position to where the terminal moved the cursor.
+void Terminal::noteLinesReflowed(int64_t firstLine,
+                                 const std::vector<int> &lineCounts,
+                                 int width)
+{
+    ASSERT(width >= 1);
+    // The lines below the cursor may have moved.
+    m_remoteBottomLine = m_remoteLine;
+    if (m_remoteLine < firstLine) {
+        return;
+    }
+    const int64_t index = m_remoteLine - firstLine;
+    const int64_t count = static_cast<int64_t>(lineCounts.size());
+    int64_t newLine = firstLine;
+    for (int64_t i = 0; i < std::min(index, count); ++i) {
+        newLine += lineCounts[i];
+    }
+    if (index < count) {
+        newLine += std::min(std::max(m_remoteColumn, 0) / width,
+                            lineCounts[index] - 1);
+    } else {
+        newLine += index - count;
+    }
+    m_remoteLine = newLine;
+    m_remoteBottomLine = newLine;
+    // The column is unknown, so the next cursor placement is absolute.
+    m_remoteColumn = -1;
+    m_lineDataValid = false;
+    m_lineData.clear();
+}
+
 void Terminal::enableMouseMode(bool enabled)
 {
     if (m_mouseModeEnabled == enabled || m_plainMode) {
         return;
     }
     m_mouseModeEnabled = enabled;
-    if (enabled) {
+    if (m_cellStream) {
+        std::string &out = frame();
+        const size_t record =
+            beginCellRecord(out, WINPTY_CELL_RECORD_MOUSE_MODE);
+        appendRaw<uint8_t>(out, enabled ? 1 : 0);
+        endCellRecord(out, record);
+    } else if (enabled) {
         // Start by disabling UTF-8 coordinate mode (1005), just in case we
         // have a terminal that does not support 1006/1015 modes, and 1005
         // happens to be enabled.  The UTF-8 coordinates can't be unambiguously
@@ -522,14 +1395,15 @@ void Terminal::enableMouseMode(bool enabled)
         // priority.  On other terminals, 1006 wins because it's listed last.
         //
         // See misc/MouseInputNotes.txt for details.
-        m_output.write(
+        frame().append(
             CSI "?1005l"
             CSI "?1000h" CSI "?1002h" CSI "?1003h" CSI "?1015h" CSI "?1006h");
     } else {
         // Resetting both encoding modes (1006 and 1015) is necessary, but
         // apparently we only need to use reset on one of the 100[023] modes.
         // Doing both doesn't hurt.
-        m_output.write(
+        frame().append(
             CSI "?1006l" CSI "?1015l" CSI "?1003l" CSI "?1002l" CSI "?1000l");
     }
+    flushFrame();
 }
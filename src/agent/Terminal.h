@@ -34,36 +34,139 @@ class NamedPipe;
 class Terminal
 {
 public:
-    explicit Terminal(NamedPipe &output, bool plainMode, bool outputColor)
-        : m_output(output), m_plainMode(plainMode), m_outputColor(outputColor)
+    explicit Terminal(NamedPipe &output, bool plainMode, bool outputColor,
+                      bool synchronizedOutput=false, bool cellStream=false)
+        : m_output(output), m_plainMode(plainMode && !cellStream),
+          m_outputColor(outputColor),
+          m_synchronizedOutput(synchronizedOutput && !plainMode &&
+                               !cellStream),
+          m_cellStream(cellStream),
+          m_sendTextLine(selectTextLineEncoder(m_plainMode, outputColor))
     {
     }
 
     enum SendClearFlag { OmitClear, SendClear };
     void reset(SendClearFlag sendClearFirst, int64_t newLine);
     void sendLine(int64_t line, const CHAR_INFO *lineData, int width,
-                  int cursorColumn);
+                  int cursorColumn,
+                  const CHAR_INFO *oldLineData=nullptr, int oldWidth=0);
+    void skipToLine(int64_t lastSentLine, int64_t line);
     void showTerminalCursor(int column, int64_t line);
     void hideTerminalCursor();
+    bool scrollRegion(int64_t top, int64_t bottom, int count);
+    void noteLinesReflowed(int64_t firstLine,
+                           const std::vector<int> &lineCounts, int width);
+    void flushFrame();
+    void sendTitle(const std::wstring &title);
+    // Switches VT color output to exact 24-bit colors taken from the
+    // console's palette (see WINPTY_FLAG_TRUE_COLOR_OUTPUT).  Calling it
+    // again with a changed palette affects the colors sent from then on.
+    void setPalette(const COLORREF (&colorTable)[16]);
+    // Shortens runs of a repeated character with REP (CSI n b).  See
+    // WINPTY_FLAG_REPEAT_CHAR_OUTPUT.
+    void setRepeatCompression(bool enabled) {
+        m_repeatCompression = enabled && !m_plainMode && !m_cellStream;
+    }
+    // Writes each line once, when it's complete, as plain text.  See
+    // WINPTY_FLAG_LOG_OUTPUT.  finishLog writes the last line.
+    void setLogMode(bool enabled) { m_logMode = enabled && m_plainMode; }
+    void finishLog();
+    int64_t linesSent() const { return m_linesSent; }
 
 private:
+    std::string &frame();
+    void commitLargeFrame();
+    typedef void (Terminal::*SendTextLineFn)(
+        int64_t line, const CHAR_INFO *lineData, int width, int cursorColumn,
+        const CHAR_INFO *oldLineData, int oldWidth);
+    static SendTextLineFn selectTextLineEncoder(bool plainMode,
+                                                bool outputColor);
+    void sendTextLine(int64_t line, const CHAR_INFO *lineData, int width,
+                      int cursorColumn,
+                      const CHAR_INFO *oldLineData, int oldWidth) {
+        (this->*m_sendTextLine)(line, lineData, width, cursorColumn,
+                                oldLineData, oldWidth);
+    }
+    template <bool kPlainMode, bool kOutputColor>
+    void sendTextLineImpl(int64_t line, const CHAR_INFO *lineData, int width,
+                          int cursorColumn,
+                          const CHAR_INFO *oldLineData, int oldWidth);
+    void holdLogLine(int64_t line, const CHAR_INFO *lineData, int width);
+    void flushLogLine();
     void moveTerminalToLine(int64_t line);
+    void hideCursorForOutput();
+    void appendLineText(const char *text, size_t size);
+    void moveTerminalCursor(int64_t line, int column);
+    template <bool kOutputColor>
+    void encodeLineDiff(std::string &out,
+                        const CHAR_INFO *lineData,
+                        const CHAR_INFO *oldLineData,
+                        int width,
+                        int &color,
+                        int &column);
+    void sendCellLine(int64_t line, const CHAR_INFO *lineData, int width,
+                      const CHAR_INFO *oldLineData, int oldWidth);
+    void sendCellCursor(int column, int64_t line, bool visible);
+    void appendColorChange(std::string &out, int oldColor, int newColor);
+    void appendTrueColorChange(std::string &out, int oldColor, int newColor);
 
 public:
     void enableMouseMode(bool enabled);
 
 private:
     NamedPipe &m_output;
+    // The pipe's output queue while a frame (i.e. scrape) is being written.
+    // m_framePartStart is its size when the frame, or the frame's latest
+    // part, was reserved.
+    std::string *m_frame = nullptr;
+    size_t m_framePartStart = 0;
+    // The number of lines sent in the current frame.
+    uint32_t m_frameLines = 0;
     int64_t m_remoteLine = 0;
+    // The lowest line the cursor has been on since the terminal's lines were
+    // last renumbered.  It is still on the screen, below or at the cursor.
+    int64_t m_remoteBottomLine = 0;
     int m_remoteColumn = 0;
     bool m_lineDataValid = true;
     std::vector<CHAR_INFO> m_lineData;
     bool m_cursorHidden = false;
     int m_remoteColor = -1;
     std::string m_termLineWorkingBuffer;
+    std::string m_termDiffWorkingBuffer;
+    std::string m_cursorMoveWorkingBuffer;
+    std::string m_cursorMoveCandidateBuffer;
+    std::vector<char> m_cellStartWorkingBuffer;
     bool m_plainMode = false;
     bool m_outputColor = true;
+    bool m_synchronizedOutput = false;
+    bool m_repeatCompression = false;
+    // Log mode state.  m_logLine is the held line, or -1.  Lines before
+    // m_logNextLine have been written.  m_logStarted is set while the last
+    // line written is unterminated.
+    bool m_logMode = false;
+    int64_t m_logLine = -1;
+    int64_t m_logNextLine = 0;
+    bool m_logStarted = false;
+    std::vector<CHAR_INFO> m_logLineData;
+    // With WINPTY_FLAG_CELL_STREAM_OUTPUT, frames are encoded as cell-stream
+    // records instead of VT sequences.  m_frameStart is the offset of the
+    // current frame's length field within the reserved chunk.
+    bool m_cellStream = false;
+    size_t m_frameStart = 0;
+    // The sendTextLineImpl specialization for m_plainMode and
+    // m_outputColor.
+    SendTextLineFn m_sendTextLine;
+    int64_t m_cellCursorLine = -1;
+    int m_cellCursorColumn = -1;
+    bool m_cellCursorVisible = false;
+    int64_t m_linesSent = 0;
     bool m_mouseModeEnabled = false;
+    // Set by setPalette.  Each palette color is kept encoded as the SGR
+    // parameters that select it as the foreground and as the background.
+    bool m_trueColor = false;
+    COLORREF m_palette[16] = {};
+    std::string m_foreParams[16];
+    std::string m_backParams[16];
 };
 
 #endif // TERMINAL_H
@@ -0,0 +1,250 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "TimerWheel.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+
+#include "../shared/WinptyAssert.h"
+
+const int64_t TimerWheel::kNever;
+
+namespace {
+
+inline int lowestSetBit64(uint64_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    if (_BitScanForward(&index, static_cast<unsigned long>(mask))) {
+        return static_cast<int>(index);
+    }
+    _BitScanForward(&index, static_cast<unsigned long>(mask >> 32));
+    return static_cast<int>(index) + 32;
+#else
+    return __builtin_ctzll(mask);
+#endif
+}
+
+} // anonymous namespace
+
+TimerWheel::Timer::~Timer()
+{
+    if (m_wheel != nullptr) {
+        m_wheel->cancel(*this);
+    }
+}
+
+TimerWheel::TimerWheel(int64_t now) : m_now(now)
+{
+}
+
+// Disarms the remaining timers, so their destructors leave the wheel alone.
+TimerWheel::~TimerWheel()
+{
+    for (int level = 0; level < kLevels; ++level) {
+        for (int slot = 0; slot < kSlots; ++slot) {
+            while (m_slots[level][slot] != nullptr) {
+                Timer &timer = *m_slots[level][slot];
+                unlink(timer);
+                timer.m_wheel = nullptr;
+            }
+        }
+    }
+    while (popExpired() != nullptr) {
+    }
+}
+
+// Arms the timer to expire once the wheel reaches the deadline tick, which
+// may already have passed.  An armed timer moves to the new deadline.
+void TimerWheel::arm(Timer &timer, int64_t deadline)
+{
+    if (timer.m_wheel != nullptr) {
+        ASSERT(timer.m_wheel == this);
+        unlink(timer);
+    }
+    timer.m_wheel = this;
+    timer.m_deadline = deadline;
+    place(timer);
+}
+
+// Disarms the timer, whether it's waiting or expired and not yet popped.
+void TimerWheel::cancel(Timer &timer)
+{
+    if (timer.m_wheel == nullptr) {
+        return;
+    }
+    ASSERT(timer.m_wheel == this);
+    unlink(timer);
+    timer.m_wheel = nullptr;
+}
+
+// Moves every timer due at or before the given tick to the expired list.
+// The wheel steps from one occupied level-0 slot to the next, stopping at
+// each 64-tick boundary to bring the next higher-level slot down.
+void TimerWheel::advance(int64_t now)
+{
+    while (m_now <= now) {
+        if ((m_occupied[0] | m_occupied[1] |
+                m_occupied[2] | m_occupied[3]) == 0) {
+            m_now = now + 1;
+            break;
+        }
+        const int index = static_cast<int>(m_now & (kSlots - 1));
+        while (m_slots[0][index] != nullptr) {
+            Timer &timer = *m_slots[0][index];
+            unlink(timer);
+            link(timer, kExpiredLevel, 0);
+        }
+        int64_t next = m_now - index + kSlots;
+        if (index + 1 < kSlots) {
+            const uint64_t ahead = m_occupied[0] & (~0ull << (index + 1));
+            if (ahead != 0) {
+                next = m_now - index + lowestSetBit64(ahead);
+            }
+        }
+        m_now = std::min(next, now + 1);
+        if ((m_now & (kSlots - 1)) == 0) {
+            for (int level = 1; level < kLevels; ++level) {
+                cascade(level);
+                if (((m_now >> (kLevelBits * level)) & (kSlots - 1)) != 0) {
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Takes the next expired timer off the expired list, or returns NULL.  The
+// timer is disarmed.  Timers due on the same tick come off in no particular
+// order.
+TimerWheel::Timer *TimerWheel::popExpired()
+{
+    Timer *const timer = m_expired;
+    if (timer != nullptr) {
+        unlink(*timer);
+        timer->m_wheel = nullptr;
+    }
+    return timer;
+}
+
+// Returns the tick of the earliest deadline, or kNever.  Only a timer that
+// is at least a whole rotation of some level away can make the result
+// early, in which case it's where that level starts its next rotation.  A
+// wake there costs one empty pass through the loop.
+int64_t TimerWheel::nextDeadline() const
+{
+    if (m_expired != nullptr) {
+        return m_now - 1;
+    }
+    for (int level = 0; level < kLevels; ++level) {
+        const int shift = kLevelBits * level;
+        const int index = static_cast<int>((m_now >> shift) & (kSlots - 1));
+        // A higher-level slot comes down as the wheel reaches its start, so
+        // the current one is already empty.
+        const int firstAhead = level == 0 ? index : index + 1;
+        const uint64_t ahead = firstAhead < kSlots ?
+            m_occupied[level] & (~0ull << firstAhead) : 0;
+        if (ahead != 0) {
+            const int slot = lowestSetBit64(ahead);
+            const int64_t slotStart =
+                ((m_now >> shift) - index + slot) << shift;
+            if (level == 0) {
+                return slotStart;
+            }
+            // Deadlines too far out for the top level wait in an earlier slot
+            // than their own, so the result is capped at the slot's end.
+            int64_t ret = slotStart + (int64_t(1) << shift);
+            for (const Timer *timer = m_slots[level][slot]; timer != nullptr;
+                    timer = timer->m_next) {
+                ret = std::min(ret, std::max(timer->m_deadline, slotStart));
+            }
+            return ret;
+        }
+        if (m_occupied[level] != 0) {
+            return ((m_now >> (shift + kLevelBits)) + 1) <<
+                (shift + kLevelBits);
+        }
+    }
+    return kNever;
+}
+
+// Links the timer into the lowest level whose span from the current tick
+// covers its deadline.
+void TimerWheel::place(Timer &timer)
+{
+    const int64_t delta = std::max<int64_t>(timer.m_deadline - m_now, 0);
+    int level = 0;
+    while (level < kLevels - 1 &&
+            delta >= (int64_t(1) << (kLevelBits * (level + 1)))) {
+        ++level;
+    }
+    const int64_t maxDelta = (int64_t(1) << (kLevelBits * kLevels)) - 1;
+    const int64_t at = m_now + std::min(delta, maxDelta);
+    link(timer, level,
+         static_cast<int>((at >> (kLevelBits * level)) & (kSlots - 1)));
+}
+
+void TimerWheel::link(Timer &timer, int level, int slot)
+{
+    Timer **const head =
+        level == kExpiredLevel ? &m_expired : &m_slots[level][slot];
+    timer.m_level = level;
+    timer.m_slot = slot;
+    timer.m_next = *head;
+    timer.m_pprev = head;
+    if (*head != nullptr) {
+        (*head)->m_pprev = &timer.m_next;
+    }
+    *head = &timer;
+    if (level != kExpiredLevel) {
+        m_occupied[level] |= uint64_t(1) << slot;
+    }
+}
+
+void TimerWheel::unlink(Timer &timer)
+{
+    *timer.m_pprev = timer.m_next;
+    if (timer.m_next != nullptr) {
+        timer.m_next->m_pprev = timer.m_pprev;
+    }
+    timer.m_next = nullptr;
+    timer.m_pprev = nullptr;
+    if (timer.m_level != kExpiredLevel &&
+            m_slots[timer.m_level][timer.m_slot] == nullptr) {
+        m_occupied[timer.m_level] &= ~(uint64_t(1) << timer.m_slot);
+    }
+}
+
+// Brings the level's slot for the current tick down to the levels below.
+// The wheel does this as it reaches a slot's start, so a timer armed
+// afterward never lands in a slot that has already come down.
+void TimerWheel::cascade(int level)
+{
+    const int slot =
+        static_cast<int>((m_now >> (kLevelBits * level)) & (kSlots - 1));
+    while (m_slots[level][slot] != nullptr) {
+        Timer &timer = *m_slots[level][slot];
+        unlink(timer);
+        place(timer);
+    }
+}
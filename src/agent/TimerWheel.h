@@ -0,0 +1,93 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef AGENT_TIMER_WHEEL_H
+#define AGENT_TIMER_WHEEL_H
+
+#include <stdint.h>
+
+// A hierarchical timer wheel of one-tick resolution.  Level 0 has a slot for
+// each of the next 64 ticks, and each higher level's slots are 64 times as
+// wide.  A timer sits in the lowest level whose span covers its deadline,
+// and moves down a level when the wheel reaches the start of its slot, so
+// arming and cancelling are O(1), and each timer moves at most once per
+// level.  Deadlines more than 2^24 ticks away wait at the top level and are
+// placed again as they come within range.
+//
+// The wheel doesn't call anything.  advance moves the timers that are due
+// onto the expired list, and the owner pops them off one at a time, so a
+// timer's handler may arm or cancel any timer, including expired ones not
+// yet popped.
+class TimerWheel
+{
+public:
+    class Timer
+    {
+    public:
+        Timer() {}
+        ~Timer();
+        Timer(const Timer &other) = delete;
+        Timer &operator=(const Timer &other) = delete;
+        bool armed() const { return m_wheel != nullptr; }
+        int64_t deadline() const { return m_deadline; }
+
+    private:
+        friend class TimerWheel;
+        TimerWheel *m_wheel = nullptr;
+        Timer *m_next = nullptr;
+        Timer **m_pprev = nullptr;
+        int64_t m_deadline = 0;
+        int m_level = 0;
+        int m_slot = 0;
+    };
+
+    explicit TimerWheel(int64_t now);
+    ~TimerWheel();
+    TimerWheel(const TimerWheel &other) = delete;
+    TimerWheel &operator=(const TimerWheel &other) = delete;
+
+    void arm(Timer &timer, int64_t deadline);
+    void cancel(Timer &timer);
+    void advance(int64_t now);
+    Timer *popExpired();
+    int64_t nextDeadline() const;
+
+    // nextDeadline's result when no timer is armed.
+    static const int64_t kNever = INT64_MAX;
+
+private:
+    enum { kLevelBits = 6, kSlots = 1 << kLevelBits, kLevels = 4 };
+    // The level number of the expired list.
+    enum { kExpiredLevel = kLevels };
+
+    void place(Timer &timer);
+    void link(Timer &timer, int level, int slot);
+    void unlink(Timer &timer);
+    void cascade(int level);
+
+    // The first tick that advance hasn't reached yet.
+    int64_t m_now;
+    Timer *m_slots[kLevels][kSlots] = {};
+    // Bit N of m_occupied[L] is set when m_slots[L][N] isn't empty.
+    uint64_t m_occupied[kLevels] = {};
+    Timer *m_expired = nullptr;
+};
+
+#endif // AGENT_TIMER_WHEEL_H
@@ -23,6 +23,7 @@
 #include <windows.h>
 #include <wchar.h>
 
+#include <algorithm>
 #include <string>
 
 #include "../shared/DebugClient.h"
@@ -37,9 +38,28 @@ Win32Console::Win32Console() : m_titleWorkBuf(16)
     //      message to the console window.
     m_hwnd = GetConsoleWindow();
     ASSERT(m_hwnd != nullptr);
+    std::fill(std::begin(m_freezeStats), std::end(m_freezeStats), 0);
 }
 
 std::wstring Win32Console::title()
+{
+    return readTitle();
+}
+
+// Reads the console title into `title`, returning true if it changed.  An
+// unchanged title is compared in the work buffer and isn't copied.
+bool Win32Console::updateTitle(std::wstring &title)
+{
+    const wchar_t *const newTitle = readTitle();
+    if (title.compare(newTitle) == 0) {
+        return false;
+    }
+    title.assign(newTitle);
+    return true;
+}
+
+// Returns the console title, NUL-terminated in m_titleWorkBuf.
+const wchar_t *Win32Console::readTitle()
 {
     while (true) {
         // Calling GetConsoleTitleW is tricky, because its behavior changed
@@ -97,11 +117,44 @@ void Win32Console::setFrozen(bool frozen) {
         // Enter selection mode by activating either Mark or SelectAll.
         const int command = m_freezeUsesMark ? SC_CONSOLE_MARK
                                              : SC_CONSOLE_SELECT_ALL;
+        TRACE_CAT(kTraceFreeze, "freezing console (%s)",
+            m_freezeUsesMark ? "Mark" : "SelectAll");
+        m_freezeLock.lock();
+        m_freezeTime = TimeMeasurement();
         SendMessage(m_hwnd, WM_SYSCOMMAND, command, 0);
         m_frozen = true;
     } else {
-        // Send Escape to cancel the selection.
-        SendMessage(m_hwnd, WM_CHAR, 27, 0x00010001);
+        // Send Escape to cancel the selection.  Messages sent from one thread
+        // to a window are handled in the order sent, so if this unfreeze is
+        // still queued when the next freeze is sent, the console handles it
+        // first.  Without a callback, nothing is queued back to this thread
+        // when conhost finishes.
+        if (m_asyncUnfreeze) {
+            SendMessageCallbackW(m_hwnd, WM_CHAR, 27, 0x00010001,
+                                 nullptr, 0);
+        } else {
+            SendMessage(m_hwnd, WM_CHAR, 27, 0x00010001);
+        }
         m_frozen = false;
+        m_freezeLock.unlock();
+        const int64_t us = m_freezeTime.elapsedUs();
+        noteFreezeDuration(us);
+        TRACE_CAT(kTraceFreeze, "console unfrozen after %lldus",
+            static_cast<long long>(us));
     }
 }
+
+void Win32Console::noteFreezeDuration(int64_t us) {
+    int64_t *const stats = m_freezeStats;
+    stats[WINPTY_FREEZE_STAT_FREEZES]++;
+    stats[WINPTY_FREEZE_STAT_TOTAL_US] += us;
+    stats[WINPTY_FREEZE_STAT_MAX_US] =
+        std::max(stats[WINPTY_FREEZE_STAT_MAX_US], us);
+    const int bucket =
+        us < 100    ? WINPTY_FREEZE_STAT_UNDER_100US :
+        us < 1000   ? WINPTY_FREEZE_STAT_UNDER_1MS :
+        us < 10000  ? WINPTY_FREEZE_STAT_UNDER_10MS :
+        us < 100000 ? WINPTY_FREEZE_STAT_UNDER_100MS :
+                      WINPTY_FREEZE_STAT_OVER_100MS;
+    stats[bucket]++;
+}
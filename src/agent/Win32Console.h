@@ -22,10 +22,15 @@
 #define AGENT_WIN32_CONSOLE_H
 
 #include <windows.h>
+#include <stdint.h>
 
 #include <string>
 #include <vector>
 
+#include "../include/winpty_constants.h"
+#include "../shared/Mutex.h"
+#include "../shared/TimeMeasurement.h"
+
 class Win32Console
 {
 public:
@@ -47,21 +52,54 @@ public:
 
     Win32Console();
 
+#ifdef WIN32_CONSOLE_TESTING
+    // A console with no window, for replaying a ConsoleTrace.  Freezing it
+    // only updates the state, since the messages go nowhere.
+    struct Detached {};
+    explicit Win32Console(Detached) : m_titleWorkBuf(16) {
+        for (int64_t &stat : m_freezeStats) {
+            stat = 0;
+        }
+    }
+#endif // WIN32_CONSOLE_TESTING
+
     HWND hwnd() { return m_hwnd; }
     std::wstring title();
+    bool updateTitle(std::wstring &title);
     void setTitle(const std::wstring &title);
     void setFreezeUsesMark(bool useMark) { m_freezeUsesMark = useMark; }
+    void setAsyncUnfreeze(bool async) { m_asyncUnfreeze = async; }
     void setNewW10(bool isNewW10) { m_isNewW10 = isNewW10; }
     bool isNewW10() { return m_isNewW10; }
     void setFrozen(bool frozen=true);
     bool frozen() { return m_frozen; }
+    // Held from each freeze until its unfreeze has been sent.  Another
+    // thread sending the console window messages that the selection would
+    // swallow (e.g. arrow keys) holds it while sending.  Messages sent to a
+    // window are handled in the order they were sent, even from different
+    // threads, so those messages never reach a frozen console.
+    Mutex &freezeLock() { return m_freezeLock; }
+
+    // Counters indexed by WINPTY_FREEZE_STAT_xxx.
+    const int64_t *freezeStats() const { return m_freezeStats; }
+    void noteTentativeScrapeAbort() {
+        m_freezeStats[WINPTY_FREEZE_STAT_TENTATIVE_ABORTS]++;
+    }
+
+private:
+    const wchar_t *readTitle();
+    void noteFreezeDuration(int64_t us);
 
 private:
     HWND m_hwnd = nullptr;
     bool m_frozen = false;
+    Mutex m_freezeLock;
     bool m_freezeUsesMark = false;
+    bool m_asyncUnfreeze = false;
     bool m_isNewW10 = false;
     std::vector<wchar_t> m_titleWorkBuf;
+    TimeMeasurement m_freezeTime;
+    int64_t m_freezeStats[WINPTY_FREEZE_STAT_COUNT];
 };
 
 #endif // AGENT_WIN32_CONSOLE_H
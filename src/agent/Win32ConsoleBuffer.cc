@@ -22,10 +22,38 @@
 
 #include <windows.h>
 
+#include <algorithm>
+#include <iterator>
+
 #include "../shared/DebugClient.h"
+#include "../shared/OsModule.h"
 #include "../shared/StringBuilder.h"
 #include "../shared/WinptyAssert.h"
 
+#include "ConsoleTrace.h"
+
+namespace {
+
+// CONSOLE_SCREEN_BUFFER_INFOEX is missing from the old MinGW headers.
+struct AGENT_CONSOLE_SCREEN_BUFFER_INFOEX {
+    ULONG cbSize;
+    COORD dwSize;
+    COORD dwCursorPosition;
+    WORD wAttributes;
+    SMALL_RECT srWindow;
+    COORD dwMaximumWindowSize;
+    WORD wPopupAttributes;
+    BOOL bFullscreenSupported;
+    COLORREF ColorTable[16];
+};
+
+// Vista and up
+typedef BOOL WINAPI GetConsoleScreenBufferInfoEx_t(
+            HANDLE hConsoleOutput,
+            AGENT_CONSOLE_SCREEN_BUFFER_INFOEX *lpConsoleScreenBufferInfoEx);
+
+} // anonymous namespace
+
 std::unique_ptr<Win32ConsoleBuffer> Win32ConsoleBuffer::openStdout() {
     return std::unique_ptr<Win32ConsoleBuffer>(
         new Win32ConsoleBuffer(GetStdHandle(STD_OUTPUT_HANDLE), false));
@@ -79,27 +107,17 @@ void Win32ConsoleBuffer::clearLines(
     }
 }
 
-void Win32ConsoleBuffer::clearAllLines(const ConsoleScreenBufferInfo &info) {
-    clearLines(0, info.bufferSize().Y, info);
-}
-
 ConsoleScreenBufferInfo Win32ConsoleBuffer::bufferInfo() {
     // TODO: error handling
     ConsoleScreenBufferInfo info;
     if (!GetConsoleScreenBufferInfo(m_conout, &info)) {
         trace("GetConsoleScreenBufferInfo failed");
+    } else if (m_trace != nullptr) {
+        m_trace->recordBufferInfo(info);
     }
     return info;
 }
 
-Coord Win32ConsoleBuffer::bufferSize() {
-    return bufferInfo().bufferSize();
-}
-
-SmallRect Win32ConsoleBuffer::windowRect() {
-    return bufferInfo().windowRect();
-}
-
 bool Win32ConsoleBuffer::resizeBufferRange(const Coord &initialSize,
                                            Coord &finalSize) {
     if (SetConsoleScreenBufferSize(m_conout, initialSize)) {
@@ -143,10 +161,6 @@ void Win32ConsoleBuffer::moveWindow(const SmallRect &rect) {
     }
 }
 
-Coord Win32ConsoleBuffer::cursorPosition() {
-    return bufferInfo().dwCursorPosition;
-}
-
 void Win32ConsoleBuffer::setCursorPosition(const Coord &coord) {
     // TODO: error handling
     if (!SetConsoleCursorPosition(m_conout, coord)) {
@@ -154,11 +168,15 @@ void Win32ConsoleBuffer::setCursorPosition(const Coord &coord) {
     }
 }
 
-void Win32ConsoleBuffer::read(const SmallRect &rect, CHAR_INFO *data) {
+bool Win32ConsoleBuffer::read(const SmallRect &rect, CHAR_INFO *data) {
     // TODO: error handling
     SmallRect tmp(rect);
-    if (!ReadConsoleOutputW(m_conout, data, rect.size(), Coord(), &tmp) &&
-            isTracingEnabled()) {
+    const BOOL success =
+        ReadConsoleOutputW(m_conout, data, rect.size(), Coord(), &tmp);
+    if (success && m_trace != nullptr) {
+        m_trace->recordRead(rect, data);
+    }
+    if (!success && isTracingEnabled()) {
         StringBuilder sb(256);
         auto outStruct = [&](const SMALL_RECT &sr) {
             sb << "{L=" << sr.Left << ",T=" << sr.Top
@@ -176,6 +194,36 @@ void Win32ConsoleBuffer::read(const SmallRect &rect, CHAR_INFO *data) {
         }
         trace("%s", sb.c_str());
     }
+    return success != FALSE;
+}
+
+// A trace records whole cells, so while recording, the caller reads those.
+bool Win32ConsoleBuffer::readText(const SmallRect &rect, wchar_t *text) {
+    if (m_trace != nullptr) {
+        return false;
+    }
+    const DWORD count = rect.width() * rect.height();
+    DWORD actual = 0;
+    if (!ReadConsoleOutputCharacterW(m_conout, text, count,
+                                     Coord(rect.Left, rect.Top), &actual)) {
+        trace("ReadConsoleOutputCharacterW failed");
+        return false;
+    }
+    return actual == count;
+}
+
+bool Win32ConsoleBuffer::readAttributes(const Coord &pos, int count,
+                                        WORD *attributes) {
+    if (m_trace != nullptr) {
+        return false;
+    }
+    DWORD actual = 0;
+    if (!ReadConsoleOutputAttribute(m_conout, attributes, count, pos,
+                                    &actual)) {
+        trace("ReadConsoleOutputAttribute failed");
+        return false;
+    }
+    return actual == static_cast<DWORD>(count);
 }
 
 void Win32ConsoleBuffer::write(const SmallRect &rect, const CHAR_INFO *data) {
@@ -191,3 +239,22 @@ void Win32ConsoleBuffer::setTextAttribute(WORD attributes) {
         trace("SetConsoleTextAttribute failed");
     }
 }
+
+bool Win32ConsoleBuffer::readColorTable(COLORREF (&table)[16]) {
+    static GetConsoleScreenBufferInfoEx_t *const getInfoEx =
+        reinterpret_cast<GetConsoleScreenBufferInfoEx_t*>(
+            loadedModuleProc(L"kernel32.dll",
+                             "GetConsoleScreenBufferInfoEx"));
+    if (getInfoEx == nullptr) {
+        return false;
+    }
+    AGENT_CONSOLE_SCREEN_BUFFER_INFOEX infoex = {};
+    infoex.cbSize = sizeof(infoex);
+    if (!getInfoEx(m_conout, &infoex)) {
+        trace("GetConsoleScreenBufferInfoEx failed");
+        return false;
+    }
+    std::copy(std::begin(infoex.ColorTable), std::end(infoex.ColorTable),
+              table);
+    return true;
+}
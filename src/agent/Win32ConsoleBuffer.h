@@ -23,26 +23,13 @@
 
 #include <windows.h>
 
-#include <string.h>
-
 #include <memory>
 
-#include "Coord.h"
-#include "SmallRect.h"
-
-class ConsoleScreenBufferInfo : public CONSOLE_SCREEN_BUFFER_INFO {
-public:
-    ConsoleScreenBufferInfo()
-    {
-        memset(this, 0, sizeof(*this));
-    }
+#include "ConsoleBuffer.h"
 
-    Coord bufferSize() const        { return dwSize;    }
-    SmallRect windowRect() const    { return srWindow;  }
-    Coord cursorPosition() const    { return dwCursorPosition; }
-};
+class ConsoleTrace;
 
-class Win32ConsoleBuffer {
+class Win32ConsoleBuffer : public ConsoleBuffer {
 private:
     Win32ConsoleBuffer(HANDLE conout, bool owned) :
         m_conout(conout), m_owned(owned)
@@ -50,8 +37,6 @@ private:
     }
 
 public:
-    static const int kDefaultAttributes = 7;
-
     ~Win32ConsoleBuffer() {
         if (m_owned) {
             CloseHandle(m_conout);
@@ -65,35 +50,34 @@ public:
     Win32ConsoleBuffer(const Win32ConsoleBuffer &other) = delete;
     Win32ConsoleBuffer &operator=(const Win32ConsoleBuffer &other) = delete;
 
-    HANDLE conout();
-    void clearLines(int row, int count, const ConsoleScreenBufferInfo &info);
-    void clearAllLines(const ConsoleScreenBufferInfo &info);
-
-    // Buffer and window sizes.
-    ConsoleScreenBufferInfo bufferInfo();
-    Coord bufferSize();
-    SmallRect windowRect();
-    void resizeBuffer(const Coord &size);
-    bool resizeBufferRange(const Coord &initialSize, Coord &finalSize);
-    bool resizeBufferRange(const Coord &initialSize) {
-        Coord dummy;
-        return resizeBufferRange(initialSize, dummy);
-    }
-    void moveWindow(const SmallRect &rect);
-
-    // Cursor.
-    Coord cursorPosition();
-    void setCursorPosition(const Coord &point);
-
-    // Screen content.
-    void read(const SmallRect &rect, CHAR_INFO *data);
-    void write(const SmallRect &rect, const CHAR_INFO *data);
-
-    void setTextAttribute(WORD attributes);
+    // While recording, the buffer info and cells read are added to `trace`.
+    void setTrace(ConsoleTrace *trace) { m_trace = trace; }
+
+    virtual HANDLE conout() override;
+    virtual void clearLines(int row, int count,
+                            const ConsoleScreenBufferInfo &info) override;
+    virtual ConsoleScreenBufferInfo bufferInfo() override;
+    virtual void resizeBuffer(const Coord &size) override;
+    using ConsoleBuffer::resizeBufferRange;
+    virtual bool resizeBufferRange(const Coord &initialSize,
+                                   Coord &finalSize) override;
+    virtual void moveWindow(const SmallRect &rect) override;
+    virtual void setCursorPosition(const Coord &point) override;
+    virtual bool read(const SmallRect &rect, CHAR_INFO *data) override;
+    virtual bool readText(const SmallRect &rect, wchar_t *text) override;
+    virtual bool readAttributes(const Coord &pos, int count,
+                                WORD *attributes) override;
+    virtual void write(const SmallRect &rect, const CHAR_INFO *data) override;
+    virtual void setTextAttribute(WORD attributes) override;
+
+    // Reads the RGB values of the console's 16 colors, indexed by the color
+    // bits of an attribute.  Returns false before Vista, which lacks the API.
+    bool readColorTable(COLORREF (&table)[16]);
 
 private:
     HANDLE m_conout = nullptr;
     bool m_owned = false;
+    ConsoleTrace *m_trace = nullptr;
 };
 
 #endif // AGENT_WIN32_CONSOLE_BUFFER_H
@@ -30,10 +30,15 @@
 
 #include "Agent.h"
 #include "AgentCreateDesktop.h"
+#include "AllocationCounter.h"
 #include "DebugShowInput.h"
+#include "EtwTrace.h"
+#include "Profiler.h"
 
 const char USAGE[] =
-"Usage: %ls controlPipeName flags mouseMode cols rows\n"
+"Usage: %ls controlPipeName flags mouseMode cols rows minPoll maxPoll\n"
+"           bufferLines escapeTimeout pipeOutBuffer pipeInBuffer pipeIoSize\n"
+"           scrollbackBudget hostCaps\n"
 "Usage: %ls controlPipeName --create-desktop\n"
 "\n"
 "Ordinarily, this program is launched by winpty.dll and is not directly\n"
@@ -56,6 +61,9 @@ static uint64_t winpty_atoi64(const char *str) {
 }
 
 int main() {
+    registerEtwProvider();
+    initProfiler();
+    initAllocationCounter();
     dumpWindowsVersion();
     dumpVersionToTrace();
 
@@ -96,16 +104,29 @@ int main() {
         return 0;
     }
 
-    if (argc != 6) {
+    if (argc != 15) {
         fprintf(stderr, USAGE, argv[0], argv[0], argv[0]);
         return 1;
     }
 
+    // Seed the version checks before the Agent makes any.
+    const uint64_t hostCaps = winpty_atoi64(utf8FromWide(argv[14]).c_str());
+    setWindowsVersionCaps(hostCaps);
+
     Agent agent(argv[1],
                 winpty_atoi64(utf8FromWide(argv[2]).c_str()),
                 atoi(utf8FromWide(argv[3]).c_str()),
                 atoi(utf8FromWide(argv[4]).c_str()),
-                atoi(utf8FromWide(argv[5]).c_str()));
+                atoi(utf8FromWide(argv[5]).c_str()),
+                atoi(utf8FromWide(argv[6]).c_str()),
+                atoi(utf8FromWide(argv[7]).c_str()),
+                atoi(utf8FromWide(argv[8]).c_str()),
+                atoi(utf8FromWide(argv[9]).c_str()),
+                atoi(utf8FromWide(argv[10]).c_str()),
+                atoi(utf8FromWide(argv[11]).c_str()),
+                atoi(utf8FromWide(argv[12]).c_str()),
+                atoi(utf8FromWide(argv[13]).c_str()),
+                hostCaps);
     agent.run();
 
     // The Agent destructor shouldn't return, but if it does, exit
@@ -25,27 +25,49 @@ $(eval $(call def_mingw_target,agent,-DWINPTY_AGENT_ASSERT))
 AGENT_OBJECTS = \
 	build/agent/agent/Agent.o \
 	build/agent/agent/AgentCreateDesktop.o \
+	build/agent/agent/AllocationCounter.o \
+	build/agent/agent/CharInfoScan.o \
+	build/agent/agent/ChunkedQueue.o \
+	build/agent/agent/ConsoleChangeTracker.o \
+	build/agent/agent/ConsoleEventHook.o \
 	build/agent/agent/ConsoleFont.o \
 	build/agent/agent/ConsoleInput.o \
 	build/agent/agent/ConsoleInputReencoding.o \
 	build/agent/agent/ConsoleLine.o \
+	build/agent/agent/ConsoleSnapshot.o \
+	build/agent/agent/ConsoleTrace.o \
 	build/agent/agent/DebugShowInput.o \
 	build/agent/agent/DefaultInputMap.o \
+	build/agent/agent/DefaultInputMapTable.o \
+	build/agent/agent/EtwTrace.o \
 	build/agent/agent/EventLoop.o \
+	build/agent/agent/FullWidthTable.o \
+	build/agent/agent/HistoryStore.o \
 	build/agent/agent/InputMap.o \
+	build/agent/agent/InputThread.o \
 	build/agent/agent/LargeConsoleRead.o \
 	build/agent/agent/NamedPipe.o \
+	build/agent/agent/OutputJournal.o \
+	build/agent/agent/OutputThread.o \
+	build/agent/agent/Profiler.o \
+	build/agent/agent/PseudoConsole.o \
 	build/agent/agent/Scraper.o \
+	build/agent/agent/SessionRecorder.o \
 	build/agent/agent/Terminal.o \
+	build/agent/agent/TimerWheel.o \
 	build/agent/agent/Win32Console.o \
 	build/agent/agent/Win32ConsoleBuffer.o \
 	build/agent/agent/main.o \
 	build/agent/shared/BackgroundDesktop.o \
 	build/agent/shared/Buffer.o \
+	build/agent/shared/CpuFeatures.o \
 	build/agent/shared/DebugClient.o \
 	build/agent/shared/GenRandom.o \
+	build/agent/shared/OutputCompression.o \
 	build/agent/shared/OwnedHandle.o \
 	build/agent/shared/StringUtil.o \
+	build/agent/shared/TraceFormat.o \
+	build/agent/shared/UnicodeTranscode.o \
 	build/agent/shared/WindowsSecurity.o \
 	build/agent/shared/WindowsVersion.o \
 	build/agent/shared/WinptyAssert.o \
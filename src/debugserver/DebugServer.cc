@@ -20,11 +20,18 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include <windows.h>
+#include <stdint.h>
 
+#include <map>
+#include <string>
+
+#include "../shared/TraceFormat.h"
 #include "../shared/WindowsSecurity.h"
 #include "../shared/WinptyException.h"
+#include "../shared/winpty_snprintf.h"
 
 const wchar_t *kPipeName = L"\\\\.\\pipe\\DebugServer";
 
@@ -32,7 +39,8 @@ const wchar_t *kPipeName = L"\\\\.\\pipe\\DebugServer";
 const int MSG_SIZE = 4096;
 
 static void usage(const char *program, int code) {
-    printf("Usage: %s [--everyone]\n"
+    printf("Usage: %s [--everyone] [--raw-log FILE]\n"
+           "       %s --decode FILE\n"
            "\n"
            "Creates the named pipe %ls and reads messages.  Prints each\n"
            "message to stdout.  By default, only the current user can send messages.\n"
@@ -40,17 +48,339 @@ static void usage(const char *program, int code) {
            "\n"
            "Use the WINPTY_DEBUG environment variable to enable winpty trace output.\n"
            "(e.g. WINPTY_DEBUG=trace for the default trace output.)  Set WINPTYDBG=1\n"
-           "to enable trace with older winpty versions.\n",
-           program, kPipeName);
+           "to enable trace with older winpty versions.\n"
+           "\n"
+           "WINPTY_DEBUG=trace_binary sends compact binary records instead, which\n"
+           "this server decodes.  --raw-log appends the binary messages to FILE, and\n"
+           "--decode prints such a file and exits.\n",
+           program, program, kPipeName);
     exit(code);
 }
 
+namespace {
+
+struct TraceProcess {
+    int64_t qpcFrequency = 1;
+    int64_t qpcStart = 0;
+    int64_t unixMsStart = 0;
+    std::string exeName;
+    std::map<int, std::string> formats;
+};
+
+// Binary trace state, by process ID.  A process sends its process record
+// again before its next records if a message fails to arrive.
+std::map<uint32_t, TraceProcess> g_traceProcesses;
+
+void appendTraceLine(std::string &out, const TraceProcess &proc,
+                     uint32_t pid, uint32_t tid, int64_t qpc,
+                     const std::string &text) {
+    const int64_t unixMs = proc.unixMsStart +
+        (qpc - proc.qpcStart) * 1000 / proc.qpcFrequency;
+    const int currentTime = static_cast<int>(unixMs % (100000 * 1000));
+    char prefix[256];
+    winpty_snprintf(prefix, "[%05d.%03d %s,p%04d,t%04d]: ",
+        currentTime / 1000, currentTime % 1000,
+        proc.exeName.c_str(), static_cast<int>(pid), static_cast<int>(tid));
+    out.append(prefix);
+    out.append(text);
+    out.push_back('\n');
+}
+
+// Decodes the records following kTraceBinaryMagic (see TraceFormat.h).
+void decodeBinaryMessage(const char *data, int size, std::string &out) {
+    const char *p = data + sizeof(kTraceBinaryMagic);
+    const char *const end = data + size;
+    while (p < end) {
+        if (end - p < kTraceRecordHeaderSize) {
+            out.append("[truncated binary trace message]\n");
+            return;
+        }
+        const int recordSize = static_cast<int>(getTraceInt(p, 2));
+        const int type = static_cast<int>(getTraceInt(p + 2, 1));
+        const uint32_t pid = static_cast<uint32_t>(getTraceInt(p + 3, 4));
+        if (recordSize < kTraceRecordHeaderSize || recordSize > end - p) {
+            out.append("[malformed binary trace record]\n");
+            return;
+        }
+        const char *body = p + kTraceRecordHeaderSize;
+        const int bodySize = recordSize - kTraceRecordHeaderSize;
+        p += recordSize;
+        TraceProcess &proc = g_traceProcesses[pid];
+        if (type == kTraceRecordProcess && bodySize >= 24) {
+            proc = TraceProcess();
+            proc.qpcFrequency = static_cast<int64_t>(getTraceInt(body, 8));
+            proc.qpcStart = static_cast<int64_t>(getTraceInt(body + 8, 8));
+            proc.unixMsStart = static_cast<int64_t>(getTraceInt(body + 16, 8));
+            proc.exeName.assign(body + 24, bodySize - 24);
+            if (proc.qpcFrequency <= 0) {
+                proc.qpcFrequency = 1;
+            }
+        } else if (type == kTraceRecordFormat && bodySize >= 2) {
+            proc.formats[static_cast<int>(getTraceInt(body, 2))].assign(
+                body + 2, bodySize - 2);
+        } else if (type == kTraceRecordEvent &&
+                   recordSize >= kTraceEventHeaderSize) {
+            const uint32_t tid = static_cast<uint32_t>(getTraceInt(body, 4));
+            const int64_t qpc = static_cast<int64_t>(getTraceInt(body + 4, 8));
+            const int formatId = static_cast<int>(getTraceInt(body + 12, 2));
+            const auto it = proc.formats.find(formatId);
+            if (it == proc.formats.end()) {
+                char text[64];
+                winpty_snprintf(text, "[unknown trace format %d]", formatId);
+                appendTraceLine(out, proc, pid, tid, qpc, text);
+            } else {
+                appendTraceLine(out, proc, pid, tid, qpc,
+                    decodeTraceArgs(it->second.c_str(), body + 14,
+                                    bodySize - 14));
+            }
+        } else if (type == kTraceRecordText && bodySize >= 12) {
+            const uint32_t tid = static_cast<uint32_t>(getTraceInt(body, 4));
+            const int64_t qpc = static_cast<int64_t>(getTraceInt(body + 4, 8));
+            appendTraceLine(out, proc, pid, tid, qpc,
+                            std::string(body + 12, bodySize - 12));
+        } else {
+            out.append("[unrecognized binary trace record]\n");
+        }
+    }
+}
+
+bool isBinaryMessage(const char *data, int size) {
+    return size >= static_cast<int>(sizeof(kTraceBinaryMagic)) &&
+        !memcmp(data, kTraceBinaryMagic, sizeof(kTraceBinaryMagic));
+}
+
+// A raw log is a sequence of binary messages, each preceded by its uint32
+// length.
+int decodeRawLog(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == nullptr) {
+        fprintf(stderr, "error: could not open %s\n", path);
+        return 1;
+    }
+    std::string message;
+    std::string out;
+    char lengthBytes[4];
+    while (fread(lengthBytes, 1, 4, file) == 4) {
+        const size_t length = static_cast<size_t>(getTraceInt(lengthBytes, 4));
+        message.resize(length);
+        if (length > 0 && fread(&message[0], 1, length, file) != length) {
+            fprintf(stderr, "error: %s is truncated\n", path);
+            break;
+        }
+        out.clear();
+        if (isBinaryMessage(message.data(), static_cast<int>(length))) {
+            decodeBinaryMessage(message.data(), static_cast<int>(length), out);
+        }
+        fwrite(out.data(), 1, out.size(), stdout);
+    }
+    fclose(file);
+    return 0;
+}
+
+// Each connected client gets its own pipe instance, and one more instance
+// always waits for the next client, so clients never wait for each other.
+// A client may keep its connection open and send any number of messages.
+// All of the instances complete their I/O through one completion port.
+class PipeServer {
+public:
+    PipeServer(PSECURITY_ATTRIBUTES psa, FILE *rawLog);
+    void run();
+
+private:
+    struct Instance {
+        HANDLE pipe = INVALID_HANDLE_VALUE;
+        OVERLAPPED over = {};
+        OVERLAPPED writeOver = {};
+        bool connected = false;
+        char buffer[MSG_SIZE];
+    };
+
+    void createInstance(bool first);
+    void startConnect(Instance &inst);
+    // Destroys the instance if the read fails immediately.
+    void startRead(Instance &inst);
+    void destroyInstance(Instance *inst);
+    void handleMessage(Instance &inst, DWORD size);
+    void flushOutput();
+
+    PSECURITY_ATTRIBUTES m_psa;
+    FILE *m_rawLog;
+    HANDLE m_port;
+    HANDLE m_writeEvent;
+    std::string m_output;
+};
+
+// Flush stdout once this much output is pending, even if more messages
+// are arriving.
+const size_t kOutputFlushSize = 64 * 1024;
+
+PipeServer::PipeServer(PSECURITY_ATTRIBUTES psa, FILE *rawLog) :
+    m_psa(psa),
+    m_rawLog(rawLog)
+{
+    m_port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+    m_writeEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if (m_port == nullptr || m_writeEvent == nullptr) {
+        fprintf(stderr, "error: could not create a completion port\n");
+        exit(1);
+    }
+    createInstance(true);
+}
+
+void PipeServer::createInstance(bool first) {
+    Instance *inst = new Instance;
+    inst->pipe = CreateNamedPipeW(
+        kPipeName,
+        /*dwOpenMode=*/PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED |
+            (first ? FILE_FLAG_FIRST_PIPE_INSTANCE : 0),
+        /*dwPipeMode=*/PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE |
+            rejectRemoteClientsPipeFlag(),
+        /*nMaxInstances=*/PIPE_UNLIMITED_INSTANCES,
+        /*nOutBufferSize=*/MSG_SIZE,
+        /*nInBufferSize=*/MSG_SIZE,
+        /*nDefaultTimeOut=*/10 * 1000,
+        m_psa);
+    if (inst->pipe == INVALID_HANDLE_VALUE) {
+        fprintf(stderr, "error: could not create %ls pipe: error %u\n",
+            kPipeName, static_cast<unsigned>(GetLastError()));
+        exit(1);
+    }
+    inst->writeOver.hEvent = m_writeEvent;
+    CreateIoCompletionPort(inst->pipe, m_port,
+                           reinterpret_cast<ULONG_PTR>(inst), 0);
+    startConnect(*inst);
+}
+
+void PipeServer::startConnect(Instance &inst) {
+    inst.connected = false;
+    while (!ConnectNamedPipe(inst.pipe, &inst.over)) {
+        if (GetLastError() == ERROR_NO_DATA) {
+            // A client connected and closed its end already.
+            DisconnectNamedPipe(inst.pipe);
+            continue;
+        } else if (GetLastError() == ERROR_PIPE_CONNECTED) {
+            // No completion packet is queued in this case.
+            PostQueuedCompletionStatus(m_port, 0,
+                reinterpret_cast<ULONG_PTR>(&inst), &inst.over);
+        } else if (GetLastError() != ERROR_IO_PENDING) {
+            fprintf(stderr, "error: ConnectNamedPipe failed\n");
+            fflush(stderr);
+            exit(1);
+        }
+        break;
+    }
+}
+
+void PipeServer::startRead(Instance &inst) {
+    if (!ReadFile(inst.pipe, inst.buffer, MSG_SIZE, nullptr, &inst.over) &&
+            GetLastError() != ERROR_IO_PENDING &&
+            GetLastError() != ERROR_MORE_DATA) {
+        // No completion packet is queued for an immediate failure, e.g.
+        // because the client already closed the pipe.
+        destroyInstance(&inst);
+    }
+}
+
+void PipeServer::destroyInstance(Instance *inst) {
+    DisconnectNamedPipe(inst->pipe);
+    CloseHandle(inst->pipe);
+    delete inst;
+}
+
+void PipeServer::handleMessage(Instance &inst, DWORD size) {
+    if (isBinaryMessage(inst.buffer, size)) {
+        if (m_rawLog != nullptr) {
+            char lengthBytes[4];
+            char *out = lengthBytes;
+            putTraceInt(out, size, 4);
+            fwrite(lengthBytes, 1, 4, m_rawLog);
+            fwrite(inst.buffer, 1, size, m_rawLog);
+            fflush(m_rawLog);
+        }
+        decodeBinaryMessage(inst.buffer, size, m_output);
+    } else {
+        m_output.append(inst.buffer, size);
+        m_output.push_back('\n');
+    }
+
+    // The client uses TransactNamedPipe and waits for this reply.
+    DWORD bytesWritten = 0;
+    if (!WriteFile(inst.pipe, "OK", 2, nullptr, &inst.writeOver) &&
+            GetLastError() != ERROR_IO_PENDING) {
+        return;
+    }
+    GetOverlappedResult(inst.pipe, &inst.writeOver, &bytesWritten, TRUE);
+}
+
+void PipeServer::flushOutput() {
+    if (!m_output.empty()) {
+        fwrite(m_output.data(), 1, m_output.size(), stdout);
+        fflush(stdout);
+        m_output.clear();
+    }
+}
+
+void PipeServer::run() {
+    while (true) {
+        // Write the pending output once no more messages are ready.
+        DWORD bytes = 0;
+        ULONG_PTR key = 0;
+        OVERLAPPED *over = nullptr;
+        const BOOL success = GetQueuedCompletionStatus(
+            m_port, &bytes, &key, &over, m_output.empty() ? INFINITE : 0);
+        if (over == nullptr) {
+            flushOutput();
+            continue;
+        }
+        Instance *inst = reinterpret_cast<Instance*>(key);
+        if (over == &inst->writeOver) {
+            // handleMessage already waited for the reply.
+            continue;
+        }
+        if (!inst->connected) {
+            if (!success) {
+                DisconnectNamedPipe(inst->pipe);
+                startConnect(*inst);
+                continue;
+            }
+            inst->connected = true;
+            createInstance(false);
+            startRead(*inst);
+        } else if (success) {
+            handleMessage(*inst, bytes);
+            startRead(*inst);
+        } else {
+            if (GetLastError() == ERROR_MORE_DATA) {
+                fprintf(stderr, "error: message exceeds %d bytes\n",
+                    MSG_SIZE);
+                fflush(stderr);
+            }
+            // The client closed its end of the pipe (or the read failed).
+            destroyInstance(inst);
+        }
+        if (m_output.size() >= kOutputFlushSize) {
+            flushOutput();
+        }
+    }
+}
+
+} // anonymous namespace
+
 int main(int argc, char *argv[]) {
     bool everyone = false;
+    FILE *rawLog = nullptr;
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
         if (arg == "--everyone") {
             everyone = true;
+        } else if (arg == "--decode" && i + 1 < argc) {
+            return decodeRawLog(argv[i + 1]);
+        } else if (arg == "--raw-log" && i + 1 < argc) {
+            rawLog = fopen(argv[++i], "ab");
+            if (rawLog == nullptr) {
+                fprintf(stderr, "error: could not open %s\n", argv[i]);
+                exit(1);
+            }
         } else if (arg == "-h" || arg == "--help") {
             usage(argv[0], 0);
         } else {
@@ -74,44 +404,6 @@ int main(int argc, char *argv[]) {
         psa = &sa;
     }
 
-    HANDLE serverPipe = CreateNamedPipeW(
-        kPipeName,
-        /*dwOpenMode=*/PIPE_ACCESS_DUPLEX | FILE_FLAG_FIRST_PIPE_INSTANCE,
-        /*dwPipeMode=*/PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE |
-            rejectRemoteClientsPipeFlag(),
-        /*nMaxInstances=*/1,
-        /*nOutBufferSize=*/MSG_SIZE,
-        /*nInBufferSize=*/MSG_SIZE,
-        /*nDefaultTimeOut=*/10 * 1000,
-        psa);
-
-    if (serverPipe == INVALID_HANDLE_VALUE) {
-        fprintf(stderr, "error: could not create %ls pipe: error %u\n",
-            kPipeName, static_cast<unsigned>(GetLastError()));
-        exit(1);
-    }
-
-    char msgBuffer[MSG_SIZE + 1];
-
-    while (true) {
-        if (!ConnectNamedPipe(serverPipe, nullptr)) {
-            fprintf(stderr, "error: ConnectNamedPipe failed\n");
-            fflush(stderr);
-            exit(1);
-        }
-        DWORD bytesRead = 0;
-        if (!ReadFile(serverPipe, msgBuffer, MSG_SIZE, &bytesRead, nullptr)) {
-            fprintf(stderr, "error: ReadFile on pipe failed\n");
-            fflush(stderr);
-            DisconnectNamedPipe(serverPipe);
-            continue;
-        }
-        msgBuffer[bytesRead] = '\n';
-        fwrite(msgBuffer, 1, bytesRead + 1, stdout);
-        fflush(stdout);
-
-        DWORD bytesWritten = 0;
-        WriteFile(serverPipe, "OK", 2, &bytesWritten, nullptr);
-        DisconnectNamedPipe(serverPipe);
-    }
+    PipeServer server(psa, rawLog);
+    server.run();
 }
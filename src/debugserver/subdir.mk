@@ -24,9 +24,12 @@ $(eval $(call def_mingw_target,debugserver,))
 
 DEBUGSERVER_OBJECTS = \
 	build/debugserver/debugserver/DebugServer.o \
+	build/debugserver/shared/CpuFeatures.o \
 	build/debugserver/shared/DebugClient.o \
 	build/debugserver/shared/OwnedHandle.o \
 	build/debugserver/shared/StringUtil.o \
+	build/debugserver/shared/TraceFormat.o \
+	build/debugserver/shared/UnicodeTranscode.o \
 	build/debugserver/shared/WindowsSecurity.o \
 	build/debugserver/shared/WindowsVersion.o \
 	build/debugserver/shared/WinptyAssert.o \
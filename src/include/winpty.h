@@ -106,6 +106,58 @@ winpty_config_set_mouse_mode(winpty_config_t *cfg, int mouseMode);
 WINPTY_API void
 winpty_config_set_agent_timeout(winpty_config_t *cfg, DWORD timeoutMs);
 
+/* The agent polls the console for new output.  It polls every minMs
+ * milliseconds while there is console output or terminal input, then backs
+ * off exponentially to every maxMs milliseconds while the console is idle.
+ * Both values must be greater than 0, and minMs must not exceed maxMs.  The
+ * default is a fixed 25ms interval. */
+WINPTY_API void
+winpty_config_set_poll_interval(winpty_config_t *cfg, int minMs, int maxMs);
+
+/* The height of the console screen buffer the agent scrapes.  If a program
+ * writes more lines than this between two polls, the agent loses track of the
+ * console and must redraw the terminal, dropping the lines in between.  A
+ * larger buffer uses more memory in the agent and conhost.  Must be between
+ * WINPTY_BUFFER_LINES_MIN and WINPTY_BUFFER_LINES_MAX.  The default is
+ * WINPTY_BUFFER_LINES_MIN. */
+WINPTY_API void
+winpty_config_set_buffer_lines(winpty_config_t *cfg, int lines);
+
+/* When terminal input ends with an incomplete escape sequence (e.g. a lone
+ * ESC keypress), the agent waits this long for the rest of the sequence
+ * before converting the bytes as ordinary keypresses.  A smaller value makes
+ * ESC more responsive, but an escape sequence split across a slow connection
+ * may then be misread.  Must be greater than 0.  The default is 1000ms. */
+WINPTY_API void
+winpty_config_set_escape_timeout(winpty_config_t *cfg, int timeoutMs);
+
+/* The sizes, in bytes, of the kernel buffers the agent requests for its data
+ * pipes: the output buffer of the CONOUT and CONERR pipes, and the input
+ * buffer of the CONIN pipe.  Windows treats them as advisory.  Larger buffers
+ * let bulk output get further ahead of the client; smaller ones use less
+ * nonpaged pool for many idle sessions.  Both must be at least 0.  The
+ * defaults are 8192 and 256. */
+WINPTY_API void
+winpty_config_set_pipe_buffer_sizes(winpty_config_t *cfg,
+                                    int outputBytes, int inputBytes);
+
+/* The largest single read or write the agent issues on a data pipe, which is
+ * also the size of each read buffer and output chunk the agent allocates.
+ * Must be between WINPTY_PIPE_IO_SIZE_MIN and WINPTY_PIPE_IO_SIZE_MAX.  The
+ * default is 64KiB. */
+WINPTY_API void
+winpty_config_set_pipe_io_size(winpty_config_t *cfg, int bytes);
+
+/* Bounds the scrollback the agent sends during an output flood.  If more
+ * than this many lines scroll past the top of the console window between two
+ * polls, the agent skips them and sends only the final window content, after
+ * a single blank line.  The skipped lines never reach the terminal's
+ * scrollback; WINPTY_STAT_SKIPPED_LINES counts them.  A budget smaller than
+ * the window height acts like the window height.  Must be at least 0.  The
+ * default, 0, sends every line. */
+WINPTY_API void
+winpty_config_set_scrollback_budget(winpty_config_t *cfg, int lines);
+
 
 
 /*****************************************************************************
@@ -144,6 +196,50 @@ WINPTY_API LPCWSTR winpty_conin_name(winpty_t *wp);
 WINPTY_API LPCWSTR winpty_conout_name(winpty_t *wp);
 WINPTY_API LPCWSTR winpty_conerr_name(winpty_t *wp);
 
+/* Connects to one of the data pipes (a WINPTY_PIPE_xxx value) and returns
+ * the handle, which is opened for overlapped I/O in the pipe's direction.  If
+ * iocp is not NULL, the handle is also associated with that I/O completion
+ * port using completionKey, so a server hosting many sessions can service
+ * all of their pipes from a few threads.  Returns NULL on error, including
+ * when the pipe doesn't exist (e.g. CONERR without WINPTY_FLAG_CONERR, or
+ * CONOUT with WINPTY_FLAG_SHARED_MEMORY_OUTPUT).  Each pipe accepts a single
+ * connection.  The caller closes the handle. */
+WINPTY_API HANDLE
+winpty_open_pipe(winpty_t *wp, int pipe,
+                 HANDLE iocp /*OPTIONAL*/, ULONG_PTR completionKey,
+                 winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Receives output from winpty_set_output_callback.  pipe is
+ * WINPTY_PIPE_CONOUT or WINPTY_PIPE_CONERR.  A size of 0 means that the
+ * pipe has closed (or is being closed by winpty_free), and is the final call
+ * for that pipe.  The data is only valid during the call. */
+typedef void (CALLBACK *winpty_output_callback_t)(void *context, int pipe,
+                                                  const void *data, int size);
+
+/* Connects to CONOUT (and CONERR, with WINPTY_FLAG_CONERR) and delivers its
+ * output to callback on the system thread pool, so no client thread needs to
+ * block reading each session's pipes.  Each pipe has one read pending at a
+ * time, so calls for one pipe are serialized, but calls for different pipes
+ * or sessions may run concurrently.  The callback must not call winpty_free
+ * for its own session, which waits for the callbacks to finish.  Fails with
+ * WINPTY_FLAG_SHARED_MEMORY_OUTPUT, or if the pipes are already connected.
+ * May be called once per session. */
+WINPTY_API BOOL
+winpty_set_output_callback(winpty_t *wp, winpty_output_callback_t callback,
+                           void *context,
+                           winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* With WINPTY_FLAG_SHARED_MEMORY_OUTPUT, reads up to size bytes of CONOUT
+ * output into buf.  Waits up to timeoutMs (which may be 0 or INFINITE) for
+ * output to arrive.  Returns the number of bytes read, which is 0 if the wait
+ * timed out.  Returns -1 on error, including once the agent has closed CONOUT
+ * (see WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN) and all of its output has been read,
+ * which is reported as WINPTY_ERROR_LOST_CONNECTION.  Calls from different
+ * threads are serialized. */
+WINPTY_API int
+winpty_read_output(winpty_t *wp, void *buf, int size, DWORD timeoutMs,
+                   winpty_error_ptr_t *err /*OPTIONAL*/);
+
 
 
 /*****************************************************************************
@@ -159,7 +255,8 @@ typedef struct winpty_spawn_config_s winpty_spawn_config_t;
  *
  * env is a a pointer to an environment block like that passed to
  * CreateProcess--a contiguous array of NUL-terminated "VAR=VAL" strings
- * followed by a final NUL terminator.
+ * followed by a final NUL terminator.  With WINPTY_SPAWN_FLAG_ENV_DELTA, it
+ * lists only the variables to change.
  *
  * N.B.: If you want to gather all of the child's output, you may want the
  * WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN flag.
@@ -192,9 +289,15 @@ WINPTY_API void winpty_spawn_config_free(winpty_spawn_config_t *cfg);
  * to GetLastError(), and the WINPTY_ERROR_SPAWN_CREATE_PROCESS_FAILED error
  * is returned.
  *
- * winpty_spawn can only be called once per winpty_t object.  If it is called
- * before the output data pipe(s) is/are connected, then collected output is
- * buffered until the pipes are connected, rather than being discarded.
+ * winpty_spawn may be called again to start more processes in the same
+ * console, one after another or side by side, e.g. to run a series of
+ * commands without starting a new agent for each.  Wait on each process
+ * handle to learn when that process exits.  The spawn flags apply to the most
+ * recently started process, so an auto-shutdown spawn ends the session when
+ * it exits; see also WINPTY_SPAWN_FLAG_RESET_TERMINAL.  No spawn may follow
+ * an auto-shutdown.  If it is called before the output data pipe(s) is/are
+ * connected, then collected output is buffered until the pipes are connected,
+ * rather than being discarded.
  *
  * N.B.: GetProcessId works even if the process has exited.  The PID is not
  * recycled until the NT process object is freed.
@@ -210,6 +313,23 @@ winpty_spawn(winpty_t *wp,
 
 
 
+/* Starts the agent and spawns the process in one call, as if by winpty_open
+ * followed by winpty_spawn.  The spawn request is sent without waiting for
+ * the agent's startup reply, so the child starts sooner.  Returns NULL on
+ * error, including when the agent's CreateProcess call failed, in which case
+ * the agent is shut down, *create_process_error is set, and the
+ * WINPTY_ERROR_SPAWN_CREATE_PROCESS_FAILED error is returned.  winpty_spawn
+ * must not be called on the returned object. */
+WINPTY_API winpty_t *
+winpty_open_and_spawn(const winpty_config_t *cfg,
+                      const winpty_spawn_config_t *spawnCfg,
+                      HANDLE *process_handle /*OPTIONAL*/,
+                      HANDLE *thread_handle /*OPTIONAL*/,
+                      DWORD *create_process_error /*OPTIONAL*/,
+                      winpty_error_ptr_t *err /*OPTIONAL*/);
+
+
+
 /*****************************************************************************
  * winpty agent RPC calls: everything else */
 
@@ -218,14 +338,209 @@ WINPTY_API BOOL
 winpty_set_size(winpty_t *wp, int cols, int rows,
                 winpty_error_ptr_t *err /*OPTIONAL*/);
 
+/* Attaches another reader to CONOUT, e.g. a second terminal that mirrors the
+ * session for pairing or auditing, and returns the read end of its pipe,
+ * opened for overlapped I/O.  The agent encodes each frame once and queues it
+ * for CONOUT and every observer, so an observer costs little CPU.  A new
+ * observer starts with a repaint of the console window (and the title),
+ * which CONOUT and the other observers also receive.  An observer that falls
+ * more than a few MiB behind is disconnected instead of slowing the session;
+ * it can attach again.  Observers are closed along with CONOUT.  Up to eight
+ * observers can be attached at once.  Returns NULL on error, including with
+ * WINPTY_FLAG_PSEUDOCONSOLE.  The caller closes the handle. */
+WINPTY_API HANDLE
+winpty_attach_output_observer(winpty_t *wp,
+                              winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Records everything the agent writes to CONOUT to the file at `path`, with
+ * the time of each write and of each resize, in one of the
+ * WINPTY_RECORDING_* formats.  The file is replaced if it exists.  Output is
+ * recorded as sent, before WINPTY_FLAG_COMPRESSED_OUTPUT compression.  The
+ * agent buffers the records and a thread of its own writes them about ten
+ * times a second, so recording doesn't slow the session.  A NULL or empty
+ * path stops recording, and the file is complete once this call returns.
+ * Starting a new recording stops the previous one.  Recording also stops when
+ * the agent exits. */
+WINPTY_API BOOL
+winpty_set_output_recording(winpty_t *wp, LPCWSTR path /*OPTIONAL*/,
+                            int format,
+                            winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Tells the agent whether the client is showing this session, e.g. whether
+ * its terminal tab is the selected one.  While a session is hidden, the agent
+ * polls the console about once a second, and sends output at that rate.  A
+ * full-screen program's console (one whose buffer is no taller than its
+ * window) isn't read at all.  When the session becomes visible again, the
+ * agent scrapes at once, and the terminal catches up in one frame.  Sessions
+ * start out visible.  This has no effect with WINPTY_FLAG_PSEUDOCONSOLE. */
+WINPTY_API BOOL
+winpty_set_visibility(winpty_t *wp, BOOL visible,
+                      winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Switches the session to frame-on-demand output, for a client that renders
+ * at its own frame rate, and returns an auto-reset event that the agent
+ * signals when there is output to request.  From then on, the agent sends
+ * CONOUT output only in response to winpty_request_frame, as one frame that
+ * brings the terminal up to date with everything since the last one.  The
+ * event is signaled once per frame, so a client may wait on it, request a
+ * frame, and wait again.  Without WINPTY_FLAG_EVENT_DRIVEN_SCRAPE, the agent
+ * can't tell cheaply whether the console changed, so the event is signaled
+ * after each frame, and a request may produce no output.  A scrolling-mode
+ * console is still scraped about once a second when no frame has been
+ * requested, so that its lines don't scroll out of the console buffer, and
+ * the child's final output is sent without a request.  The first call
+ * switches the mode; later calls return the same handle.  The handle is
+ * valid for the lifetime of the winpty_t object.  Do not close it.  Returns
+ * NULL on error, and with WINPTY_FLAG_PSEUDOCONSOLE. */
+WINPTY_API HANDLE
+winpty_frame_activity_event(winpty_t *wp,
+                            winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Asks the agent to scrape the console and send a frame of output to CONOUT.
+ * The call returns once the agent has the request, not once the frame is
+ * written.  Requires an earlier winpty_frame_activity_event call. */
+WINPTY_API BOOL
+winpty_request_frame(winpty_t *wp, winpty_error_ptr_t *err /*OPTIONAL*/);
+
 /* Gets a list of processes attached to the console. */
 WINPTY_API int
 winpty_get_console_process_list(winpty_t *wp, int *processList, const int processCount,
                                 winpty_error_ptr_t *err /*OPTIONAL*/);
 
+/* Returns an auto-reset event that the agent signals when a process attaches
+ * to or detaches from the console, so a client can wait on it rather than
+ * polling winpty_get_console_process_list.  The agent checks the list every
+ * 100ms or so once the event exists.  The first call asks the agent to start
+ * watching; later calls return the same handle.  The handle is valid for the
+ * lifetime of the winpty_t object.  Do not close it.  Returns NULL on
+ * error. */
+WINPTY_API HANDLE
+winpty_process_list_event(winpty_t *wp,
+                          winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Gets the durations of the startup phases of this winpty_t object, in
+ * microseconds.  statsUs[i] is set to the WINPTY_STARTUP_STAT_xxx value i,
+ * for each i less than both statCount and WINPTY_STARTUP_STAT_COUNT.  A phase
+ * that hasn't happened yet is reported as -1.  Returns the number of stats
+ * known (WINPTY_STARTUP_STAT_COUNT), or -1 on error. */
+WINPTY_API int
+winpty_get_startup_stats(winpty_t *wp, INT64 *statsUs, int statCount,
+                         winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Gets the agent's statistics on freezing the console, which blocks the
+ * programs writing to it.  stats[i] is set to the WINPTY_FREEZE_STAT_xxx
+ * value i, for each i less than statCount; stats the agent doesn't report are
+ * set to 0.  Returns the number of stats the agent reported, or -1 on
+ * error. */
+WINPTY_API int
+winpty_get_freeze_stats(winpty_t *wp, INT64 *stats, int statCount,
+                        winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Gets the latency of the agent's poll ticks, phase by phase, to attribute
+ * stalls.  stats[i] is set to the tick stat i (see WINPTY_TICK_STAT_COUNT),
+ * for each i less than statCount; stats the agent doesn't report are set to
+ * 0.  Returns the number of stats the agent reported, or -1 on error.  The
+ * agent also traces each tick slower than 50ms. */
+WINPTY_API int
+winpty_get_tick_stats(winpty_t *wp, INT64 *stats, int statCount,
+                      winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Gets the agent's session counters.  stats[i] is set to the
+ * WINPTY_STAT_xxx value i, for each i less than statCount; counters the agent
+ * doesn't report are set to 0.  The agent keeps the counters as it runs, so
+ * this call is cheap enough to poll.  Returns the number of counters the
+ * agent reported, or -1 on error. */
+WINPTY_API int
+winpty_get_stats(winpty_t *wp, INT64 *stats, int statCount,
+                 winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Gets the current contents of the console window in one call, e.g. so a
+ * reconnecting client can redraw without replaying the output history.  The
+ * window's cells are copied to cells in row-major order, up to cellCount of
+ * them.  The window size, and the cursor position relative to the window, are
+ * written to the non-NULL output parameters.  *cursorVisible is FALSE if the
+ * cursor is hidden or outside the window.  Returns the number of cells in the
+ * window (cols * rows), which may exceed cellCount, or -1 on error.  Call
+ * with cellCount 0 to query the size. */
+WINPTY_API int
+winpty_get_screen_snapshot(winpty_t *wp, CHAR_INFO *cells, int cellCount,
+                           int *cols /*OPTIONAL*/, int *rows /*OPTIONAL*/,
+                           int *cursorCol /*OPTIONAL*/,
+                           int *cursorRow /*OPTIONAL*/,
+                           BOOL *cursorVisible /*OPTIONAL*/,
+                           winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Copies CONOUT output retained by WINPTY_FLAG_OUTPUT_JOURNAL, starting at
+ * byte offset `since` of the CONOUT stream, to buf.  The offset is the count
+ * of CONOUT bytes the client has read, so a reconnecting client passes the
+ * amount it had read before the connection was lost.  *endPos (if non-NULL)
+ * is set to the offset of the end of the output produced so far; the call
+ * copies at most size bytes, so repeat it until the copied bytes reach
+ * *endPos.  Returns the number of bytes copied, or -1 on error.  If the
+ * journal has already discarded the output at `since`, the call fails with
+ * WINPTY_ERROR_OUTPUT_NOT_RETAINED and the client should redraw from
+ * winpty_get_screen_snapshot instead. */
+WINPTY_API int
+winpty_get_output_since(winpty_t *wp, UINT64 since, void *buf, int size,
+                        UINT64 *endPos /*OPTIONAL*/,
+                        winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Copies lines kept by WINPTY_FLAG_HISTORY_STORE, starting at firstLine.
+ * History lines are numbered from 0 in the order they scrolled above the
+ * console window.  The cells of up to lineCount lines are copied to cells,
+ * one line after another, and each line's width to lineWidths, which must
+ * hold lineCount entries.  Copying stops before a line that doesn't fit in
+ * cellCount cells, at the end of the history, or at an agent limit of about
+ * 64K cells per call.  *totalLines (if non-NULL) is set to the number of
+ * lines in the history.  Returns the number of lines copied, or -1 on
+ * error. */
+WINPTY_API int
+winpty_get_history(winpty_t *wp, UINT64 firstLine, int lineCount,
+                   CHAR_INFO *cells, int cellCount, int *lineWidths,
+                   UINT64 *totalLines /*OPTIONAL*/,
+                   winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Finds the WINPTY_FLAG_HISTORY_STORE lines that contain query, searching
+ * from fromLine toward the end of the history, or toward line 0 with
+ * WINPTY_SEARCH_FLAG_BACKWARD.  The matching line numbers (as in
+ * winpty_get_history) are written to lines, up to maxResults of them, or
+ * 1024 per call; to continue a search, call again from the line past the
+ * last match.  The agent indexes the history as it grows, so a search skips
+ * most of the lines that can't match.  Returns the number of matches, or -1
+ * on error. */
+WINPTY_API int
+winpty_search_history(winpty_t *wp, LPCWSTR query, UINT64 fromLine,
+                      UINT64 flags, UINT64 *lines, int maxResults,
+                      winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Decodes output produced with WINPTY_FLAG_COMPRESSED_OUTPUT.  The object is
+ * independent of any winpty_t, so the output may be decoded wherever it was
+ * forwarded to.  It is not thread-safe. */
+typedef struct winpty_decompressor_s winpty_decompressor_t;
+
+/* Allocates a decompressor.  Returns NULL on error. */
+WINPTY_API winpty_decompressor_t *
+winpty_decompressor_new(winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Passes compressed bytes, in pieces of any size, to the decompressor, which
+ * decodes each frame once it has all of it.  Returns FALSE on error, e.g. if
+ * the stream is malformed, after which the decompressor is unusable. */
+WINPTY_API BOOL
+winpty_decompressor_write(winpty_decompressor_t *d,
+                          const void *data, int size,
+                          winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Copies up to size decoded bytes to buf and returns the number copied, which
+ * is 0 once the decoded output has all been read. */
+WINPTY_API int
+winpty_decompressor_read(winpty_decompressor_t *d, void *buf, int size);
+
+WINPTY_API void winpty_decompressor_free(winpty_decompressor_t *d);
+
 /* Frees the winpty_t object and the OS resources contained in it.  This
  * call breaks the connection with the agent, which should then close its
- * console, terminating the processes attached to it.
+ * console, terminating the processes attached to it.  Asynchronous requests
+ * already queued are completed first.
  *
  * This function must not be called if any other threads are using the
  * winpty_t object.  Undefined behavior results. */
@@ -233,6 +548,167 @@ WINPTY_API void winpty_free(winpty_t *wp);
 
 
 
+/*****************************************************************************
+ * Asynchronous agent RPC calls. */
+
+/* The RPC calls above block the calling thread until the agent replies.
+ * Each winpty_xxx_async variant instead queues the request and returns
+ * immediately.  A winpty_t object sends its queued requests from a
+ * background thread, started by the first asynchronous call, writing each
+ * batch of queued requests in a single message before reading the replies,
+ * so e.g. a spawn, a resize, and a stats query cost one round trip.
+ * Requests (synchronous or not) are handled by the agent in the order they
+ * were made.
+ *
+ * If event is non-NULL, it is signaled when the request completes.  It is
+ * duplicated, so the caller may close it at any time.  The winpty_request_t
+ * object is thread-safe. */
+typedef struct winpty_request_s winpty_request_t;
+
+/* Starts a winpty_spawn request.  Returns NULL on error.  The results are
+ * retrieved with winpty_request_spawn_result. */
+WINPTY_API winpty_request_t *
+winpty_spawn_async(winpty_t *wp,
+                   const winpty_spawn_config_t *cfg,
+                   BOOL want_process_handle,
+                   BOOL want_thread_handle,
+                   HANDLE event /*OPTIONAL*/,
+                   winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Starts a winpty_set_size request.  Returns NULL on error.  To resize
+ * without waiting for the result, free the request immediately. */
+WINPTY_API winpty_request_t *
+winpty_set_size_async(winpty_t *wp, int cols, int rows,
+                      HANDLE event /*OPTIONAL*/,
+                      winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Queues a resize of the console window without waiting for it, e.g. while
+ * the user drags a terminal window's border.  Consecutive queued resizes are
+ * collapsed into the last one.  Returns FALSE only if the resize couldn't be
+ * queued; a failure to deliver it is not reported. */
+WINPTY_API BOOL
+winpty_set_size_nowait(winpty_t *wp, int cols, int rows,
+                       winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Starts a winpty_get_console_process_list request.  Returns NULL on error.
+ * The result is retrieved with winpty_request_process_list. */
+WINPTY_API winpty_request_t *
+winpty_get_console_process_list_async(winpty_t *wp,
+                                      HANDLE event /*OPTIONAL*/,
+                                      winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Starts a winpty_get_stats request.  Returns NULL on error.  The result is
+ * retrieved with winpty_request_stats. */
+WINPTY_API winpty_request_t *
+winpty_get_stats_async(winpty_t *wp,
+                       HANDLE event /*OPTIONAL*/,
+                       winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Returns TRUE once the request has completed.  Does not block. */
+WINPTY_API BOOL winpty_request_done(winpty_request_t *req);
+
+/* The functions below must only be called once the request has completed.
+ * Each one returns the result of the request as the corresponding
+ * synchronous call would have. */
+
+/* Returns TRUE if the request succeeded.  Otherwise, returns FALSE and, if
+ * err is non-NULL, sets it to a new error object. */
+WINPTY_API BOOL
+winpty_request_result(winpty_request_t *req,
+                      winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* The result of winpty_get_console_process_list_async. */
+WINPTY_API int
+winpty_request_process_list(winpty_request_t *req,
+                            int *processList, const int processCount,
+                            winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* The result of winpty_get_stats_async. */
+WINPTY_API int
+winpty_request_stats(winpty_request_t *req, INT64 *stats, int statCount,
+                     winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* The result of winpty_spawn_async.  Ownership of the process and thread
+ * handles passes to the caller, so they are only returned once. */
+WINPTY_API BOOL
+winpty_request_spawn_result(winpty_request_t *req,
+                            HANDLE *process_handle /*OPTIONAL*/,
+                            HANDLE *thread_handle /*OPTIONAL*/,
+                            DWORD *create_process_error /*OPTIONAL*/,
+                            winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Frees the request.  It may be called while the request is still pending,
+ * in which case the request still runs, but its result is discarded.
+ * Unclaimed spawn handles are closed. */
+WINPTY_API void winpty_request_free(winpty_request_t *req);
+
+/* Checks the agent's health without blocking, for supervisors that watch
+ * many sessions.  Returns a WINPTY_STATUS_xxx value, or -1 on error.  Each
+ * call that finds no ping in flight queues a new one, like the other
+ * asynchronous requests, so the caller's polling rate sets the ping rate.
+ *
+ * If latencyMs is non-NULL, it is set to the round-trip time of the ping
+ * that just completed (WINPTY_STATUS_OK), or to the time the pending
+ * ping has waited so far (WINPTY_STATUS_PENDING).  A pending ping that keeps
+ * growing indicates a slow or hung agent.  A ping that isn't answered
+ * within the agent timeout fails, and the session is then reported dead. */
+WINPTY_API int
+winpty_poll_status(winpty_t *wp, DWORD *latencyMs /*OPTIONAL*/,
+                   winpty_error_ptr_t *err /*OPTIONAL*/);
+
+
+
+/*****************************************************************************
+ * Pool of pre-started agents. */
+
+/* Starting an agent takes tens to hundreds of milliseconds.  A pool keeps
+ * agents started ahead of time with a single configuration, so that opening a
+ * session only claims an idle agent and sets its console size.  The
+ * winpty_pool_t object is thread-safe. */
+typedef struct winpty_pool_s winpty_pool_t;
+
+/* Creates a pool that keeps count idle agents started with cfg.  The cfg is
+ * copied, so it may be freed afterward.  Agents are started, and replaced as
+ * they are claimed, on a background thread.  Returns NULL on error.
+ * WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION is not supported and results in
+ * an assertion failure. */
+WINPTY_API winpty_pool_t *
+winpty_pool_new(const winpty_config_t *cfg, int count,
+                winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Like winpty_pool_new, but each agent also spawns spawn_cfg as it starts,
+ * so a claimed agent's shell is already running and waiting at its prompt.
+ * Output the shell writes before the client connects to the CONOUT pipe stays
+ * queued in the agent and is delivered once it connects.  An idle agent whose
+ * shell has exited is discarded rather than handed out.  spawn_cfg is copied,
+ * so it may be freed afterward.  If a shell cannot be started while the pool
+ * is refilling, the pool tries again at the next claim; if it fails in winpty_pool_open's
+ * fallback, winpty_pool_open returns NULL. */
+WINPTY_API winpty_pool_t *
+winpty_pool_new_with_shell(const winpty_config_t *cfg,
+                           const winpty_spawn_config_t *spawn_cfg,
+                           int count,
+                           winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Claims an idle agent from the pool and resizes its console to cols x rows.
+ * If no agent is idle, then one is started as winpty_open would.  Returns
+ * NULL on error.  The result is independent of the pool and is freed with
+ * winpty_free. */
+WINPTY_API winpty_t *
+winpty_pool_open(winpty_pool_t *pool, int cols, int rows,
+                 winpty_error_ptr_t *err /*OPTIONAL*/);
+
+/* Frees the pool and its idle agents.  Agents already claimed with
+ * winpty_pool_open are unaffected.  Blocks if an agent is being started. */
+WINPTY_API void winpty_pool_free(winpty_pool_t *pool);
+
+/* Returns the handle of the shell a winpty_pool_new_with_shell pool spawned in
+ * this agent, and transfers its ownership to the caller, who must close it.
+ * Returns NULL on later calls, and for agents started without a shell. */
+WINPTY_API HANDLE winpty_shell_process(winpty_t *wp);
+
+
+
 /****************************************************************************/
 
 #ifdef __cplusplus
@@ -42,6 +42,7 @@
 #define WINPTY_ERROR_AGENT_DIED                     6
 #define WINPTY_ERROR_AGENT_TIMEOUT                  7
 #define WINPTY_ERROR_AGENT_CREATION_FAILED          8
+#define WINPTY_ERROR_OUTPUT_NOT_RETAINED            9
 
 
 
@@ -76,13 +77,249 @@
  * See https://github.com/rprichard/winpty/issues/58. */
 #define WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION 0x8ull
 
+/* Scrape the console only when it reports a change (via the EVENT_CONSOLE_*
+ * WinEvents) rather than on every poll.  The agent still scrapes
+ * periodically, at a much slower rate, in case it misses an event.  This
+ * reduces the CPU cost of idle consoles and the latency of busy ones. */
+#define WINPTY_FLAG_EVENT_DRIVEN_SCRAPE 0x10ull
+
+/* Wrap the output of each console scrape in "synchronized update" markers
+ * (DEC private mode 2026), so that a terminal that supports them can render
+ * each frame atomically.  Terminals that don't support the mode ignore the
+ * markers.  This flag has no effect with WINPTY_FLAG_PLAIN_OUTPUT. */
+#define WINPTY_FLAG_SYNCHRONIZED_OUTPUT 0x20ull
+
+/* Before Windows 10, the agent freezes the console (blocking the programs
+ * writing to it) on every scrape.  With this flag, it first tries to scrape
+ * without freezing, as it does on Windows 10, and falls back to freezing if
+ * the console changes during the scrape.  Each read is bounds-checked against
+ * the current buffer size, but a program that shrinks the screen buffer at
+ * exactly the wrong moment could still crash the agent (see
+ * misc/WindowsBugCrashReader.cc), so the behavior is opt-in. */
+#define WINPTY_FLAG_LEGACY_TENTATIVE_SCRAPE 0x40ull
+
+/* To track scrolling, the agent normally writes "sync marker" text into the
+ * console's scrollback every few hundred lines of output.  With this flag, it
+ * instead remembers the content hashes of a few distinct scrollback lines and
+ * searches for them later, so tracking takes only console reads.  When there
+ * are no suitable lines (e.g. the scrollback is blank or repetitive), or the
+ * console is resized, the agent still writes a marker.  The lines could
+ * reappear elsewhere by coincidence, which would garble the terminal's
+ * scrollback, so the behavior is opt-in. */
+#define WINPTY_FLAG_FINGERPRINT_SCROLL 0x80ull
+
+/* Deliver CONOUT output through a ring buffer in shared memory, read with
+ * winpty_read_output, instead of through the CONOUT named pipe.  This avoids
+ * a pair of kernel copies and most of the syscalls per chunk of output, but
+ * the client must be on the same machine and session as the agent, which it
+ * always is when it calls winpty_open.  With this flag, winpty_conout_name
+ * returns NULL.  CONERR output still uses a pipe. */
+#define WINPTY_FLAG_SHARED_MEMORY_OUTPUT 0x100ull
+
+/* Send the console's cells on CONOUT (and CONERR) in the binary cell-stream
+ * format described below, instead of as VT escape sequences, for clients
+ * that render a cell grid themselves.  WINPTY_FLAG_PLAIN_OUTPUT,
+ * WINPTY_FLAG_COLOR_ESCAPES, and WINPTY_FLAG_SYNCHRONIZED_OUTPUT have no
+ * effect with this flag. */
+#define WINPTY_FLAG_CELL_STREAM_OUTPUT 0x200ull
+
+/* Have the agent retain the most recent CONOUT output (about a megabyte) so
+ * that a client that loses its place, e.g. after reconnecting, can fetch the
+ * output it missed with winpty_get_output_since. */
+#define WINPTY_FLAG_OUTPUT_JOURNAL 0x400ull
+
+/* Compress the CONOUT (and CONERR) output, e.g. for a client that forwards it
+ * over a slow link.  The output is a series of independently compressed
+ * frames, usually one per scrape, which the client decodes with a
+ * winpty_decompressor_t.  The frame format is: a UINT32 header whose low
+ * 31 bits are the payload size and whose high bit is set if the payload is
+ * stored uncompressed, a UINT32 uncompressed size, and the payload, which is
+ * otherwise an LZ4 block.  (Integers are little-endian.)  With
+ * WINPTY_FLAG_OUTPUT_JOURNAL, the journal holds the compressed bytes, so a
+ * replay must resume at a frame boundary. */
+#define WINPTY_FLAG_COMPRESSED_OUTPUT 0x800ull
+
+/* Declares that the terminal rewraps lines that no longer fit when it gets
+ * narrower, as the Windows 10 console does.  The agent then expects the
+ * terminal to have split those lines itself after a resize and sends only
+ * the lines the console wrapped differently, instead of every line below
+ * the first one that moved.  Only the new Windows 10 console rewraps, so
+ * the flag has no effect elsewhere, or with WINPTY_FLAG_PLAIN_OUTPUT or
+ * WINPTY_FLAG_CELL_STREAM_OUTPUT. */
+#define WINPTY_FLAG_TERMINAL_REFLOW 0x1000ull
+
+/* After 30 seconds without any pipe traffic, the agent releases its scratch
+ * buffers and idle pipe queues, and trims its working set.  The buffers are
+ * reallocated when traffic resumes.  This packs more idle sessions onto a
+ * host, at the cost of a few allocations when a session wakes up. */
+#define WINPTY_FLAG_IDLE_TRIM 0x2000ull
+
+/* Unfreeze the console asynchronously.  To freeze the console, the agent sends
+ * the console window a message that enters selection mode, and to unfreeze
+ * it, a message that cancels the selection.  By default, the agent waits for
+ * conhost to handle both messages.  With this flag, it queues the unfreeze
+ * message and moves on.  The messages are still handled in order, so the next
+ * freeze can't overtake the previous unfreeze. */
+#define WINPTY_FLAG_ASYNC_UNFREEZE 0x4000ull
+
+/* Run the child in a Windows pseudoconsole (Windows 10 1809 and later) and
+ * relay its VT output and input unchanged, instead of scraping the console.
+ * The agent doesn't poll or freeze the console, and conhost does the
+ * rendering.  Where the pseudoconsole API is missing, and with
+ * WINPTY_FLAG_CONERR, WINPTY_FLAG_PLAIN_OUTPUT, or
+ * WINPTY_FLAG_CELL_STREAM_OUTPUT, the agent scrapes as usual.  The
+ * screen-snapshot call still reads the agent's own console, so it isn't
+ * meaningful in this mode. */
+#define WINPTY_FLAG_PSEUDOCONSOLE 0x8000ull
+
+/* Lower the agent's thread priority while its session produces bulk output
+ * without terminal input (e.g. a build spewing logs), and restore it as soon
+ * as input arrives.  Since every session has its own agent process, this lets
+ * the system scheduler give the agents of interactive sessions precedence
+ * over busy ones on a loaded host. */
+#define WINPTY_FLAG_BULK_PRIORITY 0x10000ull
+
+/* Send colors as the exact 24-bit values of the console's palette (SGR 38;2
+ * and 48;2), instead of mapping them onto the terminal's 16 colors with
+ * heuristics that favor the terminal's default colors.  Underscore and
+ * reverse video are sent as SGR 4 and 7, and each SGR sequence changes only
+ * what differs from the previous cell.  The palette is reread every second,
+ * so a changed color scheme applies to the output from then on.  Requires
+ * Vista or later, and has no effect with WINPTY_FLAG_CELL_STREAM_OUTPUT,
+ * which sends the attributes themselves. */
+#define WINPTY_FLAG_TRUE_COLOR_OUTPUT 0x20000ull
+
+/* Shorten runs of a repeated character in VT output with REP (CSI n b),
+ * which repeats the preceding character n more times.  Runs of ASCII and of
+ * the box drawing and block elements qualify, which covers most TUI borders,
+ * rules, and runs of colored blanks.  Only set it if the terminal supports
+ * REP.  It has no effect with WINPTY_FLAG_PLAIN_OUTPUT or
+ * WINPTY_FLAG_CELL_STREAM_OUTPUT. */
+#define WINPTY_FLAG_REPEAT_CHAR_OUTPUT 0x40000ull
+
+/* Append-only plain text for log capture.  It implies
+ * WINPTY_FLAG_PLAIN_OUTPUT, without color escapes.  Each line is written
+ * exactly once, when a later line is written, and is never rewritten, so a
+ * log never repeats a line that was redrawn in place (e.g. a progress bar
+ * shows only its final state).  The last line is written when the child
+ * exits.  Clearing the console starts the new lines on a line of their
+ * own. */
+#define WINPTY_FLAG_LOG_OUTPUT 0x80000ull
+
+/* After 10 seconds without any pipe traffic, the agent lowers its process
+ * priority to below normal and opts into power throttling (EcoQoS, on
+ * Windows 10 1709 and later), so idle sessions, e.g. in background tabs,
+ * don't compete with active ones.  Terminal input restores normal priority
+ * immediately, and any other traffic restores it at the next poll. */
+#define WINPTY_FLAG_IDLE_ECO_QOS 0x100000ull
+
+/* Read and translate terminal input on a thread of its own, so keystrokes
+ * reach the console while the agent is busy scraping a large buffer or has
+ * the console frozen.  It is ignored with WINPTY_FLAG_PSEUDOCONSOLE. */
+#define WINPTY_FLAG_INPUT_THREAD 0x200000ull
+
+/* Have the agent keep every line that scrolls above the console window in a
+ * temporary file, so that a client can fetch old output with
+ * winpty_get_history instead of keeping all of it.  Lines skipped because of
+ * the scrollback budget aren't kept. */
+#define WINPTY_FLAG_HISTORY_STORE 0x400000ull
+
+/* On a wide console, read only as many columns as the text has recently
+ * needed (plus a margin), rather than the whole width of the buffer, and
+ * check with a full-width read about every 250ms.  A read that finds text
+ * reaching its last column is redone at full width at once, so text that
+ * grows along a line is never missed.  Text written further out in one step
+ * (e.g. past a run of spaces) shows up at the next full-width read; in
+ * scrolling mode, it can be lost if it scrolls above the window before
+ * then, so the behavior is opt-in.  Full-screen programs' consoles are read
+ * whole, as usual. */
+#define WINPTY_FLAG_TRIM_WIDE_READS 0x800000ull
+
+/* Write to the CONOUT and CONERR pipes from a thread of their own, so the
+ * pipes keep draining while the agent is busy scraping a large buffer or has
+ * the console frozen.  CONOUT ignores it with
+ * WINPTY_FLAG_SHARED_MEMORY_OUTPUT. */
+#define WINPTY_FLAG_OUTPUT_THREAD 0x1000000ull
+
 #define WINPTY_FLAG_MASK (0ull \
     | WINPTY_FLAG_CONERR \
     | WINPTY_FLAG_PLAIN_OUTPUT \
     | WINPTY_FLAG_COLOR_ESCAPES \
     | WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION \
+    | WINPTY_FLAG_EVENT_DRIVEN_SCRAPE \
+    | WINPTY_FLAG_SYNCHRONIZED_OUTPUT \
+    | WINPTY_FLAG_LEGACY_TENTATIVE_SCRAPE \
+    | WINPTY_FLAG_FINGERPRINT_SCROLL \
+    | WINPTY_FLAG_SHARED_MEMORY_OUTPUT \
+    | WINPTY_FLAG_CELL_STREAM_OUTPUT \
+    | WINPTY_FLAG_OUTPUT_JOURNAL \
+    | WINPTY_FLAG_COMPRESSED_OUTPUT \
+    | WINPTY_FLAG_TERMINAL_REFLOW \
+    | WINPTY_FLAG_IDLE_TRIM \
+    | WINPTY_FLAG_ASYNC_UNFREEZE \
+    | WINPTY_FLAG_PSEUDOCONSOLE \
+    | WINPTY_FLAG_BULK_PRIORITY \
+    | WINPTY_FLAG_TRUE_COLOR_OUTPUT \
+    | WINPTY_FLAG_REPEAT_CHAR_OUTPUT \
+    | WINPTY_FLAG_LOG_OUTPUT \
+    | WINPTY_FLAG_IDLE_ECO_QOS \
+    | WINPTY_FLAG_INPUT_THREAD \
+    | WINPTY_FLAG_HISTORY_STORE \
+    | WINPTY_FLAG_TRIM_WIDE_READS \
+    | WINPTY_FLAG_OUTPUT_THREAD \
 )
 
+/* The WINPTY_FLAG_CELL_STREAM_OUTPUT format.  All integers are
+ * little-endian.  The stream is a series of frames, one per scrape, each
+ * consisting of a UINT32 byte count followed by that many bytes of records.
+ * Each record is a UINT8 type, a UINT32 payload byte count, and the payload.
+ * Clients should skip records of unknown types.
+ *
+ * Lines are numbered as the VT output would number them: a line past the
+ * last one the client has seen scrolls the terminal up, as a newline on the
+ * bottom row would.
+ *
+ * Cell attributes are the console's: the FOREGROUND_xxx and BACKGROUND_xxx
+ * bits, COMMON_LVB_REVERSE_VIDEO (0x4000), and COMMON_LVB_UNDERSCORE
+ * (0x8000). */
+
+/* Clear the terminal.  Payload: INT64 line, the number of the top line. */
+#define WINPTY_CELL_RECORD_CLEAR        1
+/* Overwrite a span of one line.  Payload: INT64 line, UINT16 column, UINT16
+ * cellCount, UINT16 runCount, then cellCount UINT32 code points (0 for a
+ * cell that continues a wide character), then runCount pairs of UINT16
+ * attributes and UINT16 cell count, covering the span.  Cells outside the
+ * span are unchanged. */
+#define WINPTY_CELL_RECORD_LINE         2
+/* Cursor state.  Payload: INT64 line, UINT16 column, UINT8 visible. */
+#define WINPTY_CELL_RECORD_CURSOR       3
+/* Scroll the lines [top, bottom) up by count lines (down, if count is
+ * negative).  Lines scrolled in are blank.  Payload: INT64 top,
+ * INT64 bottom, INT32 count. */
+#define WINPTY_CELL_RECORD_SCROLL       4
+/* The console title.  Payload: UTF-8 text (not NUL-terminated). */
+#define WINPTY_CELL_RECORD_TITLE        5
+/* Whether the client should send mouse input.  Payload: UINT8 enabled. */
+#define WINPTY_CELL_RECORD_MOUSE_MODE   6
+
+/* Bounds on the agent's data pipe I/O size (see
+ * winpty_config_set_pipe_io_size). */
+#define WINPTY_PIPE_IO_SIZE_MIN         4096
+#define WINPTY_PIPE_IO_SIZE_MAX         (16 * 1024 * 1024)
+
+/* The data pipes, for winpty_open_pipe. */
+#define WINPTY_PIPE_CONIN               0
+#define WINPTY_PIPE_CONOUT              1
+#define WINPTY_PIPE_CONERR              2
+
+/* Bounds on the height of the console screen buffer the agent scrapes (see
+ * winpty_config_set_buffer_lines).  The window is at most 1000 rows shorter
+ * than the buffer, leaving room for the scraper's sync marker, so a taller
+ * buffer also permits a taller window (2000 rows with the minimum).  The
+ * console itself limits the height to a SHORT. */
+#define WINPTY_BUFFER_LINES_MIN         3000
+#define WINPTY_BUFFER_LINES_MAX         32766
+
 /* QuickEdit mode is initially disabled, and the agent does not send mouse
  * mode sequences to the terminal.  If it receives mouse input, though, it
  * still writes MOUSE_EVENT_RECORD values into CONIN. */
@@ -120,12 +357,272 @@
  * agent exits will fail with an I/O or dead-agent error. */
 #define WINPTY_SPAWN_FLAG_EXIT_AFTER_SHUTDOWN 2ull
 
+/* For short-lived processes: implies both flags above, and when the process
+ * exits, the agent scrapes the console immediately and writes the remaining
+ * output with blocking writes (for up to a second) instead of across poll
+ * ticks, then exits.  Output pipes the client hasn't connected yet are still
+ * waited for.  winpty_free never waits for the agent to exit. */
+#define WINPTY_SPAWN_FLAG_FAST_SHUTDOWN 4ull
+
+/* Before starting the process, send the console's remaining output, then
+ * blank the console and clear the terminal, so a new command in a reused
+ * session starts on an empty screen.  Ignored with WINPTY_FLAG_PSEUDOCONSOLE,
+ * where conhost owns the screen. */
+#define WINPTY_SPAWN_FLAG_RESET_TERMINAL 8ull
+
+/* The env block passed to winpty_spawn_config_new holds only the changes to
+ * the agent's environment, which the agent inherited from the process that
+ * called winpty_open (or created the pool).  Each "VAR=VAL" entry adds or
+ * replaces VAR, and an entry of just "VAR" (with no '=') removes it.  This
+ * avoids copying a large environment into every spawn request. */
+#define WINPTY_SPAWN_FLAG_ENV_DELTA 16ull
+
+/* Run the process, and every process it starts, in a job object owned by the
+ * agent.  When the agent shuts down (e.g. after winpty_free, or with
+ * WINPTY_SPAWN_FLAG_EXIT_AFTER_SHUTDOWN), it terminates the whole tree with
+ * one call before closing the console, instead of leaving each process to
+ * handle the console's close event, which can take seconds.  The job also
+ * kills the tree if the agent itself dies.  Processes started with
+ * CREATE_BREAKAWAY_FROM_JOB where the job allows it, and those that attach
+ * to the console from elsewhere, aren't in the job.  If the process can't be
+ * placed in a job (e.g. on Windows 7 when the agent already runs in one), it
+ * runs without. */
+#define WINPTY_SPAWN_FLAG_KILL_TREE 32ull
+
 /* All the spawn flags. */
 #define WINPTY_SPAWN_FLAG_MASK (0ull \
     | WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN \
     | WINPTY_SPAWN_FLAG_EXIT_AFTER_SHUTDOWN \
+    | WINPTY_SPAWN_FLAG_FAST_SHUTDOWN \
+    | WINPTY_SPAWN_FLAG_RESET_TERMINAL \
+    | WINPTY_SPAWN_FLAG_ENV_DELTA \
+    | WINPTY_SPAWN_FLAG_KILL_TREE \
+)
+
+
+/*****************************************************************************
+ * winpty agent RPC call: startup timing. */
+
+/* Indices into the array filled by winpty_get_startup_stats.  The first group
+ * is measured by libwinpty during winpty_open, and the second by the agent
+ * process while it starts. */
+
+/* Creating the background desktop (zero if none is used). */
+#define WINPTY_STARTUP_STAT_DESKTOP_SETUP       0
+/* The CreateProcess call that starts the agent. */
+#define WINPTY_STARTUP_STAT_AGENT_SPAWN         1
+/* Waiting for the agent to connect to the control pipe. */
+#define WINPTY_STARTUP_STAT_PIPE_CONNECT        2
+/* Checking the control pipe client's process ID. */
+#define WINPTY_STARTUP_STAT_VERIFY_PID          3
+/* Waiting for the agent to report its data pipe names. */
+#define WINPTY_STARTUP_STAT_AGENT_READY         4
+/* The whole of winpty_open. */
+#define WINPTY_STARTUP_STAT_OPEN_TOTAL          5
+/* Opening the console screen buffers in the agent. */
+#define WINPTY_STARTUP_STAT_CONSOLE_SETUP       6
+/* Detecting the new Windows 10 console. */
+#define WINPTY_STARTUP_STAT_DETECT_CONSOLE      7
+/* Connecting the control pipe and creating the data pipes. */
+#define WINPTY_STARTUP_STAT_AGENT_PIPES         8
+/* Setting the console font (see ConsoleFont.cc). */
+#define WINPTY_STARTUP_STAT_CONSOLE_FONT        9
+/* The whole of the agent's initialization. */
+#define WINPTY_STARTUP_STAT_AGENT_INIT          10
+/* The agent's first scrape of the console (-1 until it happens). */
+#define WINPTY_STARTUP_STAT_FIRST_SCRAPE        11
+
+/* The number of startup stats. */
+#define WINPTY_STARTUP_STAT_COUNT               12
+
+
+/*****************************************************************************
+ * winpty agent RPC call: console freeze statistics. */
+
+/* Indices into the array filled by winpty_get_freeze_stats.  While the agent
+ * freezes the console to scrape it, programs writing to the console block. */
+
+/* The number of times the console was frozen and unfrozen. */
+#define WINPTY_FREEZE_STAT_FREEZES              0
+/* The total time the console was frozen, in microseconds. */
+#define WINPTY_FREEZE_STAT_TOTAL_US             1
+/* The longest single freeze, in microseconds. */
+#define WINPTY_FREEZE_STAT_MAX_US               2
+/* The number of unfrozen scrapes abandoned (and redone frozen) because the
+ * console changed while it was read. */
+#define WINPTY_FREEZE_STAT_TENTATIVE_ABORTS     3
+/* A histogram of freeze durations: the number of freezes shorter than 100us,
+ * 1ms, 10ms, and 100ms, and the rest. */
+#define WINPTY_FREEZE_STAT_UNDER_100US          4
+#define WINPTY_FREEZE_STAT_UNDER_1MS            5
+#define WINPTY_FREEZE_STAT_UNDER_10MS           6
+#define WINPTY_FREEZE_STAT_UNDER_100MS          7
+#define WINPTY_FREEZE_STAT_OVER_100MS           8
+
+/* The number of freeze stats. */
+#define WINPTY_FREEZE_STAT_COUNT                9
+
+
+/*****************************************************************************
+ * winpty agent RPC call: poll tick latency. */
+
+/* The agent scrapes the console in periodic poll ticks, and it handles no
+ * input or requests while a tick runs.  winpty_get_tick_stats fills an array
+ * with WINPTY_TICK_STAT_FIELD_COUNT stats for each WINPTY_TICK_PHASE_xxx
+ * phase of a tick: the stats of phase p start at index
+ * p * WINPTY_TICK_STAT_FIELD_COUNT. */
+
+/* Applying a pending resize. */
+#define WINPTY_TICK_PHASE_RESIZE                0
+/* Checking the console process list for changes. */
+#define WINPTY_TICK_PHASE_PROCESS_LIST          1
+/* Reading the console input mode and updating the input flags. */
+#define WINPTY_TICK_PHASE_INPUT_FLAGS           2
+/* Checking whether the child has exited. */
+#define WINPTY_TICK_PHASE_CHILD_EXIT            3
+/* Syncing the console title and palette. */
+#define WINPTY_TICK_PHASE_TITLE                 4
+/* Scraping the console buffers, or, with WINPTY_FLAG_PSEUDOCONSOLE, polling
+ * the pseudoconsole. */
+#define WINPTY_TICK_PHASE_SCRAPE                5
+/* Updating the terminal's mouse mode. */
+#define WINPTY_TICK_PHASE_MOUSE_MODE            6
+/* Closing the output pipes once the child has exited. */
+#define WINPTY_TICK_PHASE_SHUTDOWN              7
+/* The idle trim, bulk output, idle EcoQoS, and output observer checks. */
+#define WINPTY_TICK_PHASE_HOUSEKEEPING          8
+/* The whole tick. */
+#define WINPTY_TICK_PHASE_TOTAL                 9
+
+/* The number of tick phases. */
+#define WINPTY_TICK_PHASE_COUNT                 10
+
+/* The stats of each phase: the number of ticks that ran it, its total and
+ * longest durations in microseconds, and a histogram of its durations, like
+ * the freeze stats' histogram. */
+#define WINPTY_TICK_STAT_RUNS                   0
+#define WINPTY_TICK_STAT_TOTAL_US               1
+#define WINPTY_TICK_STAT_MAX_US                 2
+#define WINPTY_TICK_STAT_UNDER_100US            3
+#define WINPTY_TICK_STAT_UNDER_1MS              4
+#define WINPTY_TICK_STAT_UNDER_10MS             5
+#define WINPTY_TICK_STAT_UNDER_100MS            6
+#define WINPTY_TICK_STAT_OVER_100MS             7
+
+/* The number of stats of each phase. */
+#define WINPTY_TICK_STAT_FIELD_COUNT            8
+
+/* The number of tick stats. */
+#define WINPTY_TICK_STAT_COUNT \
+    (WINPTY_TICK_PHASE_COUNT * WINPTY_TICK_STAT_FIELD_COUNT)
+
+
+/*****************************************************************************
+ * winpty agent RPC call: session counters. */
+
+/* Indices into the array filled by winpty_get_stats.  Counters accumulate
+ * from the start of the agent; a caller computes rates (e.g. scrapes per
+ * second) by sampling twice and dividing by the change in
+ * WINPTY_STAT_UPTIME_US. */
+
+/* The time since the agent started, in microseconds. */
+#define WINPTY_STAT_UPTIME_US                   0
+/* The number of console scrapes. */
+#define WINPTY_STAT_SCRAPES                     1
+/* The number of lines sent to the terminal. */
+#define WINPTY_STAT_LINES_SENT                  2
+/* The number of bytes written to the CONOUT and CONERR pipes. */
+#define WINPTY_STAT_CONOUT_BYTES                3
+#define WINPTY_STAT_CONERR_BYTES                4
+/* The number of bytes read from the CONIN pipe. */
+#define WINPTY_STAT_CONIN_BYTES                 5
+/* The number of input records written to the console. */
+#define WINPTY_STAT_INPUT_RECORDS               6
+/* The total time the console was frozen, in microseconds. */
+#define WINPTY_STAT_FREEZE_US                   7
+/* The number of times the scraper lost its sync marker and reset the
+ * terminal. */
+#define WINPTY_STAT_SYNC_MARKER_RESETS          8
+/* The number of times the scraper reset its console tracking, for any
+ * reason (including each sync marker reset). */
+#define WINPTY_STAT_CONSOLE_RESETS              9
+/* Queue depths: the bytes waiting to be written to the CONOUT and CONERR
+ * pipes, and the input bytes not yet written to the console. */
+#define WINPTY_STAT_CONOUT_QUEUED_BYTES         10
+#define WINPTY_STAT_CONERR_QUEUED_BYTES         11
+#define WINPTY_STAT_CONIN_QUEUED_BYTES          12
+/* Memory accounting: the heap bytes currently held by the scraper's tracked
+ * lines, by its console read buffers, by the input decoding map, by the pipe
+ * queues and I/O buffers, and by the trace queue.  Unlike the other counters,
+ * these are current values, not running totals. */
+#define WINPTY_STAT_LINE_MEMORY_BYTES           13
+#define WINPTY_STAT_READ_BUFFER_MEMORY_BYTES    14
+#define WINPTY_STAT_INPUT_MAP_MEMORY_BYTES      15
+#define WINPTY_STAT_PIPE_MEMORY_BYTES           16
+#define WINPTY_STAT_TRACE_MEMORY_BYTES          17
+/* The number of lines skipped because of the scrollback budget (see
+ * winpty_config_set_scrollback_budget). */
+#define WINPTY_STAT_SKIPPED_LINES               18
+/* The number of heap allocations the agent has made (calls to operator new),
+ * and the number its main thread made during its poll ticks.  An idle
+ * session's poll ticks don't allocate, so the second counter stops growing
+ * once the session settles, whatever the agent's I/O threads are doing. */
+#define WINPTY_STAT_HEAP_ALLOCATIONS            19
+#define WINPTY_STAT_POLL_ALLOCATIONS            20
+/* The number of times the scraper lost track of the scroll position (see
+ * WINPTY_STAT_SYNC_MARKER_RESETS) but found the window's content among the
+ * lines already sent, and carried on without resetting the terminal. */
+#define WINPTY_STAT_CONTENT_RESYNCS             21
+
+/* The number of session counters. */
+#define WINPTY_STAT_COUNT                       22
+
+
+
+/*****************************************************************************
+ * winpty agent RPC call: history search (see winpty_search_history). */
+
+/* Match ASCII letters regardless of case. */
+#define WINPTY_SEARCH_FLAG_IGNORE_CASE 1ull
+
+/* Search from the given line toward line 0, returning the nearest matches
+ * first. */
+#define WINPTY_SEARCH_FLAG_BACKWARD 2ull
+
+/* All the search flags. */
+#define WINPTY_SEARCH_FLAG_MASK (0ull \
+    | WINPTY_SEARCH_FLAG_IGNORE_CASE \
+    | WINPTY_SEARCH_FLAG_BACKWARD \
 )
 
 
 
+/*****************************************************************************
+ * Session recording formats (see winpty_set_output_recording). */
+
+/* asciicast v2: a JSON header line, then one [seconds, "o", data] line per
+ * write and one [seconds, "r", "COLSxROWS"] line per resize. */
+#define WINPTY_RECORDING_ASCIICAST              0
+
+/* An 8-byte "WPTYREC1" magic, an int64 Unix start time in seconds, and int32
+ * cols and rows, followed by records, each an int64 time in microseconds
+ * since the start, a uint32 type (0 for output, 1 for a resize), a uint32
+ * size, and that many bytes.  A resize's bytes are int32 cols and rows.
+ * Integers are little-endian. */
+#define WINPTY_RECORDING_BINARY                 1
+
+
+
+/*****************************************************************************
+ * Agent health (see winpty_poll_status). */
+
+/* The agent answered the most recent ping. */
+#define WINPTY_STATUS_OK                        0
+/* A ping is waiting for the agent's reply. */
+#define WINPTY_STATUS_PENDING                   1
+/* The agent process has exited, or the connection to it was lost. */
+#define WINPTY_STATUS_DEAD                      2
+
+
+
 #endif /* WINPTY_CONSTANTS_H */
@@ -63,7 +63,7 @@ static bool pathExists(const std::wstring &path) {
     return GetFileAttributesW(path.c_str()) != 0xFFFFFFFF;
 }
 
-std::wstring findAgentProgram() {
+static std::wstring locateAgentProgram() {
     std::wstring progDir = dirname(getModuleFileName(getCurrentModule()));
     std::wstring ret = progDir + (L"\\" AGENT_EXE);
     if (!pathExists(ret)) {
@@ -73,3 +73,11 @@ std::wstring findAgentProgram() {
     }
     return ret;
 }
+
+// The agent sits beside this module, which can't move while it's loaded, so
+// the path is resolved once per process.  If the agent is missing, the
+// initialization throws, and the next call looks again.
+std::wstring findAgentProgram() {
+    static const std::wstring path = locateAgentProgram();
+    return path;
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "OutputCallback.h"
+
+#include "../shared/WinptyAssert.h"
+#include "../shared/WinptyException.h"
+
+namespace {
+
+const DWORD kReadSize = 64 * 1024;
+
+} // anonymous namespace
+
+OutputCallback::OutputCallback(OwnedHandle pipe, int pipeId,
+                               winpty_output_callback_t callback,
+                               void *context) :
+    m_pipe(std::move(pipe)),
+    m_pipeId(pipeId),
+    m_callback(callback),
+    m_context(context),
+    m_doneEvent(CreateEventW(nullptr, TRUE, FALSE, nullptr)),
+    m_buffer(kReadSize)
+{
+    ASSERT(m_doneEvent.get() != nullptr);
+    m_over.self = this;
+}
+
+OutputCallback::~OutputCallback()
+{
+    {
+        LockGuard<Mutex> lock(m_mutex);
+        m_closing = true;
+        m_pipe.dispose(true);
+    }
+    WaitForSingleObject(m_doneEvent.get(), INFINITE);
+}
+
+// The pipe must have been opened with FILE_FLAG_OVERLAPPED.  Throws if the
+// pipe can't be bound to the thread pool.
+void OutputCallback::start()
+{
+    if (!BindIoCompletionCallback(m_pipe.get(), onReadComplete, 0)) {
+        throwWindowsError(L"BindIoCompletionCallback failed");
+    }
+    if (!issueRead()) {
+        finish();
+    }
+}
+
+// Returns false if the read failed to start, in which case no completion
+// will follow.
+bool OutputCallback::issueRead()
+{
+    LockGuard<Mutex> lock(m_mutex);
+    if (m_closing) {
+        return false;
+    }
+    OVERLAPPED &over = m_over;
+    over = OVERLAPPED {};
+    // Even a read that completes immediately is queued to the thread pool.
+    return ReadFile(m_pipe.get(), m_buffer.data(), kReadSize,
+                    nullptr, &over) ||
+        GetLastError() == ERROR_IO_PENDING;
+}
+
+VOID CALLBACK OutputCallback::onReadComplete(DWORD error, DWORD bytes,
+                                             LPOVERLAPPED over)
+{
+    OutputCallback *const self = static_cast<ReadOverlapped*>(over)->self;
+    if (error != ERROR_SUCCESS) {
+        // Typically ERROR_BROKEN_PIPE once the agent closes the pipe, or
+        // ERROR_OPERATION_ABORTED from the destructor.
+        self->finish();
+        return;
+    }
+    if (bytes > 0) {
+        self->m_callback(self->m_context, self->m_pipeId,
+                         self->m_buffer.data(), static_cast<int>(bytes));
+    }
+    if (!self->issueRead()) {
+        self->finish();
+    }
+}
+
+void OutputCallback::finish()
+{
+    m_callback(m_context, m_pipeId, nullptr, 0);
+    // The destructor may free the object as soon as the event is set.
+    SetEvent(m_doneEvent.get());
+}
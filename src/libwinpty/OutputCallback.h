@@ -0,0 +1,72 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef LIBWINPTY_OUTPUT_CALLBACK_H
+#define LIBWINPTY_OUTPUT_CALLBACK_H
+
+#include <windows.h>
+
+#include <memory>
+#include <vector>
+
+#include "../include/winpty.h"
+
+#include "../shared/Mutex.h"
+#include "../shared/OwnedHandle.h"
+
+// Reads an output pipe on the system thread pool (via BindIoCompletionCallback)
+// and hands each chunk to a winpty_output_callback_t.  One overlapped read is
+// pending at a time, into a buffer reused for every read.  Once the pipe
+// closes, the callback is called one last time with a size of 0.  The
+// destructor closes the pipe, which cancels the pending read, and waits for
+// that final call.
+class OutputCallback
+{
+public:
+    OutputCallback(OwnedHandle pipe, int pipeId,
+                   winpty_output_callback_t callback, void *context);
+    ~OutputCallback();
+    void start();
+
+    OutputCallback(const OutputCallback &other) = delete;
+    OutputCallback &operator=(const OutputCallback &other) = delete;
+
+private:
+    struct ReadOverlapped : OVERLAPPED {
+        OutputCallback *self;
+    };
+
+    static VOID CALLBACK onReadComplete(DWORD error, DWORD bytes,
+                                        LPOVERLAPPED over);
+    bool issueRead();
+    void finish();
+
+    Mutex m_mutex;
+    OwnedHandle m_pipe;
+    const int m_pipeId;
+    const winpty_output_callback_t m_callback;
+    void *const m_context;
+    OwnedHandle m_doneEvent;
+    bool m_closing = false;
+    ReadOverlapped m_over = {};
+    std::vector<char> m_buffer;
+};
+
+#endif // LIBWINPTY_OUTPUT_CALLBACK_H
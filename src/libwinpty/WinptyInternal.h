@@ -21,13 +21,22 @@
 #ifndef LIBWINPTY_WINPTY_INTERNAL_H
 #define LIBWINPTY_WINPTY_INTERNAL_H
 
+#include <stdint.h>
+
+#include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "../include/winpty.h"
 
+#include "../shared/AgentMsg.h"
 #include "../shared/Mutex.h"
+#include "../shared/OutputCompression.h"
 #include "../shared/OwnedHandle.h"
+#include "../shared/SharedRing.h"
+
+#include "OutputCallback.h"
 
 // The structures in this header are not intended to be accessed directly by
 // client programs.
@@ -47,18 +56,70 @@ struct winpty_config_s {
     int rows = 25;
     int mouseMode = WINPTY_MOUSE_MODE_AUTO;
     DWORD timeoutMs = 30000;
+    int minPollMs = 25;
+    int maxPollMs = 25;
+    int bufferLines = WINPTY_BUFFER_LINES_MIN;
+    int escapeTimeoutMs = 1000;
+    int pipeOutBufferSize = 8192;
+    int pipeInBufferSize = 256;
+    int pipeIoSize = 64 * 1024;
+    int scrollbackBudget = 0;
 };
 
+class AgentDesktop;
+class WriteBuffer;
+struct winpty_request_s;
+
 struct winpty_s {
     Mutex mutex;
     OwnedHandle agentProcess;
     OwnedHandle controlPipe;
     DWORD agentTimeoutMs = 0;
     OwnedHandle ioEvent;
+    // The background desktop the agent runs on, if any, which is shared
+    // with the process's other sessions.
+    std::shared_ptr<AgentDesktop> desktop;
     std::wstring spawnDesktopName;
     std::wstring coninPipeName;
     std::wstring conoutPipeName;
     std::wstring conerrPipeName;
+    // With WINPTY_FLAG_SHARED_MEMORY_OUTPUT, CONOUT output arrives here
+    // instead of through conoutPipeName.  Read by winpty_read_output, which
+    // holds outputMutex rather than the RPC mutex.
+    std::unique_ptr<SharedRing> outputRing;
+    Mutex outputMutex;
+    // Signaled by the agent when the console process list changes.  Created
+    // by the first winpty_process_list_event call.
+    OwnedHandle processListEvent;
+    // Signaled by the agent when a frame-on-demand session has output to
+    // request.  Created by the first winpty_frame_activity_event call.
+    OwnedHandle frameActivityEvent;
+    // Microseconds spent in the phases of winpty_open, indexed by
+    // WINPTY_STARTUP_STAT_xxx.  The agent reports the other phases itself.
+    int64_t startupStatsUs[WINPTY_STARTUP_STAT_COUNT];
+    // Requests from the winpty_xxx_async calls, waiting for the RPC thread,
+    // which is started by the first such call.
+    Mutex rpcQueueMutex;
+    std::deque<winpty_request_s*> rpcQueue;
+    bool rpcExiting = false;
+    OwnedHandle rpcEvent;
+    OwnedHandle rpcThread;
+    // While the RPC thread gathers requests into an AgentMsg::Batch packet,
+    // writePacket appends each request to it instead of writing it.
+    WriteBuffer *batchPacket = nullptr;
+    // Reused by readPacket for each reply (under the mutex).
+    std::vector<char> replyData;
+    // The ping in flight for winpty_poll_status, if any (under statusMutex).
+    Mutex statusMutex;
+    winpty_request_s *pingRequest = nullptr;
+    DWORD pingStartTick = 0;
+    // Set by winpty_set_output_callback (under outputMutex).  These are
+    // destroyed first, which waits for their final callbacks.
+    std::unique_ptr<OutputCallback> conoutCallback;
+    std::unique_ptr<OutputCallback> conerrCallback;
+    // The process a pool spawned in this agent, until winpty_shell_process
+    // hands it over.
+    OwnedHandle shellProcess;
 };
 
 struct winpty_spawn_config_s {
@@ -69,4 +130,48 @@ struct winpty_spawn_config_s {
     std::wstring env;
 };
 
+struct winpty_pool_s {
+    Mutex mutex;
+    winpty_config_s cfg;
+    size_t targetCount = 0;
+    std::deque<std::unique_ptr<winpty_t>> idle;
+    // With winpty_pool_new_with_shell, each agent spawns this as it starts.
+    bool hasShell = false;
+    winpty_spawn_config_s shell;
+    bool exiting = false;
+    OwnedHandle refillEvent;
+    OwnedHandle refillThread;
+};
+
+struct winpty_decompressor_s {
+    OutputCompression::Decoder decoder;
+};
+
+// An RPC started by one of the winpty_xxx_async calls.  It is shared by the
+// caller and the RPC thread, and is freed once both have released it.
+struct winpty_request_s {
+    LONG refCount = 2;
+    AgentMsg::Type type = AgentMsg::SetSize;
+    OwnedHandle event;
+
+    // Request parameters
+    int cols = 0;
+    int rows = 0;
+    winpty_spawn_config_s spawnConfig;
+    bool wantProcessHandle = false;
+    bool wantThreadHandle = false;
+
+    // Results, valid once done is set
+    Mutex mutex;
+    bool done = false;
+    DWORD doneTick = 0;
+    winpty_error_ptr_t error = nullptr;
+    std::vector<int> processList;
+    std::vector<int64_t> stats;
+    bool processCreated = false;
+    OwnedHandle processHandle;
+    OwnedHandle threadHandle;
+    DWORD createProcessError = 0;
+};
+
 #endif // LIBWINPTY_WINPTY_INTERNAL_H
@@ -24,13 +24,18 @@ $(eval $(call def_mingw_target,libwinpty,-DCOMPILING_WINPTY_DLL))
 
 LIBWINPTY_OBJECTS = \
 	build/libwinpty/libwinpty/AgentLocation.o \
+	build/libwinpty/libwinpty/OutputCallback.o \
 	build/libwinpty/libwinpty/winpty.o \
 	build/libwinpty/shared/BackgroundDesktop.o \
 	build/libwinpty/shared/Buffer.o \
+	build/libwinpty/shared/CpuFeatures.o \
 	build/libwinpty/shared/DebugClient.o \
 	build/libwinpty/shared/GenRandom.o \
+	build/libwinpty/shared/OutputCompression.o \
 	build/libwinpty/shared/OwnedHandle.o \
 	build/libwinpty/shared/StringUtil.o \
+	build/libwinpty/shared/TraceFormat.o \
+	build/libwinpty/shared/UnicodeTranscode.o \
 	build/libwinpty/shared/WindowsSecurity.o \
 	build/libwinpty/shared/WindowsVersion.o \
 	build/libwinpty/shared/WinptyAssert.o \
@@ -24,7 +24,9 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -36,8 +38,10 @@
 #include "../shared/DebugClient.h"
 #include "../shared/GenRandom.h"
 #include "../shared/OwnedHandle.h"
+#include "../shared/SharedRing.h"
 #include "../shared/StringBuilder.h"
 #include "../shared/StringUtil.h"
+#include "../shared/TimeMeasurement.h"
 #include "../shared/WindowsSecurity.h"
 #include "../shared/WindowsVersion.h"
 #include "../shared/WinptyAssert.h"
@@ -187,6 +191,49 @@ winpty_config_set_agent_timeout(winpty_config_t *cfg, DWORD timeoutMs) {
     cfg->timeoutMs = timeoutMs;
 }
 
+WINPTY_API void
+winpty_config_set_poll_interval(winpty_config_t *cfg, int minMs, int maxMs) {
+    ASSERT(cfg != nullptr && minMs > 0 && minMs <= maxMs);
+    cfg->minPollMs = minMs;
+    cfg->maxPollMs = maxMs;
+}
+
+WINPTY_API void
+winpty_config_set_buffer_lines(winpty_config_t *cfg, int lines) {
+    ASSERT(cfg != nullptr &&
+        lines >= WINPTY_BUFFER_LINES_MIN &&
+        lines <= WINPTY_BUFFER_LINES_MAX);
+    cfg->bufferLines = lines;
+}
+
+WINPTY_API void
+winpty_config_set_escape_timeout(winpty_config_t *cfg, int timeoutMs) {
+    ASSERT(cfg != nullptr && timeoutMs > 0);
+    cfg->escapeTimeoutMs = timeoutMs;
+}
+
+WINPTY_API void
+winpty_config_set_pipe_buffer_sizes(winpty_config_t *cfg,
+                                    int outputBytes, int inputBytes) {
+    ASSERT(cfg != nullptr && outputBytes >= 0 && inputBytes >= 0);
+    cfg->pipeOutBufferSize = outputBytes;
+    cfg->pipeInBufferSize = inputBytes;
+}
+
+WINPTY_API void
+winpty_config_set_pipe_io_size(winpty_config_t *cfg, int bytes) {
+    ASSERT(cfg != nullptr &&
+        bytes >= WINPTY_PIPE_IO_SIZE_MIN &&
+        bytes <= WINPTY_PIPE_IO_SIZE_MAX);
+    cfg->pipeIoSize = bytes;
+}
+
+WINPTY_API void
+winpty_config_set_scrollback_budget(winpty_config_t *cfg, int lines) {
+    ASSERT(cfg != nullptr && lines >= 0);
+    cfg->scrollbackBudget = lines;
+}
+
 
 
 /*****************************************************************************
@@ -321,9 +368,12 @@ static inline WriteBuffer newPacket() {
 }
 
 static void writePacket(winpty_t &wp, WriteBuffer &packet) {
-    const auto &buf = packet.buf();
-    packet.replaceRawValue<uint64_t>(0, buf.size());
-    writeData(wp, buf.data(), buf.size());
+    packet.replaceRawValue<uint64_t>(0, packet.size());
+    if (wp.batchPacket != nullptr) {
+        wp.batchPacket->putRawData(packet.data(), packet.size());
+    } else {
+        writeData(wp, packet.data(), packet.size());
+    }
 }
 
 static size_t readData(winpty_t &wp, void *data, size_t amount) {
@@ -355,20 +405,24 @@ static uint64_t readUInt64(winpty_t &wp) {
     return ret;
 }
 
-// Returns a reply packet's payload.
+// Returns a reply packet's payload.  The payload is read into the
+// connection's reusable reply buffer, so the ReadBuffer is only valid until
+// the next readPacket call.
 static ReadBuffer readPacket(winpty_t &wp) {
     const uint64_t packetSize = readUInt64(wp);
     if (packetSize < sizeof(packetSize) || packetSize > SIZE_MAX) {
         throwWinptyException(L"Agent RPC error: invalid packet size");
     }
     const size_t payloadSize = packetSize - sizeof(packetSize);
-    std::vector<char> bytes(payloadSize);
-    readAll(wp, bytes.data(), bytes.size());
-    return ReadBuffer(std::move(bytes));
+    if (wp.replyData.size() < payloadSize) {
+        wp.replyData.resize(payloadSize);
+    }
+    readAll(wp, wp.replyData.data(), payloadSize);
+    return ReadBuffer(wp.replyData.data(), payloadSize);
 }
 
 static OwnedHandle createControlPipe(const std::wstring &name) {
-    const auto sd = createPipeSecurityDescriptorOwnerFullControl();
+    const auto sd = sharedPipeSecurityDescriptorOwnerFullControl();
     if (!sd) {
         throwWinptyException(
             L"could not create the control pipe's SECURITY_DESCRIPTOR");
@@ -548,34 +602,45 @@ createAgentSession(const winpty_config_t *cfg,
     std::unique_ptr<winpty_t> wp(new winpty_t);
     wp->agentTimeoutMs = cfg->timeoutMs;
     wp->ioEvent = createEvent();
+    std::fill(std::begin(wp->startupStatsUs), std::end(wp->startupStatsUs), 0);
+    auto &stats = wp->startupStatsUs;
 
     // Create control server pipe.
     const auto pipeName =
-        L"\\\\.\\pipe\\winpty-control-" + GenRandom().uniqueName();
+        L"\\\\.\\pipe\\winpty-control-" + GenRandom::uniqueName();
     wp->controlPipe = createControlPipe(pipeName);
 
     DWORD agentPid = 0;
+    TimeMeasurement spawnTime;
     wp->agentProcess = startAgentProcess(
         desktop, pipeName, params, creationFlags, agentPid);
+    stats[WINPTY_STARTUP_STAT_AGENT_SPAWN] = spawnTime.elapsedUs();
+    TimeMeasurement connectTime;
     connectControlPipe(*wp.get());
+    stats[WINPTY_STARTUP_STAT_PIPE_CONNECT] = connectTime.elapsedUs();
+    TimeMeasurement verifyTime;
     verifyPipeClientPid(wp->controlPipe.get(), agentPid);
+    stats[WINPTY_STARTUP_STAT_VERIFY_PID] = verifyTime.elapsedUs();
 
     return std::move(wp);
 }
 
-namespace {
-
 class AgentDesktop {
 public:
     virtual std::wstring name() = 0;
     virtual ~AgentDesktop() {}
 };
 
+namespace {
+
 class AgentDesktopDirect : public AgentDesktop {
 public:
     AgentDesktopDirect(BackgroundDesktop &&desktop) :
         m_desktop(std::move(desktop))
     {
+        // Only the agent runs on the desktop, so don't leave this process on
+        // its window station.
+        m_desktop.restoreOriginalStation();
     }
     std::wstring name() override { return m_desktop.desktopName(); }
 private:
@@ -596,18 +661,17 @@ private:
     std::wstring m_desktopName;
 };
 
-} // anonymous namespace
-
-std::unique_ptr<AgentDesktop>
-setupBackgroundDesktop(const winpty_config_t *cfg) {
-    bool useDesktopAgent =
-        !(cfg->flags & WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION);
-    const bool useDesktop = shouldCreateBackgroundDesktop(useDesktopAgent);
+// Creating a window station is slow and uses desktop heap, so every session
+// in the process shares one background desktop.  Each winpty_t holds a
+// reference, and the desktop (and the --create-desktop agent, if one was
+// used) is released along with the last session.
+Mutex g_desktopCacheMutex;
+std::weak_ptr<AgentDesktop> g_desktopCache;
 
-    if (!useDesktop) {
-        return std::unique_ptr<AgentDesktop>();
-    }
+} // anonymous namespace
 
+static std::shared_ptr<AgentDesktop>
+createBackgroundDesktop(const winpty_config_t *cfg, bool useDesktopAgent) {
     if (useDesktopAgent) {
         auto wp = createAgentSession(
             cfg, std::wstring(), L"--create-desktop", DETACHED_PROCESS);
@@ -618,24 +682,198 @@ setupBackgroundDesktop(const winpty_config_t *cfg) {
         packet.assertEof();
 
         if (desktopName.empty()) {
-            return std::unique_ptr<AgentDesktop>();
+            return std::shared_ptr<AgentDesktop>();
         } else {
-            return std::unique_ptr<AgentDesktop>(
+            return std::shared_ptr<AgentDesktop>(
                 new AgentDesktopIndirect(std::move(wp),
                                          std::move(desktopName)));
         }
     } else {
         try {
             BackgroundDesktop desktop;
-            return std::unique_ptr<AgentDesktop>(new AgentDesktopDirect(
+            return std::shared_ptr<AgentDesktop>(new AgentDesktopDirect(
                 std::move(desktop)));
         } catch (const WinptyException &e) {
             trace("Error: failed to create background desktop, "
                   "using original desktop instead: %s",
                   utf8FromWide(e.what()).c_str());
-            return std::unique_ptr<AgentDesktop>();
+            return std::shared_ptr<AgentDesktop>();
+        }
+    }
+}
+
+static std::shared_ptr<AgentDesktop>
+setupBackgroundDesktop(const winpty_config_t *cfg) {
+    bool useDesktopAgent =
+        !(cfg->flags & WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION);
+    const bool useDesktop = shouldCreateBackgroundDesktop(useDesktopAgent);
+
+    if (!useDesktop) {
+        return std::shared_ptr<AgentDesktop>();
+    }
+
+    LockGuard<Mutex> lock(g_desktopCacheMutex);
+    auto desktop = g_desktopCache.lock();
+    if (desktop == nullptr) {
+        desktop = createBackgroundDesktop(cfg, useDesktopAgent);
+        g_desktopCache = desktop;
+    }
+    return desktop;
+}
+
+// It's safe to truncate a handle from 64-bits to 32-bits, or to sign-extend it
+// back to 64-bits.  See the MSDN article, "Interprocess Communication Between
+// 32-bit and 64-bit Applications".
+// https://msdn.microsoft.com/en-us/library/windows/desktop/aa384203.aspx
+static inline HANDLE handleFromInt64(int64_t i) {
+    return reinterpret_cast<HANDLE>(static_cast<intptr_t>(i));
+}
+
+// Given a process and a handle in that process, duplicate the handle into the
+// current process and close it in the originating process.
+static inline OwnedHandle stealHandle(HANDLE process, HANDLE handle) {
+    HANDLE result = nullptr;
+    if (!DuplicateHandle(process, handle,
+            GetCurrentProcess(),
+            &result, 0, FALSE,
+            DUPLICATE_CLOSE_SOURCE | DUPLICATE_SAME_ACCESS)) {
+        throwWindowsError(L"DuplicateHandle of process handle");
+    }
+    return OwnedHandle(result);
+}
+
+namespace {
+
+// With winpty_open_and_spawn, the StartProcess request is written as soon as
+// the control pipe is connected, ahead of the agent's startup reply.
+struct InitialSpawn {
+    const winpty_spawn_config_t &cfg;
+    bool wantProcess;
+    bool wantThread;
+};
+
+} // anonymous namespace
+
+namespace {
+
+// The host probe results passed to every agent this process starts: the
+// version checks, and the console probe reported by the first agent to run
+// it.
+Mutex g_hostCapsMutex;
+uint64_t g_hostConsoleCaps = 0;
+
+} // anonymous namespace
+
+static uint64_t agentHostCaps() {
+    const uint64_t versionCaps = windowsVersionCaps();
+    LockGuard<Mutex> lock(g_hostCapsMutex);
+    return versionCaps | g_hostConsoleCaps;
+}
+
+static void noteAgentHostCaps(uint64_t caps) {
+    LockGuard<Mutex> lock(g_hostCapsMutex);
+    if (!(g_hostConsoleCaps & HostConsoleCaps::Probed)) {
+        g_hostConsoleCaps = caps & HostConsoleCaps::Mask;
+    }
+}
+
+static void writeSpawnRequest(winpty_t &wp, const winpty_spawn_config_t &cfg,
+                              bool wantProcess, bool wantThread);
+
+static std::unique_ptr<winpty_t> openAgent(const winpty_config_t *cfg,
+                                           const InitialSpawn *spawn) {
+    if (!isWindowsVersionSupported()) {
+        throwWinptyException(
+            L"This winpty build requires Windows 10 or newer");
+    }
+    TimeMeasurement openTime;
+
+    // Setup a background desktop for the agent.
+    TimeMeasurement desktopTime;
+    auto desktop = setupBackgroundDesktop(cfg);
+    const auto desktopName = desktop ? desktop->name() : std::wstring();
+    const auto desktopUs = desktopTime.elapsedUs();
+
+    // Start the primary agent session.
+    const auto params =
+        (WStringBuilder(128)
+            << cfg->flags << L' '
+            << cfg->mouseMode << L' '
+            << cfg->cols << L' '
+            << cfg->rows << L' '
+            << cfg->minPollMs << L' '
+            << cfg->maxPollMs << L' '
+            << cfg->bufferLines << L' '
+            << cfg->escapeTimeoutMs << L' '
+            << cfg->pipeOutBufferSize << L' '
+            << cfg->pipeInBufferSize << L' '
+            << cfg->pipeIoSize << L' '
+            << cfg->scrollbackBudget << L' '
+            << agentHostCaps()).str_moved();
+    auto wp = createAgentSession(cfg, desktopName, params,
+                                 CREATE_NEW_CONSOLE);
+
+    // Keep a reference to the background desktop for the session's lifetime.
+    // If the handles were closed too soon, then the desktop and windowstation
+    // would be destroyed before the agent can connect with them, and later
+    // sessions reuse them.
+    wp->desktop = std::move(desktop);
+
+    // If we ran the agent process on a background desktop, then when we
+    // spawn a child process from the agent, it will need to be explicitly
+    // placed back onto the original desktop.
+    if (!desktopName.empty()) {
+        wp->spawnDesktopName = getCurrentDesktopName();
+    }
+
+    // The agent handles control packets once its console is set up, so the
+    // child starts without waiting for the startup reply to reach us.
+    if (spawn != nullptr) {
+        writeSpawnRequest(*wp, spawn->cfg,
+                          spawn->wantProcess, spawn->wantThread);
+    }
+
+    // Get the CONIN/CONOUT pipe names.
+    TimeMeasurement readyTime;
+    auto packet = readPacket(*wp.get());
+    wp->coninPipeName = packet.getWString();
+    wp->conoutPipeName = packet.getWString();
+    if (cfg->flags & WINPTY_FLAG_CONERR) {
+        wp->conerrPipeName = packet.getWString();
+    }
+    if (cfg->flags & WINPTY_FLAG_SHARED_MEMORY_OUTPUT) {
+        const auto capacity = static_cast<uint32_t>(packet.getInt32());
+        const HANDLE remoteSection = handleFromInt64(packet.getInt64());
+        const HANDLE remoteDataEvent = handleFromInt64(packet.getInt64());
+        const HANDLE remoteSpaceEvent = handleFromInt64(packet.getInt64());
+        const HANDLE agent = wp->agentProcess.get();
+        auto section = stealHandle(agent, remoteSection);
+        auto dataEvent = stealHandle(agent, remoteDataEvent);
+        auto spaceEvent = stealHandle(agent, remoteSpaceEvent);
+        wp->outputRing = SharedRing::attach(
+            std::move(section), std::move(dataEvent), std::move(spaceEvent),
+            capacity);
+        if (wp->outputRing == nullptr) {
+            throwWindowsError(L"Could not map the CONOUT shared ring");
         }
     }
+    noteAgentHostCaps(static_cast<uint64_t>(packet.getInt64()));
+    packet.assertEof();
+
+    auto &stats = wp->startupStatsUs;
+    stats[WINPTY_STARTUP_STAT_AGENT_READY] = readyTime.elapsedUs();
+    stats[WINPTY_STARTUP_STAT_DESKTOP_SETUP] = desktopUs;
+    stats[WINPTY_STARTUP_STAT_OPEN_TOTAL] = openTime.elapsedUs();
+    trace("winpty_open: desktop=%dus spawn=%dus connect=%dus verify=%dus "
+          "ready=%dus total=%dus",
+          static_cast<int>(stats[WINPTY_STARTUP_STAT_DESKTOP_SETUP]),
+          static_cast<int>(stats[WINPTY_STARTUP_STAT_AGENT_SPAWN]),
+          static_cast<int>(stats[WINPTY_STARTUP_STAT_PIPE_CONNECT]),
+          static_cast<int>(stats[WINPTY_STARTUP_STAT_VERIFY_PID]),
+          static_cast<int>(stats[WINPTY_STARTUP_STAT_AGENT_READY]),
+          static_cast<int>(stats[WINPTY_STARTUP_STAT_OPEN_TOTAL]));
+
+    return wp;
 }
 
 WINPTY_API winpty_t *
@@ -645,48 +883,7 @@ winpty_open(const winpty_config_t *cfg,
         ASSERT(cfg != nullptr);
         dumpWindowsVersion();
         dumpVersionToTrace();
-
-        // Setup a background desktop for the agent.
-        auto desktop = setupBackgroundDesktop(cfg);
-        const auto desktopName = desktop ? desktop->name() : std::wstring();
-
-        // Start the primary agent session.
-        const auto params =
-            (WStringBuilder(128)
-                << cfg->flags << L' '
-                << cfg->mouseMode << L' '
-                << cfg->cols << L' '
-                << cfg->rows).str_moved();
-        auto wp = createAgentSession(cfg, desktopName, params,
-                                     CREATE_NEW_CONSOLE);
-
-        // Close handles to the background desktop and restore the original
-        // window station.  This must wait until we know the agent is running
-        // -- if we close these handles too soon, then the desktop and
-        // windowstation will be destroyed before the agent can connect with
-        // them.
-        //
-        // If we used a separate agent process to create the desktop, we
-        // disconnect from that process here, allowing it to exit.
-        desktop.reset();
-
-        // If we ran the agent process on a background desktop, then when we
-        // spawn a child process from the agent, it will need to be explicitly
-        // placed back onto the original desktop.
-        if (!desktopName.empty()) {
-            wp->spawnDesktopName = getCurrentDesktopName();
-        }
-
-        // Get the CONIN/CONOUT pipe names.
-        auto packet = readPacket(*wp.get());
-        wp->coninPipeName = packet.getWString();
-        wp->conoutPipeName = packet.getWString();
-        if (cfg->flags & WINPTY_FLAG_CONERR) {
-            wp->conerrPipeName = packet.getWString();
-        }
-        packet.assertEof();
-
-        return wp.release();
+        return openAgent(cfg, nullptr).release();
     } API_CATCH(nullptr)
 }
 
@@ -715,7 +912,11 @@ WINPTY_API LPCWSTR winpty_conin_name(winpty_t *wp) {
 
 WINPTY_API LPCWSTR winpty_conout_name(winpty_t *wp) {
     ASSERT(wp != nullptr);
-    return cstrFromWStringOrNull(wp->conoutPipeName);
+    if (wp->conoutPipeName.empty()) {
+        return nullptr;
+    } else {
+        return cstrFromWStringOrNull(wp->conoutPipeName);
+    }
 }
 
 WINPTY_API LPCWSTR winpty_conerr_name(winpty_t *wp) {
@@ -727,6 +928,101 @@ WINPTY_API LPCWSTR winpty_conerr_name(winpty_t *wp) {
     }
 }
 
+// Connects to one of the data pipes for overlapped I/O.
+static OwnedHandle openDataPipe(winpty_t &wp, int pipe) {
+    ASSERT(pipe >= WINPTY_PIPE_CONIN && pipe <= WINPTY_PIPE_CONERR);
+    const std::wstring &name =
+        pipe == WINPTY_PIPE_CONIN ? wp.coninPipeName :
+        pipe == WINPTY_PIPE_CONOUT ? wp.conoutPipeName :
+        wp.conerrPipeName;
+    if (name.empty()) {
+        throwWinptyException(L"The data pipe doesn't exist");
+    }
+    const DWORD access =
+        pipe == WINPTY_PIPE_CONIN ? GENERIC_WRITE : GENERIC_READ;
+    const HANDLE h = CreateFileW(name.c_str(), access, 0, nullptr,
+                                 OPEN_EXISTING,
+                                 FILE_FLAG_OVERLAPPED, nullptr);
+    if (h == INVALID_HANDLE_VALUE) {
+        throwWindowsError(L"Could not connect to the data pipe");
+    }
+    return OwnedHandle(h);
+}
+
+WINPTY_API HANDLE
+winpty_open_pipe(winpty_t *wp, int pipe,
+                 HANDLE iocp /*OPTIONAL*/, ULONG_PTR completionKey,
+                 winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        OwnedHandle handle = openDataPipe(*wp, pipe);
+        if (iocp != nullptr &&
+                CreateIoCompletionPort(handle.get(), iocp,
+                                       completionKey, 0) == nullptr) {
+            throwWindowsError(
+                L"winpty_open_pipe: CreateIoCompletionPort failed");
+        }
+        return handle.release();
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API BOOL
+winpty_set_output_callback(winpty_t *wp, winpty_output_callback_t callback,
+                           void *context,
+                           winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr && callback != nullptr);
+        LockGuard<Mutex> lock(wp->outputMutex);
+        ASSERT(wp->conoutCallback == nullptr &&
+            "winpty_set_output_callback called twice");
+        // Connect both pipes before starting either, so a failure leaves
+        // no callback running.
+        std::unique_ptr<OutputCallback> conout(new OutputCallback(
+            openDataPipe(*wp, WINPTY_PIPE_CONOUT), WINPTY_PIPE_CONOUT,
+            callback, context));
+        std::unique_ptr<OutputCallback> conerr;
+        if (!wp->conerrPipeName.empty()) {
+            conerr.reset(new OutputCallback(
+                openDataPipe(*wp, WINPTY_PIPE_CONERR), WINPTY_PIPE_CONERR,
+                callback, context));
+        }
+        conout->start();
+        wp->conoutCallback = std::move(conout);
+        if (conerr != nullptr) {
+            conerr->start();
+            wp->conerrCallback = std::move(conerr);
+        }
+        return TRUE;
+    } API_CATCH(FALSE)
+}
+
+WINPTY_API int
+winpty_read_output(winpty_t *wp, void *buf, int size, DWORD timeoutMs,
+                   winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        ASSERT(wp->outputRing != nullptr &&
+            "winpty_read_output requires WINPTY_FLAG_SHARED_MEMORY_OUTPUT");
+        ASSERT(buf != nullptr && size > 0);
+        LockGuard<Mutex> lock(wp->outputMutex);
+        SharedRing &ring = *wp->outputRing;
+        if (!ring.waitForData(timeoutMs, wp->agentProcess.get())) {
+            if (WaitForSingleObject(wp->agentProcess.get(), 0) ==
+                    WAIT_OBJECT_0) {
+                throw LibWinptyException(WINPTY_ERROR_AGENT_DIED,
+                                         L"agent died");
+            }
+            return 0;
+        }
+        const size_t amount = ring.read(static_cast<char*>(buf), size);
+        if (amount == 0 && ring.isDrainedAndClosed()) {
+            throw LibWinptyException(WINPTY_ERROR_LOST_CONNECTION,
+                                     L"agent closed CONOUT");
+        }
+        return static_cast<int>(amount);
+    } API_CATCH(-1)
+}
+
 
 
 /*****************************************************************************
@@ -820,25 +1116,73 @@ WINPTY_API void winpty_spawn_config_free(winpty_spawn_config_t *cfg) {
     delete cfg;
 }
 
-// It's safe to truncate a handle from 64-bits to 32-bits, or to sign-extend it
-// back to 64-bits.  See the MSDN article, "Interprocess Communication Between
-// 32-bit and 64-bit Applications".
-// https://msdn.microsoft.com/en-us/library/windows/desktop/aa384203.aspx
-static inline HANDLE handleFromInt64(int64_t i) {
-    return reinterpret_cast<HANDLE>(static_cast<intptr_t>(i));
+static void writeSpawnRequest(winpty_t &wp, const winpty_spawn_config_t &cfg,
+                              bool wantProcess, bool wantThread) {
+    auto packet = newPacket();
+    packet.putInt32(AgentMsg::StartProcess);
+    packet.putInt64(cfg.winptyFlags);
+    packet.putInt32(wantProcess);
+    packet.putInt32(wantThread);
+    packet.putWString(cfg.appname);
+    packet.putWString(cfg.cmdline);
+    packet.putWString(cfg.cwd);
+    packet.putWString(cfg.env);
+    packet.putWString(wp.spawnDesktopName);
+    writePacket(wp, packet);
 }
 
-// Given a process and a handle in that process, duplicate the handle into the
-// current process and close it in the originating process.
-static inline OwnedHandle stealHandle(HANDLE process, HANDLE handle) {
-    HANDLE result = nullptr;
-    if (!DuplicateHandle(process, handle,
-            GetCurrentProcess(),
-            &result, 0, FALSE,
-            DUPLICATE_CLOSE_SOURCE | DUPLICATE_SAME_ACCESS)) {
-        throwWindowsError(L"DuplicateHandle of process handle");
+// Returns false if the agent's CreateProcess call failed, in which case
+// createProcessError is set to its GetLastError() value.
+static bool readSpawnReply(winpty_t &wp, OwnedHandle &process,
+                           OwnedHandle &thread, DWORD &createProcessError) {
+    auto reply = readPacket(wp);
+    const auto result = static_cast<StartProcessResult>(reply.getInt32());
+    if (result == StartProcessResult::CreateProcessFailed) {
+        createProcessError = reply.getInt32();
+        reply.assertEof();
+        return false;
+    } else if (result == StartProcessResult::ProcessCreated) {
+        const HANDLE remoteProcess = handleFromInt64(reply.getInt64());
+        const HANDLE remoteThread = handleFromInt64(reply.getInt64());
+        reply.assertEof();
+        if (remoteProcess != nullptr) {
+            process = stealHandle(wp.agentProcess.get(), remoteProcess);
+        }
+        if (remoteThread != nullptr) {
+            thread = stealHandle(wp.agentProcess.get(), remoteThread);
+        }
+        return true;
+    } else {
+        throwWinptyException(
+            L"Agent RPC error: invalid StartProcessResult");
+    }
+}
+
+// Reads the reply to a StartProcess request into winpty_spawn's output
+// parameters.
+static void completeSpawn(winpty_t &wp, RpcOperation &rpc,
+                          HANDLE *process_handle,
+                          HANDLE *thread_handle,
+                          DWORD *create_process_error) {
+    OwnedHandle localProcess;
+    OwnedHandle localThread;
+    DWORD lastError = 0;
+    const bool created =
+        readSpawnReply(wp, localProcess, localThread, lastError);
+    rpc.success();
+    if (!created) {
+        if (create_process_error != nullptr) {
+            *create_process_error = lastError;
+        }
+        throw LibWinptyException(WINPTY_ERROR_SPAWN_CREATE_PROCESS_FAILED,
+            L"CreateProcess failed");
+    }
+    if (process_handle != nullptr) {
+        *process_handle = localProcess.release();
+    }
+    if (thread_handle != nullptr) {
+        *thread_handle = localThread.release();
     }
-    return OwnedHandle(result);
 }
 
 WINPTY_API BOOL
@@ -857,77 +1201,148 @@ winpty_spawn(winpty_t *wp,
 
         LockGuard<Mutex> lock(wp->mutex);
         RpcOperation rpc(*wp);
-
-        // Send spawn request.
-        auto packet = newPacket();
-        packet.putInt32(AgentMsg::StartProcess);
-        packet.putInt64(cfg->winptyFlags);
-        packet.putInt32(process_handle != nullptr);
-        packet.putInt32(thread_handle != nullptr);
-        packet.putWString(cfg->appname);
-        packet.putWString(cfg->cmdline);
-        packet.putWString(cfg->cwd);
-        packet.putWString(cfg->env);
-        packet.putWString(wp->spawnDesktopName);
-        writePacket(*wp, packet);
-
-        // Receive reply.
-        auto reply = readPacket(*wp);
-        const auto result = static_cast<StartProcessResult>(reply.getInt32());
-        if (result == StartProcessResult::CreateProcessFailed) {
-            const DWORD lastError = reply.getInt32();
-            reply.assertEof();
-            if (create_process_error != nullptr) {
-                *create_process_error = lastError;
-            }
-            rpc.success();
-            throw LibWinptyException(WINPTY_ERROR_SPAWN_CREATE_PROCESS_FAILED,
-                L"CreateProcess failed");
-        } else if (result == StartProcessResult::ProcessCreated) {
-            const HANDLE remoteProcess = handleFromInt64(reply.getInt64());
-            const HANDLE remoteThread = handleFromInt64(reply.getInt64());
-            reply.assertEof();
-            OwnedHandle localProcess;
-            OwnedHandle localThread;
-            if (remoteProcess != nullptr) {
-                localProcess =
-                    stealHandle(wp->agentProcess.get(), remoteProcess);
-            }
-            if (remoteThread != nullptr) {
-                localThread =
-                    stealHandle(wp->agentProcess.get(), remoteThread);
-            }
-            if (process_handle != nullptr) {
-                *process_handle = localProcess.release();
-            }
-            if (thread_handle != nullptr) {
-                *thread_handle = localThread.release();
-            }
-            rpc.success();
-        } else {
-            throwWinptyException(
-                L"Agent RPC error: invalid StartProcessResult");
-        }
+        writeSpawnRequest(*wp, *cfg,
+                          process_handle != nullptr,
+                          thread_handle != nullptr);
+        completeSpawn(*wp, rpc, process_handle, thread_handle,
+                      create_process_error);
         return TRUE;
     } API_CATCH(FALSE)
 }
 
+WINPTY_API winpty_t *
+winpty_open_and_spawn(const winpty_config_t *cfg,
+                      const winpty_spawn_config_t *spawnCfg,
+                      HANDLE *process_handle /*OPTIONAL*/,
+                      HANDLE *thread_handle /*OPTIONAL*/,
+                      DWORD *create_process_error /*OPTIONAL*/,
+                      winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(cfg != nullptr && spawnCfg != nullptr);
+
+        if (process_handle != nullptr) { *process_handle = nullptr; }
+        if (thread_handle != nullptr) { *thread_handle = nullptr; }
+        if (create_process_error != nullptr) { *create_process_error = 0; }
+
+        dumpWindowsVersion();
+        dumpVersionToTrace();
+        const InitialSpawn spawn = {
+            *spawnCfg,
+            process_handle != nullptr,
+            thread_handle != nullptr,
+        };
+        auto wp = openAgent(cfg, &spawn);
+        LockGuard<Mutex> lock(wp->mutex);
+        RpcOperation rpc(*wp);
+        completeSpawn(*wp, rpc, process_handle, thread_handle,
+                      create_process_error);
+        return wp.release();
+    } API_CATCH(nullptr)
+}
+
 
 
 /*****************************************************************************
  * winpty agent RPC calls: everything else */
 
+static void writeSetSizeRequest(winpty_t &wp, int cols, int rows) {
+    auto packet = newPacket();
+    packet.putInt32(AgentMsg::SetSize);
+    packet.putInt32(cols);
+    packet.putInt32(rows);
+    writePacket(wp, packet);
+}
+
+static void readSetSizeReply(winpty_t &wp) {
+    readPacket(wp).assertEof();
+}
+
+static void setSize(winpty_t &wp, int cols, int rows) {
+    LockGuard<Mutex> lock(wp.mutex);
+    RpcOperation rpc(wp);
+    writeSetSizeRequest(wp, cols, rows);
+    readSetSizeReply(wp);
+    rpc.success();
+}
+
 WINPTY_API BOOL
 winpty_set_size(winpty_t *wp, int cols, int rows,
                 winpty_error_ptr_t *err /*OPTIONAL*/) {
     API_TRY {
         ASSERT(wp != nullptr && cols > 0 && rows > 0);
+        setSize(*wp, cols, rows);
+        return TRUE;
+    } API_CATCH(FALSE)
+}
+
+WINPTY_API HANDLE
+winpty_attach_output_observer(winpty_t *wp,
+                              winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        std::wstring name;
+        {
+            LockGuard<Mutex> lock(wp->mutex);
+            RpcOperation rpc(*wp);
+            auto packet = newPacket();
+            packet.putInt32(AgentMsg::AttachOutputObserver);
+            writePacket(*wp, packet);
+            auto reply = readPacket(*wp);
+            name = reply.getWString();
+            reply.assertEof();
+            rpc.success();
+        }
+        if (name.empty()) {
+            throwWinptyException(
+                L"The agent can't attach a CONOUT observer");
+        }
+        const HANDLE h = CreateFileW(name.c_str(), GENERIC_READ, 0, nullptr,
+                                     OPEN_EXISTING, FILE_FLAG_OVERLAPPED,
+                                     nullptr);
+        if (h == INVALID_HANDLE_VALUE) {
+            throwWindowsError(L"Could not connect to the observer pipe");
+        }
+        return h;
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API BOOL
+winpty_set_output_recording(winpty_t *wp, LPCWSTR path /*OPTIONAL*/,
+                            int format,
+                            winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        DWORD error = 0;
+        {
+            LockGuard<Mutex> lock(wp->mutex);
+            RpcOperation rpc(*wp);
+            auto packet = newPacket();
+            packet.putInt32(AgentMsg::SetOutputRecording);
+            packet.putWString(path != nullptr ? path : L"");
+            packet.putInt32(format);
+            writePacket(*wp, packet);
+            auto reply = readPacket(*wp);
+            error = static_cast<DWORD>(reply.getInt32());
+            reply.assertEof();
+            rpc.success();
+        }
+        if (error != 0) {
+            throwWindowsError(L"The agent could not start recording", error);
+        }
+        return TRUE;
+    } API_CATCH(FALSE)
+}
+
+WINPTY_API BOOL
+winpty_set_visibility(winpty_t *wp, BOOL visible,
+                      winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
         LockGuard<Mutex> lock(wp->mutex);
         RpcOperation rpc(*wp);
         auto packet = newPacket();
-        packet.putInt32(AgentMsg::SetSize);
-        packet.putInt32(cols);
-        packet.putInt32(rows);
+        packet.putInt32(AgentMsg::SetVisibility);
+        packet.putInt32(visible ? 1 : 0);
         writePacket(*wp, packet);
         readPacket(*wp).assertEof();
         rpc.success();
@@ -935,36 +1350,1034 @@ winpty_set_size(winpty_t *wp, int cols, int rows,
     } API_CATCH(FALSE)
 }
 
-WINPTY_API int
-winpty_get_console_process_list(winpty_t *wp, int *processList, const int processCount,
-                                winpty_error_ptr_t *err /*OPTIONAL*/) {
+WINPTY_API HANDLE
+winpty_frame_activity_event(winpty_t *wp,
+                            winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        LockGuard<Mutex> lock(wp->mutex);
+        if (wp->frameActivityEvent.get() == nullptr) {
+            RpcOperation rpc(*wp);
+            auto packet = newPacket();
+            packet.putInt32(AgentMsg::EnableFrameOnDemand);
+            writePacket(*wp, packet);
+            auto reply = readPacket(*wp);
+            const HANDLE remoteEvent = handleFromInt64(reply.getInt64());
+            reply.assertEof();
+            rpc.success();
+            if (remoteEvent == nullptr) {
+                throwWinptyException(
+                    L"Frame-on-demand output isn't supported with "
+                    L"WINPTY_FLAG_PSEUDOCONSOLE");
+            }
+            wp->frameActivityEvent =
+                stealHandle(wp->agentProcess.get(), remoteEvent);
+        }
+        return wp->frameActivityEvent.get();
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API BOOL
+winpty_request_frame(winpty_t *wp, winpty_error_ptr_t *err /*OPTIONAL*/) {
     API_TRY {
         ASSERT(wp != nullptr);
-        ASSERT(processList != nullptr);
         LockGuard<Mutex> lock(wp->mutex);
+        ASSERT(wp->frameActivityEvent.get() != nullptr &&
+            "winpty_request_frame requires winpty_frame_activity_event");
         RpcOperation rpc(*wp);
         auto packet = newPacket();
-        packet.putInt32(AgentMsg::GetConsoleProcessList);
+        packet.putInt32(AgentMsg::RequestFrame);
         writePacket(*wp, packet);
-        auto reply = readPacket(*wp);
+        readPacket(*wp).assertEof();
+        rpc.success();
+        return TRUE;
+    } API_CATCH(FALSE)
+}
 
-        auto actualProcessCount = reply.getInt32();
+static void writeConsoleProcessListRequest(winpty_t &wp) {
+    auto packet = newPacket();
+    packet.putInt32(AgentMsg::GetConsoleProcessList);
+    writePacket(wp, packet);
+}
 
-        if (actualProcessCount <= processCount) {
-            for (auto i = 0; i < actualProcessCount; i++) {
-                processList[i] = reply.getInt32();
-            }
+static std::vector<int> readConsoleProcessListReply(winpty_t &wp) {
+    auto reply = readPacket(wp);
+    const auto actualProcessCount = reply.getInt32();
+    std::vector<int> ret;
+    for (auto i = 0; i < actualProcessCount; i++) {
+        ret.push_back(reply.getInt32());
+    }
+    reply.assertEof();
+    return ret;
+}
+
+// Copies as much of the list as fits and returns the full count.
+static int copyProcessList(const std::vector<int> &list,
+                           int *processList, int processCount) {
+    const int actualProcessCount = static_cast<int>(list.size());
+    if (actualProcessCount <= processCount) {
+        std::copy(list.begin(), list.end(), processList);
+    }
+    return actualProcessCount;
+}
+
+WINPTY_API int
+winpty_get_console_process_list(winpty_t *wp, int *processList, const int processCount,
+                                winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        ASSERT(processList != nullptr);
+        LockGuard<Mutex> lock(wp->mutex);
+        RpcOperation rpc(*wp);
+        writeConsoleProcessListRequest(*wp);
+        const auto list = readConsoleProcessListReply(*wp);
+        rpc.success();
+        return copyProcessList(list, processList, processCount);
+    } API_CATCH(0)
+}
+
+WINPTY_API HANDLE
+winpty_process_list_event(winpty_t *wp,
+                          winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        LockGuard<Mutex> lock(wp->mutex);
+        if (wp->processListEvent.get() == nullptr) {
+            RpcOperation rpc(*wp);
+            auto packet = newPacket();
+            packet.putInt32(AgentMsg::SubscribeProcessList);
+            writePacket(*wp, packet);
+            auto reply = readPacket(*wp);
+            const HANDLE remoteEvent = handleFromInt64(reply.getInt64());
+            reply.assertEof();
+            rpc.success();
+            wp->processListEvent =
+                stealHandle(wp->agentProcess.get(), remoteEvent);
+        }
+        return wp->processListEvent.get();
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API int
+winpty_get_startup_stats(winpty_t *wp, INT64 *statsUs, int statCount,
+                         winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        ASSERT(statsUs != nullptr || statCount == 0);
+        int64_t stats[WINPTY_STARTUP_STAT_COUNT];
+        std::copy(std::begin(wp->startupStatsUs),
+                  std::end(wp->startupStatsUs),
+                  stats);
+        {
+            LockGuard<Mutex> lock(wp->mutex);
+            RpcOperation rpc(*wp);
+            auto packet = newPacket();
+            packet.putInt32(AgentMsg::GetStartupStats);
+            writePacket(*wp, packet);
+            auto reply = readPacket(*wp);
+            const int first = reply.getInt32();
+            const int count = reply.getInt32();
+            ASSERT(first >= 0 && count >= 0 &&
+                first + count <= WINPTY_STARTUP_STAT_COUNT);
+            for (int i = first; i < first + count; ++i) {
+                stats[i] = reply.getInt64();
+            }
+            reply.assertEof();
+            rpc.success();
+        }
+        for (int i = 0; i < std::min(statCount, WINPTY_STARTUP_STAT_COUNT); ++i) {
+            statsUs[i] = stats[i];
+        }
+        return WINPTY_STARTUP_STAT_COUNT;
+    } API_CATCH(-1)
+}
+
+// Sends a request whose reply is a count and that many INT64 stats, and
+// copies the stats out as winpty_get_freeze_stats documents.
+static int getAgentStatArray(winpty_t &wp, AgentMsg::Type type, int maxCount,
+                             INT64 *stats, int statCount) {
+    ASSERT(stats != nullptr || statCount == 0);
+    LockGuard<Mutex> lock(wp.mutex);
+    RpcOperation rpc(wp);
+    auto packet = newPacket();
+    packet.putInt32(type);
+    writePacket(wp, packet);
+    auto reply = readPacket(wp);
+    const int count = reply.getInt32();
+    ASSERT(count >= 0 && count <= maxCount);
+    for (int i = 0; i < count; ++i) {
+        const int64_t value = reply.getInt64();
+        if (i < statCount) {
+            stats[i] = value;
         }
+    }
+    reply.assertEof();
+    rpc.success();
+    for (int i = count; i < statCount; ++i) {
+        stats[i] = 0;
+    }
+    return count;
+}
 
+WINPTY_API int
+winpty_get_freeze_stats(winpty_t *wp, INT64 *stats, int statCount,
+                        winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        return getAgentStatArray(*wp, AgentMsg::GetFreezeStats,
+                                 WINPTY_FREEZE_STAT_COUNT, stats, statCount);
+    } API_CATCH(-1)
+}
+
+WINPTY_API int
+winpty_get_tick_stats(winpty_t *wp, INT64 *stats, int statCount,
+                      winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        return getAgentStatArray(*wp, AgentMsg::GetTickStats,
+                                 WINPTY_TICK_STAT_COUNT, stats, statCount);
+    } API_CATCH(-1)
+}
+
+static void writeStatsRequest(winpty_t &wp) {
+    auto packet = newPacket();
+    packet.putInt32(AgentMsg::GetStats);
+    writePacket(wp, packet);
+}
+
+static std::vector<int64_t> readStatsReply(winpty_t &wp) {
+    auto reply = readPacket(wp);
+    const int count = reply.getInt32();
+    ASSERT(count >= 0 && count <= WINPTY_STAT_COUNT);
+    std::vector<int64_t> ret;
+    for (int i = 0; i < count; ++i) {
+        ret.push_back(reply.getInt64());
+    }
+    reply.assertEof();
+    return ret;
+}
+
+static int copyStats(const std::vector<int64_t> &stats,
+                     INT64 *out, int outCount) {
+    const int count = static_cast<int>(stats.size());
+    for (int i = 0; i < outCount; ++i) {
+        out[i] = i < count ? stats[i] : 0;
+    }
+    return count;
+}
+
+WINPTY_API int
+winpty_get_stats(winpty_t *wp, INT64 *stats, int statCount,
+                 winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        ASSERT(stats != nullptr || statCount == 0);
+        LockGuard<Mutex> lock(wp->mutex);
+        RpcOperation rpc(*wp);
+        writeStatsRequest(*wp);
+        const auto values = readStatsReply(*wp);
+        rpc.success();
+        return copyStats(values, stats, statCount);
+    } API_CATCH(-1)
+}
+
+WINPTY_API int
+winpty_get_screen_snapshot(winpty_t *wp, CHAR_INFO *cells, int cellCount,
+                           int *cols, int *rows,
+                           int *cursorCol, int *cursorRow,
+                           BOOL *cursorVisible,
+                           winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        ASSERT(cells != nullptr || cellCount == 0);
+        LockGuard<Mutex> lock(wp->mutex);
+        RpcOperation rpc(*wp);
+        auto packet = newPacket();
+        packet.putInt32(AgentMsg::GetScreenSnapshot);
+        writePacket(*wp, packet);
+        auto reply = readPacket(*wp);
+        const int replyCols = reply.getInt32();
+        const int replyRows = reply.getInt32();
+        const int replyCursorCol = reply.getInt32();
+        const int replyCursorRow = reply.getInt32();
+        const bool replyCursorVisible = reply.getInt32() != 0;
+        if (replyCols < 0 || replyRows < 0) {
+            throwWinptyException(L"Agent RPC error: invalid snapshot size");
+        }
+        const int total = replyCols * replyRows;
+        const int copied = std::min(total, cellCount);
+        reply.getRawData(cells, copied * sizeof(CHAR_INFO));
+        reply.getRawSpan((total - copied) * sizeof(CHAR_INFO));
         reply.assertEof();
         rpc.success();
-        return actualProcessCount;
-    } API_CATCH(0)
+        if (cols != nullptr) {
+            *cols = replyCols;
+        }
+        if (rows != nullptr) {
+            *rows = replyRows;
+        }
+        if (cursorCol != nullptr) {
+            *cursorCol = replyCursorCol;
+        }
+        if (cursorRow != nullptr) {
+            *cursorRow = replyCursorRow;
+        }
+        if (cursorVisible != nullptr) {
+            *cursorVisible = replyCursorVisible;
+        }
+        return total;
+    } API_CATCH(-1)
+}
+
+WINPTY_API int
+winpty_get_output_since(winpty_t *wp, UINT64 since, void *buf, int size,
+                        UINT64 *endPos,
+                        winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        ASSERT(buf != nullptr || size == 0);
+        ASSERT(size >= 0);
+        LockGuard<Mutex> lock(wp->mutex);
+        RpcOperation rpc(*wp);
+        auto packet = newPacket();
+        packet.putInt32(AgentMsg::GetOutputSince);
+        packet.putInt64(since);
+        packet.putInt32(size);
+        writePacket(*wp, packet);
+        auto reply = readPacket(*wp);
+        const int status = reply.getInt32();
+        reply.getInt64(); // start offset
+        const uint64_t replyEnd = reply.getInt64();
+        const int copied = reply.getInt32();
+        if (copied < 0 || copied > size) {
+            throwWinptyException(L"Agent RPC error: invalid output size");
+        }
+        reply.getRawData(buf, copied);
+        reply.assertEof();
+        rpc.success();
+        if (status == 2) {
+            throwWinptyException(
+                L"WINPTY_FLAG_OUTPUT_JOURNAL was not specified");
+        } else if (status != 0) {
+            throw LibWinptyException(WINPTY_ERROR_OUTPUT_NOT_RETAINED,
+                L"The requested output is no longer retained");
+        }
+        if (endPos != nullptr) {
+            *endPos = replyEnd;
+        }
+        return copied;
+    } API_CATCH(-1)
+}
+
+WINPTY_API int
+winpty_get_history(winpty_t *wp, UINT64 firstLine, int lineCount,
+                   CHAR_INFO *cells, int cellCount, int *lineWidths,
+                   UINT64 *totalLines,
+                   winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        ASSERT(lineCount >= 0 && cellCount >= 0);
+        ASSERT(cells != nullptr || cellCount == 0);
+        ASSERT(lineWidths != nullptr || lineCount == 0);
+        LockGuard<Mutex> lock(wp->mutex);
+        RpcOperation rpc(*wp);
+        auto packet = newPacket();
+        packet.putInt32(AgentMsg::GetHistory);
+        packet.putInt64(firstLine);
+        packet.putInt32(lineCount);
+        packet.putInt32(cellCount);
+        writePacket(*wp, packet);
+        auto reply = readPacket(*wp);
+        const int status = reply.getInt32();
+        const uint64_t replyTotal = reply.getInt64();
+        const int count = reply.getInt32();
+        if (count < 0 || count > lineCount) {
+            throwWinptyException(L"Agent RPC error: invalid line count");
+        }
+        int copied = 0;
+        for (int i = 0; i < count; ++i) {
+            const int width = reply.getInt32();
+            if (width < 0 || width > cellCount - copied) {
+                throwWinptyException(L"Agent RPC error: invalid line width");
+            }
+            reply.getRawData(cells + copied, width * sizeof(CHAR_INFO));
+            lineWidths[i] = width;
+            copied += width;
+        }
+        reply.assertEof();
+        rpc.success();
+        if (status == 2) {
+            throwWinptyException(
+                L"WINPTY_FLAG_HISTORY_STORE was not specified");
+        }
+        if (totalLines != nullptr) {
+            *totalLines = replyTotal;
+        }
+        return count;
+    } API_CATCH(-1)
+}
+
+WINPTY_API int
+winpty_search_history(winpty_t *wp, LPCWSTR query, UINT64 fromLine,
+                      UINT64 flags, UINT64 *lines, int maxResults,
+                      winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        ASSERT(query != nullptr);
+        ASSERT(lines != nullptr || maxResults == 0);
+        ASSERT(maxResults >= 0);
+        if ((flags & WINPTY_SEARCH_FLAG_MASK) != flags) {
+            throwWinptyException(L"Invalid search flags");
+        }
+        LockGuard<Mutex> lock(wp->mutex);
+        RpcOperation rpc(*wp);
+        auto packet = newPacket();
+        packet.putInt32(AgentMsg::SearchHistory);
+        packet.putWString(query);
+        packet.putInt64(fromLine);
+        packet.putInt64(flags);
+        packet.putInt32(maxResults);
+        writePacket(*wp, packet);
+        auto reply = readPacket(*wp);
+        const int status = reply.getInt32();
+        const int count = reply.getInt32();
+        if (count < 0 || count > maxResults) {
+            throwWinptyException(L"Agent RPC error: invalid match count");
+        }
+        for (int i = 0; i < count; ++i) {
+            lines[i] = reply.getInt64();
+        }
+        reply.assertEof();
+        rpc.success();
+        if (status == 2) {
+            throwWinptyException(
+                L"WINPTY_FLAG_HISTORY_STORE was not specified");
+        }
+        return count;
+    } API_CATCH(-1)
+}
+
+WINPTY_API winpty_decompressor_t *
+winpty_decompressor_new(winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        return new winpty_decompressor_t;
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API BOOL
+winpty_decompressor_write(winpty_decompressor_t *d,
+                          const void *data, int size,
+                          winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(d != nullptr);
+        ASSERT(data != nullptr || size == 0);
+        ASSERT(size >= 0);
+        if (!d->decoder.write(static_cast<const char*>(data), size)) {
+            throwWinptyException(L"Malformed compressed output");
+        }
+        return TRUE;
+    } API_CATCH(FALSE)
+}
+
+WINPTY_API int
+winpty_decompressor_read(winpty_decompressor_t *d, void *buf, int size) {
+    ASSERT(d != nullptr);
+    ASSERT(buf != nullptr || size == 0);
+    ASSERT(size >= 0);
+    return static_cast<int>(d->decoder.read(static_cast<char*>(buf), size));
+}
+
+WINPTY_API void winpty_decompressor_free(winpty_decompressor_t *d) {
+    delete d;
 }
 
 WINPTY_API void winpty_free(winpty_t *wp) {
+    if (wp == nullptr) {
+        return;
+    }
+    if (wp->rpcThread.get() != nullptr) {
+        // Let the RPC thread finish the requests already queued.
+        {
+            LockGuard<Mutex> lock(wp->rpcQueueMutex);
+            wp->rpcExiting = true;
+        }
+        SetEvent(wp->rpcEvent.get());
+        WaitForSingleObject(wp->rpcThread.get(), INFINITE);
+    }
+    if (wp->pingRequest != nullptr) {
+        releaseRequest(wp->pingRequest);
+    }
     // At least in principle, CloseHandle can fail, so this deletion can
     // fail.  It won't throw an exception, but maybe there's an error that
     // should be propagated?
     delete wp;
 }
+
+
+
+/*****************************************************************************
+ * Asynchronous agent RPC calls. */
+
+static void releaseRequest(winpty_request_t *req) {
+    if (InterlockedDecrement(&req->refCount) == 0) {
+        winpty_error_free(req->error);
+        delete req;
+    }
+}
+
+static void completeRequest(winpty_request_t &req) {
+    {
+        LockGuard<Mutex> lock(req.mutex);
+        req.done = true;
+        req.doneTick = GetTickCount();
+    }
+    if (req.event.get() != nullptr) {
+        SetEvent(req.event.get());
+    }
+    releaseRequest(&req);
+}
+
+// Must be called from within a catch block.
+static void failRequest(winpty_request_t &req) {
+    winpty_error_ptr_t *err = &req.error;
+    translateException(err);
+    completeRequest(req);
+}
+
+static void writeAsyncRequest(winpty_t &wp, winpty_request_t &req) {
+    switch (req.type) {
+    case AgentMsg::StartProcess:
+        writeSpawnRequest(wp, req.spawnConfig,
+                          req.wantProcessHandle, req.wantThreadHandle);
+        break;
+    case AgentMsg::SetSize:
+        writeSetSizeRequest(wp, req.cols, req.rows);
+        break;
+    case AgentMsg::GetConsoleProcessList:
+        writeConsoleProcessListRequest(wp);
+        break;
+    case AgentMsg::GetStats:
+        writeStatsRequest(wp);
+        break;
+    case AgentMsg::Ping: {
+        auto packet = newPacket();
+        packet.putInt32(AgentMsg::Ping);
+        writePacket(wp, packet);
+        break;
+    }
+    default:
+        ASSERT(false && "unexpected async request type");
+    }
+}
+
+static void readAsyncReply(winpty_t &wp, winpty_request_t &req) {
+    switch (req.type) {
+    case AgentMsg::StartProcess:
+        req.processCreated = readSpawnReply(
+            wp, req.processHandle, req.threadHandle, req.createProcessError);
+        break;
+    case AgentMsg::SetSize:
+        readSetSizeReply(wp);
+        break;
+    case AgentMsg::GetConsoleProcessList:
+        req.processList = readConsoleProcessListReply(wp);
+        break;
+    case AgentMsg::GetStats:
+        req.stats = readStatsReply(wp);
+        break;
+    case AgentMsg::Ping:
+        readPacket(wp).assertEof();
+        break;
+    default:
+        ASSERT(false && "unexpected async request type");
+    }
+}
+
+// Write every request in the batch, as one AgentMsg::Batch packet, before
+// reading any reply, so the agent works through the batch without waiting on
+// a round trip per request.  The agent handles the whole packet before it
+// replies, and the replies arrive in request order.
+static void runRpcBatch(winpty_t &wp, std::vector<winpty_request_t*> &batch) {
+    // A resize immediately followed by another one is superseded by it, so
+    // it's completed without being sent.
+    size_t kept = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (batch[i]->type == AgentMsg::SetSize &&
+                i + 1 < batch.size() &&
+                batch[i + 1]->type == AgentMsg::SetSize) {
+            completeRequest(*batch[i]);
+        } else {
+            batch[kept++] = batch[i];
+        }
+    }
+    batch.resize(kept);
+    LockGuard<Mutex> lock(wp.mutex);
+    size_t written = 0;
+    try {
+        RpcOperation rpc(wp);
+        if (batch.size() == 1) {
+            writeAsyncRequest(wp, *batch[0]);
+        } else {
+            auto packet = newPacket();
+            packet.putInt32(AgentMsg::Batch);
+            packet.putInt32(static_cast<int32_t>(batch.size()));
+            wp.batchPacket = &packet;
+            for (winpty_request_t *req : batch) {
+                writeAsyncRequest(wp, *req);
+            }
+            wp.batchPacket = nullptr;
+            writePacket(wp, packet);
+        }
+        written = batch.size();
+        rpc.success();
+    } catch (...) {
+        wp.batchPacket = nullptr;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            failRequest(*batch[i]);
+        }
+    }
+    for (size_t i = 0; i < written; ++i) {
+        winpty_request_t &req = *batch[i];
+        try {
+            RpcOperation rpc(wp);
+            readAsyncReply(wp, req);
+            rpc.success();
+            if (req.type == AgentMsg::StartProcess && !req.processCreated) {
+                throw LibWinptyException(
+                    WINPTY_ERROR_SPAWN_CREATE_PROCESS_FAILED,
+                    L"CreateProcess failed");
+            }
+        } catch (...) {
+            failRequest(req);
+            continue;
+        }
+        completeRequest(req);
+    }
+}
+
+static DWORD WINAPI rpcThread(void *param) {
+    winpty_t &wp = *static_cast<winpty_t*>(param);
+    std::vector<winpty_request_t*> batch;
+    while (true) {
+        {
+            LockGuard<Mutex> lock(wp.rpcQueueMutex);
+            batch.assign(wp.rpcQueue.begin(), wp.rpcQueue.end());
+            wp.rpcQueue.clear();
+            if (batch.empty() && wp.rpcExiting) {
+                return 0;
+            }
+        }
+        if (batch.empty()) {
+            WaitForSingleObject(wp.rpcEvent.get(), INFINITE);
+        } else {
+            runRpcBatch(wp, batch);
+        }
+    }
+}
+
+static winpty_request_t *
+startRequest(winpty_t &wp, std::unique_ptr<winpty_request_t> req,
+             HANDLE event) {
+    if (event != nullptr) {
+        HANDLE dup = nullptr;
+        if (!DuplicateHandle(GetCurrentProcess(), event,
+                GetCurrentProcess(), &dup,
+                0, FALSE, DUPLICATE_SAME_ACCESS)) {
+            throwWindowsError(L"DuplicateHandle of request event");
+        }
+        req->event = OwnedHandle(dup);
+    }
+    LockGuard<Mutex> lock(wp.rpcQueueMutex);
+    if (wp.rpcThread.get() == nullptr) {
+        HANDLE rpcEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        if (rpcEvent == nullptr) {
+            throwWindowsError(L"CreateEventW failed");
+        }
+        wp.rpcEvent = OwnedHandle(rpcEvent);
+        HANDLE thread = CreateThread(nullptr, 0, rpcThread, &wp, 0, nullptr);
+        if (thread == nullptr) {
+            throwWindowsError(L"CreateThread failed");
+        }
+        wp.rpcThread = OwnedHandle(thread);
+    }
+    wp.rpcQueue.push_back(req.get());
+    SetEvent(wp.rpcEvent.get());
+    return req.release();
+}
+
+static winpty_error_ptr_t copyError(winpty_error_ptr_t err) {
+    if (err == nullptr || err->msgDynamic == nullptr) {
+        // Static error objects are never freed.
+        return err;
+    }
+    std::unique_ptr<winpty_error_t> ret(new winpty_error_t(*err));
+    ret->msgDynamic = new std::shared_ptr<std::wstring>(*err->msgDynamic);
+    return ret.release();
+}
+
+WINPTY_API winpty_request_t *
+winpty_spawn_async(winpty_t *wp,
+                   const winpty_spawn_config_t *cfg,
+                   BOOL want_process_handle,
+                   BOOL want_thread_handle,
+                   HANDLE event /*OPTIONAL*/,
+                   winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr && cfg != nullptr);
+        std::unique_ptr<winpty_request_t> req(new winpty_request_t);
+        req->type = AgentMsg::StartProcess;
+        req->spawnConfig = *cfg;
+        req->wantProcessHandle = want_process_handle != FALSE;
+        req->wantThreadHandle = want_thread_handle != FALSE;
+        return startRequest(*wp, std::move(req), event);
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API winpty_request_t *
+winpty_set_size_async(winpty_t *wp, int cols, int rows,
+                      HANDLE event /*OPTIONAL*/,
+                      winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr && cols > 0 && rows > 0);
+        std::unique_ptr<winpty_request_t> req(new winpty_request_t);
+        req->type = AgentMsg::SetSize;
+        req->cols = cols;
+        req->rows = rows;
+        return startRequest(*wp, std::move(req), event);
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API BOOL
+winpty_set_size_nowait(winpty_t *wp, int cols, int rows,
+                       winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr && cols > 0 && rows > 0);
+        std::unique_ptr<winpty_request_t> req(new winpty_request_t);
+        req->type = AgentMsg::SetSize;
+        req->cols = cols;
+        req->rows = rows;
+        releaseRequest(startRequest(*wp, std::move(req), nullptr));
+        return TRUE;
+    } API_CATCH(FALSE)
+}
+
+WINPTY_API winpty_request_t *
+winpty_get_console_process_list_async(winpty_t *wp,
+                                      HANDLE event /*OPTIONAL*/,
+                                      winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        std::unique_ptr<winpty_request_t> req(new winpty_request_t);
+        req->type = AgentMsg::GetConsoleProcessList;
+        return startRequest(*wp, std::move(req), event);
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API winpty_request_t *
+winpty_get_stats_async(winpty_t *wp,
+                       HANDLE event /*OPTIONAL*/,
+                       winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        std::unique_ptr<winpty_request_t> req(new winpty_request_t);
+        req->type = AgentMsg::GetStats;
+        return startRequest(*wp, std::move(req), event);
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API BOOL winpty_request_done(winpty_request_t *req) {
+    ASSERT(req != nullptr);
+    LockGuard<Mutex> lock(req->mutex);
+    return req->done;
+}
+
+WINPTY_API BOOL
+winpty_request_result(winpty_request_t *req,
+                      winpty_error_ptr_t *err /*OPTIONAL*/) {
+    ASSERT(req != nullptr);
+    LockGuard<Mutex> lock(req->mutex);
+    ASSERT(req->done && "winpty_request_result: request is still pending");
+    if (req->error != nullptr) {
+        if (err != nullptr) {
+            *err = copyError(req->error);
+        }
+        return FALSE;
+    }
+    if (err != nullptr) {
+        *err = nullptr;
+    }
+    return TRUE;
+}
+
+WINPTY_API int
+winpty_request_process_list(winpty_request_t *req,
+                            int *processList, const int processCount,
+                            winpty_error_ptr_t *err /*OPTIONAL*/) {
+    ASSERT(processList != nullptr);
+    if (!winpty_request_result(req, err)) {
+        return 0;
+    }
+    ASSERT(req->type == AgentMsg::GetConsoleProcessList);
+    LockGuard<Mutex> lock(req->mutex);
+    return copyProcessList(req->processList, processList, processCount);
+}
+
+WINPTY_API int
+winpty_request_stats(winpty_request_t *req, INT64 *stats, int statCount,
+                     winpty_error_ptr_t *err /*OPTIONAL*/) {
+    ASSERT(stats != nullptr || statCount == 0);
+    if (!winpty_request_result(req, err)) {
+        return -1;
+    }
+    ASSERT(req->type == AgentMsg::GetStats);
+    LockGuard<Mutex> lock(req->mutex);
+    return copyStats(req->stats, stats, statCount);
+}
+
+WINPTY_API BOOL
+winpty_request_spawn_result(winpty_request_t *req,
+                            HANDLE *process_handle /*OPTIONAL*/,
+                            HANDLE *thread_handle /*OPTIONAL*/,
+                            DWORD *create_process_error /*OPTIONAL*/,
+                            winpty_error_ptr_t *err /*OPTIONAL*/) {
+    ASSERT(req != nullptr && req->type == AgentMsg::StartProcess);
+    if (process_handle != nullptr) { *process_handle = nullptr; }
+    if (thread_handle != nullptr) { *thread_handle = nullptr; }
+    if (create_process_error != nullptr) { *create_process_error = 0; }
+    const BOOL ret = winpty_request_result(req, err);
+    LockGuard<Mutex> lock(req->mutex);
+    if (create_process_error != nullptr) {
+        *create_process_error = req->createProcessError;
+    }
+    if (process_handle != nullptr) {
+        *process_handle = req->processHandle.release();
+    }
+    if (thread_handle != nullptr) {
+        *thread_handle = req->threadHandle.release();
+    }
+    return ret;
+}
+
+WINPTY_API int
+winpty_poll_status(winpty_t *wp, DWORD *latencyMs /*OPTIONAL*/,
+                   winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(wp != nullptr);
+        if (latencyMs != nullptr) {
+            *latencyMs = 0;
+        }
+        if (WaitForSingleObject(wp->agentProcess.get(), 0) == WAIT_OBJECT_0) {
+            return WINPTY_STATUS_DEAD;
+        }
+        LockGuard<Mutex> lock(wp->statusMutex);
+        int status = WINPTY_STATUS_PENDING;
+        winpty_request_t *const ping = wp->pingRequest;
+        if (ping != nullptr) {
+            bool done = false;
+            bool failed = false;
+            DWORD doneTick = 0;
+            {
+                LockGuard<Mutex> reqLock(ping->mutex);
+                done = ping->done;
+                failed = ping->error != nullptr;
+                doneTick = ping->doneTick;
+            }
+            if (!done) {
+                if (latencyMs != nullptr) {
+                    *latencyMs = GetTickCount() - wp->pingStartTick;
+                }
+                return WINPTY_STATUS_PENDING;
+            }
+            wp->pingRequest = nullptr;
+            releaseRequest(ping);
+            if (failed) {
+                return WINPTY_STATUS_DEAD;
+            }
+            if (latencyMs != nullptr) {
+                *latencyMs = doneTick - wp->pingStartTick;
+            }
+            status = WINPTY_STATUS_OK;
+        }
+        std::unique_ptr<winpty_request_t> req(new winpty_request_t);
+        req->type = AgentMsg::Ping;
+        wp->pingStartTick = GetTickCount();
+        wp->pingRequest = startRequest(*wp, std::move(req), nullptr);
+        return status;
+    } API_CATCH(-1)
+}
+
+WINPTY_API void winpty_request_free(winpty_request_t *req) {
+    if (req != nullptr) {
+        releaseRequest(req);
+    }
+}
+
+
+
+/*****************************************************************************
+ * Pool of pre-started agents. */
+
+// Starts an agent for the pool, along with the pool's shell, if it has one.
+static std::unique_ptr<winpty_t> openPoolAgent(const winpty_pool_t &pool,
+                                               const winpty_config_t *cfg) {
+    if (!pool.hasShell) {
+        return openAgent(cfg, nullptr);
+    }
+    const InitialSpawn spawn = { pool.shell, true, false };
+    auto wp = openAgent(cfg, &spawn);
+    LockGuard<Mutex> lock(wp->mutex);
+    RpcOperation rpc(*wp);
+    OwnedHandle process;
+    OwnedHandle thread;
+    DWORD createProcessError = 0;
+    const bool created =
+        readSpawnReply(*wp, process, thread, createProcessError);
+    rpc.success();
+    if (!created) {
+        throwWindowsError(L"The pool's shell could not be started",
+                          createProcessError);
+    }
+    wp->shellProcess = std::move(process);
+    return wp;
+}
+
+// Keeps the pool topped up.  The thread sleeps until the pool is created or
+// an agent is claimed, then starts agents until the pool is full again.  If
+// an agent fails to start, the error is traced and the thread waits for the
+// next claim rather than retrying in a loop.
+static DWORD WINAPI poolRefillThread(void *param) {
+    winpty_pool_t &pool = *static_cast<winpty_pool_t*>(param);
+    while (true) {
+        WaitForSingleObject(pool.refillEvent.get(), INFINITE);
+        while (true) {
+            {
+                LockGuard<Mutex> lock(pool.mutex);
+                if (pool.exiting) {
+                    return 0;
+                }
+                if (pool.idle.size() >= pool.targetCount) {
+                    break;
+                }
+            }
+            std::unique_ptr<winpty_t> wp;
+            try {
+                wp = openPoolAgent(pool, &pool.cfg);
+            } catch (...) {
+                winpty_error_ptr_t *err = nullptr;
+                translateException(err);
+                break;
+            }
+            LockGuard<Mutex> lock(pool.mutex);
+            pool.idle.push_back(std::move(wp));
+        }
+    }
+}
+
+static winpty_pool_t *newPool(const winpty_config_t *cfg,
+                              const winpty_spawn_config_t *shell,
+                              int count) {
+    ASSERT(cfg != nullptr && count > 0);
+    // Creating the background desktop in this process isn't thread-safe,
+    // so the refill thread can't do it.
+    ASSERT(!(cfg->flags & WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION) &&
+        "WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION is incompatible "
+        "with winpty_pool_new");
+    dumpWindowsVersion();
+    dumpVersionToTrace();
+    std::unique_ptr<winpty_pool_t> pool(new winpty_pool_t);
+    pool->cfg = *cfg;
+    pool->targetCount = count;
+    if (shell != nullptr) {
+        pool->hasShell = true;
+        pool->shell = *shell;
+    }
+    HANDLE event = CreateEventW(nullptr, FALSE, TRUE, nullptr);
+    if (event == nullptr) {
+        throwWindowsError(L"CreateEventW failed");
+    }
+    pool->refillEvent = OwnedHandle(event);
+    HANDLE thread = CreateThread(nullptr, 0, poolRefillThread,
+                                 pool.get(), 0, nullptr);
+    if (thread == nullptr) {
+        throwWindowsError(L"CreateThread failed");
+    }
+    pool->refillThread = OwnedHandle(thread);
+    return pool.release();
+}
+
+WINPTY_API winpty_pool_t *
+winpty_pool_new(const winpty_config_t *cfg, int count,
+                winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        return newPool(cfg, nullptr, count);
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API winpty_pool_t *
+winpty_pool_new_with_shell(const winpty_config_t *cfg,
+                           const winpty_spawn_config_t *spawnCfg,
+                           int count,
+                           winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(spawnCfg != nullptr);
+        return newPool(cfg, spawnCfg, count);
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API winpty_t *
+winpty_pool_open(winpty_pool_t *pool, int cols, int rows,
+                 winpty_error_ptr_t *err /*OPTIONAL*/) {
+    API_TRY {
+        ASSERT(pool != nullptr && cols > 0 && rows > 0);
+        std::unique_ptr<winpty_t> wp;
+        {
+            LockGuard<Mutex> lock(pool->mutex);
+            while (!pool->idle.empty() && wp == nullptr) {
+                wp = std::move(pool->idle.front());
+                pool->idle.pop_front();
+                if (WaitForSingleObject(wp->agentProcess.get(), 0) ==
+                        WAIT_OBJECT_0) {
+                    trace("winpty_pool_open: discarding exited agent");
+                    wp.reset();
+                } else if (wp->shellProcess.get() != nullptr &&
+                        WaitForSingleObject(wp->shellProcess.get(), 0) ==
+                            WAIT_OBJECT_0) {
+                    trace("winpty_pool_open: discarding agent whose shell "
+                          "exited");
+                    wp.reset();
+                }
+            }
+        }
+        SetEvent(pool->refillEvent.get());
+        if (wp == nullptr) {
+            // The pool is empty, so start an agent the slow way.
+            winpty_config_t cfg = pool->cfg;
+            cfg.cols = cols;
+            cfg.rows = rows;
+            return openPoolAgent(*pool, &cfg).release();
+        }
+        if (cols != pool->cfg.cols || rows != pool->cfg.rows) {
+            setSize(*wp, cols, rows);
+        }
+        return wp.release();
+    } API_CATCH(nullptr)
+}
+
+WINPTY_API HANDLE winpty_shell_process(winpty_t *wp) {
+    ASSERT(wp != nullptr);
+    LockGuard<Mutex> lock(wp->mutex);
+    return wp->shellProcess.release();
+}
+
+WINPTY_API void winpty_pool_free(winpty_pool_t *pool) {
+    if (pool == nullptr) {
+        return;
+    }
+    {
+        LockGuard<Mutex> lock(pool->mutex);
+        pool->exiting = true;
+    }
+    SetEvent(pool->refillEvent.get());
+    WaitForSingleObject(pool->refillThread.get(), INFINITE);
+    delete pool;
+}
@@ -21,12 +21,50 @@
 #ifndef WINPTY_SHARED_AGENT_MSG_H
 #define WINPTY_SHARED_AGENT_MSG_H
 
+#include <stdint.h>
+
 struct AgentMsg
 {
     enum Type {
         StartProcess,
         SetSize,
         GetConsoleProcessList,
+        GetStartupStats,
+        GetFreezeStats,
+        GetStats,
+        GetScreenSnapshot,
+        GetOutputSince,
+        SubscribeProcessList,
+        // A count, then that many complete packets, handled in order.  The
+        // agent replies to each one as if it had been sent separately.
+        Batch,
+        // An empty request with an empty reply, to check the agent's health.
+        Ping,
+        GetTickStats,
+        GetHistory,
+        SearchHistory,
+        // An int32 that is nonzero if the session is visible.
+        SetVisibility,
+        AttachOutputObserver,
+        // A WString path (empty to stop recording) and an int32 format.
+        SetOutputRecording,
+        // The reply is an int64 handle of the activity event, or zero if
+        // frame-on-demand output isn't possible.
+        EnableFrameOnDemand,
+        RequestFrame,
+    };
+};
+
+// The agent's console probe results, in the caller bits of a
+// windowsVersionCaps value.  The agent reports them at the end of its setup
+// packet, and libwinpty passes the first agent's results to later agents on
+// their command lines, so only one agent per process runs the probe.
+struct HostConsoleCaps
+{
+    enum : uint64_t {
+        Probed  = 1u << 8,
+        NewW10  = 1u << 9,
+        Mask    = Probed | NewW10,
     };
 };
 
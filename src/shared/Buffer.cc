@@ -37,15 +37,30 @@
 
 enum class Piece : uint8_t { Int32, Int64, WString };
 
+void WriteBuffer::reserveSpace(size_t len) {
+    ASSERT(len <= SIZE_MAX - m_size);
+    if (m_size + len <= m_capacity) {
+        return;
+    }
+    const size_t newCapacity = std::max(m_capacity * 2, m_size + len);
+    std::unique_ptr<char[]> newHeap(new char[newCapacity]);
+    std::copy(m_data, m_data + m_size, newHeap.get());
+    m_heap = std::move(newHeap);
+    m_data = m_heap.get();
+    m_capacity = newCapacity;
+}
+
 void WriteBuffer::putRawData(const void *data, size_t len) {
+    reserveSpace(len);
     const auto p = reinterpret_cast<const char*>(data);
-    m_buf.insert(m_buf.end(), p, p + len);
+    std::copy(p, p + len, m_data + m_size);
+    m_size += len;
 }
 
 void WriteBuffer::replaceRawData(size_t pos, const void *data, size_t len) {
-    ASSERT(pos <= m_buf.size() && len <= m_buf.size() - pos);
+    ASSERT(pos <= m_size && len <= m_size - pos);
     const auto p = reinterpret_cast<const char*>(data);
-    std::copy(p, p + len, &m_buf[pos]);
+    std::copy(p, p + len, m_data + pos);
 }
 
 void WriteBuffer::putInt32(int32_t i) {
@@ -66,11 +81,16 @@ void WriteBuffer::putWString(const wchar_t *str, size_t len) {
 }
 
 void ReadBuffer::getRawData(void *data, size_t len) {
-    ASSERT(m_off <= m_buf.size());
-    READ_BUFFER_CHECK(len <= m_buf.size() - m_off);
-    const char *const inp = &m_buf[m_off];
+    const char *const inp = getRawSpan(len);
     std::copy(inp, inp + len, reinterpret_cast<char*>(data));
+}
+
+const char *ReadBuffer::getRawSpan(size_t len) {
+    ASSERT(m_off <= m_size);
+    READ_BUFFER_CHECK(len <= m_size - m_off);
+    const char *const ret = m_data + m_off;
     m_off += len;
+    return ret;
 }
 
 int32_t ReadBuffer::getInt32() {
@@ -84,20 +104,25 @@ int64_t ReadBuffer::getInt64() {
 }
 
 std::wstring ReadBuffer::getWString() {
+    std::wstring ret;
+    getWString(ret);
+    return ret;
+}
+
+void ReadBuffer::getWString(std::wstring &out) {
     READ_BUFFER_CHECK(getRawValue<Piece>() == Piece::WString);
     const uint64_t charLen = getRawValue<uint64_t>();
     READ_BUFFER_CHECK(charLen <= SIZE_MAX / sizeof(wchar_t));
     // To be strictly conforming, we can't use the convenient wstring
-    // constructor, because the string in m_buf mightn't be aligned.
-    std::wstring ret;
+    // constructor, because the string in the buffer mightn't be aligned.
+    const size_t byteLen = static_cast<size_t>(charLen) * sizeof(wchar_t);
+    const char *const inp = getRawSpan(byteLen);
+    out.resize(static_cast<size_t>(charLen));
     if (charLen > 0) {
-        const size_t byteLen = charLen * sizeof(wchar_t);
-        ret.resize(charLen);
-        getRawData(&ret[0], byteLen);
+        memcpy(&out[0], inp, byteLen);
     }
-    return ret;
 }
 
 void ReadBuffer::assertEof() {
-    READ_BUFFER_CHECK(m_off == m_buf.size());
+    READ_BUFFER_CHECK(m_off == m_size);
 }
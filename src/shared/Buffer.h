@@ -25,18 +25,31 @@
 #include <string.h>
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 #include <vector>
 #include <string>
 
 #include "WinptyException.h"
 
+// Control messages are small, so a WriteBuffer holds up to kInlineSize bytes
+// without allocating, and moves to the heap only for larger messages (e.g. a
+// StartProcess request with a big environment block).
 class WriteBuffer {
+public:
+    enum { kInlineSize = 256 };
+
 private:
-    std::vector<char> m_buf;
+    char *m_data;
+    size_t m_size = 0;
+    size_t m_capacity = kInlineSize;
+    std::unique_ptr<char[]> m_heap;
+    char m_inline[kInlineSize];
+
+    void reserveSpace(size_t len);
 
 public:
-    WriteBuffer() {}
+    WriteBuffer() : m_data(m_inline) {}
 
     template <typename T> void putRawValue(const T &t) {
         putRawData(&t, sizeof(t));
@@ -52,14 +65,31 @@ public:
     void putWString(const wchar_t *str, size_t len);
     void putWString(const wchar_t *str)         { putWString(str, wcslen(str)); }
     void putWString(const std::wstring &str)    { putWString(str.data(), str.size()); }
-    std::vector<char> &buf()                    { return m_buf; }
+    const char *data() const                    { return m_data; }
+    size_t size() const                         { return m_size; }
 
-    // MSVC 2013 does not generate these automatically, so help it out.
-    WriteBuffer(WriteBuffer &&other) : m_buf(std::move(other.m_buf)) {}
+    WriteBuffer(WriteBuffer &&other) : m_data(m_inline) {
+        *this = std::move(other);
+    }
     WriteBuffer &operator=(WriteBuffer &&other) {
-        m_buf = std::move(other.m_buf);
+        if (this != &other) {
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            m_heap = std::move(other.m_heap);
+            if (m_heap) {
+                m_data = m_heap.get();
+            } else {
+                m_data = m_inline;
+                memcpy(m_inline, other.m_inline, m_size);
+            }
+            other.m_data = other.m_inline;
+            other.m_size = 0;
+            other.m_capacity = kInlineSize;
+        }
         return *this;
     }
+    WriteBuffer(const WriteBuffer &other) = delete;
+    WriteBuffer &operator=(const WriteBuffer &other) = delete;
 };
 
 class ReadBuffer {
@@ -71,11 +101,21 @@ public:
     };
 
 private:
-    std::vector<char> m_buf;
+    // The buffer either owns its bytes (m_storage) or decodes bytes owned by
+    // the caller, e.g. a connection's reusable packet buffer.
+    std::vector<char> m_storage;
+    const char *m_data;
+    size_t m_size;
     size_t m_off = 0;
 
 public:
-    explicit ReadBuffer(std::vector<char> &&buf) : m_buf(std::move(buf)) {}
+    explicit ReadBuffer(std::vector<char> &&buf) :
+        m_storage(std::move(buf)),
+        m_data(m_storage.data()),
+        m_size(m_storage.size()) {}
+
+    // The data must outlive the ReadBuffer.
+    ReadBuffer(const char *data, size_t size) : m_data(data), m_size(size) {}
 
     template <typename T> T getRawValue() {
         T ret = {};
@@ -84,16 +124,28 @@ public:
     }
 
     void getRawData(void *data, size_t len);
+    // Returns the next len bytes in place and skips over them.
+    const char *getRawSpan(size_t len);
     int32_t getInt32();
     int64_t getInt64();
     std::wstring getWString();
+    // Decodes a string into out, reusing its capacity.  (The characters
+    // mightn't be aligned within the packet, so they can't be returned in
+    // place.)
+    void getWString(std::wstring &out);
     void assertEof();
 
-    // MSVC 2013 does not generate these automatically, so help it out.
+    // MSVC 2013 does not generate these automatically, so help it out.  (A
+    // moved vector keeps its storage, so m_data stays valid.)
     ReadBuffer(ReadBuffer &&other) :
-        m_buf(std::move(other.m_buf)), m_off(other.m_off) {}
+        m_storage(std::move(other.m_storage)),
+        m_data(other.m_data),
+        m_size(other.m_size),
+        m_off(other.m_off) {}
     ReadBuffer &operator=(ReadBuffer &&other) {
-        m_buf = std::move(other.m_buf);
+        m_storage = std::move(other.m_storage);
+        m_data = other.m_data;
+        m_size = other.m_size;
         m_off = other.m_off;
         return *this;
     }
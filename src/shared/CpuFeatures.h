@@ -0,0 +1,45 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef WINPTY_SHARED_CPU_FEATURES_H
+#define WINPTY_SHARED_CPU_FEATURES_H
+
+// Support for the vectorized kernels (CharInfoScan, UnicodeTranscode), which
+// are compiled for every level and chosen at runtime.
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define WINPTY_CPU_X86 1
+#endif
+
+// Lets GCC compile one function for an instruction set the rest of the
+// program can't assume.  MSVC needs no attribute.
+#ifdef __GNUC__
+#define WINPTY_TARGET(x) __attribute__((target(x)))
+#else
+#define WINPTY_TARGET(x)
+#endif
+
+enum class CpuLevel { Generic, Sse2, Avx2 };
+
+// The best kernel level the processor and OS support.  It's always Generic
+// on processors other than x86.
+CpuLevel detectCpuLevel();
+
+#endif // WINPTY_SHARED_CPU_FEATURES_H
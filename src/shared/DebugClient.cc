@@ -21,18 +21,22 @@
 #include "DebugClient.h"
 
 #include <windows.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <algorithm>
+#include <iterator>
 #include <string>
 
+#include "TraceFormat.h"
 #include "winpty_snprintf.h"
 
 const wchar_t *const kPipeName = L"\\\\.\\pipe\\DebugServer";
 
 void *volatile g_debugConfig;
+volatile unsigned int g_traceCategories = ~0u;
 
 namespace {
 
@@ -48,9 +52,103 @@ private:
     DWORD m_lastError;
 };
 
+// trace() formats each message into a slot of this bounded MPSC queue (in
+// the style of Dmitry Vyukov's bounded queue), and a background thread sends
+// the messages to the debug server, several per pipe transaction.  A slot's
+// sequence number equals its position when it's free for a producer and the
+// position plus one once its message is ready for the consumer.  A slot
+// holds either a text message or a binary record (see TraceFormat.h).
+const int kTraceSlotCount = 256;
+const int kTraceMessageSize = 1024;
+
+// Keep each batch below the debug server's 4096-byte message limit.
+const int kTraceBatchSize = 4000;
+
+// The number of distinct format strings the binary trace format can name.
+const int kTraceFormatCount = 1024;
+
+struct TraceSlot {
+    volatile LONG sequence;
+    int length;
+    bool binary;
+    char message[kTraceMessageSize];
+};
+
+struct TraceBatch {
+    char data[kTraceBatchSize];
+    int length = 0;
+    bool binary = false;
+};
+
+struct TraceQueue {
+    TraceSlot slots[kTraceSlotCount];
+    volatile LONG enqueuePos;
+    volatile LONG dequeuePos;
+    volatile LONG dropped;
+    // The ID of the thread consuming the queue, or 0.
+    volatile LONG consuming;
+    volatile LONG flusherIdle;
+    volatile LONG noFlusher;
+    volatile LONG stopping;
+    HANDLE wakeEvent;
+    HANDLE flusherThread;
+    // The flusher thread's reference to the module containing this code, or
+    // NULL when that's the executable.
+    HMODULE flusherModule;
+    // The consumer's connection to the debug server.
+    HANDLE serverPipe;
+    // Binary tracing: the format strings, indexed by format ID (a hash of
+    // the string's address), and the records the consumer has sent since
+    // the debug server last failed to receive a batch.
+    void *volatile formats[kTraceFormatCount];
+    bool formatSent[kTraceFormatCount];
+    bool processSent;
+    int64_t qpcFrequency;
+    int64_t qpcStart;
+    int64_t unixMsStart;
+};
+
+TraceQueue *volatile g_traceQueue;
+
+inline LONG atomicLoad(volatile LONG *value) {
+    return InterlockedCompareExchange(value, 0, 0);
+}
+
+// The difference between two queue positions, which wrap around.
+inline LONG positionDiff(LONG a, LONG b) {
+    return static_cast<LONG>(
+        static_cast<unsigned long>(a) - static_cast<unsigned long>(b));
+}
+
 } // anonymous namespace
 
-static void sendToDebugServer(const char *message)
+// Get the current UTC time as milliseconds from the epoch (ignoring leap
+// seconds).  Use the Unix epoch for consistency with DebugClient.py.  There
+// are 134774 days between 1601-01-01 (the Win32 epoch) and 1970-01-01 (the
+// Unix epoch).
+static long long unixTimeMillis()
+{
+    FILETIME fileTime;
+    GetSystemTimeAsFileTime(&fileTime);
+    long long msTime = (((long long)fileTime.dwHighDateTime << 32) +
+                       fileTime.dwLowDateTime) / 10000;
+    return msTime - 134774LL * 24 * 3600 * 1000;
+}
+
+static const char *traceModuleBaseName()
+{
+    static char moduleName[1024];
+    static const char *volatile baseName;
+    if (baseName == NULL) {
+        GetModuleFileNameA(NULL, moduleName, sizeof(moduleName));
+        moduleName[sizeof(moduleName) - 1] = '\0';
+        const char *sep = strrchr(moduleName, '\\');
+        baseName = (sep != NULL) ? sep + 1 : moduleName;
+    }
+    return baseName;
+}
+
+static HANDLE connectToDebugServer()
 {
     HANDLE tracePipe = INVALID_HANDLE_VALUE;
 
@@ -73,26 +171,417 @@ static void sendToDebugServer(const char *message)
     if (tracePipe != INVALID_HANDLE_VALUE) {
         DWORD newMode = PIPE_READMODE_MESSAGE;
         SetNamedPipeHandleState(tracePipe, &newMode, NULL, NULL);
+    }
+    return tracePipe;
+}
+
+// The consumer keeps its connection to the debug server open.  An older
+// server disconnects after every message, so if a transaction on the open
+// connection fails, reconnect and try once more.
+static bool sendToDebugServer(TraceQueue &queue, const char *message,
+                              int length)
+{
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        if (queue.serverPipe == INVALID_HANDLE_VALUE) {
+            queue.serverPipe = connectToDebugServer();
+            if (queue.serverPipe == INVALID_HANDLE_VALUE) {
+                return false;
+            }
+        }
         char response[16];
         DWORD actual = 0;
-        TransactNamedPipe(tracePipe,
-            const_cast<char*>(message), strlen(message),
-            response, sizeof(response), &actual, NULL);
-        CloseHandle(tracePipe);
+        if (TransactNamedPipe(queue.serverPipe,
+                const_cast<char*>(message), length,
+                response, sizeof(response), &actual, NULL)) {
+            return true;
+        }
+        CloseHandle(queue.serverPipe);
+        queue.serverPipe = INVALID_HANDLE_VALUE;
     }
+    return false;
 }
 
-// Get the current UTC time as milliseconds from the epoch (ignoring leap
-// seconds).  Use the Unix epoch for consistency with DebugClient.py.  There
-// are 134774 days between 1601-01-01 (the Win32 epoch) and 1970-01-01 (the
-// Unix epoch).
-static long long unixTimeMillis()
+static bool traceQueueEmpty(TraceQueue &queue)
 {
-    FILETIME fileTime;
-    GetSystemTimeAsFileTime(&fileTime);
-    long long msTime = (((long long)fileTime.dwHighDateTime << 32) +
-                       fileTime.dwLowDateTime) / 10000;
-    return msTime - 134774LL * 24 * 3600 * 1000;
+    return atomicLoad(&queue.dequeuePos) == atomicLoad(&queue.enqueuePos);
+}
+
+// Returns false if the queue is full.
+static bool enqueueTrace(TraceQueue &queue, const char *message, int length,
+                         bool binary)
+{
+    LONG pos = atomicLoad(&queue.enqueuePos);
+    while (true) {
+        TraceSlot &slot = queue.slots[pos & (kTraceSlotCount - 1)];
+        const LONG diff = positionDiff(atomicLoad(&slot.sequence), pos);
+        if (diff == 0) {
+            const LONG oldPos = InterlockedCompareExchange(
+                &queue.enqueuePos, pos + 1, pos);
+            if (oldPos == pos) {
+                slot.length = std::min(length, kTraceMessageSize);
+                slot.binary = binary;
+                memcpy(slot.message, message, slot.length);
+                InterlockedExchange(&slot.sequence, pos + 1);
+                return true;
+            }
+            pos = oldPos;
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomicLoad(&queue.enqueuePos);
+        }
+    }
+}
+
+static char *putTraceRecordHeader(char *out, int size, TraceRecordType type)
+{
+    putTraceInt(out, static_cast<uint32_t>(size), 2);
+    putTraceInt(out, type, 1);
+    putTraceInt(out, GetCurrentProcessId(), 4);
+    return out;
+}
+
+static void flushTraceBatch(TraceQueue &queue, TraceBatch &batch)
+{
+    if (batch.length == 0) {
+        return;
+    }
+    if (!sendToDebugServer(queue, batch.data, batch.length) &&
+            batch.binary) {
+        // The server may not have seen the definitions; send them again.
+        queue.processSent = false;
+        std::fill(std::begin(queue.formatSent), std::end(queue.formatSent),
+                  false);
+    }
+    batch.length = 0;
+}
+
+// Text messages in a batch are separated by newlines.  A binary batch starts
+// with kTraceBinaryMagic.
+static void appendToTraceBatch(TraceQueue &queue, TraceBatch &batch,
+                               const char *data, int length, bool binary)
+{
+    if (batch.length > 0 &&
+            (batch.binary != binary ||
+             batch.length + length + 1 > kTraceBatchSize)) {
+        flushTraceBatch(queue, batch);
+    }
+    if (batch.length == 0) {
+        batch.binary = binary;
+        if (binary) {
+            memcpy(batch.data, kTraceBinaryMagic, sizeof(kTraceBinaryMagic));
+            batch.length = sizeof(kTraceBinaryMagic);
+        }
+    } else if (!binary) {
+        batch.data[batch.length++] = '\n';
+    }
+    memcpy(&batch.data[batch.length], data, length);
+    batch.length += length;
+}
+
+// Write the process and format records the binary record depends on that
+// haven't been sent yet.  Returns their total size.
+static int writeTraceDefinitions(TraceQueue &queue, const TraceSlot &slot,
+                                 char *out)
+{
+    char *const start = out;
+    if (!queue.processSent) {
+        const char *const name = traceModuleBaseName();
+        const int nameLen = std::min<int>(strlen(name), 256);
+        const int size = kTraceRecordHeaderSize + 24 + nameLen;
+        out = putTraceRecordHeader(out, size, kTraceRecordProcess);
+        putTraceInt(out, queue.qpcFrequency, 8);
+        putTraceInt(out, queue.qpcStart, 8);
+        putTraceInt(out, queue.unixMsStart, 8);
+        memcpy(out, name, nameLen);
+        out += nameLen;
+    }
+    if (slot.message[2] == kTraceRecordEvent) {
+        const int id = static_cast<int>(
+            getTraceInt(&slot.message[kTraceEventHeaderSize - 2], 2));
+        if (!queue.formatSent[id]) {
+            const char *const format =
+                static_cast<const char*>(queue.formats[id]);
+            const int formatLen = std::min<int>(
+                strlen(format), kTraceMessageSize - kTraceRecordHeaderSize - 2);
+            const int size = kTraceRecordHeaderSize + 2 + formatLen;
+            out = putTraceRecordHeader(out, size, kTraceRecordFormat);
+            putTraceInt(out, id, 2);
+            memcpy(out, format, formatLen);
+            out += formatLen;
+        }
+    }
+    return static_cast<int>(out - start);
+}
+
+static void markTraceDefinitionsSent(TraceQueue &queue, const TraceSlot &slot)
+{
+    queue.processSent = true;
+    if (slot.message[2] == kTraceRecordEvent) {
+        const int id = static_cast<int>(
+            getTraceInt(&slot.message[kTraceEventHeaderSize - 2], 2));
+        queue.formatSent[id] = true;
+    }
+}
+
+// Send every queued message to the debug server.  Only one thread consumes
+// the queue at a time; if another thread is already doing so, return.
+static void drainTraceQueue(TraceQueue &queue)
+{
+    const LONG threadId = static_cast<LONG>(GetCurrentThreadId());
+    if (InterlockedCompareExchange(&queue.consuming, threadId, 0) != 0) {
+        return;
+    }
+    TraceBatch batch;
+    char defs[kTraceMessageSize * 2];
+    while (true) {
+        const LONG pos = queue.dequeuePos;
+        TraceSlot &slot = queue.slots[pos & (kTraceSlotCount - 1)];
+        if (positionDiff(atomicLoad(&slot.sequence), pos + 1) != 0) {
+            break;
+        }
+        if (slot.binary) {
+            int defsLen = writeTraceDefinitions(queue, slot, defs);
+            if (batch.length > 0 &&
+                    (!batch.binary ||
+                     batch.length + defsLen + slot.length > kTraceBatchSize)) {
+                flushTraceBatch(queue, batch);
+                defsLen = writeTraceDefinitions(queue, slot, defs);
+            }
+            if (defsLen > 0) {
+                appendToTraceBatch(queue, batch, defs, defsLen, true);
+                markTraceDefinitionsSent(queue, slot);
+            }
+        }
+        appendToTraceBatch(queue, batch, slot.message, slot.length,
+                           slot.binary);
+        InterlockedExchange(&slot.sequence, pos + kTraceSlotCount);
+        InterlockedExchange(&queue.dequeuePos, pos + 1);
+    }
+    flushTraceBatch(queue, batch);
+    const LONG dropped = InterlockedExchange(&queue.dropped, 0);
+    if (dropped > 0) {
+        char note[64];
+        const int len = winpty_snprintf(note, "[%d trace messages dropped]",
+                                        static_cast<int>(dropped));
+        sendToDebugServer(queue, note, len);
+    }
+    InterlockedExchange(&queue.consuming, 0);
+}
+
+// Returns true if the queue's consumer is a thread that has exited, e.g.
+// because ExitProcess ended it in the middle of a drain.  The queue can't be
+// drained again.
+static bool traceConsumerGone(TraceQueue &queue)
+{
+    const DWORD threadId = static_cast<DWORD>(atomicLoad(&queue.consuming));
+    if (threadId == 0 || threadId == GetCurrentThreadId()) {
+        return false;
+    }
+    HANDLE thread = OpenThread(SYNCHRONIZE, FALSE, threadId);
+    if (thread == NULL) {
+        return true;
+    }
+    const bool exited = WaitForSingleObject(thread, 0) == WAIT_OBJECT_0;
+    CloseHandle(thread);
+    return exited;
+}
+
+// The flusher holds a reference to the DLL it runs in (winpty.dll), so that
+// a FreeLibrary call can't unmap its code while it runs.  It drops the
+// reference as it exits.
+static DWORD WINAPI traceFlusherThread(void *param)
+{
+    TraceQueue &queue = *static_cast<TraceQueue*>(param);
+    while (true) {
+        drainTraceQueue(queue);
+        if (atomicLoad(&queue.stopping)) {
+            break;
+        }
+        InterlockedExchange(&queue.flusherIdle, 1);
+        if (!traceQueueEmpty(queue)) {
+            InterlockedExchange(&queue.flusherIdle, 0);
+            continue;
+        }
+        WaitForSingleObject(queue.wakeEvent, INFINITE);
+    }
+    if (queue.flusherModule != NULL) {
+        FreeLibraryAndExitThread(queue.flusherModule, 0);
+    }
+    return 0;
+}
+
+// Stops and joins the flusher thread at exit, then sends whatever it left
+// behind.  In a DLL, this runs at DLL_PROCESS_DETACH, under the loader lock
+// and after ExitProcess has ended the thread, so the wait is bounded rather
+// than trusting the thread to finish.  Later messages are sent inline.
+static void stopTraceFlusher()
+{
+    TraceQueue *queue = g_traceQueue;
+    if (queue == NULL || queue->flusherThread == NULL) {
+        return;
+    }
+    InterlockedExchange(&queue->stopping, 1);
+    SetEvent(queue->wakeEvent);
+    WaitForSingleObject(queue->flusherThread, 1000);
+    CloseHandle(queue->flusherThread);
+    queue->flusherThread = NULL;
+    InterlockedExchange(&queue->noFlusher, 1);
+    flushTrace();
+}
+
+static TraceQueue *getTraceQueue()
+{
+    TraceQueue *queue = g_traceQueue;
+    if (queue != NULL) {
+        return queue;
+    }
+    TraceQueue *newQueue = new TraceQueue;
+    for (int i = 0; i < kTraceSlotCount; ++i) {
+        newQueue->slots[i].sequence = i;
+    }
+    newQueue->enqueuePos = 0;
+    newQueue->dequeuePos = 0;
+    newQueue->dropped = 0;
+    newQueue->consuming = 0;
+    newQueue->flusherIdle = 0;
+    newQueue->noFlusher = 0;
+    newQueue->stopping = 0;
+    newQueue->wakeEvent = CreateEventW(NULL, FALSE, FALSE, NULL);
+    newQueue->flusherThread = NULL;
+    newQueue->flusherModule = NULL;
+    newQueue->serverPipe = INVALID_HANDLE_VALUE;
+    std::fill(std::begin(newQueue->formats), std::end(newQueue->formats),
+              nullptr);
+    std::fill(std::begin(newQueue->formatSent),
+              std::end(newQueue->formatSent), false);
+    newQueue->processSent = false;
+    LARGE_INTEGER qpc;
+    QueryPerformanceFrequency(&qpc);
+    newQueue->qpcFrequency = qpc.QuadPart;
+    QueryPerformanceCounter(&qpc);
+    newQueue->qpcStart = qpc.QuadPart;
+    newQueue->unixMsStart = unixTimeMillis();
+    void *oldValue = InterlockedCompareExchangePointer(
+        reinterpret_cast<void *volatile*>(&g_traceQueue), newQueue, NULL);
+    if (oldValue != NULL) {
+        CloseHandle(newQueue->wakeEvent);
+        delete newQueue;
+        return static_cast<TraceQueue*>(oldValue);
+    }
+    HMODULE module = NULL;
+    if (GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS,
+                reinterpret_cast<LPCWSTR>(traceFlusherThread), &module) &&
+            module == GetModuleHandleW(NULL)) {
+        FreeLibrary(module);
+        module = NULL;
+    }
+    newQueue->flusherModule = module;
+    if (newQueue->wakeEvent != NULL) {
+        newQueue->flusherThread =
+            CreateThread(NULL, 0, traceFlusherThread, newQueue, 0, NULL);
+    }
+    if (newQueue->flusherThread != NULL) {
+        atexit(stopTraceFlusher);
+    } else {
+        if (module != NULL) {
+            FreeLibrary(module);
+            newQueue->flusherModule = NULL;
+        }
+        InterlockedExchange(&newQueue->noFlusher, 1);
+    }
+    return newQueue;
+}
+
+// Wait (briefly) for the queued trace messages to reach the debug server,
+// e.g. before the process aborts.  Give up at once if the consumer died
+// holding the queue.
+void flushTrace()
+{
+    TraceQueue *queue = g_traceQueue;
+    if (queue == NULL) {
+        return;
+    }
+    PreserveLastError preserve;
+    for (int i = 0; i < 1000 && !traceQueueEmpty(*queue); ++i) {
+        if (traceConsumerGone(*queue)) {
+            return;
+        }
+        drainTraceQueue(*queue);
+        if (!traceQueueEmpty(*queue)) {
+            Sleep(1);
+        }
+    }
+}
+
+// The bytes allocated for the trace queue, which exists once anything has
+// been traced.
+size_t traceMemoryUsage()
+{
+    return g_traceQueue != NULL ? sizeof(TraceQueue) : 0;
+}
+
+// Returns the binary trace format ID for the format string, or -1 if the
+// table is full.
+static int traceFormatId(TraceQueue &queue, const char *format)
+{
+    const uint32_t hash = static_cast<uint32_t>(
+        reinterpret_cast<uintptr_t>(format) >> 2) * 2654435761u;
+    int index = static_cast<int>(hash >> 22) & (kTraceFormatCount - 1);
+    for (int i = 0; i < kTraceFormatCount; ++i) {
+        void *const current = queue.formats[index];
+        if (current == format) {
+            return index;
+        }
+        if (current == NULL) {
+            void *const oldValue = InterlockedCompareExchangePointer(
+                &queue.formats[index], const_cast<char*>(format), NULL);
+            if (oldValue == NULL || oldValue == format) {
+                return index;
+            }
+        }
+        index = (index + 1) & (kTraceFormatCount - 1);
+    }
+    return -1;
+}
+
+static bool configHasFlag(const char *config, const char *flag)
+{
+    if (config[0] == '\0') {
+        return false;
+    }
+    std::string configStr(config);
+    std::string flagStr(flag);
+    configStr = "," + configStr + ",";
+    flagStr = "," + flagStr + ",";
+    return configStr.find(flagStr) != std::string::npos;
+}
+
+static unsigned int parseTraceCategories(const char *config)
+{
+    // Recognize WINPTY_DEBUG=1 for backwards compatibility.
+    if (!configHasFlag(config, "trace") && !configHasFlag(config, "1") &&
+            !configHasFlag(config, "trace_binary")) {
+        return 0;
+    }
+    static const struct {
+        const char *name;
+        unsigned int category;
+    } kCategories[] = {
+        { "scrape",     kTraceScrape },
+        { "terminal",   kTraceTerminal },
+        { "input",      kTraceInput },
+        { "pipe",       kTracePipe },
+        { "resize",     kTraceResize },
+        { "freeze",     kTraceFreeze },
+    };
+    unsigned int ret = 0;
+    for (const auto &entry : kCategories) {
+        if (configHasFlag(config, entry.name)) {
+            ret |= entry.category;
+        }
+    }
+    return ret;
 }
 
 static const char *getDebugConfig()
@@ -106,6 +595,10 @@ static const char *getDebugConfig()
         if (actualSize == 0 || actualSize >= static_cast<DWORD>(bufSize)) {
             buf[0] = '\0';
         }
+        // Store the category mask before publishing the config string, so
+        // that a thread that sees the config also sees the mask.  Racing
+        // threads compute the same mask.
+        g_traceCategories = parseTraceCategories(buf);
         const size_t len = strlen(buf) + 1;
         char *newConfig = new char[len];
         std::copy(buf, buf + len, newConfig);
@@ -128,7 +621,8 @@ bool isTracingEnabled()
     } else {
         // Recognize WINPTY_DEBUG=1 for backwards compatibility.
         PreserveLastError preserve;
-        bool value = hasDebugFlag("trace") || hasDebugFlag("1");
+        bool value = hasDebugFlag("trace") || hasDebugFlag("1") ||
+            hasDebugFlag("trace_binary");
         disabled = !value;
         enabled = value;
         return value;
@@ -146,11 +640,72 @@ bool hasDebugFlag(const char *flag)
         return false;
     }
     PreserveLastError preserve;
-    std::string config(configCStr);
-    std::string flagStr(flag);
-    config = "," + config + ",";
-    flagStr = "," + flagStr + ",";
-    return config.find(flagStr) != std::string::npos;
+    return configHasFlag(configCStr, flag);
+}
+
+bool isTraceCategoryEnabledSlow(unsigned int category)
+{
+    getDebugConfig();
+    return (g_traceCategories & category) != 0;
+}
+
+static bool isBinaryTracingEnabled()
+{
+    static int enabled = -1;
+    if (enabled < 0) {
+        enabled = hasDebugFlag("trace_binary") ? 1 : 0;
+    }
+    return enabled != 0;
+}
+
+static void enqueueTraceMessage(TraceQueue &queue, const char *message,
+                                int length, bool binary)
+{
+    if (!enqueueTrace(queue, message, length, binary)) {
+        InterlockedIncrement(&queue.dropped);
+        return;
+    }
+    if (queue.noFlusher) {
+        drainTraceQueue(queue);
+    } else if (InterlockedCompareExchange(&queue.flusherIdle, 0, 1) == 1) {
+        SetEvent(queue.wakeEvent);
+    }
+}
+
+// Queue an event record with the format string's ID and raw arguments, or a
+// text record if the arguments can't be encoded.
+static void traceBinary(const char *format, va_list ap)
+{
+    TraceQueue &queue = *getTraceQueue();
+    LARGE_INTEGER qpc;
+    QueryPerformanceCounter(&qpc);
+    char record[kTraceMessageSize];
+    const int formatId = traceFormatId(queue, format);
+    va_list apCopy;
+    va_copy(apCopy, ap);
+    const int argsLen = formatId < 0 ? -1 :
+        encodeTraceArgs(record + kTraceEventHeaderSize,
+                        sizeof(record) - kTraceEventHeaderSize,
+                        format, apCopy);
+    va_end(apCopy);
+    int size = 0;
+    char *out = record;
+    if (argsLen >= 0) {
+        size = kTraceEventHeaderSize + argsLen;
+        out = putTraceRecordHeader(out, size, kTraceRecordEvent);
+        putTraceInt(out, GetCurrentThreadId(), 4);
+        putTraceInt(out, qpc.QuadPart, 8);
+        putTraceInt(out, formatId, 2);
+    } else {
+        const int textOffset = kTraceRecordHeaderSize + 12;
+        char *const text = record + textOffset;
+        winpty_vsnprintf(text, sizeof(record) - textOffset, format, ap);
+        size = textOffset + static_cast<int>(strlen(text));
+        out = putTraceRecordHeader(out, size, kTraceRecordText);
+        putTraceInt(out, GetCurrentThreadId(), 4);
+        putTraceInt(out, qpc.QuadPart, 8);
+    }
+    enqueueTraceMessage(queue, record, size, true);
 }
 
 void trace(const char *format, ...)
@@ -159,6 +714,15 @@ void trace(const char *format, ...)
         return;
 
     PreserveLastError preserve;
+
+    if (isBinaryTracingEnabled()) {
+        va_list ap;
+        va_start(ap, format);
+        traceBinary(format, ap);
+        va_end(ap);
+        return;
+    }
+
     char message[1024];
 
     va_list ap;
@@ -169,19 +733,15 @@ void trace(const char *format, ...)
 
     const int currentTime = (int)(unixTimeMillis() % (100000 * 1000));
 
-    char moduleName[1024];
-    moduleName[0] = '\0';
-    GetModuleFileNameA(NULL, moduleName, sizeof(moduleName));
-    const char *baseName = strrchr(moduleName, '\\');
-    baseName = (baseName != NULL) ? baseName + 1 : moduleName;
-
     char fullMessage[1024];
     winpty_snprintf(fullMessage,
              "[%05d.%03d %s,p%04d,t%04d]: %s",
              currentTime / 1000, currentTime % 1000,
-             baseName, (int)GetCurrentProcessId(), (int)GetCurrentThreadId(),
+             traceModuleBaseName(),
+             (int)GetCurrentProcessId(), (int)GetCurrentThreadId(),
              message);
     fullMessage[sizeof(fullMessage) - 1] = '\0';
 
-    sendToDebugServer(fullMessage);
+    enqueueTraceMessage(*getTraceQueue(), fullMessage,
+                        static_cast<int>(strlen(fullMessage)), false);
 }
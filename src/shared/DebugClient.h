@@ -21,11 +21,39 @@
 #ifndef DEBUGCLIENT_H
 #define DEBUGCLIENT_H
 
+#include <stddef.h>
+
 #include "winpty_snprintf.h"
 
+// Trace categories.  Each is enabled by the WINPTY_DEBUG flag of the same
+// name (e.g. WINPTY_DEBUG=trace,input,pipe), and only while tracing is
+// enabled.
+enum TraceCategory {
+    kTraceScrape    = 0x01,     // scrape
+    kTraceTerminal  = 0x02,     // terminal
+    kTraceInput     = 0x04,     // input
+    kTracePipe      = 0x08,     // pipe
+    kTraceResize    = 0x10,     // resize
+    kTraceFreeze    = 0x20,     // freeze
+};
+
+// The enabled TraceCategory bits.  getDebugConfig sets the real mask when it
+// first reads WINPTY_DEBUG; until then, every bit is set so that the first
+// test of each category reaches isTraceCategoryEnabledSlow.
+extern volatile unsigned int g_traceCategories;
+
 bool isTracingEnabled();
 bool hasDebugFlag(const char *flag);
+bool isTraceCategoryEnabledSlow(unsigned int category);
 void trace(const char *format, ...) WINPTY_SNPRINTF_FORMAT(1, 2);
+void flushTrace();
+size_t traceMemoryUsage();
+
+// A disabled category costs a single load-and-test.
+inline bool isTraceCategoryEnabled(unsigned int category) {
+    return (g_traceCategories & category) != 0 &&
+        isTraceCategoryEnabledSlow(category);
+}
 
 // This macro calls trace without evaluating the arguments.
 #define TRACE(format, ...)                          \
@@ -35,4 +63,12 @@ void trace(const char *format, ...) WINPTY_SNPRINTF_FORMAT(1, 2);
         }                                           \
     } while (false)
 
+// Like TRACE, but only when the given TraceCategory is enabled.
+#define TRACE_CAT(category, format, ...)                \
+    do {                                                \
+        if (isTraceCategoryEnabled(category)) {         \
+            trace((format), ## __VA_ARGS__);            \
+        }                                               \
+    } while (false)
+
 #endif // DEBUGCLIENT_H
@@ -24,37 +24,69 @@
 #include <string.h>
 
 #include "DebugClient.h"
+#include "Mutex.h"
+#include "OsModule.h"
 #include "StringBuilder.h"
+#include "WinptyAssert.h"
 
 static volatile LONG g_pipeCounter;
 
-GenRandom::GenRandom() : m_advapi32(L"advapi32.dll") {
-    // First try to use the pseudo-documented RtlGenRandom function from
-    // advapi32.dll.  Creating a CryptoAPI context is slow, and RtlGenRandom
-    // avoids the overhead.  It's documented in this blog post[1] and on
-    // MSDN[2] with a disclaimer about future breakage.  This technique is
-    // apparently built-in into the MSVC CRT, though, for the rand_s function,
-    // so perhaps it is stable enough.
-    //
-    // [1] http://blogs.msdn.com/b/michael_howard/archive/2005/01/14/353379.aspx
-    // [2] https://msdn.microsoft.com/en-us/library/windows/desktop/aa387694(v=vs.85).aspx
-    //
-    // Both RtlGenRandom and the Crypto API functions exist in XP and up.
-    m_rtlGenRandom = reinterpret_cast<RtlGenRandom_t*>(
-        m_advapi32.proc("SystemFunction036"));
-    // The OsModule class logs an error message if the proc is nullptr.
-    if (m_rtlGenRandom != nullptr) {
-        return;
+namespace {
+
+// uniqueName draws its random bytes from this process-wide pool.  The pool is
+// refilled from the generator once it's used up, so most names need no
+// generator call.  Each byte is handed out once, and then cleared.
+struct NameBytePool {
+    Mutex mutex;
+    uint8_t bytes[512];
+    size_t used = sizeof(bytes);
+};
+
+NameBytePool g_namePool;
+
+} // anonymous namespace
+
+// Returns the pseudo-documented RtlGenRandom function from advapi32.dll, or
+// NULL if it's missing.  Creating a CryptoAPI context is slow, and
+// RtlGenRandom avoids the overhead.  It's documented in this blog post[1] and
+// on MSDN[2] with a disclaimer about future breakage.  This technique is
+// apparently built-in into the MSVC CRT, though, for the rand_s function, so
+// perhaps it is stable enough.
+//
+// [1] http://blogs.msdn.com/b/michael_howard/archive/2005/01/14/353379.aspx
+// [2] https://msdn.microsoft.com/en-us/library/windows/desktop/aa387694(v=vs.85).aspx
+//
+// Both RtlGenRandom and the Crypto API functions exist in XP and up.  The
+// lookup is done once per process.  Racing threads store the same pointer.
+GenRandom::RtlGenRandom_t *GenRandom::rtlGenRandom() {
+    static RtlGenRandom_t *volatile s_func = nullptr;
+    static volatile LONG s_resolved = 0;
+    if (!s_resolved) {
+        // loadedModuleProc logs an error message if the proc is nullptr.
+        s_func = reinterpret_cast<RtlGenRandom_t*>(
+            loadedModuleProc(L"advapi32.dll", "SystemFunction036"));
+        InterlockedExchange(&s_resolved, 1);
     }
+    return s_func;
+}
 
-    // Fall back to the crypto API.
-    m_cryptProvIsValid =
-        CryptAcquireContext(&m_cryptProv, nullptr, nullptr,
-                            PROV_RSA_FULL, CRYPT_VERIFYCONTEXT) != 0;
-    if (!m_cryptProvIsValid) {
-        trace("GenRandom: CryptAcquireContext failed: %u",
-            static_cast<unsigned>(GetLastError()));
+GenRandom::GenRandom() : m_rtlGenRandom(rtlGenRandom()) {
+}
+
+// Fall back to the crypto API.  The context is only acquired if RtlGenRandom
+// is missing and random bytes are actually needed.
+bool GenRandom::acquireCryptProv() {
+    if (!m_cryptProvAcquired) {
+        m_cryptProvAcquired = true;
+        m_cryptProvIsValid =
+            CryptAcquireContext(&m_cryptProv, nullptr, nullptr,
+                                PROV_RSA_FULL, CRYPT_VERIFYCONTEXT) != 0;
+        if (!m_cryptProvIsValid) {
+            trace("GenRandom: CryptAcquireContext failed: %u",
+                static_cast<unsigned>(GetLastError()));
+        }
     }
+    return m_cryptProvIsValid;
 }
 
 GenRandom::~GenRandom() {
@@ -73,7 +105,7 @@ bool GenRandom::fillBuffer(void *buffer, size_t size) {
             trace("GenRandom: RtlGenRandom/SystemFunction036 failed: %u",
                 static_cast<unsigned>(GetLastError()));
         }
-    } else if (m_cryptProvIsValid) {
+    } else if (acquireCryptProv()) {
         success =
             CryptGenRandom(m_cryptProv, size,
                            reinterpret_cast<BYTE*>(buffer)) != 0;
@@ -96,14 +128,38 @@ std::string GenRandom::randomBytes(size_t numBytes) {
     return ret;
 }
 
+static std::wstring hexString(const uint8_t *bytes, size_t numBytes) {
+    std::wstring ret(numBytes * 2, L'\0');
+    for (size_t i = 0; i < numBytes; ++i) {
+        static const wchar_t hex[] = L"0123456789abcdef";
+        ret[i * 2]     = hex[bytes[i] >> 4];
+        ret[i * 2 + 1] = hex[bytes[i] & 0xF];
+    }
+    return ret;
+}
+
 std::wstring GenRandom::randomHexString(size_t numBytes) {
     const std::string bytes = randomBytes(numBytes);
-    std::wstring ret(bytes.size() * 2, L'\0');
-    for (size_t i = 0; i < bytes.size(); ++i) {
-        static const wchar_t hex[] = L"0123456789abcdef";
-        ret[i * 2]     = hex[static_cast<uint8_t>(bytes[i]) >> 4];
-        ret[i * 2 + 1] = hex[static_cast<uint8_t>(bytes[i]) & 0xF];
+    return hexString(reinterpret_cast<const uint8_t*>(bytes.data()),
+                     bytes.size());
+}
+
+// Like randomHexString, but takes the bytes from the process-wide pool.
+static std::wstring pooledRandomHexString(size_t numBytes) {
+    NameBytePool &pool = g_namePool;
+    LockGuard<Mutex> lock(pool.mutex);
+    ASSERT(numBytes <= sizeof(pool.bytes));
+    if (sizeof(pool.bytes) - pool.used < numBytes) {
+        if (!GenRandom().fillBuffer(pool.bytes, sizeof(pool.bytes))) {
+            pool.used = sizeof(pool.bytes);
+            return std::wstring();
+        }
+        pool.used = 0;
     }
+    uint8_t *const bytes = &pool.bytes[pool.used];
+    pool.used += numBytes;
+    const std::wstring ret = hexString(bytes, numBytes);
+    SecureZeroMemory(bytes, numBytes);
     return ret;
 }
 
@@ -130,7 +186,7 @@ std::wstring GenRandom::uniqueName() {
     // It isn't clear to me how the crypto APIs would fail.  It *probably*
     // doesn't matter that much anyway?  In principle, a predictable pipe name
     // is subject to a local denial-of-service attack.
-    auto random = randomHexString(16);
+    auto random = pooledRandomHexString(16);
     if (!random.empty()) {
         sb << L'-' << random;
     }
@@ -28,13 +28,14 @@
 
 #include <string>
 
-#include "OsModule.h"
-
 class GenRandom {
     typedef BOOLEAN WINAPI RtlGenRandom_t(PVOID, ULONG);
 
-    OsModule m_advapi32;
+    static RtlGenRandom_t *rtlGenRandom();
+    bool acquireCryptProv();
+
     RtlGenRandom_t *m_rtlGenRandom = nullptr;
+    bool m_cryptProvAcquired = false;
     bool m_cryptProvIsValid = false;
     HCRYPTPROV m_cryptProv = 0;
 
@@ -44,11 +45,11 @@ public:
     bool fillBuffer(void *buffer, size_t size);
     std::string randomBytes(size_t numBytes);
     std::wstring randomHexString(size_t numBytes);
-    std::wstring uniqueName();
+    static std::wstring uniqueName();
 
     // Return true if the crypto context was successfully initialized.
-    bool valid() const {
-        return m_rtlGenRandom != nullptr || m_cryptProvIsValid;
+    bool valid() {
+        return m_rtlGenRandom != nullptr || acquireCryptProv();
     }
 };
 
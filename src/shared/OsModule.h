@@ -60,4 +60,19 @@ public:
     }
 };
 
+// Looks up a function in a DLL that stays loaded for the life of the process
+// (ntdll, or a DLL that winpty links against, like kernel32 or advapi32).
+// Unlike an OsModule, this doesn't take the loader lock twice to adjust the
+// DLL's reference count.  Returns NULL if the function is missing.
+inline FARPROC loadedModuleProc(const wchar_t *moduleName,
+                                const char *funcName) {
+    const HMODULE module = GetModuleHandleW(moduleName);
+    ASSERT(module != NULL);
+    FARPROC ret = GetProcAddress(module, funcName);
+    if (ret == NULL) {
+        trace("GetProcAddress: %s is missing", funcName);
+    }
+    return ret;
+}
+
 #endif // WINPTY_SHARED_OS_MODULE_H
@@ -0,0 +1,268 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "OutputCompression.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace OutputCompression {
+
+namespace {
+
+// LZ4 block format constants.  A match is at least kMinMatch bytes, the
+// last kLastLiterals bytes of a block are always literals, and no match
+// starts within kMatchSafeDistance bytes of the end.
+const size_t kMinMatch = 4;
+const size_t kLastLiterals = 5;
+const size_t kMatchSafeDistance = 12;
+const size_t kMaxOffset = 65535;
+const int kHashBits = 12;
+const uint32_t kNoPosition = 0xFFFFFFFFu;
+
+static uint32_t read32(const char *p) {
+    uint32_t ret;
+    memcpy(&ret, p, sizeof(ret));
+    return ret;
+}
+
+static uint32_t hashSequence(uint32_t value) {
+    return (value * 2654435761u) >> (32 - kHashBits);
+}
+
+static void putUInt32(std::string &out, uint32_t value) {
+    char bytes[4] = {
+        static_cast<char>(value),
+        static_cast<char>(value >> 8),
+        static_cast<char>(value >> 16),
+        static_cast<char>(value >> 24),
+    };
+    out.append(bytes, sizeof(bytes));
+}
+
+static uint32_t getUInt32(const char *p) {
+    const unsigned char *u = reinterpret_cast<const unsigned char*>(p);
+    return u[0] | (u[1] << 8) | (u[2] << 16) |
+        (static_cast<uint32_t>(u[3]) << 24);
+}
+
+static void putLength(std::string &out, size_t length) {
+    while (length >= 255) {
+        out.push_back(static_cast<char>(255));
+        length -= 255;
+    }
+    out.push_back(static_cast<char>(length));
+}
+
+// Appends a sequence of literals followed by a match.  A matchLength of 0
+// marks the block's final, literal-only sequence.
+static void putSequence(std::string &out, const char *literals,
+                        size_t literalLength, size_t matchLength,
+                        size_t offset) {
+    const size_t matchCode = matchLength == 0 ? 0 : matchLength - kMinMatch;
+    out.push_back(static_cast<char>(
+        (std::min<size_t>(literalLength, 15) << 4) |
+        std::min<size_t>(matchCode, 15)));
+    if (literalLength >= 15) {
+        putLength(out, literalLength - 15);
+    }
+    out.append(literals, literalLength);
+    if (matchLength == 0) {
+        return;
+    }
+    out.push_back(static_cast<char>(offset));
+    out.push_back(static_cast<char>(offset >> 8));
+    if (matchCode >= 15) {
+        putLength(out, matchCode - 15);
+    }
+}
+
+// A greedy, single-probe LZ4 compressor.  VT output repeats the same escape
+// sequences and runs of spaces, so this finds most of what a slower search
+// would.
+static void compressBlock(const char *src, size_t size, std::string &out) {
+    size_t anchor = 0;
+    if (size > kMatchSafeDistance) {
+        uint32_t table[1 << kHashBits];
+        std::fill(std::begin(table), std::end(table), kNoPosition);
+        const size_t limit = size - kMatchSafeDistance;
+        size_t pos = 0;
+        while (pos < limit) {
+            const uint32_t sequence = read32(src + pos);
+            uint32_t &slot = table[hashSequence(sequence)];
+            const uint32_t candidate = slot;
+            slot = static_cast<uint32_t>(pos);
+            if (candidate == kNoPosition || pos - candidate > kMaxOffset ||
+                    read32(src + candidate) != sequence) {
+                ++pos;
+                continue;
+            }
+            const size_t maxLength = size - kLastLiterals - pos;
+            size_t length = kMinMatch;
+            while (length < maxLength &&
+                    src[candidate + length] == src[pos + length]) {
+                ++length;
+            }
+            putSequence(out, src + anchor, pos - anchor, length,
+                        pos - candidate);
+            pos += length;
+            anchor = pos;
+        }
+    }
+    putSequence(out, src + anchor, size - anchor, 0, 0);
+}
+
+static bool getLength(const char *&src, const char *end, size_t &length) {
+    unsigned char byte;
+    do {
+        if (src == end) {
+            return false;
+        }
+        byte = static_cast<unsigned char>(*src++);
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+// Decodes an LZ4 block that must expand to exactly dstSize bytes.
+static bool decompressBlock(const char *src, size_t srcSize,
+                            char *dst, size_t dstSize) {
+    const char *const srcEnd = src + srcSize;
+    size_t outPos = 0;
+    while (src < srcEnd) {
+        const unsigned char token = static_cast<unsigned char>(*src++);
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !getLength(src, srcEnd, literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(srcEnd - src) ||
+                literalLength > dstSize - outPos) {
+            return false;
+        }
+        memcpy(dst + outPos, src, literalLength);
+        src += literalLength;
+        outPos += literalLength;
+        if (src == srcEnd) {
+            break;
+        }
+        if (srcEnd - src < 2) {
+            return false;
+        }
+        const size_t offset = static_cast<unsigned char>(src[0]) |
+            (static_cast<unsigned char>(src[1]) << 8);
+        src += 2;
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !getLength(src, srcEnd, matchLength)) {
+            return false;
+        }
+        matchLength += kMinMatch;
+        if (offset == 0 || offset > outPos ||
+                matchLength > dstSize - outPos) {
+            return false;
+        }
+        // The match may overlap the bytes it produces, so copy forward.
+        const char *match = dst + outPos - offset;
+        for (size_t i = 0; i < matchLength; ++i) {
+            dst[outPos + i] = match[i];
+        }
+        outPos += matchLength;
+    }
+    return outPos == dstSize;
+}
+
+} // anonymous namespace
+
+void appendFrames(const char *data, size_t size, std::string &out) {
+    while (size > 0) {
+        const size_t frameSize = std::min(size, kMaxFrameSize);
+        const size_t headerPos = out.size();
+        putUInt32(out, 0);
+        putUInt32(out, static_cast<uint32_t>(frameSize));
+        compressBlock(data, frameSize, out);
+        size_t payloadSize = out.size() - headerPos - kFrameHeaderSize;
+        uint32_t header = 0;
+        if (payloadSize >= frameSize) {
+            // Incompressible data is stored as-is.
+            out.resize(headerPos + kFrameHeaderSize);
+            out.append(data, frameSize);
+            payloadSize = frameSize;
+            header = kStoredFlag;
+        }
+        header |= static_cast<uint32_t>(payloadSize);
+        std::string headerBytes;
+        putUInt32(headerBytes, header);
+        out.replace(headerPos, headerBytes.size(), headerBytes);
+        data += frameSize;
+        size -= frameSize;
+    }
+}
+
+bool Decoder::write(const char *data, size_t size) {
+    if (m_failed) {
+        return false;
+    }
+    m_input.append(data, size);
+    size_t pos = 0;
+    while (m_input.size() - pos >= kFrameHeaderSize) {
+        const uint32_t header = getUInt32(&m_input[pos]);
+        const size_t payloadSize = header & ~kStoredFlag;
+        const size_t frameSize = getUInt32(&m_input[pos + 4]);
+        if (frameSize > kMaxFrameSize ||
+                ((header & kStoredFlag) && payloadSize != frameSize)) {
+            m_failed = true;
+            return false;
+        }
+        if (m_input.size() - pos - kFrameHeaderSize < payloadSize) {
+            break;
+        }
+        const char *payload = &m_input[pos + kFrameHeaderSize];
+        if (m_outputOffset == m_output.size()) {
+            m_output.clear();
+            m_outputOffset = 0;
+        }
+        const size_t outPos = m_output.size();
+        m_output.resize(outPos + frameSize);
+        if (header & kStoredFlag) {
+            memcpy(&m_output[outPos], payload, frameSize);
+        } else if (!decompressBlock(payload, payloadSize,
+                                    &m_output[outPos], frameSize)) {
+            m_failed = true;
+            return false;
+        }
+        pos += kFrameHeaderSize + payloadSize;
+    }
+    m_input.erase(0, pos);
+    return true;
+}
+
+size_t Decoder::read(char *data, size_t size) {
+    const size_t n = std::min(size, available());
+    memcpy(data, m_output.data() + m_outputOffset, n);
+    m_outputOffset += n;
+    if (m_outputOffset == m_output.size()) {
+        m_output.clear();
+        m_outputOffset = 0;
+    }
+    return n;
+}
+
+} // namespace OutputCompression
@@ -0,0 +1,63 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef WINPTY_SHARED_OUTPUT_COMPRESSION_H
+#define WINPTY_SHARED_OUTPUT_COMPRESSION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+// The WINPTY_FLAG_COMPRESSED_OUTPUT framing.  Each frame is a UINT32 header,
+// a UINT32 uncompressed size, and a payload.  The header's low 31 bits are
+// the payload size.  If its high bit is set, the payload is the data itself;
+// otherwise, it's an LZ4 block.  Frames are compressed independently, so
+// decoding can start at any frame boundary.
+namespace OutputCompression {
+
+const uint32_t kStoredFlag = 0x80000000u;
+const size_t kFrameHeaderSize = 8;
+// The largest input a frame holds.  Decoders reject larger sizes rather than
+// allocate for them.
+const size_t kMaxFrameSize = 16 * 1024 * 1024;
+
+// Appends frames holding the given data to `out`.
+void appendFrames(const char *data, size_t size, std::string &out);
+
+// Decodes a byte stream of frames, which may arrive in arbitrary pieces.
+class Decoder {
+public:
+    // Decodes the complete frames buffered so far.  Returns false if the
+    // stream is malformed, after which the decoder is unusable.
+    bool write(const char *data, size_t size);
+    size_t available() const { return m_output.size() - m_outputOffset; }
+    size_t read(char *data, size_t size);
+
+private:
+    std::string m_input;
+    std::string m_output;
+    size_t m_outputOffset = 0;
+    bool m_failed = false;
+};
+
+} // namespace OutputCompression
+
+#endif // WINPTY_SHARED_OUTPUT_COMPRESSION_H
@@ -0,0 +1,248 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef WINPTY_SHARED_SHARED_RING_H
+#define WINPTY_SHARED_SHARED_RING_H
+
+#include <windows.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "OwnedHandle.h"
+
+// A single-producer, single-consumer byte ring in a shared memory section,
+// used to hand CONOUT output from the agent to libwinpty without a pipe (see
+// WINPTY_FLAG_SHARED_MEMORY_OUTPUT).  The agent writes and libwinpty reads.
+//
+// Each side publishes its position with an interlocked store after copying
+// the data, and reads the other side's position with an interlocked load.
+// A side that finds the ring empty (or full) sets its waiting flag, checks
+// again, and then waits on its event.  The other side signals the event
+// only when it clears a set flag, so the steady state makes no syscalls.
+class SharedRing {
+public:
+    struct Header {
+        uint32_t capacity;          // A power of two.
+        volatile LONG closed;       // Set by the writer once it's done.
+        volatile LONG readerWaiting;
+        volatile LONG writerWaiting;
+        char pad1[48];
+        volatile LONG writePos;     // Modified only by the writer.
+        char pad2[60];
+        volatile LONG readPos;      // Modified only by the reader.
+        char pad3[60];
+    };
+
+    // Creates a new ring and its section and events.  Returns NULL on
+    // failure, with the Windows error in GetLastError().
+    static std::unique_ptr<SharedRing> create(uint32_t capacity) {
+        if (capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+                capacity > 0x40000000u) {
+            SetLastError(ERROR_INVALID_PARAMETER);
+            return std::unique_ptr<SharedRing>();
+        }
+        const DWORD sectionSize = sizeof(Header) + capacity;
+        OwnedHandle section(CreateFileMappingW(
+            INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sectionSize,
+            nullptr));
+        OwnedHandle dataEvent(CreateEventW(nullptr, FALSE, FALSE, nullptr));
+        OwnedHandle spaceEvent(CreateEventW(nullptr, FALSE, FALSE, nullptr));
+        if (section.get() == nullptr || dataEvent.get() == nullptr ||
+                spaceEvent.get() == nullptr) {
+            return std::unique_ptr<SharedRing>();
+        }
+        std::unique_ptr<SharedRing> ret(new SharedRing(
+            std::move(section), std::move(dataEvent), std::move(spaceEvent)));
+        if (!ret->map()) {
+            return std::unique_ptr<SharedRing>();
+        }
+        // The section is zero-filled, so only the capacity needs setting.
+        ret->m_header->capacity = capacity;
+        ret->m_mask = capacity - 1;
+        return ret;
+    }
+
+    // Opens a ring created by the other process, taking ownership of the
+    // (already duplicated) handles.  Returns NULL if the section can't be
+    // mapped or doesn't hold a ring of the expected capacity.
+    static std::unique_ptr<SharedRing> attach(
+            OwnedHandle section, OwnedHandle dataEvent,
+            OwnedHandle spaceEvent, uint32_t capacity) {
+        std::unique_ptr<SharedRing> ret(new SharedRing(
+            std::move(section), std::move(dataEvent), std::move(spaceEvent)));
+        if (!ret->map()) {
+            return std::unique_ptr<SharedRing>();
+        }
+        MEMORY_BASIC_INFORMATION info = {};
+        if (ret->m_header->capacity != capacity ||
+                VirtualQuery(ret->m_header, &info, sizeof(info)) == 0 ||
+                info.RegionSize < sizeof(Header) + capacity) {
+            SetLastError(ERROR_INVALID_DATA);
+            return std::unique_ptr<SharedRing>();
+        }
+        ret->m_mask = capacity - 1;
+        return ret;
+    }
+
+    ~SharedRing() {
+        if (m_header != nullptr) {
+            UnmapViewOfFile(m_header);
+        }
+    }
+
+    HANDLE section() const { return m_section.get(); }
+    HANDLE dataEvent() const { return m_dataEvent.get(); }
+    HANDLE spaceEvent() const { return m_spaceEvent.get(); }
+    uint32_t capacity() const { return m_header->capacity; }
+
+    // Writer: copies as much of the data as fits and returns the amount.
+    size_t write(const char *data, size_t size) {
+        const uint32_t w = static_cast<uint32_t>(m_header->writePos);
+        const uint32_t r = load(m_header->readPos);
+        const uint32_t space = m_header->capacity - (w - r);
+        const uint32_t n = static_cast<uint32_t>(
+            std::min<size_t>(size, space));
+        if (n == 0) {
+            return 0;
+        }
+        const uint32_t start = w & m_mask;
+        const uint32_t first = std::min(n, m_header->capacity - start);
+        memcpy(m_data + start, data, first);
+        memcpy(m_data, data + first, n - first);
+        InterlockedExchange(&m_header->writePos, static_cast<LONG>(w + n));
+        if (InterlockedExchange(&m_header->readerWaiting, 0) != 0) {
+            SetEvent(m_dataEvent.get());
+        }
+        return n;
+    }
+
+    // Writer: returns true if the ring has space.  Otherwise, arranges for
+    // spaceEvent to be signaled once the reader frees some, and returns
+    // false.
+    bool checkSpaceOrArm() {
+        if (hasSpace()) {
+            return true;
+        }
+        InterlockedExchange(&m_header->writerWaiting, 1);
+        return hasSpace();
+    }
+
+    // Writer: marks the end of the output.
+    void close() {
+        InterlockedExchange(&m_header->closed, 1);
+        SetEvent(m_dataEvent.get());
+    }
+
+    // Reader: copies up to size bytes out of the ring and returns the
+    // amount.
+    size_t read(char *out, size_t size) {
+        const uint32_t r = static_cast<uint32_t>(m_header->readPos);
+        const uint32_t w = load(m_header->writePos);
+        const uint32_t n = static_cast<uint32_t>(
+            std::min<size_t>(size, w - r));
+        if (n == 0) {
+            return 0;
+        }
+        const uint32_t start = r & m_mask;
+        const uint32_t first = std::min(n, m_header->capacity - start);
+        memcpy(out, m_data + start, first);
+        memcpy(out + first, m_data, n - first);
+        InterlockedExchange(&m_header->readPos, static_cast<LONG>(r + n));
+        if (InterlockedExchange(&m_header->writerWaiting, 0) != 0) {
+            SetEvent(m_spaceEvent.get());
+        }
+        return n;
+    }
+
+    // Reader: waits until the ring has data or is closed, or the timeout
+    // elapses, or abortHandle (if non-NULL) is signaled.  Returns false if
+    // the wait ended without data.
+    bool waitForData(DWORD timeoutMs, HANDLE abortHandle=nullptr) {
+        const HANDLE handles[] = { m_dataEvent.get(), abortHandle };
+        const DWORD handleCount = abortHandle != nullptr ? 2 : 1;
+        while (!hasDataOrClosed()) {
+            InterlockedExchange(&m_header->readerWaiting, 1);
+            if (hasDataOrClosed()) {
+                break;
+            }
+            if (WaitForMultipleObjects(handleCount, handles, FALSE,
+                                       timeoutMs) != WAIT_OBJECT_0) {
+                return hasDataOrClosed();
+            }
+        }
+        return true;
+    }
+
+    // Reader: true once the writer has closed the ring and it's empty.
+    bool isDrainedAndClosed() {
+        return load(m_header->closed) != 0 && !hasData();
+    }
+
+private:
+    SharedRing(OwnedHandle section, OwnedHandle dataEvent,
+               OwnedHandle spaceEvent) :
+        m_section(std::move(section)),
+        m_dataEvent(std::move(dataEvent)),
+        m_spaceEvent(std::move(spaceEvent)) {}
+
+    bool map() {
+        void *view = MapViewOfFile(m_section.get(), FILE_MAP_ALL_ACCESS,
+                                   0, 0, 0);
+        if (view == nullptr) {
+            return false;
+        }
+        m_header = static_cast<Header*>(view);
+        m_data = static_cast<char*>(view) + sizeof(Header);
+        return true;
+    }
+
+    static uint32_t load(volatile LONG &value) {
+        return static_cast<uint32_t>(InterlockedCompareExchange(&value, 0, 0));
+    }
+
+    bool hasSpace() {
+        const uint32_t w = static_cast<uint32_t>(m_header->writePos);
+        return w - load(m_header->readPos) < m_header->capacity;
+    }
+
+    bool hasData() {
+        const uint32_t r = static_cast<uint32_t>(m_header->readPos);
+        return load(m_header->writePos) != r;
+    }
+
+    bool hasDataOrClosed() {
+        return hasData() || load(m_header->closed) != 0;
+    }
+
+    OwnedHandle m_section;
+    OwnedHandle m_dataEvent;
+    OwnedHandle m_spaceEvent;
+    Header *m_header = nullptr;
+    char *m_data = nullptr;
+    uint32_t m_mask = 0;
+
+    SharedRing(const SharedRing &other) = delete;
+    SharedRing &operator=(const SharedRing &other) = delete;
+};
+
+#endif // WINPTY_SHARED_SHARED_RING_H
@@ -22,6 +22,7 @@
 
 #include <windows.h>
 
+#include "UnicodeTranscode.h"
 #include "WinptyAssert.h"
 
 // Workaround.  MinGW (from mingw.org) does not have wcsnlen.  MinGW-w64 *does*
@@ -37,19 +38,7 @@ size_t winpty_wcsnlen(const wchar_t *s, size_t maxlen) {
 }
 
 std::string utf8FromWide(const std::wstring &input) {
-    int mblen = WideCharToMultiByte(
-        CP_UTF8, 0,
-        input.data(), input.size(),
-        NULL, 0, NULL, NULL);
-    if (mblen <= 0) {
-        return std::string();
-    }
-    std::vector<char> tmp(mblen);
-    int mblen2 = WideCharToMultiByte(
-        CP_UTF8, 0,
-        input.data(), input.size(),
-        tmp.data(), tmp.size(),
-        NULL, NULL);
-    ASSERT(mblen2 == mblen);
-    return std::string(tmp.data(), tmp.size());
+    std::string ret;
+    appendUtf8FromUtf16(ret, input.data(), input.size());
+    return ret;
 }
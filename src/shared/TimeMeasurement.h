@@ -31,31 +31,37 @@
 class TimeMeasurement {
 public:
     TimeMeasurement() {
-        static double freq = static_cast<double>(getFrequency());
+        static double freq = static_cast<double>(frequency());
         m_freq = freq;
-        m_start = value();
+        m_start = ticks();
     }
 
     double elapsed() {
-        uint64_t elapsedTicks = value() - m_start;
+        uint64_t elapsedTicks = ticks() - m_start;
         return static_cast<double>(elapsedTicks) / m_freq;
     }
 
-private:
-    uint64_t getFrequency() {
-        LARGE_INTEGER freq;
-        BOOL success = QueryPerformanceFrequency(&freq);
-        assert(success && "QueryPerformanceFrequency failed");
-        return freq.QuadPart;
+    int64_t elapsedUs() {
+        return static_cast<int64_t>(elapsed() * 1000000.0);
     }
 
-    uint64_t value() {
+    // The raw counter, for callers that accumulate many short intervals
+    // without constructing a TimeMeasurement for each.
+    static uint64_t ticks() {
         LARGE_INTEGER ret;
         BOOL success = QueryPerformanceCounter(&ret);
         assert(success && "QueryPerformanceCounter failed");
         return ret.QuadPart;
     }
 
+    static uint64_t frequency() {
+        LARGE_INTEGER freq;
+        BOOL success = QueryPerformanceFrequency(&freq);
+        assert(success && "QueryPerformanceFrequency failed");
+        return freq.QuadPart;
+    }
+
+private:
     uint64_t m_start;
     double m_freq;
 };
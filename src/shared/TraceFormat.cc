@@ -0,0 +1,277 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "TraceFormat.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <wchar.h>
+
+#include "winpty_snprintf.h"
+
+namespace {
+
+// Formats one conversion.  The conversion spec is copied out of the format
+// string so that it is NUL-terminated.
+template <typename T>
+int formatConversion(char (&out)[512], const TraceConversion &conv,
+                     const int *stars, T value) {
+    char spec[32];
+    if (conv.specLength >= static_cast<int>(sizeof(spec))) {
+        out[0] = '\0';
+        return -1;
+    }
+    memcpy(spec, conv.spec, conv.specLength);
+    spec[conv.specLength] = '\0';
+    switch (conv.starCount) {
+        case 0:  return winpty_snprintf(out, spec, value);
+        case 1:  return winpty_snprintf(out, spec, stars[0], value);
+        default: return winpty_snprintf(out, spec, stars[0], stars[1], value);
+    }
+}
+
+} // anonymous namespace
+
+const char *nextTraceConversion(const char *format, TraceConversion &conv) {
+    const char *p = strchr(format, '%');
+    conv.literal = format;
+    if (p == NULL) {
+        conv.literalLength = static_cast<int>(strlen(format));
+        return NULL;
+    }
+    conv.literalLength = static_cast<int>(p - format);
+    conv.spec = p++;
+    conv.starCount = 0;
+    conv.kind = kTraceArgInvalid;
+    if (*p == '%') {
+        conv.kind = kTraceArgPercent;
+        conv.specLength = 2;
+        return p + 1;
+    }
+    while (*p != '\0' && strchr("-+ #0", *p) != NULL) {
+        ++p;
+    }
+    for (int part = 0; part < 2; ++part) {
+        if (*p == '*') {
+            ++conv.starCount;
+            ++p;
+        } else {
+            while (*p >= '0' && *p <= '9') {
+                ++p;
+            }
+        }
+        if (part == 0 && *p == '.') {
+            ++p;
+        } else {
+            break;
+        }
+    }
+    // Length modifiers.
+    enum { kNone, kShort, kLong, kLongLong, kSize, kLongDouble } length = kNone;
+    if (*p == 'h') {
+        length = kShort;
+        p += (p[1] == 'h') ? 2 : 1;
+    } else if (*p == 'l') {
+        length = (p[1] == 'l') ? kLongLong : kLong;
+        p += (p[1] == 'l') ? 2 : 1;
+    } else if (!strncmp(p, "I64", 3)) {
+        length = kLongLong;
+        p += 3;
+    } else if (!strncmp(p, "I32", 3)) {
+        p += 3;
+    } else if (*p == 'I' || *p == 'z' || *p == 't') {
+        length = kSize;
+        ++p;
+    } else if (*p == 'j') {
+        length = kLongLong;
+        ++p;
+    } else if (*p == 'L') {
+        length = kLongDouble;
+        ++p;
+    }
+    const char type = *p;
+    if (type == '\0') {
+        conv.specLength = static_cast<int>(p - conv.spec);
+        return p;
+    }
+    ++p;
+    conv.specLength = static_cast<int>(p - conv.spec);
+    if (strchr("diouxXc", type) != NULL) {
+        switch (length) {
+            case kNone:
+            case kShort:    conv.kind = kTraceArgInt; break;
+            case kLong:     conv.kind = type == 'c' ?
+                                kTraceArgInt : kTraceArgLong; break;
+            case kLongLong: conv.kind = kTraceArgLongLong; break;
+            case kSize:     conv.kind = kTraceArgSize; break;
+            default:        break;
+        }
+    } else if (strchr("eEfFgGaA", type) != NULL) {
+        if (length == kNone || length == kLong) {
+            conv.kind = kTraceArgDouble;
+        }
+    } else if (type == 's') {
+        if (length == kNone) {
+            conv.kind = kTraceArgString;
+        } else if (length == kLong) {
+            conv.kind = kTraceArgWideString;
+        }
+    } else if (type == 'p' && length == kNone) {
+        conv.kind = kTraceArgPointer;
+    }
+    return p;
+}
+
+int encodeTraceArgs(char *out, int outSize, const char *format, va_list ap) {
+    char *const start = out;
+    char *const end = out + outSize;
+    TraceConversion conv;
+    while ((format = nextTraceConversion(format, conv)) != NULL) {
+        if (conv.kind == kTraceArgInvalid) {
+            return -1;
+        } else if (conv.kind == kTraceArgPercent) {
+            continue;
+        }
+        if (end - out < conv.starCount * 4 + 8) {
+            return -1;
+        }
+        int stars[2] = {};
+        for (int i = 0; i < conv.starCount; ++i) {
+            stars[i] = va_arg(ap, int);
+            putTraceInt(out, static_cast<uint32_t>(stars[i]), 4);
+        }
+        uint64_t value = 0;
+        switch (conv.kind) {
+            case kTraceArgInt:
+                value = static_cast<int64_t>(va_arg(ap, int));
+                break;
+            case kTraceArgLong:
+                value = static_cast<int64_t>(va_arg(ap, long));
+                break;
+            case kTraceArgLongLong:
+                value = static_cast<uint64_t>(va_arg(ap, long long));
+                break;
+            case kTraceArgSize:
+                value = va_arg(ap, size_t);
+                break;
+            case kTraceArgPointer:
+                value = reinterpret_cast<uintptr_t>(va_arg(ap, void*));
+                break;
+            case kTraceArgDouble: {
+                const double d = va_arg(ap, double);
+                memcpy(&value, &d, sizeof(value));
+                break;
+            }
+            default: {
+                char text[512];
+                const int len = (conv.kind == kTraceArgString) ?
+                    formatConversion(text, conv, stars,
+                                     va_arg(ap, const char*)) :
+                    formatConversion(text, conv, stars,
+                                     va_arg(ap, const wchar_t*));
+                if (len < 0 || end - out < 2 + len) {
+                    return -1;
+                }
+                putTraceInt(out, static_cast<uint32_t>(len), 2);
+                memcpy(out, text, len);
+                out += len;
+                continue;
+            }
+        }
+        putTraceInt(out, value, 8);
+    }
+    return static_cast<int>(out - start);
+}
+
+std::string decodeTraceArgs(const char *format, const char *args, int size) {
+    std::string ret;
+    const char *const end = args + size;
+    TraceConversion conv;
+    while (true) {
+        format = nextTraceConversion(format, conv);
+        ret.append(conv.literal, conv.literalLength);
+        if (format == NULL) {
+            break;
+        } else if (conv.kind == kTraceArgPercent) {
+            ret.push_back('%');
+            continue;
+        } else if (conv.kind == kTraceArgInvalid) {
+            ret.append("<unsupported conversion>");
+            break;
+        }
+        int stars[2] = {};
+        if (end - args < conv.starCount * 4) {
+            ret.append("<truncated>");
+            break;
+        }
+        for (int i = 0; i < conv.starCount; ++i) {
+            stars[i] = static_cast<int32_t>(getTraceInt(args, 4));
+            args += 4;
+        }
+        if (conv.kind == kTraceArgString ||
+                conv.kind == kTraceArgWideString) {
+            const int len = (end - args >= 2) ?
+                static_cast<int>(getTraceInt(args, 2)) : -1;
+            if (len < 0 || end - args < 2 + len) {
+                ret.append("<truncated>");
+                break;
+            }
+            ret.append(args + 2, len);
+            args += 2 + len;
+            continue;
+        }
+        if (end - args < 8) {
+            ret.append("<truncated>");
+            break;
+        }
+        const uint64_t value = getTraceInt(args, 8);
+        args += 8;
+        char text[512];
+        switch (conv.kind) {
+            case kTraceArgInt:
+                formatConversion(text, conv, stars, static_cast<int>(value));
+                break;
+            case kTraceArgLong:
+                formatConversion(text, conv, stars, static_cast<long>(value));
+                break;
+            case kTraceArgLongLong:
+                formatConversion(text, conv, stars,
+                                 static_cast<long long>(value));
+                break;
+            case kTraceArgSize:
+                formatConversion(text, conv, stars,
+                                 static_cast<size_t>(value));
+                break;
+            case kTraceArgPointer:
+                formatConversion(text, conv, stars,
+                                 reinterpret_cast<void*>(
+                                     static_cast<uintptr_t>(value)));
+                break;
+            default: {
+                double d;
+                memcpy(&d, &value, sizeof(d));
+                formatConversion(text, conv, stars, d);
+                break;
+            }
+        }
+        ret.append(text);
+    }
+    return ret;
+}
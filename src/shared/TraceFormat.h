@@ -0,0 +1,110 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// The binary trace format (WINPTY_DEBUG=trace_binary).  Instead of running
+// printf, trace() copies its format string's arguments into an event record,
+// and the debug server formats the message when it receives it.
+//
+// Each pipe message starts with kTraceBinaryMagic, followed by records.  A
+// record starts with a common header:
+//     uint16 size (of the whole record), uint8 type, uint32 pid
+// followed by (little-endian, unaligned):
+//     kTraceRecordProcess: int64 qpcFrequency, int64 qpcStart,
+//                          int64 unixMsStart, char exeName[]
+//     kTraceRecordFormat:  uint16 formatId, char format[]
+//     kTraceRecordEvent:   uint32 tid, int64 qpc, uint16 formatId, args
+//     kTraceRecordText:    uint32 tid, int64 qpc, char text[]
+// An event's arguments are stored in order.  A '*' width or precision is an
+// int32, an integer, character, or pointer is an int64, and a double is a
+// 64-bit IEEE value.  String arguments are formatted by the client and
+// stored as a uint16 length followed by the text.
+
+#ifndef WINPTY_SHARED_TRACE_FORMAT_H
+#define WINPTY_SHARED_TRACE_FORMAT_H
+
+#include <stdarg.h>
+#include <stdint.h>
+
+#include <string>
+
+const char kTraceBinaryMagic[4] = { '\0', 'W', 'T', 'B' };
+
+enum TraceRecordType {
+    kTraceRecordProcess = 1,
+    kTraceRecordFormat  = 2,
+    kTraceRecordEvent   = 3,
+    kTraceRecordText    = 4,
+};
+
+const int kTraceRecordHeaderSize = 7;
+const int kTraceEventHeaderSize = kTraceRecordHeaderSize + 14;
+
+enum TraceArgKind {
+    kTraceArgInvalid,
+    kTraceArgPercent,
+    kTraceArgInt,
+    kTraceArgLong,
+    kTraceArgLongLong,
+    kTraceArgSize,
+    kTraceArgPointer,
+    kTraceArgDouble,
+    kTraceArgString,
+    kTraceArgWideString,
+};
+
+struct TraceConversion {
+    // The text before the conversion.
+    const char *literal;
+    int literalLength;
+    // The conversion, starting at its '%'.
+    const char *spec;
+    int specLength;
+    int starCount;
+    TraceArgKind kind;
+};
+
+// Parses the next printf conversion in the format string.  Returns a pointer
+// just past it, or NULL if there are no more conversions, in which case only
+// the literal fields of `conv` are set.
+const char *nextTraceConversion(const char *format, TraceConversion &conv);
+
+// Stores the arguments for the format string.  Returns the number of bytes
+// written, or -1 if they don't fit or the format isn't supported.
+int encodeTraceArgs(char *out, int outSize, const char *format, va_list ap);
+
+// Formats a message from a format string and its encoded arguments.
+std::string decodeTraceArgs(const char *format, const char *args, int size);
+
+inline void putTraceInt(char *&out, uint64_t value, int size) {
+    for (int i = 0; i < size; ++i) {
+        *out++ = static_cast<char>(value >> (i * 8));
+    }
+}
+
+inline uint64_t getTraceInt(const char *in, int size) {
+    uint64_t ret = 0;
+    for (int i = 0; i < size; ++i) {
+        ret |= static_cast<uint64_t>(static_cast<unsigned char>(in[i])) <<
+            (i * 8);
+    }
+    return ret;
+}
+
+#endif // WINPTY_SHARED_TRACE_FORMAT_H
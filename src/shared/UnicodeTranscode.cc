@@ -0,0 +1,266 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "UnicodeTranscode.h"
+
+#include "CpuFeatures.h"
+#include "WinptyAssert.h"
+
+#ifdef WINPTY_CPU_X86
+#include <immintrin.h>
+#endif
+
+static_assert(sizeof(wchar_t) == 2, "wchar_t is expected to hold UTF-16");
+
+namespace {
+
+const wchar_t kReplacementChar = 0xFFFD;
+
+// Each kernel copies the leading ASCII units of `input` to `out` and returns
+// how many it copied.  The scalar loops finish the tail of the vector
+// kernels, starting at `i`.
+
+size_t narrowAsciiScalar(const wchar_t *input, size_t i, size_t length,
+                         char *out) {
+    for (; i < length && input[i] < 0x80; ++i) {
+        out[i] = static_cast<char>(input[i]);
+    }
+    return i;
+}
+
+size_t widenAsciiScalar(const char *input, size_t i, size_t length,
+                        wchar_t *out) {
+    for (; i < length && static_cast<unsigned char>(input[i]) < 0x80; ++i) {
+        out[i] = input[i];
+    }
+    return i;
+}
+
+size_t narrowAsciiGeneric(const wchar_t *input, size_t length, char *out) {
+    return narrowAsciiScalar(input, 0, length, out);
+}
+
+size_t widenAsciiGeneric(const char *input, size_t length, wchar_t *out) {
+    return widenAsciiScalar(input, 0, length, out);
+}
+
+struct Kernels {
+    size_t (*narrowAscii)(const wchar_t*, size_t, char*);
+    size_t (*widenAscii)(const char*, size_t, wchar_t*);
+};
+
+#ifdef WINPTY_CPU_X86
+
+// Eight UTF-16 units are ASCII when none has a bit above 0x7F set; they are
+// then packed into eight bytes.
+WINPTY_TARGET("sse2")
+size_t narrowAsciiSse2(const wchar_t *input, size_t length, char *out) {
+    const __m128i highBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i high = _mm_and_si128(v, highBits);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF) {
+            break;
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i),
+                         _mm_packus_epi16(v, v));
+    }
+    return narrowAsciiScalar(input, i, length, out);
+}
+
+// Sixteen bytes are ASCII when none has its top bit set; they are then
+// zero-extended into sixteen UTF-16 units.
+WINPTY_TARGET("sse2")
+size_t widenAsciiSse2(const char *input, size_t length, wchar_t *out) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8),
+                         _mm_unpackhi_epi8(v, zero));
+    }
+    return widenAsciiScalar(input, i, length, out);
+}
+
+Kernels selectKernels() {
+    if (detectCpuLevel() != CpuLevel::Generic) {
+        return { narrowAsciiSse2, widenAsciiSse2 };
+    }
+    return { narrowAsciiGeneric, widenAsciiGeneric };
+}
+
+#else
+
+Kernels selectKernels() {
+    return { narrowAsciiGeneric, widenAsciiGeneric };
+}
+
+#endif // WINPTY_CPU_X86
+
+const Kernels &kernels() {
+    static const Kernels ret = selectKernels();
+    return ret;
+}
+
+inline char *encodeUtf8(char *out, uint32_t code) {
+    if (code < 0x80) {
+        *out++ = static_cast<char>(code);
+    } else if (code < 0x800) {
+        *out++ = static_cast<char>(0xC0 | (code >> 6));
+        *out++ = static_cast<char>(0x80 | (code & 0x3F));
+    } else if (code < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | (code >> 12));
+        *out++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (code & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xF0 | (code >> 18));
+        *out++ = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (code & 0x3F));
+    }
+    return out;
+}
+
+} // anonymous namespace
+
+int decodeUtf8Sequence(const char *input, size_t length, uint32_t &codePoint) {
+    ASSERT(length > 0);
+    const unsigned char lead = input[0];
+    if (lead < 0x80) {
+        codePoint = lead;
+        return 1;
+    }
+    int len;
+    uint32_t code;
+    uint32_t minimum;
+    if ((lead & 0xE0) == 0xC0) {
+        len = 2;
+        code = lead & 0x1F;
+        minimum = 0x80;
+    } else if ((lead & 0xF0) == 0xE0) {
+        len = 3;
+        code = lead & 0x0F;
+        minimum = 0x800;
+    } else if ((lead & 0xF8) == 0xF0) {
+        len = 4;
+        code = lead & 0x07;
+        minimum = 0x10000;
+    } else {
+        codePoint = kInvalidCodePoint;
+        return 1;
+    }
+    for (int i = 1; i < len; ++i) {
+        if (static_cast<size_t>(i) >= length) {
+            return 0;
+        }
+        const unsigned char ch = input[i];
+        if ((ch & 0xC0) != 0x80) {
+            codePoint = kInvalidCodePoint;
+            return i;
+        }
+        code = (code << 6) | (ch & 0x3F);
+    }
+    if (code < minimum || code > 0x10FFFF ||
+            (code >= 0xD800 && code <= 0xDFFF)) {
+        codePoint = kInvalidCodePoint;
+    } else {
+        codePoint = code;
+    }
+    return len;
+}
+
+void appendUtf8FromUtf16(std::string &out, const wchar_t *input,
+                         size_t length) {
+    // A UTF-16 unit never needs more than three bytes, and a surrogate pair
+    // needs four.
+    const size_t start = out.size();
+    out.resize(start + length * 3);
+    char *const base = &out[0];
+    char *p = base + start;
+    const Kernels &k = kernels();
+    size_t i = 0;
+    while (i < length) {
+        const size_t ascii = k.narrowAscii(input + i, length - i, p);
+        i += ascii;
+        p += ascii;
+        if (i == length) {
+            break;
+        }
+        const uint32_t ch = input[i];
+        if ((ch & 0xF800) != 0xD800) {
+            p = encodeUtf8(p, ch);
+            ++i;
+        } else if ((ch & 0xFC00) == 0xD800 && i + 1 < length &&
+                (input[i + 1] & 0xFC00) == 0xDC00) {
+            const uint32_t low = input[i + 1];
+            p = encodeUtf8(p, 0x10000 + ((ch - 0xD800) << 10) + (low - 0xDC00));
+            i += 2;
+        } else {
+            p = encodeUtf8(p, kReplacementChar);
+            ++i;
+        }
+    }
+    out.resize(p - base);
+}
+
+size_t appendUtf16FromUtf8(std::wstring &out, const char *input,
+                           size_t length) {
+    // Every byte yields at most one UTF-16 unit.
+    const size_t start = out.size();
+    out.resize(start + length);
+    wchar_t *const base = &out[0];
+    wchar_t *p = base + start;
+    const Kernels &k = kernels();
+    size_t i = 0;
+    while (i < length) {
+        const size_t ascii = k.widenAscii(input + i, length - i, p);
+        i += ascii;
+        p += ascii;
+        if (i == length) {
+            break;
+        }
+        uint32_t code;
+        const int len = decodeUtf8Sequence(input + i, length - i, code);
+        if (len == 0) {
+            break;
+        }
+        i += len;
+        if (code == kInvalidCodePoint) {
+            *p++ = kReplacementChar;
+        } else if (code >= 0x10000) {
+            code -= 0x10000;
+            *p++ = static_cast<wchar_t>(0xD800 | (code >> 10));
+            *p++ = static_cast<wchar_t>(0xDC00 | (code & 0x3FF));
+        } else {
+            *p++ = static_cast<wchar_t>(code);
+        }
+    }
+    out.resize(p - base);
+    return i;
+}
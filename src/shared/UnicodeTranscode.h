@@ -0,0 +1,60 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef WINPTY_SHARED_UNICODE_TRANSCODE_H
+#define WINPTY_SHARED_UNICODE_TRANSCODE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+// Bulk conversion between UTF-16 and UTF-8.  Runs of ASCII are copied with
+// SSE2 where the CPU has it; everything else goes through a scalar loop.
+// Both directions validate their input and substitute U+FFFD for anything
+// that isn't well-formed, so the output is always valid.
+
+// The code point decodeUtf8Sequence reports for an invalid sequence.
+const uint32_t kInvalidCodePoint = 0xFFFFFFFF;
+
+// Decodes the UTF-8 character at the start of `input`, which must hold at
+// least one byte.  Returns the number of bytes the character occupies and
+// stores its code point, or returns 0 if `input` ends partway through a
+// character that could still be valid.
+//
+// An invalid sequence (a stray continuation byte, a missing continuation
+// byte, an overlong form, a surrogate, or a value past U+10FFFF) sets
+// `codePoint` to kInvalidCodePoint.  The returned length stops before a byte
+// that can't continue the sequence, so the decoder resynchronizes on it.
+int decodeUtf8Sequence(const char *input, size_t length, uint32_t &codePoint);
+
+// Appends the UTF-8 encoding of the UTF-16 `input`.  An unpaired surrogate
+// becomes U+FFFD.
+void appendUtf8FromUtf16(std::string &out, const wchar_t *input,
+                         size_t length);
+
+// Appends the UTF-16 decoding of the UTF-8 `input`, replacing each invalid
+// sequence with U+FFFD.  Returns the number of bytes consumed, which is less
+// than `length` only when the input ends partway through a character; the
+// caller keeps the rest for its next call.
+size_t appendUtf16FromUtf8(std::wstring &out, const char *input,
+                           size_t length);
+
+#endif // WINPTY_SHARED_UNICODE_TRANSCODE_H
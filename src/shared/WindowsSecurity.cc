@@ -23,6 +23,7 @@
 #include <array>
 
 #include "DebugClient.h"
+#include "Mutex.h"
 #include "OsModule.h"
 #include "OwnedHandle.h"
 #include "StringBuilder.h"
@@ -250,6 +251,41 @@ createPipeSecurityDescriptorOwnerFullControl() {
     return SecurityDescriptor(retValue, std::move(impl));
 }
 
+// Guards the lazily built descriptor of
+// sharedPipeSecurityDescriptorOwnerFullControl.  (A namespace-scope Mutex is
+// constructed before any thread can call it.)
+static Mutex g_sharedPipeSdMutex;
+static SecurityDescriptor *g_sharedPipeSd = nullptr;
+
+// Returns true unless the thread is known to be using the process' token.
+static bool isThreadImpersonating() {
+    HANDLE token = nullptr;
+    if (OpenThreadToken(GetCurrentThread(), TOKEN_QUERY,
+                        /*OpenAsSelf=*/FALSE, &token)) {
+        CloseHandle(token);
+        return true;
+    }
+    return GetLastError() != ERROR_NO_TOKEN;
+}
+
+// Like createPipeSecurityDescriptorOwnerFullControl, but the descriptor is
+// built once per process and shared, so each new pipe doesn't repeat the
+// token query, SID allocations, and ACL construction.  The returned item
+// doesn't own the descriptor, which is never freed.  An impersonating thread
+// gets a descriptor of its own, because its owner may not be the process'.
+SecurityDescriptor sharedPipeSecurityDescriptorOwnerFullControl() {
+    if (isThreadImpersonating()) {
+        return createPipeSecurityDescriptorOwnerFullControl();
+    }
+    LockGuard<Mutex> guard(g_sharedPipeSdMutex);
+    if (g_sharedPipeSd == nullptr) {
+        g_sharedPipeSd = new SecurityDescriptor(
+            createPipeSecurityDescriptorOwnerFullControl());
+    }
+    return SecurityDescriptor(
+        g_sharedPipeSd->get(), std::unique_ptr<SecurityDescriptor::Impl>());
+}
+
 SecurityDescriptor
 createPipeSecurityDescriptorOwnerFullControlEveryoneWrite() {
 
@@ -423,15 +459,19 @@ std::wstring sdToString(PSECURITY_DESCRIPTOR sd) {
 // Vista added a useful flag to CreateNamedPipe, PIPE_REJECT_REMOTE_CLIENTS,
 // that rejects remote connections.  Return this flag on Vista, or return 0
 // otherwise.
+// The OS version is checked once, on the first call.
 DWORD rejectRemoteClientsPipeFlag() {
-    if (isAtLeastWindowsVista()) {
-        // MinGW lacks this flag; MinGW-w64 has it.
-        const DWORD kPIPE_REJECT_REMOTE_CLIENTS = 8;
-        return kPIPE_REJECT_REMOTE_CLIENTS;
-    } else {
-        trace("Omitting PIPE_REJECT_REMOTE_CLIENTS on pre-Vista OS");
-        return 0;
-    }
+    static const DWORD flag = []() -> DWORD {
+        if (isAtLeastWindowsVista()) {
+            // MinGW lacks this flag; MinGW-w64 has it.
+            const DWORD kPIPE_REJECT_REMOTE_CLIENTS = 8;
+            return kPIPE_REJECT_REMOTE_CLIENTS;
+        } else {
+            trace("Omitting PIPE_REJECT_REMOTE_CLIENTS on pre-Vista OS");
+            return 0;
+        }
+    }();
+    return flag;
 }
 
 typedef BOOL WINAPI GetNamedPipeClientProcessId_t(
@@ -82,6 +82,7 @@ Sid localSystemSid();
 Sid everyoneSid();
 
 SecurityDescriptor createPipeSecurityDescriptorOwnerFullControl();
+SecurityDescriptor sharedPipeSecurityDescriptorOwnerFullControl();
 SecurityDescriptor createPipeSecurityDescriptorOwnerFullControlEveryoneWrite();
 SecurityDescriptor getObjectSecurityDescriptor(HANDLE handle);
 
@@ -62,11 +62,6 @@ OSVERSIONINFOEX getWindowsVersionInfo() {
 #endif
 }
 
-Version getWindowsVersion() {
-    const auto info = getWindowsVersionInfo();
-    return Version(info.dwMajorVersion, info.dwMinorVersion);
-}
-
 struct ModuleNotFound : WinptyException {
     virtual const wchar_t *what() const WINPTY_NOEXCEPT override {
         return L"ModuleNotFound";
@@ -158,21 +153,103 @@ std::string versionToString(uint64_t version) {
     return b.str_moved();
 }
 
+typedef LONG WINAPI RtlGetVersion_t(OSVERSIONINFOW *info);
+
+const uint64_t kCapsKnown       = 1u << 0;
+const uint64_t kCapsVista       = 1u << 1;
+const uint64_t kCapsWindows7    = 1u << 2;
+const uint64_t kCapsWindows8    = 1u << 3;
+const uint64_t kCapsWindows10   = 1u << 4;
+// The bits left for the callers' own probes.
+const uint64_t kCapsCallerMask  = 0xFFFFFF00;
+
+// GetVersionEx reports 6.2 for Windows 10 (or Windows Server 2016) unless the
+// executable is manifested, so ask ntdll's RtlGetVersion, which isn't capped,
+// instead.
+bool queryIsWindows10() {
+    const auto pRtlGetVersion = reinterpret_cast<RtlGetVersion_t*>(
+        loadedModuleProc(L"ntdll.dll", "RtlGetVersion"));
+    if (pRtlGetVersion == nullptr) {
+        return true;
+    }
+    OSVERSIONINFOW info = {};
+    info.dwOSVersionInfoSize = sizeof(info);
+    if (pRtlGetVersion(&info) != 0) {
+        return true;
+    }
+    return info.dwMajorVersion >= 10;
+}
+
+uint64_t queryVersionCaps() {
+    const auto info = getWindowsVersionInfo();
+    const Version version(info.dwMajorVersion, info.dwMinorVersion);
+    uint64_t caps = kCapsKnown;
+    if (version >= Version(6, 0)) { caps |= kCapsVista; }
+    if (version >= Version(6, 1)) { caps |= kCapsWindows7; }
+    if (version >= Version(6, 2)) {
+        caps |= kCapsWindows8;
+        if (queryIsWindows10()) { caps |= kCapsWindows10; }
+    }
+    return caps | (static_cast<uint64_t>(info.dwBuildNumber) << 32);
+}
+
+uint64_t g_seededCaps = 0;
+
+uint64_t versionCaps() {
+    static const uint64_t caps =
+        (g_seededCaps & kCapsKnown) ? g_seededCaps : queryVersionCaps();
+    return caps;
+}
+
 } // anonymous namespace
 
+#ifndef WINPTY_TARGET_WIN10
+
 // Returns true for Windows Vista (or Windows Server 2008) or newer.
 bool isAtLeastWindowsVista() {
-    return getWindowsVersion() >= Version(6, 0);
+    return (versionCaps() & kCapsVista) != 0;
 }
 
 // Returns true for Windows 7 (or Windows Server 2008 R2) or newer.
 bool isAtLeastWindows7() {
-    return getWindowsVersion() >= Version(6, 1);
+    return (versionCaps() & kCapsWindows7) != 0;
 }
 
 // Returns true for Windows 8 (or Windows Server 2012) or newer.
 bool isAtLeastWindows8() {
-    return getWindowsVersion() >= Version(6, 2);
+    return (versionCaps() & kCapsWindows8) != 0;
+}
+
+// Returns true for Windows 10 (or Windows Server 2016) or newer.
+bool isAtLeastWindows10() {
+    return (versionCaps() & kCapsWindows10) != 0;
+}
+
+#endif // WINPTY_TARGET_WIN10
+
+// Returns false if this is a WINPTY_TARGET_WIN10 build running on an older
+// release of Windows.
+bool isWindowsVersionSupported() {
+#ifdef WINPTY_TARGET_WIN10
+    return (versionCaps() & kCapsWindows10) != 0;
+#else
+    return true;
+#endif
+}
+
+// Like the version checks, this is capped unless the executable is manifested
+// for newer versions of Windows.
+unsigned int windowsBuildNumber() {
+    return static_cast<unsigned int>(versionCaps() >> 32);
+}
+
+uint64_t windowsVersionCaps() {
+    return versionCaps() & ~kCapsCallerMask;
+}
+
+// Has no effect once a version check has been made, or if caps is unknown.
+void setWindowsVersionCaps(uint64_t caps) {
+    g_seededCaps = caps & ~kCapsCallerMask;
 }
 
 #define WINPTY_IA32     1
@@ -206,10 +283,9 @@ void dumpWindowsVersion() {
     b << ' ';
 #if WINPTY_ARCH == WINPTY_IA32
     b << "IA32";
-    OsModule kernel32(L"kernel32.dll");
     IsWow64Process_t *pIsWow64Process =
         reinterpret_cast<IsWow64Process_t*>(
-            kernel32.proc("IsWow64Process"));
+            loadedModuleProc(L"kernel32.dll", "IsWow64Process"));
     if (pIsWow64Process != nullptr) {
         BOOL result = false;
         const BOOL success = pIsWow64Process(GetCurrentProcess(), &result);
@@ -21,9 +21,31 @@
 #ifndef WINPTY_SHARED_WINDOWS_VERSION_H
 #define WINPTY_SHARED_WINDOWS_VERSION_H
 
+#include <stdint.h>
+
+#ifdef WINPTY_TARGET_WIN10
+// A WINPTY_TARGET_WIN10 build only runs on Windows 10 and newer, so the checks
+// are constants, and the code for older releases compiles away.
+inline bool isAtLeastWindowsVista() { return true; }
+inline bool isAtLeastWindows7() { return true; }
+inline bool isAtLeastWindows8() { return true; }
+inline bool isAtLeastWindows10() { return true; }
+#else
 bool isAtLeastWindowsVista();
 bool isAtLeastWindows7();
 bool isAtLeastWindows8();
+bool isAtLeastWindows10();
+#endif
+bool isWindowsVersionSupported();
+unsigned int windowsBuildNumber();
 void dumpWindowsVersion();
 
+// The checks above are made once per process.  windowsVersionCaps packs their
+// results into the low 32 bits of a value (zero bits 0-7 mean "unknown"), and
+// the build number into the high 32 bits.  libwinpty passes it to the agent,
+// which calls setWindowsVersionCaps before its first check to skip the
+// queries.  Bits 8-31 are free for callers' own probe results.
+uint64_t windowsVersionCaps();
+void setWindowsVersionCaps(uint64_t caps);
+
 #endif // WINPTY_SHARED_WINDOWS_VERSION_H
@@ -28,6 +28,7 @@
 void assertTrace(const char *file, int line, const char *cond) {
     trace("Assertion failed: %s, file %s, line %d",
           cond, file, line);
+    flushTrace();
 }
 
 #ifdef WINPTY_AGENT_ASSERT
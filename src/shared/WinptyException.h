@@ -31,13 +31,22 @@
 #define WINPTY_NOEXCEPT
 #endif
 
+#if defined(__GNUC__)
+#define WINPTY_NORETURN [[noreturn]]
+#elif defined(_MSC_VER) && _MSC_VER >= 1900
+#define WINPTY_NORETURN [[noreturn]]
+#else
+#define WINPTY_NORETURN __declspec(noreturn)
+#endif
+
 class WinptyException {
 public:
     virtual const wchar_t *what() const WINPTY_NOEXCEPT = 0;
     virtual ~WinptyException() {}
 };
 
-void throwWinptyException(const wchar_t *what);
-void throwWindowsError(const wchar_t *prefix, DWORD error=GetLastError());
+WINPTY_NORETURN void throwWinptyException(const wchar_t *what);
+WINPTY_NORETURN void throwWindowsError(const wchar_t *prefix,
+                                       DWORD error=GetLastError());
 
 #endif // WINPTY_EXCEPTION_H
@@ -2,4 +2,5 @@ include src/agent/subdir.mk
 include src/debugserver/subdir.mk
 include src/libwinpty/subdir.mk
 include src/tests/subdir.mk
+include src/unittest/subdir.mk
 include src/unix-adapter/subdir.mk
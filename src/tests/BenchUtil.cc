@@ -0,0 +1,90 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "BenchUtil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int64_t qpcValue() {
+    LARGE_INTEGER ret;
+    QueryPerformanceCounter(&ret);
+    return ret.QuadPart;
+}
+
+double qpcMs(int64_t ticks) {
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    return static_cast<double>(ticks) * 1000.0 /
+        static_cast<double>(freq.QuadPart);
+}
+
+double percentile(const std::vector<double> &sorted, int pct) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    return sorted[(sorted.size() - 1) * pct / 100];
+}
+
+void benchCheck(bool success, const char *what) {
+    if (success) {
+        return;
+    }
+    fprintf(stderr, "Error: %s (error %u)\n",
+            what, static_cast<unsigned int>(GetLastError()));
+    fflush(stdout);
+    exit(1);
+}
+
+HANDLE openPipe(LPCWSTR name, DWORD access) {
+    if (name == nullptr) {
+        return nullptr;
+    }
+    HANDLE ret = CreateFileW(
+        name, access, 0, nullptr, OPEN_EXISTING, 0, nullptr);
+    benchCheck(ret != INVALID_HANDLE_VALUE, "could not open a winpty pipe");
+    return ret;
+}
+
+void writeConsole(HANDLE conout, const std::wstring &text) {
+    DWORD actual = 0;
+    WriteConsoleW(conout, text.data(), static_cast<DWORD>(text.size()),
+                  &actual, nullptr);
+}
+
+std::wstring selfPath() {
+    wchar_t program[1024] = {};
+    const DWORD length = GetModuleFileNameW(nullptr, program, 1024);
+    benchCheck(length > 0 && length < 1024, "GetModuleFileNameW failed");
+    return program;
+}
+
+std::wstring childCommandLine(const std::wstring &args) {
+    std::wstring ret = L"\"" + selfPath() + L"\" CHILD";
+    if (!args.empty()) {
+        ret += L" " + args;
+    }
+    return ret;
+}
+
+bool isChildRun(int argc, char *argv[]) {
+    return argc >= 2 && !strcmp(argv[1], "CHILD");
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef TESTS_BENCH_UTIL_H
+#define TESTS_BENCH_UTIL_H
+
+#include <windows.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// Scaffolding shared by the benchmark programs in this directory.  Each
+// benchmark runs itself again, with "CHILD" as its first argument, as the
+// program inside the winpty sessions it measures.
+
+// The console size of the benchmarks' sessions.
+const int kCols = 80;
+const int kRows = 25;
+
+int64_t qpcValue();
+double qpcMs(int64_t ticks);
+
+// Returns the given percentile of an ascending vector, or 0.0 if it's empty.
+double percentile(const std::vector<double> &sorted, int pct);
+
+// Unless `success` is true, prints "Error: <what>" with the last Windows
+// error code and exits with status 1.  Unlike assert, this is still checked
+// in an NDEBUG build.
+void benchCheck(bool success, const char *what);
+
+// Opens one of a session's pipes, or returns nullptr if the name is nullptr
+// (e.g. CONERR without WINPTY_FLAG_CONERR).  Exits on failure.
+HANDLE openPipe(LPCWSTR name, DWORD access=GENERIC_READ);
+
+void writeConsole(HANDLE conout, const std::wstring &text);
+
+// The path of this program, and the command line that runs it again as a
+// child with the given arguments after "CHILD".
+std::wstring selfPath();
+std::wstring childCommandLine(const std::wstring &args=std::wstring());
+
+// Returns true if this process was started with a childCommandLine.
+bool isChildRun(int argc, char *argv[]);
+
+#endif // TESTS_BENCH_UTIL_H
@@ -0,0 +1,253 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Measures keystroke-to-echo latency through the agent.  For each setting,
+// this program runs itself again as a child inside a new winpty_t.  The child
+// reads console input one key at a time and echoes each key as an
+// "ECHO <key>" line.  The parent writes one keystroke at a time to CONIN,
+// waits for its echo on CONOUT, and reports the p50, p99, and maximum delay.
+// The parent pauses between keystrokes so the agent's polling goes idle, as
+// it would between a user's keystrokes.
+//
+// Usage: echo_latency_bench [-flags HEX] [-samples N] [SETTING...]
+// The settings are default, poll-1ms, backoff, event, event-backoff, and
+// legacy.  With no setting arguments, all of them run.  -flags adds
+// WINPTY_FLAG_xxx bits to every setting.
+
+#include <windows.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../include/winpty.h"
+
+#include "BenchUtil.h"
+
+namespace {
+
+const DWORD kKeyIntervalMs = 50;
+
+// Agent flags and poll interval to measure.  A zero minMs keeps the default
+// poll interval.
+struct Setting {
+    const char *name;
+    UINT64 flags;
+    int minMs;
+    int maxMs;
+};
+
+const Setting kSettings[] = {
+    { "default",       0,                                   0,   0 },
+    { "poll-1ms",      0,                                   1,   1 },
+    { "backoff",       0,                                   5, 100 },
+    { "event",         WINPTY_FLAG_EVENT_DRIVEN_SCRAPE,     0,   0 },
+    { "event-backoff", WINPTY_FLAG_EVENT_DRIVEN_SCRAPE,     5, 100 },
+    { "legacy",        WINPTY_FLAG_LEGACY_TENTATIVE_SCRAPE, 0,   0 },
+};
+
+// Echoes each key until it reads a '.'.  The console is switched out of line
+// mode so every keystroke is delivered as it arrives, like a shell's raw-mode
+// line editor.
+void childMain() {
+    HANDLE conin = GetStdHandle(STD_INPUT_HANDLE);
+    HANDLE conout = GetStdHandle(STD_OUTPUT_HANDLE);
+    SetConsoleMode(conin, 0);
+    writeConsole(conout, L"READY\r\n");
+    while (true) {
+        INPUT_RECORD records[16];
+        DWORD count = 0;
+        if (!ReadConsoleInputW(conin, records, 16, &count)) {
+            return;
+        }
+        for (DWORD i = 0; i < count; ++i) {
+            const INPUT_RECORD &rec = records[i];
+            if (rec.EventType != KEY_EVENT || !rec.Event.KeyEvent.bKeyDown) {
+                continue;
+            }
+            const wchar_t ch = rec.Event.KeyEvent.uChar.UnicodeChar;
+            if (ch == L'.') {
+                return;
+            }
+            if (ch == L'\0') {
+                continue;
+            }
+            wchar_t buf[16];
+            swprintf(buf, 16, L"ECHO %lc\r\n", ch);
+            writeConsole(conout, buf);
+        }
+    }
+}
+
+// Reads CONOUT until `marker` appears in the output read since the last call.
+// The agent may split the marker across reads, so the search restarts a few
+// bytes before the end of the previous read.
+bool readUntil(HANDLE conout, std::string &text, const std::string &marker) {
+    size_t scanPos = 0;
+    while (true) {
+        const size_t pos = text.find(marker, scanPos);
+        if (pos != std::string::npos) {
+            text.erase(0, pos + marker.size());
+            return true;
+        }
+        scanPos = text.size() >= marker.size()
+            ? text.size() - marker.size() + 1 : 0;
+        char buf[4096];
+        DWORD amount = 0;
+        if (!ReadFile(conout, buf, sizeof(buf), &amount, nullptr) ||
+                amount == 0) {
+            return false;
+        }
+        text.append(buf, amount);
+    }
+}
+
+bool runSetting(const Setting &setting, UINT64 extraFlags, int samples) {
+    const std::wstring program = selfPath();
+    const std::wstring cmdline = childCommandLine();
+
+    auto agentCfg = winpty_config_new(setting.flags | extraFlags, nullptr);
+    if (agentCfg == nullptr) {
+        fprintf(stderr, "Error: winpty_config_new failed\n");
+        return false;
+    }
+    winpty_config_set_initial_size(agentCfg, kCols, kRows);
+    if (setting.minMs > 0) {
+        winpty_config_set_poll_interval(
+            agentCfg, setting.minMs, setting.maxMs);
+    }
+    auto pty = winpty_open(agentCfg, nullptr);
+    winpty_config_free(agentCfg);
+    if (pty == nullptr) {
+        fprintf(stderr, "Error: winpty_open failed\n");
+        return false;
+    }
+    HANDLE conin = openPipe(winpty_conin_name(pty), GENERIC_WRITE);
+    HANDLE conout = openPipe(winpty_conout_name(pty));
+
+    auto spawnCfg = winpty_spawn_config_new(
+            WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN, program.c_str(), cmdline.c_str(),
+            nullptr, nullptr, nullptr);
+    benchCheck(spawnCfg != nullptr, "winpty_spawn_config_new failed");
+    HANDLE process = nullptr;
+    const BOOL spawnSuccess = winpty_spawn(
+        pty, spawnCfg, &process, nullptr, nullptr, nullptr);
+    winpty_spawn_config_free(spawnCfg);
+    if (!spawnSuccess) {
+        fprintf(stderr, "Error: winpty_spawn failed\n");
+        CloseHandle(conin);
+        CloseHandle(conout);
+        winpty_free(pty);
+        return false;
+    }
+
+    std::string text;
+    std::vector<double> latencies;
+    bool success = readUntil(conout, text, "READY");
+    for (int i = 0; success && i < samples; ++i) {
+        Sleep(kKeyIntervalMs);
+        // Cycle through the letters so a redraw of an earlier echo line
+        // isn't mistaken for this one.
+        const char key = static_cast<char>('a' + i % 26);
+        const std::string marker = std::string("ECHO ") + key;
+        text.clear();
+        const int64_t startTime = qpcValue();
+        DWORD actual = 0;
+        success = WriteFile(conin, &key, 1, &actual, nullptr) &&
+            readUntil(conout, text, marker);
+        if (success) {
+            latencies.push_back(qpcMs(qpcValue() - startTime));
+        }
+    }
+    DWORD actual = 0;
+    WriteFile(conin, ".", 1, &actual, nullptr);
+    char buf[4096];
+    while (ReadFile(conout, buf, sizeof(buf), &actual, nullptr) &&
+            actual != 0) {
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    printf("%-14s %8d %8.1f %8.1f %8.1f\n",
+           setting.name,
+           static_cast<int>(latencies.size()),
+           percentile(latencies, 50),
+           percentile(latencies, 99),
+           latencies.empty() ? 0.0 : latencies.back());
+    if (!success) {
+        fprintf(stderr, "Error: %s: CONOUT ended before the echo arrived\n",
+                setting.name);
+    }
+
+    CloseHandle(process);
+    CloseHandle(conin);
+    CloseHandle(conout);
+    winpty_free(pty);
+    return success;
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (isChildRun(argc, argv)) {
+        childMain();
+        return 0;
+    }
+
+    UINT64 extraFlags = 0;
+    int samples = 200;
+    std::vector<const Setting*> settings;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-flags") && i + 1 < argc) {
+            extraFlags = _strtoui64(argv[++i], nullptr, 16);
+        } else if (!strcmp(argv[i], "-samples") && i + 1 < argc) {
+            samples = std::max(1, atoi(argv[++i]));
+        } else {
+            const Setting *found = nullptr;
+            for (const auto &setting : kSettings) {
+                if (!strcmp(argv[i], setting.name)) {
+                    found = &setting;
+                }
+            }
+            if (found == nullptr) {
+                fprintf(stderr, "Error: unrecognized argument: '%s'\n",
+                        argv[i]);
+                return 1;
+            }
+            settings.push_back(found);
+        }
+    }
+    if (settings.empty()) {
+        for (const auto &setting : kSettings) {
+            settings.push_back(&setting);
+        }
+    }
+
+    printf("%-14s %8s %8s %8s %8s\n",
+           "setting", "samples", "p50-ms", "p99-ms", "max-ms");
+    bool success = true;
+    for (const Setting *setting : settings) {
+        success = runSetting(*setting, extraFlags, samples) && success;
+    }
+    return success ? 0 : 1;
+}
@@ -0,0 +1,310 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Measures the memory cost of idle sessions.  For each workload, this program
+// opens N sessions at once, waits for them to settle, and then samples each
+// agent's private bytes and working set, along with the agent's own
+// accounting of its heap (the WINPTY_STAT_xxx_MEMORY_BYTES counters): the
+// scraper's tracked lines, its console read buffers, the pipe queues and I/O
+// buffers, the input decoding map, and the trace queue.  The per-session mean
+// of each is reported in KiB.  The "other" column is the private bytes not
+// covered by the counters: code, stacks, the CRT heap's slack, and so on.
+//
+// The workloads are an idle cmd.exe prompt, an idle bash prompt (only with
+// -bash, since there's no standard bash to find), and a full-screen program,
+// which is this program run as a child that shows a window-sized screen
+// buffer, as editors and pagers do.  -flags adds WINPTY_FLAG_xxx bits to
+// every session, e.g. to compare WINPTY_FLAG_IDLE_TRIM, and -settle sets how
+// long to wait before sampling; idle trimming needs more than its 30 second
+// idle period.
+//
+// Usage: memory_bench [-sessions N] [-settle MS] [-flags HEX] [-bash PATH]
+
+#include <windows.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../include/winpty.h"
+
+#include "BenchUtil.h"
+
+namespace {
+
+// PROCESS_MEMORY_COUNTERS_EX, declared here so that this program doesn't
+// need psapi.h or psapi.lib.
+struct MemoryCounters {
+    DWORD cb;
+    DWORD PageFaultCount;
+    SIZE_T PeakWorkingSetSize;
+    SIZE_T WorkingSetSize;
+    SIZE_T QuotaPeakPagedPoolUsage;
+    SIZE_T QuotaPagedPoolUsage;
+    SIZE_T QuotaPeakNonPagedPoolUsage;
+    SIZE_T QuotaNonPagedPoolUsage;
+    SIZE_T PagefileUsage;
+    SIZE_T PeakPagefileUsage;
+    SIZE_T PrivateUsage;
+};
+
+typedef BOOL WINAPI GetProcessMemoryInfoFn(HANDLE, MemoryCounters*, DWORD);
+
+// GetProcessMemoryInfo moved into kernel32 (as K32GetProcessMemoryInfo) in
+// Windows 7.  Before that, it's only in psapi.dll.
+GetProcessMemoryInfoFn *getProcessMemoryInfoFn() {
+    static GetProcessMemoryInfoFn *const ret = []() {
+        FARPROC proc = GetProcAddress(GetModuleHandleW(L"kernel32.dll"),
+                                      "K32GetProcessMemoryInfo");
+        if (proc == nullptr) {
+            HMODULE psapi = LoadLibraryW(L"psapi.dll");
+            if (psapi != nullptr) {
+                proc = GetProcAddress(psapi, "GetProcessMemoryInfo");
+            }
+        }
+        return reinterpret_cast<GetProcessMemoryInfoFn*>(proc);
+    }();
+    return ret;
+}
+
+struct Workload {
+    std::string name;
+    std::wstring program;
+    std::wstring cmdline;
+};
+
+// The columns reported for each workload, in KiB per session.
+enum Column {
+    kPrivate,
+    kWorkingSet,
+    kLines,
+    kReadBuffers,
+    kPipes,
+    kInputMap,
+    kTrace,
+    kOther,
+    kColumnCount,
+};
+
+const char *const kColumnNames[kColumnCount] = {
+    "private", "ws", "lines", "reads", "pipes", "input", "trace", "other",
+};
+
+struct Session {
+    winpty_t *pty = nullptr;
+    HANDLE conout = nullptr;
+    HANDLE conerr = nullptr;
+};
+
+// The output pipes are kept open, but not read.  An idle prompt's output is
+// far smaller than the pipe buffer, so the agent never blocks on them.
+bool openSession(Session &session, const Workload &workload, UINT64 flags) {
+    auto agentCfg = winpty_config_new(flags, nullptr);
+    if (agentCfg == nullptr) {
+        return false;
+    }
+    winpty_config_set_initial_size(agentCfg, kCols, kRows);
+    session.pty = winpty_open(agentCfg, nullptr);
+    winpty_config_free(agentCfg);
+    if (session.pty == nullptr) {
+        return false;
+    }
+    session.conout = openPipe(winpty_conout_name(session.pty));
+    session.conerr = openPipe(winpty_conerr_name(session.pty));
+    auto spawnCfg = winpty_spawn_config_new(
+            WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN,
+            workload.program.c_str(), workload.cmdline.c_str(),
+            nullptr, nullptr, nullptr);
+    benchCheck(spawnCfg != nullptr, "winpty_spawn_config_new failed");
+    const BOOL ret = winpty_spawn(
+        session.pty, spawnCfg, nullptr, nullptr, nullptr, nullptr);
+    winpty_spawn_config_free(spawnCfg);
+    return ret != FALSE;
+}
+
+void closeSession(Session &session) {
+    if (session.pty != nullptr) {
+        winpty_free(session.pty);
+    }
+    if (session.conout != nullptr) {
+        CloseHandle(session.conout);
+    }
+    if (session.conerr != nullptr) {
+        CloseHandle(session.conerr);
+    }
+}
+
+// Adds the session's sample to total, in bytes.
+bool sampleSession(Session &session, int64_t (&total)[kColumnCount]) {
+    MemoryCounters counters = {};
+    counters.cb = sizeof(counters);
+    GetProcessMemoryInfoFn *const getMemoryInfo = getProcessMemoryInfoFn();
+    if (getMemoryInfo == nullptr ||
+            !getMemoryInfo(winpty_agent_process(session.pty),
+                           &counters, sizeof(counters))) {
+        return false;
+    }
+    INT64 stats[WINPTY_STAT_COUNT] = {};
+    if (winpty_get_stats(session.pty, stats, WINPTY_STAT_COUNT,
+                         nullptr) < 0) {
+        return false;
+    }
+    int64_t sample[kColumnCount] = {};
+    sample[kPrivate] = counters.PrivateUsage;
+    sample[kWorkingSet] = counters.WorkingSetSize;
+    sample[kLines] = stats[WINPTY_STAT_LINE_MEMORY_BYTES];
+    sample[kReadBuffers] = stats[WINPTY_STAT_READ_BUFFER_MEMORY_BYTES];
+    sample[kPipes] = stats[WINPTY_STAT_PIPE_MEMORY_BYTES];
+    sample[kInputMap] = stats[WINPTY_STAT_INPUT_MAP_MEMORY_BYTES];
+    sample[kTrace] = stats[WINPTY_STAT_TRACE_MEMORY_BYTES];
+    sample[kOther] = sample[kPrivate] - sample[kLines] -
+        sample[kReadBuffers] - sample[kPipes] - sample[kInputMap] -
+        sample[kTrace];
+    for (int i = 0; i < kColumnCount; ++i) {
+        total[i] += sample[i];
+    }
+    return true;
+}
+
+bool runWorkload(const Workload &workload, int sessionCount, DWORD settleMs,
+                 UINT64 flags) {
+    std::vector<Session> sessions(sessionCount);
+    int failures = 0;
+    for (auto &session : sessions) {
+        if (!openSession(session, workload, flags)) {
+            ++failures;
+        }
+    }
+    Sleep(settleMs);
+
+    int64_t total[kColumnCount] = {};
+    int sampled = 0;
+    for (auto &session : sessions) {
+        if (session.pty == nullptr) {
+            continue;
+        }
+        if (sampleSession(session, total)) {
+            ++sampled;
+        } else {
+            ++failures;
+        }
+    }
+    for (auto &session : sessions) {
+        closeSession(session);
+    }
+
+    printf("%-10s %8d", workload.name.c_str(), sampled);
+    for (int i = 0; i < kColumnCount; ++i) {
+        printf(" %8.1f", sampled == 0 ? 0.0 :
+            static_cast<double>(total[i]) / sampled / 1024.0);
+    }
+    printf(" %8d\n", failures);
+    return failures == 0;
+}
+
+// Shows a window-sized screen buffer, as a full-screen program does, fills
+// it, and waits to be killed.
+void fullScreenChildMain() {
+    HANDLE conout = GetStdHandle(STD_OUTPUT_HANDLE);
+    CONSOLE_SCREEN_BUFFER_INFO info = {};
+    GetConsoleScreenBufferInfo(conout, &info);
+    const COORD size = {
+        static_cast<SHORT>(info.srWindow.Right - info.srWindow.Left + 1),
+        static_cast<SHORT>(info.srWindow.Bottom - info.srWindow.Top + 1),
+    };
+    HANDLE screen = CreateConsoleScreenBuffer(
+        GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr, CONSOLE_TEXTMODE_BUFFER, nullptr);
+    benchCheck(screen != INVALID_HANDLE_VALUE,
+               "CreateConsoleScreenBuffer failed");
+    SetConsoleScreenBufferSize(screen, size);
+    SetConsoleActiveScreenBuffer(screen);
+    std::vector<char> line(size.X, '.');
+    for (SHORT y = 0; y < size.Y; ++y) {
+        snprintf(line.data(), line.size(), "line %d", y);
+        line[strlen(line.data())] = ' ';
+        const COORD pos = { 0, y };
+        DWORD actual = 0;
+        WriteConsoleOutputCharacterA(screen, line.data(), size.X, pos,
+                                     &actual);
+    }
+    Sleep(INFINITE);
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (isChildRun(argc, argv)) {
+        fullScreenChildMain();
+        return 0;
+    }
+
+    int sessionCount = 20;
+    DWORD settleMs = 3000;
+    UINT64 flags = 0;
+    std::wstring bashPath;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-sessions") && i + 1 < argc) {
+            sessionCount = std::max(1, atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "-settle") && i + 1 < argc) {
+            settleMs = std::max(0, atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "-flags") && i + 1 < argc) {
+            flags = _strtoui64(argv[++i], nullptr, 16);
+        } else if (!strcmp(argv[i], "-bash") && i + 1 < argc) {
+            const char *const path = argv[++i];
+            bashPath.assign(path, path + strlen(path));
+        } else {
+            fprintf(stderr, "Error: unrecognized argument: '%s'\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if (getProcessMemoryInfoFn() == nullptr) {
+        fprintf(stderr, "Error: GetProcessMemoryInfo is missing\n");
+        return 1;
+    }
+
+    std::vector<Workload> workloads;
+    wchar_t comspec[MAX_PATH] = {};
+    if (GetEnvironmentVariableW(L"COMSPEC", comspec, MAX_PATH) == 0) {
+        wcscpy(comspec, L"C:\\Windows\\System32\\cmd.exe");
+    }
+    workloads.push_back({ "cmd", comspec, L"cmd.exe" });
+    if (!bashPath.empty()) {
+        workloads.push_back({ "bash", bashPath, L"bash --login -i" });
+    }
+    workloads.push_back({ "fullscreen", selfPath(), childCommandLine() });
+
+    printf("%-10s %8s", "workload", "sessions");
+    for (int i = 0; i < kColumnCount; ++i) {
+        printf(" %8s", kColumnNames[i]);
+    }
+    printf(" %8s\n", "failures");
+    bool success = true;
+    for (const auto &workload : workloads) {
+        success = runWorkload(workload, sessionCount, settleMs, flags) &&
+            success;
+    }
+    return success ? 0 : 1;
+}
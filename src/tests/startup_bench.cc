@@ -0,0 +1,258 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Measures how quickly sessions can be started and torn down.  Each session
+// is a winpty_open, a winpty_spawn of this program as a trivial child that
+// prints one line, a read of CONOUT (and CONERR) to EOF, and a winpty_free.
+// Each configuration runs its sessions serially on one thread and then spread
+// across several threads, and reports sessions per second along with the p50
+// and p99 time from the start of winpty_open to the return of winpty_spawn.
+//
+// The configurations cover the background desktop, created either by a
+// helper agent process (the default) or in this process
+// (WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION), with and without
+// WINPTY_FLAG_CONERR.  The desktop is only created on XP and Vista, so the
+// two desktop modes should match elsewhere.  With -pool, sessions are claimed
+// from a winpty_pool_t of N agents instead; the pool doesn't support
+// in-process desktop creation, so those configurations are skipped.
+//
+// Usage: startup_bench [-sessions N] [-threads N] [-pool N]
+
+#include <windows.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../include/winpty.h"
+
+#include "BenchUtil.h"
+
+namespace {
+
+struct Config {
+    const char *desktop;
+    const char *conerr;
+    UINT64 flags;
+};
+
+const Config kConfigs[] = {
+    { "helper",  "no",  0 },
+    { "helper",  "yes", WINPTY_FLAG_CONERR },
+    { "curproc", "no",  WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION },
+    { "curproc", "yes", WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION |
+                        WINPTY_FLAG_CONERR },
+};
+
+void drainPipe(HANDLE pipe) {
+    if (pipe == nullptr) {
+        return;
+    }
+    char buf[4096];
+    DWORD amount = 0;
+    while (ReadFile(pipe, buf, sizeof(buf), &amount, nullptr) &&
+            amount != 0) {
+    }
+    CloseHandle(pipe);
+}
+
+// The state shared by the threads of one run.
+struct Run {
+    const Config *config;
+    winpty_pool_t *pool;
+    int sessions;
+    std::wstring program;
+    std::wstring cmdline;
+    CRITICAL_SECTION lock;
+    int nextSession;
+    int failures;
+    std::vector<double> startupMs;
+};
+
+// Runs one session, returning its startup time in milliseconds, or -1.0 on
+// error.  CONOUT and CONERR are both connected before the spawn, then drained
+// one after the other.  The child writes nothing to CONERR, so reading CONOUT
+// first can't deadlock.
+double runSession(Run &run) {
+    const int64_t startTime = qpcValue();
+    winpty_t *pty = nullptr;
+    if (run.pool != nullptr) {
+        pty = winpty_pool_open(run.pool, kCols, kRows, nullptr);
+    } else {
+        auto agentCfg = winpty_config_new(run.config->flags, nullptr);
+        if (agentCfg == nullptr) {
+            return -1.0;
+        }
+        winpty_config_set_initial_size(agentCfg, kCols, kRows);
+        pty = winpty_open(agentCfg, nullptr);
+        winpty_config_free(agentCfg);
+    }
+    if (pty == nullptr) {
+        return -1.0;
+    }
+    HANDLE conout = openPipe(winpty_conout_name(pty));
+    HANDLE conerr = openPipe(winpty_conerr_name(pty));
+    auto spawnCfg = winpty_spawn_config_new(
+            WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN,
+            run.program.c_str(), run.cmdline.c_str(),
+            nullptr, nullptr, nullptr);
+    benchCheck(spawnCfg != nullptr, "winpty_spawn_config_new failed");
+    const BOOL spawnSuccess = winpty_spawn(
+        pty, spawnCfg, nullptr, nullptr, nullptr, nullptr);
+    winpty_spawn_config_free(spawnCfg);
+    const double ret = spawnSuccess ? qpcMs(qpcValue() - startTime) : -1.0;
+    if (spawnSuccess) {
+        drainPipe(conout);
+        drainPipe(conerr);
+    } else {
+        CloseHandle(conout);
+        if (conerr != nullptr) {
+            CloseHandle(conerr);
+        }
+    }
+    winpty_free(pty);
+    return ret;
+}
+
+DWORD WINAPI sessionThread(LPVOID param) {
+    Run &run = *static_cast<Run*>(param);
+    while (true) {
+        EnterCriticalSection(&run.lock);
+        const bool done = run.nextSession >= run.sessions;
+        ++run.nextSession;
+        LeaveCriticalSection(&run.lock);
+        if (done) {
+            return 0;
+        }
+        const double startupMs = runSession(run);
+        EnterCriticalSection(&run.lock);
+        if (startupMs < 0.0) {
+            ++run.failures;
+        } else {
+            run.startupMs.push_back(startupMs);
+        }
+        LeaveCriticalSection(&run.lock);
+    }
+}
+
+bool runConfig(const Config &config, int sessions, int threadCount,
+               int poolSize) {
+    Run run;
+    run.config = &config;
+    run.pool = nullptr;
+    run.sessions = sessions;
+    run.program = selfPath();
+    run.cmdline = childCommandLine();
+    InitializeCriticalSection(&run.lock);
+    run.nextSession = 0;
+    run.failures = 0;
+
+    if (poolSize > 0) {
+        auto agentCfg = winpty_config_new(config.flags, nullptr);
+        benchCheck(agentCfg != nullptr, "winpty_config_new failed");
+        winpty_config_set_initial_size(agentCfg, kCols, kRows);
+        run.pool = winpty_pool_new(agentCfg, poolSize, nullptr);
+        winpty_config_free(agentCfg);
+        if (run.pool == nullptr) {
+            fprintf(stderr, "Error: winpty_pool_new failed\n");
+            DeleteCriticalSection(&run.lock);
+            return false;
+        }
+    }
+
+    const int64_t startTime = qpcValue();
+    std::vector<HANDLE> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        HANDLE thread = CreateThread(
+            nullptr, 0, sessionThread, &run, 0, nullptr);
+        benchCheck(thread != nullptr, "CreateThread failed");
+        threads.push_back(thread);
+    }
+    for (HANDLE thread : threads) {
+        WaitForSingleObject(thread, INFINITE);
+        CloseHandle(thread);
+    }
+    const double elapsedMs = qpcMs(qpcValue() - startTime);
+
+    if (run.pool != nullptr) {
+        winpty_pool_free(run.pool);
+    }
+    DeleteCriticalSection(&run.lock);
+
+    std::sort(run.startupMs.begin(), run.startupMs.end());
+    printf("%-8s %-6s %7d %8d %10.1f %8.1f %8.1f %8d\n",
+           config.desktop, config.conerr, threadCount,
+           static_cast<int>(run.startupMs.size()),
+           run.startupMs.size() / (elapsedMs / 1000.0),
+           percentile(run.startupMs, 50),
+           percentile(run.startupMs, 99),
+           run.failures);
+    return run.failures == 0;
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (isChildRun(argc, argv)) {
+        printf("hello\n");
+        return 0;
+    }
+
+    int sessions = 50;
+    int threadCount = 4;
+    int poolSize = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-sessions") && i + 1 < argc) {
+            sessions = std::max(1, atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "-threads") && i + 1 < argc) {
+            threadCount = std::max(1, atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "-pool") && i + 1 < argc) {
+            poolSize = std::max(0, atoi(argv[++i]));
+        } else {
+            fprintf(stderr, "Error: unrecognized argument: '%s'\n", argv[i]);
+            return 1;
+        }
+    }
+
+    printf("%-8s %-6s %7s %8s %10s %8s %8s %8s\n",
+           "desktop", "conerr", "threads", "sessions", "sessions/s",
+           "p50-ms", "p99-ms", "failures");
+    bool success = true;
+    for (const auto &config : kConfigs) {
+        if (poolSize > 0 &&
+                (config.flags & WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION)) {
+            continue;
+        }
+        // In-process desktop creation changes this process' window station,
+        // so those sessions can't safely start on several threads at once.
+        const bool curproc =
+            (config.flags & WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION) != 0;
+        success = runConfig(config, sessions, 1, poolSize) && success;
+        if (threadCount > 1 && !curproc) {
+            success = runConfig(config, sessions, threadCount, poolSize) &&
+                success;
+        }
+    }
+    return success ? 0 : 1;
+}
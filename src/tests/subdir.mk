@@ -22,7 +22,20 @@ build/%.exe : src/tests/%.cc build/winpty.dll
 	$(info Building $@)
 	@$(MINGW_CXX) $(MINGW_CXXFLAGS) $(MINGW_LDFLAGS) -o $@ $^
 
+# The benchmarks also compile BenchUtil.cc.
+BENCH_PROGRAMS = \
+        build/echo_latency_bench.exe \
+        build/memory_bench.exe \
+        build/startup_bench.exe \
+        build/throughput_bench.exe
+
+$(BENCH_PROGRAMS) : src/tests/BenchUtil.cc
+
 TEST_PROGRAMS = \
+        build/echo_latency_bench.exe \
+        build/memory_bench.exe \
+        build/startup_bench.exe \
+        build/throughput_bench.exe \
         build/trivial_test.exe
 
 -include $(TEST_PROGRAMS:.exe=.d)
@@ -0,0 +1,383 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Measures how quickly console output makes it through the agent.  Each
+// workload runs this program again as a child inside a new winpty_t; the
+// parent reads CONOUT to EOF and reports:
+//  - CONOUT bytes and MB/s, from the spawn to EOF
+//  - the delay until the first CONOUT byte
+//  - the agent's CPU time and console freezes
+//  - CONOUT bytes per console cell the child wrote
+// The "latency" workload instead writes timestamped lines at intervals and
+// reports the delay until each line appears on CONOUT.
+//
+// Usage: throughput_bench [-flags HEX] [-scale N] [WORKLOAD...]
+// The workloads are bulk, color, cjk, repaint, progress, and latency.  With
+// no workload arguments, all of them run.  -flags passes WINPTY_FLAG_xxx bits
+// to winpty_config_new, e.g. to compare scraping options.
+
+#include <windows.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../include/winpty.h"
+
+#include "BenchUtil.h"
+
+namespace {
+
+const int kLatencySamples = 50;
+const DWORD kLatencyIntervalMs = 20;
+
+const char *const kWorkloads[] = {
+    "bulk", "color", "cjk", "repaint", "progress", "latency",
+};
+
+// A run of text written with one attribute.  If `home` is set, the cursor
+// moves to the top-left of the window first.
+struct Segment {
+    WORD attr;
+    bool home;
+    std::wstring text;
+};
+
+void addSegment(std::vector<Segment> &out, WORD attr, bool home,
+                const std::wstring &text) {
+    Segment seg;
+    seg.attr = attr;
+    seg.home = home;
+    seg.text = text;
+    out.push_back(seg);
+}
+
+// Generates the output for a workload.  The child writes it, and the parent
+// generates it again to count the cells written.
+std::vector<Segment> makeWorkload(const std::string &name, int scale) {
+    std::vector<Segment> ret;
+    if (name == "bulk") {
+        std::wstring chunk;
+        for (int line = 0; line < 1000 * scale; ++line) {
+            wchar_t buf[kCols + 8];
+            for (int i = 0; i < kCols - 1; ++i) {
+                buf[i] = L'!' + (line + i) % 94;
+            }
+            buf[kCols - 1] = L'\0';
+            chunk += buf;
+            chunk += L"\r\n";
+            if (chunk.size() >= 8192) {
+                addSegment(ret, 7, false, chunk);
+                chunk.clear();
+            }
+        }
+        addSegment(ret, 7, false, chunk);
+    } else if (name == "color") {
+        for (int line = 0; line < 1000 * scale; ++line) {
+            for (int word = 0; word < 8; ++word) {
+                const WORD attr = static_cast<WORD>(
+                    (1 + (line + word) % 15) | ((word % 2) ? 0 : 0x10));
+                addSegment(ret, attr, false, L"colored ");
+            }
+            addSegment(ret, 7, false, L"text\r\n");
+        }
+    } else if (name == "cjk") {
+        std::wstring chunk;
+        for (int line = 0; line < 1000 * scale; ++line) {
+            for (int i = 0; i < kCols / 2 - 1; ++i) {
+                chunk.push_back(
+                    static_cast<wchar_t>(0x4E00 + (line + i) % 2000));
+            }
+            chunk += L"\r\n";
+            if (chunk.size() >= 8192) {
+                addSegment(ret, 7, false, chunk);
+                chunk.clear();
+            }
+        }
+        addSegment(ret, 7, false, chunk);
+    } else if (name == "repaint") {
+        for (int frame = 0; frame < 50 * scale; ++frame) {
+            std::wstring screen;
+            for (int row = 0; row < kRows - 1; ++row) {
+                for (int col = 0; col < kCols; ++col) {
+                    screen.push_back(L'A' + (frame + row + col) % 26);
+                }
+            }
+            addSegment(ret, static_cast<WORD>(1 + frame % 15), true, screen);
+        }
+    } else if (name == "progress") {
+        const int steps = 2000 * scale;
+        for (int step = 0; step <= steps; ++step) {
+            const int filled = step * 50 / steps;
+            wchar_t buf[80];
+            swprintf(buf, 80, L"\r[%-50ls] %3d%%",
+                     std::wstring(filled, L'#').c_str(), step * 100 / steps);
+            addSegment(ret, 7, false, buf);
+        }
+        addSegment(ret, 7, false, L"\r\n");
+    }
+    return ret;
+}
+
+int64_t countCells(const std::vector<Segment> &segments) {
+    int64_t ret = 0;
+    for (const auto &seg : segments) {
+        for (wchar_t ch : seg.text) {
+            if (ch == L'\r' || ch == L'\n') {
+                continue;
+            }
+            ret += (ch >= 0x4E00 && ch <= 0x9FFF) ? 2 : 1;
+        }
+    }
+    return ret;
+}
+
+double fileTimeMs(const FILETIME &ft) {
+    ULARGE_INTEGER value;
+    value.LowPart = ft.dwLowDateTime;
+    value.HighPart = ft.dwHighDateTime;
+    return static_cast<double>(value.QuadPart) / 10000.0;
+}
+
+void childMain(const std::string &name, int scale) {
+    HANDLE conout = GetStdHandle(STD_OUTPUT_HANDLE);
+    if (name == "latency") {
+        for (int i = 0; i < kLatencySamples; ++i) {
+            Sleep(kLatencyIntervalMs);
+            wchar_t buf[64];
+            swprintf(buf, 64, L"LAT %d %lld\r\n", i,
+                     static_cast<long long>(qpcValue()));
+            writeConsole(conout, buf);
+        }
+        return;
+    }
+    for (const auto &seg : makeWorkload(name, scale)) {
+        SetConsoleTextAttribute(conout, seg.attr);
+        if (seg.home) {
+            CONSOLE_SCREEN_BUFFER_INFO info = {};
+            GetConsoleScreenBufferInfo(conout, &info);
+            COORD pos = { 0, info.srWindow.Top };
+            SetConsoleCursorPosition(conout, pos);
+        }
+        writeConsole(conout, seg.text);
+    }
+    SetConsoleTextAttribute(conout, 7);
+}
+
+// Parses the "LAT <seq> <qpc>" lines the latency child writes.  A line can be
+// split across reads, or repeated when the agent redraws the window, so only
+// complete lines with a new sequence number count.
+class LatencyScanner {
+public:
+    void feed(const char *data, size_t size, int64_t now) {
+        m_text.append(data, size);
+        while (true) {
+            const size_t pos = m_text.find("LAT ", m_scanPos);
+            if (pos == std::string::npos) {
+                m_scanPos = m_text.size() > 3 ? m_text.size() - 3 : 0;
+                return;
+            }
+            const char *start = m_text.c_str() + pos + 4;
+            char *end = nullptr;
+            const long seq = strtol(start, &end, 10);
+            if (end == start || *end != ' ') {
+                if (*end == '\0') {
+                    m_scanPos = pos;
+                    return;
+                }
+                m_scanPos = pos + 4;
+                continue;
+            }
+            const char *stampStart = end + 1;
+            const long long stamp = strtoll(stampStart, &end, 10);
+            if (*end == '\0') {
+                // The number may continue in the next read.
+                m_scanPos = pos;
+                return;
+            }
+            m_scanPos = end - m_text.c_str();
+            if (end != stampStart && seq > m_lastSeq) {
+                m_lastSeq = seq;
+                m_samples.push_back(qpcMs(now - stamp));
+            }
+        }
+    }
+    const std::vector<double> &samples() const { return m_samples; }
+
+private:
+    std::string m_text;
+    size_t m_scanPos = 0;
+    long m_lastSeq = -1;
+    std::vector<double> m_samples;
+};
+
+bool runWorkload(const std::string &name, int scale, DWORD agentFlags) {
+    const std::wstring program = selfPath();
+    wchar_t args[64];
+    swprintf(args, 64, L"%hs %d", name.c_str(), scale);
+    const std::wstring cmdline = childCommandLine(args);
+
+    auto agentCfg = winpty_config_new(agentFlags, nullptr);
+    if (agentCfg == nullptr) {
+        fprintf(stderr, "Error: winpty_config_new failed\n");
+        return false;
+    }
+    winpty_config_set_initial_size(agentCfg, kCols, kRows);
+    auto pty = winpty_open(agentCfg, nullptr);
+    winpty_config_free(agentCfg);
+    if (pty == nullptr) {
+        fprintf(stderr, "Error: winpty_open failed\n");
+        return false;
+    }
+    HANDLE conout = openPipe(winpty_conout_name(pty));
+
+    auto spawnCfg = winpty_spawn_config_new(
+            WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN, program.c_str(), cmdline.c_str(),
+            nullptr, nullptr, nullptr);
+    benchCheck(spawnCfg != nullptr, "winpty_spawn_config_new failed");
+    HANDLE process = nullptr;
+    const int64_t startTime = qpcValue();
+    const BOOL spawnSuccess = winpty_spawn(
+        pty, spawnCfg, &process, nullptr, nullptr, nullptr);
+    winpty_spawn_config_free(spawnCfg);
+    if (!spawnSuccess) {
+        fprintf(stderr, "Error: winpty_spawn failed\n");
+        CloseHandle(conout);
+        winpty_free(pty);
+        return false;
+    }
+
+    LatencyScanner latency;
+    int64_t totalBytes = 0;
+    int64_t firstByteTime = -1;
+    char buf[64 * 1024];
+    while (true) {
+        DWORD amount = 0;
+        if (!ReadFile(conout, buf, sizeof(buf), &amount, nullptr) ||
+                amount == 0) {
+            break;
+        }
+        const int64_t now = qpcValue();
+        if (firstByteTime == -1) {
+            firstByteTime = now;
+        }
+        totalBytes += amount;
+        if (name == "latency") {
+            latency.feed(buf, amount, now);
+        }
+    }
+    const double elapsedMs = qpcMs(qpcValue() - startTime);
+
+    INT64 freezeStats[WINPTY_FREEZE_STAT_COUNT] = {};
+    const bool haveFreezeStats = winpty_get_freeze_stats(
+        pty, freezeStats, WINPTY_FREEZE_STAT_COUNT, nullptr) >= 0;
+    FILETIME createTime, exitTime, kernelTime, userTime;
+    double agentCpuMs = -1.0;
+    if (GetProcessTimes(winpty_agent_process(pty),
+                        &createTime, &exitTime, &kernelTime, &userTime)) {
+        agentCpuMs = fileTimeMs(kernelTime) + fileTimeMs(userTime);
+    }
+
+    printf("%-9s %10lld %8.1f %7.2f %8.1f %9.1f",
+           name.c_str(),
+           static_cast<long long>(totalBytes),
+           elapsedMs,
+           totalBytes / (elapsedMs / 1000.0) / (1024.0 * 1024.0),
+           firstByteTime == -1
+               ? -1.0 : qpcMs(firstByteTime - startTime),
+           agentCpuMs);
+    if (haveFreezeStats) {
+        printf(" %7lld %9.1f",
+               static_cast<long long>(freezeStats[WINPTY_FREEZE_STAT_FREEZES]),
+               freezeStats[WINPTY_FREEZE_STAT_TOTAL_US] / 1000.0);
+    } else {
+        printf(" %7s %9s", "-", "-");
+    }
+    if (name == "latency") {
+        const auto &samples = latency.samples();
+        double sum = 0.0;
+        double maxValue = 0.0;
+        for (double value : samples) {
+            sum += value;
+            maxValue = std::max(maxValue, value);
+        }
+        printf("  latency avg %.1fms max %.1fms (%d/%d lines)\n",
+               samples.empty() ? 0.0 : sum / samples.size(), maxValue,
+               static_cast<int>(samples.size()), kLatencySamples);
+    } else {
+        const int64_t cells = countCells(makeWorkload(name, scale));
+        printf("  %.2f bytes/cell\n",
+               cells == 0 ? 0.0 : static_cast<double>(totalBytes) / cells);
+    }
+
+    CloseHandle(process);
+    CloseHandle(conout);
+    winpty_free(pty);
+    return true;
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[]) {
+    if (isChildRun(argc, argv) && argc == 4) {
+        childMain(argv[2], atoi(argv[3]));
+        return 0;
+    }
+
+    DWORD agentFlags = 0;
+    int scale = 1;
+    std::vector<std::string> workloads;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-flags") && i + 1 < argc) {
+            agentFlags = strtoul(argv[++i], nullptr, 16);
+        } else if (!strcmp(argv[i], "-scale") && i + 1 < argc) {
+            scale = std::max(1, atoi(argv[++i]));
+        } else {
+            bool known = false;
+            for (const char *name : kWorkloads) {
+                known = known || !strcmp(argv[i], name);
+            }
+            if (!known) {
+                fprintf(stderr, "Error: unrecognized argument: '%s'\n",
+                        argv[i]);
+                return 1;
+            }
+            workloads.push_back(argv[i]);
+        }
+    }
+    if (workloads.empty()) {
+        workloads.assign(std::begin(kWorkloads), std::end(kWorkloads));
+    }
+
+    printf("%-9s %10s %8s %7s %8s %9s %7s %9s\n",
+           "workload", "bytes", "ms", "MB/s", "first-ms", "agent-ms",
+           "freezes", "freeze-ms");
+    bool success = true;
+    for (const auto &name : workloads) {
+        success = runWorkload(name, scale, agentFlags) && success;
+    }
+    return success ? 0 : 1;
+}
@@ -0,0 +1,246 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Checks each vector kernel behind CharInfoScan against the generic one.
+// Every scan runs at the generic level and then at each vector level the
+// processor supports, over lengths that cover a kernel's block loop and its
+// tail, starting at every cell offset within a 32-byte block.
+
+#include "../agent/CharInfoScan.h"
+
+#include <windows.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "UnitTest.h"
+
+int g_unitTestFailures = 0;
+
+namespace {
+
+const int kMaxLength = 80;
+const int kMaxOffset = 8;
+const int kTrials = 4;
+
+const CpuLevel kVectorLevels[] = { CpuLevel::Sse2, CpuLevel::Avx2 };
+
+uint64_t g_rngState = 0xD1B54A32D192ED03ull;
+
+uint32_t nextRandom() {
+    g_rngState ^= g_rngState >> 12;
+    g_rngState ^= g_rngState << 25;
+    g_rngState ^= g_rngState >> 27;
+    return static_cast<uint32_t>((g_rngState * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+CHAR_INFO makeCell(WCHAR ch, WORD attributes) {
+    CHAR_INFO ret;
+    ret.Char.UnicodeChar = ch;
+    ret.Attributes = attributes;
+    return ret;
+}
+
+// Characters and attributes from a small set, so that random cells often
+// match, with the occasional high bit in either half.
+CHAR_INFO randomCell() {
+    const uint32_t r = nextRandom();
+    const WCHAR ch = (r & 0x100)
+        ? static_cast<WCHAR>(0x20 + r % 4)
+        : static_cast<WCHAR>(r >> 16);
+    const WORD attributes = (r & 0x200)
+        ? static_cast<WORD>(7 + ((r >> 10) & 1) * 0x8000)
+        : static_cast<WORD>(r >> 12);
+    return makeCell(ch, attributes);
+}
+
+std::vector<uint32_t> lineBits(const CHAR_INFO *line, int length) {
+    std::vector<uint32_t> ret(length);
+    for (int i = 0; i < length; ++i) {
+        memcpy(&ret[i], &line[i], sizeof(ret[i]));
+    }
+    return ret;
+}
+
+// Changes one random cell, or none, so the first difference lands anywhere
+// in the line or past its end.
+void perturb(CHAR_INFO *line, int length) {
+    const int index = static_cast<int>(nextRandom() % (length + 1));
+    if (index == length) {
+        return;
+    }
+    if (nextRandom() & 1) {
+        line[index].Char.UnicodeChar ^=
+            static_cast<WCHAR>(1 << (nextRandom() % 16));
+    } else {
+        line[index].Attributes ^= static_cast<WORD>(1 << (nextRandom() % 16));
+    }
+}
+
+// Runs the scan at the generic level, then at each vector level the
+// processor has, and checks that every level gets the same result.
+template <typename Scan>
+void checkAgainstGeneric(Scan scan) {
+    charInfoScanUseCpuLevel(CpuLevel::Generic);
+    const auto expected = scan();
+    for (CpuLevel level : kVectorLevels) {
+        if (charInfoScanUseCpuLevel(level) == level) {
+            CHECK(scan() == expected);
+        }
+    }
+}
+
+// Calls the test for every length and offset, a few times each, with a
+// line at that offset into a zeroed buffer.
+template <typename Test>
+void forEachLine(Test test) {
+    std::vector<CHAR_INFO> buffer(kMaxOffset + kMaxLength);
+    for (int length = 0; length <= kMaxLength; ++length) {
+        for (int offset = 0; offset < kMaxOffset; ++offset) {
+            for (int trial = 0; trial < kTrials; ++trial) {
+                memset(buffer.data(), 0, buffer.size() * sizeof(CHAR_INFO));
+                test(buffer.data() + offset, length);
+            }
+        }
+    }
+}
+
+void testFirstDifference() {
+    forEachLine([](CHAR_INFO *line, int length) {
+        std::vector<CHAR_INFO> other(length + 1);
+        for (int i = 0; i < length; ++i) {
+            line[i] = randomCell();
+            other[i] = line[i];
+        }
+        perturb(other.data(), length);
+        checkAgainstGeneric([&]() {
+            return charInfoFirstDifference(line, other.data(), length);
+        });
+        checkAgainstGeneric([&]() {
+            return charInfoLinesEqual(line, other.data(), length);
+        });
+    });
+}
+
+void testLineBlank() {
+    forEachLine([](CHAR_INFO *line, int length) {
+        const WORD attributes = static_cast<WORD>(nextRandom());
+        for (int i = 0; i < length; ++i) {
+            line[i] = makeCell(L' ', attributes);
+        }
+        perturb(line, length);
+        checkAgainstGeneric([&]() {
+            return charInfoLineBlank(line, length, attributes);
+        });
+    });
+}
+
+void testLineHash() {
+    forEachLine([](CHAR_INFO *line, int length) {
+        for (int i = 0; i < length; ++i) {
+            line[i] = randomCell();
+        }
+        checkAgainstGeneric([&]() {
+            return charInfoLineHash(line, length);
+        });
+    });
+}
+
+void testFirstRunDifference() {
+    forEachLine([](CHAR_INFO *line, int length) {
+        const WORD attributes = static_cast<WORD>(nextRandom());
+        std::vector<WCHAR> text(length + 1);
+        for (int i = 0; i < length; ++i) {
+            text[i] = randomCell().Char.UnicodeChar;
+            line[i] = makeCell(text[i], attributes);
+        }
+        perturb(line, length);
+        checkAgainstGeneric([&]() {
+            return charInfoFirstRunDifference(
+                line, text.data(), length, attributes);
+        });
+    });
+}
+
+void testNarrowAscii() {
+    forEachLine([](CHAR_INFO *line, int length) {
+        const WORD attributes = static_cast<WORD>(nextRandom());
+        for (int i = 0; i < length; ++i) {
+            line[i] = makeCell(
+                static_cast<WCHAR>(0x20 + nextRandom() % 0x5F), attributes);
+        }
+        perturb(line, length);
+        checkAgainstGeneric([&]() {
+            std::string out(length, '\0');
+            const int count =
+                charInfoNarrowAscii(line, length, attributes, &out[0]);
+            out.resize(count);
+            return std::make_pair(count, out);
+        });
+    });
+}
+
+// The bits are usually clear everywhere, so that one cell setting them is
+// the whole answer.
+void testAnyAttributes() {
+    forEachLine([](CHAR_INFO *line, int length) {
+        const WORD bits = static_cast<WORD>(1 << (nextRandom() % 16));
+        for (int i = 0; i < length; ++i) {
+            line[i] = randomCell();
+            line[i].Attributes &= static_cast<WORD>(~bits);
+        }
+        perturb(line, length);
+        checkAgainstGeneric([&]() {
+            return charInfoAnyAttributes(line, length, bits);
+        });
+    });
+}
+
+// Each level masks its own copy, and the cells past the end must survive.
+void testMaskAttributes() {
+    forEachLine([](CHAR_INFO *line, int length) {
+        const WORD mask = static_cast<WORD>(nextRandom());
+        for (int i = 0; i < length; ++i) {
+            line[i] = randomCell();
+        }
+        checkAgainstGeneric([&]() {
+            std::vector<CHAR_INFO> copy(line, line + length);
+            copy.push_back(makeCell(0xFFFF, 0xFFFF));
+            charInfoMaskAttributes(copy.data(), length, mask);
+            return lineBits(copy.data(), length + 1);
+        });
+    });
+}
+
+} // anonymous namespace
+
+int main() {
+    testFirstDifference();
+    testLineBlank();
+    testLineHash();
+    testFirstRunDifference();
+    testNarrowAscii();
+    testAnyAttributes();
+    testMaskAttributes();
+    return unitTestResult("CharInfoScanTest");
+}
@@ -0,0 +1,146 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Checks that ConsoleChangeTracker never loses a change, in particular one
+// made while a scrape is reading the buffer, and that the agent's own freeze
+// doesn't keep the console dirty.
+
+#include "../agent/ConsoleChangeTracker.h"
+
+#include <windows.h>
+#include <limits.h>
+
+#include "UnitTest.h"
+
+int g_unitTestFailures = 0;
+
+namespace {
+
+const LONG kCaretSelection = 0x1;
+const LONG kCaretVisible = 0x2;
+
+void updateRegion(ConsoleChangeTracker &tracker,
+                  int left, int top, int right, int bottom)
+{
+    tracker.noteEvent(EVENT_CONSOLE_UPDATE_REGION,
+                      MAKELONG(left, top), MAKELONG(right, bottom));
+}
+
+void testInitiallyDirty()
+{
+    ConsoleChangeTracker tracker;
+    CHECK(tracker.dirty());
+    const ConsoleChangeTracker::Changes changes = tracker.take();
+    CHECK(changes.dirty);
+    CHECK(changes.firstRow == -1);
+    CHECK(!tracker.dirty());
+    CHECK(!tracker.take().dirty);
+}
+
+void testRegionBounds()
+{
+    ConsoleChangeTracker tracker;
+    tracker.take();
+    updateRegion(tracker, 4, 10, 20, 12);
+    updateRegion(tracker, 2, 15, 8, 15);
+    tracker.noteEvent(EVENT_CONSOLE_UPDATE_SIMPLE, MAKELONG(30, 11), 'x');
+    const ConsoleChangeTracker::Changes changes = tracker.take();
+    CHECK(changes.dirty);
+    CHECK(changes.firstRow == 10);
+    CHECK(changes.lastRow == 15);
+    CHECK(changes.firstColumn == 2);
+    CHECK(changes.lastColumn == 31);
+}
+
+void testScrollDirtiesEverything()
+{
+    ConsoleChangeTracker tracker;
+    tracker.take();
+    updateRegion(tracker, 0, 5, 79, 5);
+    tracker.noteEvent(EVENT_CONSOLE_UPDATE_SCROLL, 0, -1);
+    updateRegion(tracker, 0, 6, 79, 6);
+    const ConsoleChangeTracker::Changes changes = tracker.take();
+    CHECK(changes.dirty);
+    CHECK(changes.firstRow == -1);
+}
+
+// A scrape takes the changes, then reads the buffer.  A row the child writes
+// during the read must show up in the next take, even though its event
+// arrives before the scrape finishes.
+void testWriteDuringScrape()
+{
+    ConsoleChangeTracker tracker;
+    tracker.take();
+
+    updateRegion(tracker, 0, 3, 79, 3);
+    ConsoleChangeTracker::Changes changes = tracker.take();
+    CHECK(changes.firstRow == 3 && changes.lastRow == 3);
+
+    // The scrape is reading rows 3 and below when row 20 is written.
+    updateRegion(tracker, 0, 20, 9, 20);
+    CHECK(tracker.dirty());
+
+    changes = tracker.take();
+    CHECK(changes.dirty);
+    CHECK(changes.firstRow == 20);
+    CHECK(changes.lastRow == 20);
+    CHECK(changes.firstColumn == 0);
+    CHECK(changes.lastColumn == 9);
+
+    // A write above the previous hint is not hidden by it either.
+    updateRegion(tracker, 0, 1, 79, 1);
+    changes = tracker.take();
+    CHECK(changes.firstRow == 1);
+}
+
+// The agent freezes the console by selecting, which raises selection caret
+// events and may hide and restore the cursor.  None of that is output.
+void testFreezeIsNotAChange()
+{
+    ConsoleChangeTracker tracker;
+    tracker.noteEvent(EVENT_CONSOLE_CARET, kCaretVisible, MAKELONG(5, 7));
+    tracker.take();
+
+    CHECK(!tracker.noteEvent(EVENT_CONSOLE_CARET,
+                             kCaretSelection | kCaretVisible, 0));
+    tracker.noteEvent(EVENT_CONSOLE_CARET, 0, MAKELONG(5, 7));
+    CHECK(tracker.dirty());
+    tracker.noteEvent(EVENT_CONSOLE_CARET, kCaretVisible, MAKELONG(5, 7));
+    CHECK(!tracker.dirty());
+    CHECK(!tracker.take().dirty);
+
+    // A real cursor move is a change, without any modified rows.
+    tracker.noteEvent(EVENT_CONSOLE_CARET, kCaretVisible, MAKELONG(6, 7));
+    const ConsoleChangeTracker::Changes changes = tracker.take();
+    CHECK(changes.dirty);
+    CHECK(changes.firstRow == INT_MAX);
+}
+
+} // anonymous namespace
+
+int main()
+{
+    testInitiallyDirty();
+    testRegionBounds();
+    testScrollDirtiesEverything();
+    testWriteDuringScrape();
+    testFreezeIsNotAChange();
+    return unitTestResult("ConsoleChangeTrackerTest");
+}
@@ -0,0 +1,207 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Round-trips randomized inputs through the WINPTY_FLAG_COMPRESSED_OUTPUT
+// framing: empty input, incompressible bytes, repetitive terminal-like text,
+// matches near the LZ4 window limit, and inputs spanning several frames, each
+// decoded from randomly split pieces.
+
+#include "../shared/OutputCompression.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+#include "UnitTest.h"
+
+int g_unitTestFailures = 0;
+
+namespace {
+
+using namespace OutputCompression;
+
+// xorshift64*, so that every run checks the same inputs.
+uint64_t g_rngState = 0x9E3779B97F4A7C15ull;
+
+uint32_t nextRandom() {
+    g_rngState ^= g_rngState >> 12;
+    g_rngState ^= g_rngState << 25;
+    g_rngState ^= g_rngState >> 27;
+    return static_cast<uint32_t>((g_rngState * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+size_t randomBelow(size_t limit) {
+    return limit == 0 ? 0 : nextRandom() % limit;
+}
+
+std::string randomBytes(size_t size) {
+    std::string ret(size, '\0');
+    for (char &ch : ret) {
+        ch = static_cast<char>(nextRandom());
+    }
+    return ret;
+}
+
+// Lines of escape sequences and text drawn from a small vocabulary, like a
+// scraper's output.
+std::string terminalText(size_t size) {
+    static const char *const kPieces[] = {
+        "\x1b[0m", "\x1b[1;32m", "\x1b[K", "\r\n", "    ", "ls -la ",
+        "drwxr-xr-x ", "winpty ", "0123456789", "\x1b[25;1H",
+    };
+    const size_t pieceCount = sizeof(kPieces) / sizeof(kPieces[0]);
+    std::string ret;
+    while (ret.size() < size) {
+        ret += kPieces[randomBelow(pieceCount)];
+    }
+    ret.resize(size);
+    return ret;
+}
+
+// Random blocks repeated at distances around the 64KiB match window.
+std::string farRepeats(size_t size) {
+    const std::string block = randomBytes(4096);
+    std::string ret = randomBytes(65535 - 2048);
+    while (ret.size() < size) {
+        ret += block;
+        ret += randomBytes(randomBelow(64));
+    }
+    ret.resize(size);
+    return ret;
+}
+
+// Encodes the input, decodes it from randomly sized pieces, and returns the
+// decoded data.
+std::string roundTrip(const std::string &input, std::string *encodedOut) {
+    std::string encoded;
+    appendFrames(input.data(), input.size(), encoded);
+    Decoder decoder;
+    std::string ret;
+    size_t pos = 0;
+    while (pos < encoded.size()) {
+        const size_t piece =
+            std::min(encoded.size() - pos, 1 + randomBelow(3000));
+        CHECK(decoder.write(encoded.data() + pos, piece));
+        pos += piece;
+        char buf[1024];
+        while (size_t n = decoder.read(buf, randomBelow(sizeof(buf)) + 1)) {
+            ret.append(buf, n);
+        }
+    }
+    CHECK(decoder.available() == 0);
+    if (encodedOut != nullptr) {
+        *encodedOut = encoded;
+    }
+    return ret;
+}
+
+void testEmpty() {
+    std::string encoded;
+    CHECK(roundTrip(std::string(), &encoded).empty());
+    CHECK(encoded.empty());
+}
+
+void testIncompressible() {
+    for (int iter = 0; iter < 200; ++iter) {
+        const std::string input = randomBytes(1 + randomBelow(5000));
+        std::string encoded;
+        CHECK(roundTrip(input, &encoded) == input);
+        // Stored frames cost only their header.
+        CHECK(encoded.size() == input.size() + kFrameHeaderSize);
+    }
+}
+
+void testCompressible() {
+    for (int iter = 0; iter < 200; ++iter) {
+        const size_t size = randomBelow(20000);
+        const std::string input = iter % 2 == 0
+            ? terminalText(size)
+            : std::string(size, static_cast<char>(nextRandom()));
+        std::string encoded;
+        CHECK(roundTrip(input, &encoded) == input);
+        if (size >= 1000) {
+            CHECK(encoded.size() < input.size() / 2);
+        }
+    }
+}
+
+void testShortInputs() {
+    // Every size around the LZ4 end-of-block rules, with and without
+    // repeats.
+    for (size_t size = 1; size <= 64; ++size) {
+        const std::string zeros(size, '\0');
+        CHECK(roundTrip(zeros, nullptr) == zeros);
+        const std::string text = terminalText(size);
+        CHECK(roundTrip(text, nullptr) == text);
+        const std::string bytes = randomBytes(size);
+        CHECK(roundTrip(bytes, nullptr) == bytes);
+    }
+}
+
+void testFarMatches() {
+    for (int iter = 0; iter < 10; ++iter) {
+        const std::string input = farRepeats(200000 + randomBelow(100000));
+        CHECK(roundTrip(input, nullptr) == input);
+    }
+}
+
+void testSeveralFrames() {
+    const std::string input = terminalText(kMaxFrameSize * 2 + 12345);
+    std::string encoded;
+    CHECK(roundTrip(input, &encoded) == input);
+}
+
+void testMalformed() {
+    // A frame claiming more than kMaxFrameSize bytes.
+    std::string encoded;
+    appendFrames("hello", 5, encoded);
+    encoded[4] = encoded[5] = encoded[6] = encoded[7] = '\x7f';
+    Decoder decoder;
+    CHECK(!decoder.write(encoded.data(), encoded.size()));
+    CHECK(!decoder.write("", 0));
+
+    // A truncated LZ4 payload.
+    const std::string text = terminalText(4000);
+    encoded.clear();
+    appendFrames(text.data(), text.size(), encoded);
+    uint32_t header = 0;
+    memcpy(&header, encoded.data(), sizeof(header));
+    CHECK((header & kStoredFlag) == 0);
+    header -= 1;
+    memcpy(&encoded[0], &header, sizeof(header));
+    encoded.erase(encoded.size() - 1);
+    Decoder truncated;
+    CHECK(!truncated.write(encoded.data(), encoded.size()));
+}
+
+} // anonymous namespace
+
+int main() {
+    testEmpty();
+    testIncompressible();
+    testCompressible();
+    testShortInputs();
+    testFarMatches();
+    testSeveralFrames();
+    testMalformed();
+    return unitTestResult("OutputCompressionTest");
+}
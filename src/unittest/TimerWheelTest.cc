@@ -0,0 +1,236 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Checks TimerWheel against a plain list of deadlines: timers come off at
+// exactly their deadline tick, whichever level they started in, and
+// nextDeadline never points past the earliest one.
+
+#include "../agent/TimerWheel.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "UnitTest.h"
+
+int g_unitTestFailures = 0;
+
+namespace {
+
+typedef TimerWheel::Timer Timer;
+
+uint64_t g_rngState = 0x9E3779B97F4A7C15ull;
+
+uint32_t nextRandom() {
+    g_rngState ^= g_rngState >> 12;
+    g_rngState ^= g_rngState << 25;
+    g_rngState ^= g_rngState >> 27;
+    return static_cast<uint32_t>((g_rngState * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+// Advances to the tick and returns which of the timers came off, by index.
+std::vector<bool> advanceAndPop(TimerWheel &wheel, int64_t now,
+                                const Timer *timers, size_t count) {
+    wheel.advance(now);
+    std::vector<bool> ret(count);
+    while (Timer *timer = wheel.popExpired()) {
+        CHECK(!timer->armed());
+        const size_t index = timer - timers;
+        CHECK(index < count);
+        if (index < count) {
+            CHECK(!ret[index]);
+            ret[index] = true;
+        }
+    }
+    return ret;
+}
+
+// A timer on each side of every level boundary moves down through the
+// levels and expires on its own tick, no earlier.
+void testCascade() {
+    const int64_t kStart = 1000;
+    std::vector<int64_t> deltas;
+    deltas.push_back(0);
+    deltas.push_back(1);
+    for (int bits = 6; bits <= 24; bits += 6) {
+        const int64_t boundary = int64_t(1) << bits;
+        deltas.push_back(boundary - 1);
+        deltas.push_back(boundary);
+        deltas.push_back(boundary + 1);
+    }
+
+    TimerWheel wheel(kStart);
+    std::vector<Timer> timers(deltas.size());
+    for (size_t i = 0; i < deltas.size(); ++i) {
+        wheel.arm(timers[i], kStart + deltas[i]);
+    }
+    for (size_t i = 0; i < deltas.size(); ++i) {
+        const int64_t deadline = kStart + deltas[i];
+        if (deadline > kStart) {
+            const std::vector<bool> early = advanceAndPop(
+                wheel, deadline - 1, timers.data(), timers.size());
+            CHECK(!early[i]);
+            CHECK(timers[i].armed());
+            CHECK(wheel.nextDeadline() <= deadline);
+        }
+        const std::vector<bool> due =
+            advanceAndPop(wheel, deadline, timers.data(), timers.size());
+        CHECK(due[i] || !timers[i].armed());
+        CHECK(!timers[i].armed());
+    }
+    CHECK(wheel.nextDeadline() == TimerWheel::kNever);
+}
+
+// A timer cancelled while waiting, or after expiring but before it's
+// popped, never comes off; a destroyed timer leaves the wheel; re-arming
+// moves a timer rather than adding it twice.
+void testCancel() {
+    TimerWheel wheel(0);
+    Timer timers[4];
+    wheel.arm(timers[0], 100);
+    wheel.arm(timers[1], 5000);
+    wheel.arm(timers[2], 10);
+    wheel.arm(timers[3], 10);
+    wheel.cancel(timers[1]);
+    CHECK(!timers[1].armed());
+    wheel.cancel(timers[1]);
+
+    wheel.advance(10);
+    wheel.cancel(timers[2]);
+    std::vector<bool> popped = advanceAndPop(wheel, 10, timers, 4);
+    CHECK(!popped[2] && popped[3]);
+
+    wheel.arm(timers[0], 50);
+    wheel.arm(timers[0], 70);
+    popped = advanceAndPop(wheel, 69, timers, 4);
+    CHECK(!popped[0]);
+    popped = advanceAndPop(wheel, 70, timers, 4);
+    CHECK(popped[0]);
+
+    {
+        Timer scoped;
+        wheel.arm(scoped, 200);
+    }
+    popped = advanceAndPop(wheel, 10000, timers, 4);
+    CHECK(wheel.popExpired() == nullptr);
+    CHECK(wheel.nextDeadline() == TimerWheel::kNever);
+}
+
+// Deadlines beyond the top level's span wait there and are placed again as
+// they come within range.  An owner that sleeps until nextDeadline each
+// time sees them expire on time after a bounded number of wakes.
+void testFarFuture() {
+    const int64_t kStart = 12345;
+    const int64_t deltas[] = {
+        (int64_t(1) << 24) + 7,
+        (int64_t(1) << 30) + 3,
+        (int64_t(1) << 34) + 99,
+    };
+    const size_t count = sizeof(deltas) / sizeof(deltas[0]);
+    TimerWheel wheel(kStart);
+    Timer timers[count];
+    for (size_t i = 0; i < count; ++i) {
+        wheel.arm(timers[i], kStart + deltas[i]);
+    }
+    size_t remaining = count;
+    int wakes = 0;
+    // The farthest timer is placed again once per top-level rotation, and
+    // the rotation's start costs a wake of its own.
+    const int maxWakes = 2 * static_cast<int>(deltas[count - 1] >> 24) + 64;
+    while (remaining > 0 && wakes <= maxWakes) {
+        const int64_t next = wheel.nextDeadline();
+        CHECK(next != TimerWheel::kNever);
+        for (size_t i = 0; i < count; ++i) {
+            if (timers[i].armed()) {
+                CHECK(next <= timers[i].deadline());
+            }
+        }
+        const std::vector<bool> popped =
+            advanceAndPop(wheel, next, timers, count);
+        for (size_t i = 0; i < count; ++i) {
+            if (popped[i]) {
+                CHECK(kStart + deltas[i] == next);
+                --remaining;
+            }
+        }
+        ++wakes;
+    }
+    CHECK(remaining == 0);
+    CHECK(wakes <= maxWakes);
+}
+
+// Random arms, cancels, and advances, checked against the deadlines alone.
+void testRandom() {
+    const size_t kTimers = 256;
+    const int kSteps = 20000;
+    int64_t now = 0;
+    TimerWheel wheel(now);
+    std::vector<Timer> timers(kTimers);
+    for (int step = 0; step < kSteps; ++step) {
+        const uint32_t r = nextRandom();
+        Timer &timer = timers[(r >> 8) % kTimers];
+        switch (r % 8) {
+            case 0: case 1: case 2: {
+                // Mostly near deadlines, some far, and a few already past.
+                const int bits = 1 + nextRandom() % 28;
+                const int64_t delta =
+                    static_cast<int64_t>(nextRandom() & ((1u << bits) - 1));
+                wheel.arm(timer, (r & 0x100) ? now + delta : now - 3);
+                break;
+            }
+            case 3:
+                wheel.cancel(timer);
+                break;
+            default: {
+                int64_t next = wheel.nextDeadline();
+                if (next != TimerWheel::kNever) {
+                    for (size_t i = 0; i < kTimers; ++i) {
+                        if (timers[i].armed()) {
+                            CHECK(next <= std::max(timers[i].deadline(), now));
+                        }
+                    }
+                }
+                const int bits = nextRandom() % 20;
+                next = now + static_cast<int64_t>(
+                    nextRandom() & ((1u << bits) - 1));
+                std::vector<bool> due(kTimers);
+                for (size_t i = 0; i < kTimers; ++i) {
+                    due[i] = timers[i].armed() && timers[i].deadline() <= next;
+                }
+                const std::vector<bool> popped =
+                    advanceAndPop(wheel, next, timers.data(), kTimers);
+                CHECK(popped == due);
+                now = next + 1;
+                break;
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+int main() {
+    testCascade();
+    testCancel();
+    testFarFuture();
+    testRandom();
+    return unitTestResult("TimerWheelTest");
+}
@@ -0,0 +1,222 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Checks the bulk UTF-8/UTF-16 transcoder, whose ASCII runs go through the
+// vector kernel the CPU supports, against a plain per-unit reference.  Every
+// length and buffer offset from 0 to 64 is tried, so each kernel's block
+// loop, tail, and unaligned loads are covered, with non-ASCII units at
+// random positions to stop the runs at every point.
+
+#include "../shared/UnicodeTranscode.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "UnitTest.h"
+
+int g_unitTestFailures = 0;
+
+namespace {
+
+const int kMaxLength = 64;
+const int kMaxOffset = 64;
+const int kTrials = 8;
+
+uint64_t g_rngState = 0x2545F4914F6CDD1Dull;
+
+uint32_t nextRandom() {
+    g_rngState ^= g_rngState >> 12;
+    g_rngState ^= g_rngState << 25;
+    g_rngState ^= g_rngState >> 27;
+    return static_cast<uint32_t>((g_rngState * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+void appendReferenceUtf8(std::string &out, uint32_t code) {
+    if (code < 0x80) {
+        out.push_back(static_cast<char>(code));
+    } else if (code < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else if (code < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+}
+
+std::string referenceUtf8(const wchar_t *input, size_t length) {
+    std::string ret;
+    for (size_t i = 0; i < length; ++i) {
+        const uint32_t ch = input[i];
+        if (ch >= 0xD800 && ch <= 0xDBFF && i + 1 < length &&
+                input[i + 1] >= 0xDC00 && input[i + 1] <= 0xDFFF) {
+            appendReferenceUtf8(
+                ret, 0x10000 + ((ch - 0xD800) << 10) + (input[i + 1] - 0xDC00));
+            ++i;
+        } else if (ch >= 0xD800 && ch <= 0xDFFF) {
+            appendReferenceUtf8(ret, 0xFFFD);
+        } else {
+            appendReferenceUtf8(ret, ch);
+        }
+    }
+    return ret;
+}
+
+// Decodes one sequence at a time with decodeUtf8Sequence, which the
+// transcoder uses for everything but ASCII runs.
+std::wstring referenceUtf16(const char *input, size_t length,
+                            size_t &consumed) {
+    std::wstring ret;
+    size_t i = 0;
+    while (i < length) {
+        uint32_t code = 0;
+        const int len = decodeUtf8Sequence(input + i, length - i, code);
+        if (len == 0) {
+            break;
+        }
+        i += len;
+        if (code == kInvalidCodePoint) {
+            ret.push_back(0xFFFD);
+        } else if (code >= 0x10000) {
+            code -= 0x10000;
+            ret.push_back(static_cast<wchar_t>(0xD800 | (code >> 10)));
+            ret.push_back(static_cast<wchar_t>(0xDC00 | (code & 0x3FF)));
+        } else {
+            ret.push_back(static_cast<wchar_t>(code));
+        }
+    }
+    consumed = i;
+    return ret;
+}
+
+// Mostly ASCII, with the occasional BMP character, surrogate pair, or
+// unpaired surrogate.
+wchar_t randomUtf16Unit() {
+    const uint32_t r = nextRandom();
+    switch (r % 16) {
+        case 0:  return static_cast<wchar_t>(0x80 + (r >> 8) % 0x780);
+        case 1:  return static_cast<wchar_t>(0x4E00 + (r >> 8) % 0x1000);
+        case 2:  return static_cast<wchar_t>(0xD800 + (r >> 8) % 0x400);
+        case 3:  return static_cast<wchar_t>(0xDC00 + (r >> 8) % 0x400);
+        default: return static_cast<wchar_t>((r >> 8) % 0x80);
+    }
+}
+
+// Mostly ASCII, with the occasional lead, continuation, or invalid byte.
+char randomUtf8Byte() {
+    const uint32_t r = nextRandom();
+    switch (r % 16) {
+        case 0:  return static_cast<char>(0x80 + (r >> 8) % 0x40);
+        case 1:  return static_cast<char>(0xC2 + (r >> 8) % 0x1E);
+        case 2:  return static_cast<char>(0xE0 + (r >> 8) % 0x10);
+        case 3:  return static_cast<char>(0xF0 + (r >> 8) % 0x10);
+        default: return static_cast<char>((r >> 8) % 0x80);
+    }
+}
+
+void testUtf16ToUtf8() {
+    std::vector<wchar_t> buffer(kMaxOffset + kMaxLength);
+    for (int length = 0; length <= kMaxLength; ++length) {
+        for (int offset = 0; offset <= kMaxOffset; ++offset) {
+            for (int trial = 0; trial < kTrials; ++trial) {
+                wchar_t *const input = buffer.data() + offset;
+                for (int i = 0; i < length; ++i) {
+                    // The first trial is all ASCII, so the run covers the
+                    // whole input.
+                    input[i] = trial == 0
+                        ? static_cast<wchar_t>(0x20 + (i + offset) % 0x5F)
+                        : randomUtf16Unit();
+                }
+                std::string actual = "prefix";
+                appendUtf8FromUtf16(actual, input, length);
+                CHECK(actual == "prefix" + referenceUtf8(input, length));
+            }
+        }
+    }
+}
+
+void testUtf8ToUtf16() {
+    std::vector<char> buffer(kMaxOffset + kMaxLength);
+    for (int length = 0; length <= kMaxLength; ++length) {
+        for (int offset = 0; offset <= kMaxOffset; ++offset) {
+            for (int trial = 0; trial < kTrials; ++trial) {
+                char *const input = buffer.data() + offset;
+                for (int i = 0; i < length; ++i) {
+                    input[i] = trial == 0
+                        ? static_cast<char>(0x20 + (i + offset) % 0x5F)
+                        : randomUtf8Byte();
+                }
+                size_t expectedConsumed = 0;
+                const std::wstring expected =
+                    L"prefix" + referenceUtf16(input, length, expectedConsumed);
+                std::wstring actual = L"prefix";
+                const size_t consumed =
+                    appendUtf16FromUtf8(actual, input, length);
+                CHECK(consumed == expectedConsumed);
+                CHECK(actual == expected);
+            }
+        }
+    }
+}
+
+void testDecodeSequence() {
+    struct Case {
+        const char *input;
+        int expectedLength;
+        uint32_t expectedCode;
+    };
+    const Case kCases[] = {
+        { "A",                  1, 'A' },
+        { "\xC3\xA9",           2, 0xE9 },
+        { "\xE4\xB8\x80",       3, 0x4E00 },
+        { "\xF0\x9F\x98\x80",   4, 0x1F600 },
+        { "\xC0\x80",           2, kInvalidCodePoint },   // overlong
+        { "\xED\xA0\x80",       3, kInvalidCodePoint },   // surrogate
+        { "\xF4\x90\x80\x80",   4, kInvalidCodePoint },   // past U+10FFFF
+        { "\x80",               1, kInvalidCodePoint },   // continuation
+        { "\xE4\x41",           1, kInvalidCodePoint },   // resynchronize
+        { "\xE4\xB8",           0, 0 },                   // incomplete
+    };
+    for (const Case &c : kCases) {
+        uint32_t code = 0;
+        const int len = decodeUtf8Sequence(c.input, strlen(c.input), code);
+        CHECK(len == c.expectedLength);
+        if (len != 0) {
+            CHECK(code == c.expectedCode);
+        }
+    }
+}
+
+} // anonymous namespace
+
+int main() {
+    testDecodeSequence();
+    testUtf16ToUtf8();
+    testUtf8ToUtf16();
+    return unitTestResult("UnicodeTranscodeTest");
+}
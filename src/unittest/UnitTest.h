@@ -0,0 +1,51 @@
+// Copyright (c) 2016 Ryan Prichard
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef UNITTEST_UNIT_TEST_H
+#define UNITTEST_UNIT_TEST_H
+
+#include <stdio.h>
+
+// The programs in src/unittest are standalone, like UnicodeEncodingTest.cc.
+// Each failed CHECK prints the failing expression and its location, and
+// main returns unitTestResult(), so a failed run exits with status 1.
+
+extern int g_unitTestFailures;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("Error: %s:%d: CHECK(%s) failed\n",                      \
+                __FILE__, __LINE__, #cond);                                 \
+            ++g_unitTestFailures;                                           \
+        }                                                                   \
+    } while (false)
+
+inline int unitTestResult(const char *name)
+{
+    if (g_unitTestFailures != 0) {
+        printf("%s: %d check(s) failed\n", name, g_unitTestFailures);
+        return 1;
+    }
+    printf("%s: all checks passed\n", name);
+    return 0;
+}
+
+#endif // UNITTEST_UNIT_TEST_H
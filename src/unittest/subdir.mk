@@ -0,0 +1,73 @@
+# Copyright (c) 2015 Ryan Prichard
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+$(eval $(call def_mingw_target,unittest,-DWINPTY_AGENT_ASSERT))
+
+# Each unit test links only the objects it tests, compiled the same way as
+# for the agent.
+
+build/unittest/CharInfoScanTest.exe : \
+		build/unittest/unittest/CharInfoScanTest.o \
+		build/agent/agent/CharInfoScan.o \
+		build/agent/shared/CpuFeatures.o
+	$(info Linking $@)
+	@$(MINGW_CXX) $(MINGW_LDFLAGS) -o $@ $^
+
+build/unittest/ConsoleChangeTrackerTest.exe : \
+		build/unittest/unittest/ConsoleChangeTrackerTest.o \
+		build/agent/agent/ConsoleChangeTracker.o
+	$(info Linking $@)
+	@$(MINGW_CXX) $(MINGW_LDFLAGS) -o $@ $^
+
+build/unittest/OutputCompressionTest.exe : \
+		build/unittest/unittest/OutputCompressionTest.o \
+		build/agent/shared/OutputCompression.o
+	$(info Linking $@)
+	@$(MINGW_CXX) $(MINGW_LDFLAGS) -o $@ $^
+
+build/unittest/TimerWheelTest.exe : \
+		build/unittest/unittest/TimerWheelTest.o \
+		build/agent/agent/TimerWheel.o \
+		build/agent/shared/DebugClient.o \
+		build/agent/shared/TraceFormat.o \
+		build/agent/shared/WinptyAssert.o
+	$(info Linking $@)
+	@$(MINGW_CXX) $(MINGW_LDFLAGS) -o $@ $^
+
+build/unittest/UnicodeTranscodeTest.exe : \
+		build/unittest/unittest/UnicodeTranscodeTest.o \
+		build/agent/shared/CpuFeatures.o \
+		build/agent/shared/DebugClient.o \
+		build/agent/shared/TraceFormat.o \
+		build/agent/shared/UnicodeTranscode.o \
+		build/agent/shared/WinptyAssert.o
+	$(info Linking $@)
+	@$(MINGW_CXX) $(MINGW_LDFLAGS) -o $@ $^
+
+UNITTEST_PROGRAMS = \
+	build/unittest/CharInfoScanTest.exe \
+	build/unittest/ConsoleChangeTrackerTest.exe \
+	build/unittest/OutputCompressionTest.exe \
+	build/unittest/TimerWheelTest.exe \
+	build/unittest/UnicodeTranscodeTest.exe
+
+TEST_PROGRAMS += $(UNITTEST_PROGRAMS)
+
+-include $(UNITTEST_PROGRAMS:build/unittest/%.exe=build/unittest/unittest/%.d)
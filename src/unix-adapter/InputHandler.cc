@@ -26,58 +26,73 @@
 #include <sys/select.h>
 #include <unistd.h>
 
-#include <algorithm>
-#include <vector>
-
 #include "../shared/DebugClient.h"
-#include "Util.h"
-#include "WakeupFd.h"
 
-InputHandler::InputHandler(
-        HANDLE conin, int inputfd, WakeupFd &completionWakeup) :
+InputHandler::InputHandler(HANDLE conin, int inputfd) :
     m_conin(conin),
     m_inputfd(inputfd),
-    m_completionWakeup(completionWakeup),
-    m_threadHasBeenJoined(false),
-    m_shouldShutdown(0),
-    m_threadCompleted(0)
+    m_current(0),
+    m_over(),
+    m_pendingSize(0)
 {
-    pthread_create(&m_thread, NULL, InputHandler::threadProcS, this);
+    m_buffers[0].resize(kBufferSize);
+    m_buffers[1].resize(kBufferSize);
+    m_over.hEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+    assert(m_over.hEvent != NULL && "CreateEventW failed");
 }
 
-void InputHandler::shutdown() {
-    startShutdown();
-    if (!m_threadHasBeenJoined) {
-        int ret = pthread_join(m_thread, NULL);
-        assert(ret == 0 && "pthread_join failed");
-        m_threadHasBeenJoined = true;
+// Wait for the last write to CONIN, canceling it first if `cancel` is set
+// (i.e. the agent is gone).
+void InputHandler::shutdown(bool cancel) {
+    if (m_pendingSize > 0) {
+        if (cancel) {
+            CancelIo(m_conin);
+        }
+        finishWrite();
+    }
+    if (m_over.hEvent != NULL) {
+        CloseHandle(m_over.hEvent);
+        m_over.hEvent = NULL;
+    }
+}
+
+// Each batch of tty input is written to CONIN with one overlapped write.
+// While it's in flight, the main loop goes on, and the next batch is read
+// into the other buffer.  Returns false once the tty or CONIN is closed.
+bool InputHandler::service() {
+    char *const buffer = &m_buffers[m_current][0];
+    const int numRead = readAvailable(buffer, kBufferSize);
+    if (numRead < 0) {
+        return false;
+    }
+    if (numRead == 0) {
+        return true;
+    }
+    if (m_pendingSize > 0 && !finishWrite()) {
+        return false;
+    }
+    if (!startWrite(buffer, numRead)) {
+        return false;
     }
+    m_current ^= 1;
+    return true;
 }
 
-void InputHandler::threadProc() {
-    std::vector<char> buffer(4096);
+bool InputHandler::isReadable() {
     fd_set readfds;
     FD_ZERO(&readfds);
-    while (true) {
-        // Handle shutdown.
-        m_wakeup.reset();
-        if (m_shouldShutdown) {
-            trace("InputHandler: shutting down");
-            break;
-        }
-
-        // Block until data arrives.
-        {
-            const int max_fd = std::max(m_inputfd, m_wakeup.fd());
-            FD_SET(m_inputfd, &readfds);
-            FD_SET(m_wakeup.fd(), &readfds);
-            selectWrapper("InputHandler", max_fd + 1, &readfds);
-            if (!FD_ISSET(m_inputfd, &readfds)) {
-                continue;
-            }
-        }
+    FD_SET(m_inputfd, &readfds);
+    timeval timeout = {};
+    return select(m_inputfd + 1, &readfds, NULL, NULL, &timeout) > 0 &&
+        FD_ISSET(m_inputfd, &readfds);
+}
 
-        const int numRead = read(m_inputfd, &buffer[0], buffer.size());
+// Read the bytes the fd has available, up to `size`, blocking only for the
+// first read.  Returns -1 if the tty is closed or the read failed.
+int InputHandler::readAvailable(char *buffer, int size) {
+    int total = 0;
+    do {
+        const int numRead = read(m_inputfd, buffer + total, size - total);
         if (numRead == -1 && errno == EINTR) {
             // Apparently, this read is interrupted on Cygwin 1.7 by a SIGWINCH
             // signal even though I set the SA_RESTART flag on the handler.
@@ -85,30 +100,50 @@ void InputHandler::threadProc() {
         }
 
         // tty is closed, or the read failed for some unexpected reason.
+        // Forward what was already read; the next read fails again.
         if (numRead <= 0) {
             trace("InputHandler: tty read failed: numRead=%d", numRead);
-            break;
+            return total > 0 ? total : -1;
         }
+        total += numRead;
+    } while (total < size && isReadable());
+    return total;
+}
+
+bool InputHandler::startWrite(const char *buffer, int size) {
+    const BOOL ret = WriteFile(m_conin, buffer, size, NULL, &m_over);
+    if (!ret && GetLastError() != ERROR_IO_PENDING) {
+        if (GetLastError() == ERROR_BROKEN_PIPE) {
+            trace("InputHandler: pipe closed");
+        } else {
+            trace("InputHandler: write failed: lastError=0x%x size=%d",
+                static_cast<unsigned int>(GetLastError()), size);
+        }
+        return false;
+    }
+    m_pendingSize = size;
+    return true;
+}
 
-        DWORD written = 0;
-        BOOL ret = WriteFile(m_conin,
-                             &buffer[0], numRead,
-                             &written, NULL);
-        if (!ret || written != static_cast<DWORD>(numRead)) {
-            if (!ret && GetLastError() == ERROR_BROKEN_PIPE) {
-                trace("InputHandler: pipe closed: written=%u",
-                    static_cast<unsigned int>(written));
-            } else {
-                trace("InputHandler: write failed: "
-                    "ret=%d lastError=0x%x numRead=%d written=%u",
-                    ret,
-                    static_cast<unsigned int>(GetLastError()),
-                    numRead,
-                    static_cast<unsigned int>(written));
-            }
-            break;
+// Wait for the write started by startWrite.
+bool InputHandler::finishWrite() {
+    const int size = m_pendingSize;
+    m_pendingSize = 0;
+    DWORD written = 0;
+    const BOOL ret = GetOverlappedResult(m_conin, &m_over, &written, TRUE);
+    if (!ret || written != static_cast<DWORD>(size)) {
+        if (!ret && GetLastError() == ERROR_BROKEN_PIPE) {
+            trace("InputHandler: pipe closed: written=%u",
+                static_cast<unsigned int>(written));
+        } else {
+            trace("InputHandler: write failed: "
+                "ret=%d lastError=0x%x size=%d written=%u",
+                ret,
+                static_cast<unsigned int>(GetLastError()),
+                size,
+                static_cast<unsigned int>(written));
         }
+        return false;
     }
-    m_threadCompleted = 1;
-    m_completionWakeup.set();
+    return true;
 }
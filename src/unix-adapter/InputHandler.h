@@ -22,35 +22,41 @@
 #define UNIX_ADAPTER_INPUT_HANDLER_H
 
 #include <windows.h>
-#include <pthread.h>
-#include <signal.h>
 
-#include "WakeupFd.h"
+#include <vector>
 
-// Connect a Cygwin blocking fd to winpty CONIN.
+// Connect a Cygwin blocking fd to winpty CONIN.  The handle must be opened
+// with FILE_FLAG_OVERLAPPED, so the fd can be read while the previous write
+// to CONIN is still in progress.
+//
+// The handler has no thread of its own.  The main loop selects on the fd
+// along with its other events, and calls service whenever it's readable.
 class InputHandler {
 public:
-    InputHandler(HANDLE conin, int inputfd, WakeupFd &completionWakeup);
-    ~InputHandler() { shutdown(); }
-    bool isComplete() { return m_threadCompleted; }
-    void startShutdown() { m_shouldShutdown = 1; m_wakeup.set(); }
-    void shutdown();
+    enum { kBufferSize = 64 * 1024 };
+
+    InputHandler(HANDLE conin, int inputfd);
+    ~InputHandler() { shutdown(false); }
+    int fd() const { return m_inputfd; }
+    bool service();
+    void shutdown(bool cancel);
 
 private:
-    static void *threadProcS(void *pvthis) {
-        reinterpret_cast<InputHandler*>(pvthis)->threadProc();
-        return NULL;
-    }
-    void threadProc();
+    bool isReadable();
+    int readAvailable(char *buffer, int size);
+    bool startWrite(const char *buffer, int size);
+    bool finishWrite();
 
     HANDLE m_conin;
     int m_inputfd;
-    pthread_t m_thread;
-    WakeupFd &m_completionWakeup;
-    WakeupFd m_wakeup;
-    bool m_threadHasBeenJoined;
-    volatile sig_atomic_t m_shouldShutdown;
-    volatile sig_atomic_t m_threadCompleted;
+    std::vector<char> m_buffers[2];
+    int m_current;
+    OVERLAPPED m_over;
+    int m_pendingSize;
+
+    // Do not allow copying the InputHandler object.
+    InputHandler(const InputHandler &other);
+    InputHandler &operator=(const InputHandler &other);
 };
 
 #endif // UNIX_ADAPTER_INPUT_HANDLER_H
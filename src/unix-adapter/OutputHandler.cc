@@ -33,9 +33,11 @@
 #include "WakeupFd.h"
 
 OutputHandler::OutputHandler(
-        HANDLE conout, int outputfd, WakeupFd &completionWakeup) :
+        HANDLE conout, int outputfd, WakeupFd &completionWakeup,
+        size_t readSize) :
     m_conout(conout),
     m_outputfd(outputfd),
+    m_readSize(readSize),
     m_completionWakeup(completionWakeup),
     m_threadHasBeenJoined(false),
     m_threadCompleted(0)
@@ -51,30 +53,72 @@ void OutputHandler::shutdown() {
     }
 }
 
+// Alternate between two buffers: while one buffer's data is written to the
+// fd, the next CONOUT read fills the other.
 void OutputHandler::threadProc() {
-    std::vector<char> buffer(4096);
-    while (true) {
-        DWORD numRead = 0;
-        BOOL ret = ReadFile(m_conout,
-                            &buffer[0], buffer.size(),
-                            &numRead, NULL);
-        if (!ret || numRead == 0) {
-            if (!ret && GetLastError() == ERROR_BROKEN_PIPE) {
-                trace("OutputHandler: pipe closed: numRead=%u",
-                    static_cast<unsigned int>(numRead));
-            } else {
-                trace("OutputHandler: read failed: "
-                    "ret=%d lastError=0x%x numRead=%u",
-                    ret,
-                    static_cast<unsigned int>(GetLastError()),
-                    static_cast<unsigned int>(numRead));
-            }
+    assert(m_readSize > 0);
+    std::vector<char> buffers[2] = {
+        std::vector<char>(m_readSize),
+        std::vector<char>(m_readSize),
+    };
+    OVERLAPPED over = {};
+    over.hEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+    assert(over.hEvent != NULL && "CreateEventW failed");
+    int current = 0;
+    bool reading = startRead(&buffers[current][0], over);
+    while (reading) {
+        const DWORD numRead = finishRead(over);
+        if (numRead == 0) {
             break;
         }
-        if (!writeAll(m_outputfd, &buffer[0], numRead)) {
+        const int next = current ^ 1;
+        reading = startRead(&buffers[next][0], over);
+        if (!writeAll(m_outputfd, &buffers[current][0], numRead)) {
+            if (reading) {
+                CancelIo(m_conout);
+                finishRead(over);
+            }
             break;
         }
+        current = next;
     }
+    CloseHandle(over.hEvent);
     m_threadCompleted = 1;
     m_completionWakeup.set();
 }
+
+// Start an overlapped read into the buffer.  Returns false if the read
+// failed immediately.
+bool OutputHandler::startRead(char *buffer, OVERLAPPED &over) {
+    const BOOL ret = ReadFile(m_conout, buffer, m_readSize, NULL, &over);
+    if (!ret && GetLastError() != ERROR_IO_PENDING) {
+        traceReadFailure(ret, 0);
+        return false;
+    }
+    return true;
+}
+
+// Wait for the read started by startRead.  Returns the number of bytes read,
+// or 0 if the pipe closed or the read failed.
+DWORD OutputHandler::finishRead(OVERLAPPED &over) {
+    DWORD numRead = 0;
+    const BOOL ret = GetOverlappedResult(m_conout, &over, &numRead, TRUE);
+    if (!ret || numRead == 0) {
+        traceReadFailure(ret, numRead);
+        return 0;
+    }
+    return numRead;
+}
+
+void OutputHandler::traceReadFailure(BOOL ret, DWORD numRead) {
+    if (!ret && GetLastError() == ERROR_BROKEN_PIPE) {
+        trace("OutputHandler: pipe closed: numRead=%u",
+            static_cast<unsigned int>(numRead));
+    } else {
+        trace("OutputHandler: read failed: "
+            "ret=%d lastError=0x%x numRead=%u",
+            ret,
+            static_cast<unsigned int>(GetLastError()),
+            static_cast<unsigned int>(numRead));
+    }
+}
@@ -27,10 +27,15 @@
 
 #include "WakeupFd.h"
 
-// Connect winpty CONOUT/CONERR to a Cygwin blocking fd.
+// Connect winpty CONOUT/CONERR to a Cygwin blocking fd.  The handle must be
+// opened with FILE_FLAG_OVERLAPPED, so the next read can be in flight while
+// the previous one is written to the fd.
 class OutputHandler {
 public:
-    OutputHandler(HANDLE conout, int outputfd, WakeupFd &completionWakeup);
+    enum { kDefaultReadSize = 64 * 1024 };
+
+    OutputHandler(HANDLE conout, int outputfd, WakeupFd &completionWakeup,
+                  size_t readSize=kDefaultReadSize);
     ~OutputHandler() { shutdown(); }
     bool isComplete() { return m_threadCompleted; }
     void shutdown();
@@ -41,9 +46,13 @@ private:
         return NULL;
     }
     void threadProc();
+    bool startRead(char *buffer, OVERLAPPED &over);
+    DWORD finishRead(OVERLAPPED &over);
+    void traceReadFailure(BOOL ret, DWORD numRead);
 
     HANDLE m_conout;
     int m_outputfd;
+    size_t m_readSize;
     pthread_t m_thread;
     WakeupFd &m_completionWakeup;
     bool m_threadHasBeenJoined;
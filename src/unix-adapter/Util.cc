@@ -59,8 +59,9 @@ bool writeStr(int fd, const char *str) {
     return writeAll(fd, str, strlen(str));
 }
 
-void selectWrapper(const char *diagName, int nfds, fd_set *readfds) {
-    int ret = select(nfds, readfds, NULL, NULL, NULL);
+void selectWrapper(const char *diagName, int nfds, fd_set *readfds,
+                   timeval *timeout) {
+    int ret = select(nfds, readfds, NULL, NULL, timeout);
     if (ret < 0) {
         if (errno == EINTR) {
             FD_ZERO(readfds);
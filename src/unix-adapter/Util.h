@@ -26,6 +26,7 @@
 
 bool writeAll(int fd, const void *buffer, size_t size);
 bool writeStr(int fd, const char *str);
-void selectWrapper(const char *diagName, int nfds, fd_set *readfds);
+void selectWrapper(const char *diagName, int nfds, fd_set *readfds,
+                   timeval *timeout=NULL);
 
 #endif // UNIX_ADAPTER_UTIL_H
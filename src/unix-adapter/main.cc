@@ -35,6 +35,7 @@
 #include <termios.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <utility>
@@ -63,6 +64,13 @@ static WakeupFd &mainWakeup()
     return *g_mainWakeup;
 }
 
+// While a terminal window is dragged, the new size is sent to the agent at
+// most this often, and the final size is sent once the interval passes.
+const DWORD kResizeIntervalMs = 50;
+
+// The CONOUT read size used with -Xpipe-output when stdout isn't a tty.
+const size_t kPipeOutputReadSize = 1024 * 1024;
+
 struct SavedTermiosMode {
     int count;
     bool valid[3];
@@ -475,6 +483,12 @@ struct Arguments {
     bool testConerr;
     bool testPlainOutput;
     bool testColorEscapes;
+    bool testEventScrape;
+    bool testSyncOutput;
+    bool testLegacyTentativeScrape;
+    bool testFingerprintScroll;
+    bool testPipeOutput;
+    size_t outputReadSize;
 };
 
 static void parseArguments(int argc, char *argv[], Arguments &out)
@@ -484,6 +498,12 @@ static void parseArguments(int argc, char *argv[], Arguments &out)
     out.testConerr = false;
     out.testPlainOutput = false;
     out.testColorEscapes = false;
+    out.testEventScrape = false;
+    out.testSyncOutput = false;
+    out.testLegacyTentativeScrape = false;
+    out.testFingerprintScroll = false;
+    out.testPipeOutput = false;
+    out.outputReadSize = OutputHandler::kDefaultReadSize;
     bool doShowKeys = false;
     const char *const program = argc >= 1 ? argv[0] : "<program>";
     int argi = 1;
@@ -507,6 +527,24 @@ static void parseArguments(int argc, char *argv[], Arguments &out)
                 out.testPlainOutput = true;
             } else if (arg == "-Xcolor") {
                 out.testColorEscapes = true;
+            } else if (arg == "-Xevent-scrape") {
+                out.testEventScrape = true;
+            } else if (arg == "-Xsync-output") {
+                out.testSyncOutput = true;
+            } else if (arg == "-Xlegacy-tentative-scrape") {
+                out.testLegacyTentativeScrape = true;
+            } else if (arg == "-Xfingerprint-scroll") {
+                out.testFingerprintScroll = true;
+            } else if (arg == "-Xpipe-output") {
+                out.testPipeOutput = true;
+            } else if (arg == "-Xoutput-read-size") {
+                const int size = argi < argc ? atoi(argv[argi++]) : 0;
+                if (size <= 0) {
+                    fprintf(stderr, "Error: -Xoutput-read-size requires a "
+                        "positive byte count\n");
+                    exit(1);
+                }
+                out.outputReadSize = size;
             } else if (arg == "--") {
                 break;
             } else {
@@ -594,10 +632,31 @@ int main(int argc, char *argv[])
     sz.ws_row = 25;
     ioctl(STDIN_FILENO, TIOCGWINSZ, &sz);
 
+    // With -Xpipe-output, a redirected stdout (e.g. in a batch job) gets an
+    // append-only log of plain text rather than terminal escapes, read from
+    // CONOUT in large chunks.
+    const bool pipeOutput = args.testPipeOutput && !isatty(STDOUT_FILENO);
+    if (pipeOutput) {
+        args.testPlainOutput = true;
+        args.outputReadSize =
+            std::max<size_t>(args.outputReadSize, kPipeOutputReadSize);
+    }
+
     DWORD agentFlags = WINPTY_FLAG_ALLOW_CURPROC_DESKTOP_CREATION;
     if (args.testConerr)        { agentFlags |= WINPTY_FLAG_CONERR; }
     if (args.testPlainOutput)   { agentFlags |= WINPTY_FLAG_PLAIN_OUTPUT; }
     if (args.testColorEscapes)  { agentFlags |= WINPTY_FLAG_COLOR_ESCAPES; }
+    if (args.testEventScrape)   { agentFlags |= WINPTY_FLAG_EVENT_DRIVEN_SCRAPE; }
+    if (args.testSyncOutput)    { agentFlags |= WINPTY_FLAG_SYNCHRONIZED_OUTPUT; }
+    if (args.testLegacyTentativeScrape) {
+        agentFlags |= WINPTY_FLAG_LEGACY_TENTATIVE_SCRAPE;
+    }
+    if (args.testFingerprintScroll) {
+        agentFlags |= WINPTY_FLAG_FINGERPRINT_SCROLL;
+    }
+    if (pipeOutput) {
+        agentFlags |= WINPTY_FLAG_LOG_OUTPUT;
+    }
     winpty_config_t *agentCfg = winpty_config_new(agentFlags, NULL);
     assert(agentCfg != NULL);
     winpty_config_set_initial_size(agentCfg, sz.ws_col, sz.ws_row);
@@ -605,84 +664,90 @@ int main(int argc, char *argv[])
         winpty_config_set_mouse_mode(agentCfg, WINPTY_MOUSE_MODE_FORCE);
     }
 
+    // Start the agent and the child process under its console.
+    args.childArgv[0] = findProgram(argv[0], args.childArgv[0]);
+    std::string cmdLine = argvToCommandLine(args.childArgv);
+    wchar_t *cmdLineW = heapMbsToWcs(cmdLine.c_str());
+
+    winpty_spawn_config_t *spawnCfg = winpty_spawn_config_new(
+            WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN,
+            NULL, cmdLineW, NULL, NULL, NULL);
+    assert(spawnCfg != NULL);
+
+    HANDLE childHandle = NULL;
     winpty_error_ptr_t openErr = NULL;
-    winpty_t *wp = winpty_open(agentCfg, &openErr);
+    DWORD lastError = 0;
+    winpty_t *wp = winpty_open_and_spawn(agentCfg, spawnCfg, &childHandle,
+        NULL, &lastError, &openErr);
+    winpty_spawn_config_free(spawnCfg);
     if (wp == NULL) {
-        fprintf(stderr, "Error creating winpty: %s\n",
-            wcsToMbs(winpty_error_msg(openErr)).c_str());
+        winpty_result_t openCode = winpty_error_code(openErr);
+        if (openCode == WINPTY_ERROR_SPAWN_CREATE_PROCESS_FAILED) {
+            fprintf(stderr, "%s: error: cannot start '%s': %s\n",
+                argv[0],
+                cmdLine.c_str(),
+                formatErrorMessage(lastError).c_str());
+        } else {
+            fprintf(stderr, "Error creating winpty: %s\n",
+                wcsToMbs(winpty_error_msg(openErr)).c_str());
+        }
         exit(1);
     }
     winpty_config_free(agentCfg);
     winpty_error_free(openErr);
+    delete [] cmdLineW;
 
     HANDLE conin = CreateFileW(winpty_conin_name(wp), GENERIC_WRITE, 0, NULL,
-                               OPEN_EXISTING, 0, NULL);
+                               OPEN_EXISTING, FILE_FLAG_OVERLAPPED, NULL);
     HANDLE conout = CreateFileW(winpty_conout_name(wp), GENERIC_READ, 0, NULL,
-                                OPEN_EXISTING, 0, NULL);
+                                OPEN_EXISTING, FILE_FLAG_OVERLAPPED, NULL);
     assert(conin != INVALID_HANDLE_VALUE);
     assert(conout != INVALID_HANDLE_VALUE);
     HANDLE conerr = NULL;
     if (args.testConerr) {
         conerr = CreateFileW(winpty_conerr_name(wp), GENERIC_READ, 0, NULL,
-                             OPEN_EXISTING, 0, NULL);
+                             OPEN_EXISTING, FILE_FLAG_OVERLAPPED, NULL);
         assert(conerr != INVALID_HANDLE_VALUE);
     }
 
-    HANDLE childHandle = NULL;
-
-    {
-        // Start the child process under the console.
-        args.childArgv[0] = findProgram(argv[0], args.childArgv[0]);
-        std::string cmdLine = argvToCommandLine(args.childArgv);
-        wchar_t *cmdLineW = heapMbsToWcs(cmdLine.c_str());
-
-        winpty_spawn_config_t *spawnCfg = winpty_spawn_config_new(
-                WINPTY_SPAWN_FLAG_AUTO_SHUTDOWN,
-                NULL, cmdLineW, NULL, NULL, NULL);
-        assert(spawnCfg != NULL);
-
-        winpty_error_ptr_t spawnErr = NULL;
-        DWORD lastError = 0;
-        BOOL spawnRet = winpty_spawn(wp, spawnCfg, &childHandle, NULL,
-            &lastError, &spawnErr);
-        winpty_spawn_config_free(spawnCfg);
-
-        if (!spawnRet) {
-            winpty_result_t spawnCode = winpty_error_code(spawnErr);
-            if (spawnCode == WINPTY_ERROR_SPAWN_CREATE_PROCESS_FAILED) {
-                fprintf(stderr, "%s: error: cannot start '%s': %s\n",
-                    argv[0],
-                    cmdLine.c_str(),
-                    formatErrorMessage(lastError).c_str());
-            } else {
-                fprintf(stderr, "%s: error: cannot start '%s': internal error: %s\n",
-                    argv[0],
-                    cmdLine.c_str(),
-                    wcsToMbs(winpty_error_msg(spawnErr)).c_str());
-            }
-            exit(1);
-        }
-        winpty_error_free(spawnErr);
-        delete [] cmdLineW;
-    }
-
     registerResizeSignalHandler();
     SavedTermiosMode mode =
-        setRawTerminalMode(args.testAllowNonTtys, true, args.testConerr);
+        setRawTerminalMode(args.testAllowNonTtys, !pipeOutput,
+                           args.testConerr);
 
-    InputHandler inputHandler(conin, STDIN_FILENO, mainWakeup());
-    OutputHandler outputHandler(conout, STDOUT_FILENO, mainWakeup());
+    InputHandler inputHandler(conin, STDIN_FILENO);
+    OutputHandler outputHandler(conout, STDOUT_FILENO, mainWakeup(),
+                                args.outputReadSize);
     OutputHandler *errorHandler = NULL;
     if (args.testConerr) {
-        errorHandler = new OutputHandler(conerr, STDERR_FILENO, mainWakeup());
+        errorHandler = new OutputHandler(conerr, STDERR_FILENO, mainWakeup(),
+                                         args.outputReadSize);
     }
 
+    // The main loop waits for tty input, SIGWINCH, and the output handlers
+    // exiting.  The latter two arrive through the wakeup pipe.  A resize
+    // that arrives within kResizeIntervalMs of the last one sent is held
+    // back, and the loop wakes up to send it when the interval ends.
+    bool resizePending = false;
+    DWORD lastResizeTick = GetTickCount() - kResizeIntervalMs;
     while (true) {
         fd_set readfds;
         FD_ZERO(&readfds);
+        FD_SET(inputHandler.fd(), &readfds);
         FD_SET(mainWakeup().fd(), &readfds);
-        selectWrapper("main thread", mainWakeup().fd() + 1, &readfds);
-        mainWakeup().reset();
+        timeval resizeTimeout = {};
+        if (resizePending) {
+            const DWORD elapsed = GetTickCount() - lastResizeTick;
+            const DWORD remaining = elapsed < kResizeIntervalMs
+                ? kResizeIntervalMs - elapsed : 0;
+            resizeTimeout.tv_usec = remaining * 1000;
+        }
+        selectWrapper("main thread",
+            std::max(inputHandler.fd(), mainWakeup().fd()) + 1, &readfds,
+            resizePending ? &resizeTimeout : NULL);
+        if (FD_ISSET(mainWakeup().fd(), &readfds)) {
+            mainWakeup().reset();
+        }
 
         // Check for terminal resize.
         {
@@ -690,16 +755,27 @@ int main(int argc, char *argv[])
             ioctl(STDIN_FILENO, TIOCGWINSZ, &sz2);
             if (memcmp(&sz, &sz2, sizeof(sz)) != 0) {
                 sz = sz2;
-                winpty_set_size(wp, sz.ws_col, sz.ws_row, NULL);
+                resizePending = true;
+            }
+            if (resizePending &&
+                    GetTickCount() - lastResizeTick >= kResizeIntervalMs) {
+                winpty_set_size_nowait(wp, sz.ws_col, sz.ws_row, NULL);
+                lastResizeTick = GetTickCount();
+                resizePending = false;
             }
         }
 
         // Check for an I/O handler shutting down (possibly indicating that the
         // child process has exited).
-        if (inputHandler.isComplete() || outputHandler.isComplete() ||
+        if (outputHandler.isComplete() ||
                 (errorHandler != NULL && errorHandler->isComplete())) {
             break;
         }
+
+        if (FD_ISSET(inputHandler.fd(), &readfds) &&
+                !inputHandler.service()) {
+            break;
+        }
     }
 
     // Kill the agent connection.  This will kill the agent, closing the CONIN
@@ -707,7 +783,7 @@ int main(int argc, char *argv[])
     // down.
     winpty_free(wp);
 
-    inputHandler.shutdown();
+    inputHandler.shutdown(true);
     outputHandler.shutdown();
     CloseHandle(conin);
     CloseHandle(conout);
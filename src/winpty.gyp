@@ -11,6 +11,9 @@
 
     'variables': {
         'WINPTY_COMMIT_HASH%': '<!(cmd /c "cd shared && GetCommitHash.bat")',
+        # Pass -D WINPTY_TARGET_WIN10=1 to gyp to build for Windows 10 and
+        # newer only, without the code paths for older releases.
+        'WINPTY_TARGET_WIN10%': 0,
     },
     'target_defaults' : {
         'defines' : [
@@ -19,6 +22,13 @@
             '_WIN32_WINNT=0x0501',
             'NOMINMAX',
         ],
+        'conditions': [
+            ['WINPTY_TARGET_WIN10==1', {
+                'defines': [
+                    'WINPTY_TARGET_WIN10',
+                ],
+            }],
+        ],
         'include_dirs': [
             # Add the 'src/gen' directory to the include path and force gyp to
             # run the script (re)generating the version header.
@@ -52,6 +62,18 @@
                 'agent/Agent.cc',
                 'agent/AgentCreateDesktop.h',
                 'agent/AgentCreateDesktop.cc',
+                'agent/AllocationCounter.h',
+                'agent/AllocationCounter.cc',
+                'agent/Arena.h',
+                'agent/CharInfoScan.cc',
+                'agent/CharInfoScan.h',
+                'agent/ChunkedQueue.cc',
+                'agent/ChunkedQueue.h',
+                'agent/ConsoleBuffer.h',
+                'agent/ConsoleChangeTracker.cc',
+                'agent/ConsoleChangeTracker.h',
+                'agent/ConsoleEventHook.cc',
+                'agent/ConsoleEventHook.h',
                 'agent/ConsoleFont.cc',
                 'agent/ConsoleFont.h',
                 'agent/ConsoleInput.cc',
@@ -60,26 +82,50 @@
                 'agent/ConsoleInputReencoding.h',
                 'agent/ConsoleLine.cc',
                 'agent/ConsoleLine.h',
+                'agent/ConsoleSnapshot.cc',
+                'agent/ConsoleSnapshot.h',
+                'agent/ConsoleTrace.cc',
+                'agent/ConsoleTrace.h',
                 'agent/Coord.h',
                 'agent/DebugShowInput.h',
                 'agent/DebugShowInput.cc',
                 'agent/DefaultInputMap.h',
                 'agent/DefaultInputMap.cc',
+                'agent/DefaultInputMapTable.cc',
                 'agent/DsrSender.h',
+                'agent/EtwTrace.h',
+                'agent/EtwTrace.cc',
                 'agent/EventLoop.h',
                 'agent/EventLoop.cc',
+                'agent/FullWidthTable.h',
+                'agent/FullWidthTable.cc',
+                'agent/HistoryStore.h',
+                'agent/HistoryStore.cc',
                 'agent/InputMap.h',
                 'agent/InputMap.cc',
+                'agent/InputThread.h',
+                'agent/InputThread.cc',
                 'agent/LargeConsoleRead.h',
                 'agent/LargeConsoleRead.cc',
                 'agent/NamedPipe.h',
                 'agent/NamedPipe.cc',
+                'agent/OutputJournal.h',
+                'agent/OutputJournal.cc',
+                'agent/OutputThread.h',
+                'agent/OutputThread.cc',
+                'agent/Profiler.h',
+                'agent/Profiler.cc',
+                'agent/PseudoConsole.h',
+                'agent/PseudoConsole.cc',
                 'agent/Scraper.h',
                 'agent/Scraper.cc',
-                'agent/SimplePool.h',
+                'agent/SessionRecorder.h',
+                'agent/SessionRecorder.cc',
                 'agent/SmallRect.h',
                 'agent/Terminal.h',
                 'agent/Terminal.cc',
+                'agent/TimerWheel.h',
+                'agent/TimerWheel.cc',
                 'agent/UnicodeEncoding.h',
                 'agent/Win32Console.cc',
                 'agent/Win32Console.h',
@@ -91,16 +137,25 @@
                 'shared/BackgroundDesktop.cc',
                 'shared/Buffer.h',
                 'shared/Buffer.cc',
+                'shared/CpuFeatures.h',
+                'shared/CpuFeatures.cc',
                 'shared/DebugClient.h',
                 'shared/DebugClient.cc',
                 'shared/GenRandom.h',
                 'shared/GenRandom.cc',
                 'shared/OsModule.h',
+                'shared/OutputCompression.h',
+                'shared/OutputCompression.cc',
                 'shared/OwnedHandle.h',
                 'shared/OwnedHandle.cc',
+                'shared/SharedRing.h',
                 'shared/StringBuilder.h',
                 'shared/StringUtil.cc',
                 'shared/StringUtil.h',
+                'shared/TraceFormat.h',
+                'shared/TraceFormat.cc',
+                'shared/UnicodeTranscode.h',
+                'shared/UnicodeTranscode.cc',
                 'shared/UnixCtrlChars.h',
                 'shared/WindowsSecurity.cc',
                 'shared/WindowsSecurity.h',
@@ -139,22 +194,33 @@
                 'include/winpty.h',
                 'libwinpty/AgentLocation.cc',
                 'libwinpty/AgentLocation.h',
+                'libwinpty/OutputCallback.cc',
+                'libwinpty/OutputCallback.h',
                 'libwinpty/winpty.cc',
                 'shared/AgentMsg.h',
                 'shared/BackgroundDesktop.h',
                 'shared/BackgroundDesktop.cc',
                 'shared/Buffer.h',
                 'shared/Buffer.cc',
+                'shared/CpuFeatures.h',
+                'shared/CpuFeatures.cc',
                 'shared/DebugClient.h',
                 'shared/DebugClient.cc',
                 'shared/GenRandom.h',
                 'shared/GenRandom.cc',
                 'shared/OsModule.h',
+                'shared/OutputCompression.h',
+                'shared/OutputCompression.cc',
                 'shared/OwnedHandle.h',
                 'shared/OwnedHandle.cc',
+                'shared/SharedRing.h',
                 'shared/StringBuilder.h',
                 'shared/StringUtil.cc',
                 'shared/StringUtil.h',
+                'shared/TraceFormat.h',
+                'shared/TraceFormat.cc',
+                'shared/UnicodeTranscode.h',
+                'shared/UnicodeTranscode.cc',
                 'shared/WindowsSecurity.cc',
                 'shared/WindowsSecurity.h',
                 'shared/WindowsVersion.h',
@@ -180,6 +246,8 @@
             },
             'sources' : [
                 'debugserver/DebugServer.cc',
+                'shared/CpuFeatures.h',
+                'shared/CpuFeatures.cc',
                 'shared/DebugClient.h',
                 'shared/DebugClient.cc',
                 'shared/OwnedHandle.h',
@@ -188,6 +256,10 @@
                 'shared/StringBuilder.h',
                 'shared/StringUtil.cc',
                 'shared/StringUtil.h',
+                'shared/TraceFormat.h',
+                'shared/TraceFormat.cc',
+                'shared/UnicodeTranscode.h',
+                'shared/UnicodeTranscode.cc',
                 'shared/WindowsSecurity.h',
                 'shared/WindowsSecurity.cc',
                 'shared/WindowsVersion.h',